@@ -0,0 +1,283 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/utilities/result.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A structurally hashed and-inverter graph (AIG) representing an arbitrary number of single-bit Boolean functions that share their common logic.
+     * 
+     * In contrast to a `BooleanFunction`, which is tree-shaped, every structurally identical sub-function is represented by exactly one node, 
+     * i.e., reconvergent logic is stored only once and shared among all outputs of the graph. 
+     * Nodes are referenced by literals, where the least significant bit of a literal marks a complemented (inverted) edge.
+     * Node 0 is the constant zero, i.e., literal 0 represents the constant 0 and literal 1 represents the constant 1.
+     * Since the fan-in of a node is always created before the node itself, the node indices form a topological order.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API AndInverterGraph final
+    {
+    public:
+        /// A reference to a node of the graph with the least significant bit marking a complemented edge.
+        using Literal = u32;
+
+        /// The literal representing the constant 0.
+        static constexpr Literal CONSTANT_ZERO = 0;
+        /// The literal representing the constant 1.
+        static constexpr Literal CONSTANT_ONE = 1;
+
+        /**
+         * Construct an empty graph that only consists of the constant node.
+         */
+        AndInverterGraph();
+
+        /**
+         * Get the complement of a literal.
+         * 
+         * @param[in] literal - The literal.
+         * @returns The complemented literal.
+         */
+        static Literal negate(Literal literal);
+
+        /**
+         * Check whether a literal references its node via a complemented edge.
+         * 
+         * @param[in] literal - The literal.
+         * @returns `true` if the literal is complemented, `false` otherwise.
+         */
+        static bool is_complemented(Literal literal);
+
+        /**
+         * Get the index of the node referenced by a literal.
+         * 
+         * @param[in] literal - The literal.
+         * @returns The node index.
+         */
+        static u32 get_node_index(Literal literal);
+
+        /**
+         * Get the number of nodes of the graph including the constant node and all input nodes.
+         * 
+         * @returns The number of nodes.
+         */
+        u32 get_num_nodes() const;
+
+        /**
+         * Get the number of AND nodes of the graph.
+         * 
+         * @returns The number of AND nodes.
+         */
+        u32 get_num_and_nodes() const;
+
+        /**
+         * Check whether the node at the given index is an input node.
+         * 
+         * @param[in] node_index - The node index.
+         * @returns `true` if the node is an input node, `false` otherwise.
+         */
+        bool is_input_node(u32 node_index) const;
+
+        /**
+         * Check whether the node at the given index is an AND node.
+         * 
+         * @param[in] node_index - The node index.
+         * @returns `true` if the node is an AND node, `false` otherwise.
+         */
+        bool is_and_node(u32 node_index) const;
+
+        /**
+         * Get the two fan-in literals of an AND node.
+         * 
+         * @param[in] node_index - The node index.
+         * @returns The fan-in literals on success, an error otherwise.
+         */
+        Result<std::pair<Literal, Literal>> get_fan_in(u32 node_index) const;
+
+        /**
+         * Add a named input to the graph. 
+         * If an input with the given name already exists, its literal is returned instead.
+         * 
+         * @param[in] name - The name of the input.
+         * @returns The literal of the input.
+         */
+        Literal add_input(const std::string& name);
+
+        /**
+         * Get the literal of a named input.
+         * 
+         * @param[in] name - The name of the input.
+         * @returns The literal of the input on success, an error otherwise.
+         */
+        Result<Literal> get_input(const std::string& name) const;
+
+        /**
+         * Get the names of all inputs in the order they were added.
+         * 
+         * @returns The input names.
+         */
+        const std::vector<std::string>& get_input_names() const;
+
+        /**
+         * Get the name of the input represented by the node at the given index.
+         * 
+         * @param[in] node_index - The node index.
+         * @returns The input name on success, an error otherwise.
+         */
+        Result<std::string> get_input_name(u32 node_index) const;
+
+        /**
+         * Get the conjunction of two literals. 
+         * Trivial cases are resolved without creating a node and structurally identical nodes are reused.
+         * Both literals must belong to this graph.
+         * 
+         * @param[in] a - The first literal.
+         * @param[in] b - The second literal.
+         * @returns The literal of the conjunction.
+         */
+        Literal add_and(Literal a, Literal b);
+
+        /**
+         * Get the disjunction of two literals.
+         * Both literals must belong to this graph.
+         * 
+         * @param[in] a - The first literal.
+         * @param[in] b - The second literal.
+         * @returns The literal of the disjunction.
+         */
+        Literal add_or(Literal a, Literal b);
+
+        /**
+         * Get the exclusive disjunction of two literals.
+         * Both literals must belong to this graph.
+         * 
+         * @param[in] a - The first literal.
+         * @param[in] b - The second literal.
+         * @returns The literal of the exclusive disjunction.
+         */
+        Literal add_xor(Literal a, Literal b);
+
+        /**
+         * Get the if-then-else of three literals.
+         * All literals must belong to this graph.
+         * 
+         * @param[in] condition - The condition literal.
+         * @param[in] true_case - The literal selected if the condition is 1.
+         * @param[in] false_case - The literal selected if the condition is 0.
+         * @returns The literal of the if-then-else.
+         */
+        Literal add_ite(Literal condition, Literal true_case, Literal false_case);
+
+        /**
+         * Add a single-bit Boolean function to the graph.
+         * The function may consist of AND, OR, NOT, XOR, ITE, and equality nodes as well as single-bit constants and variables.
+         * Variables contained in the given map are replaced by the respective literals, all other variables are added as inputs.
+         * 
+         * @param[in] function - The Boolean function.
+         * @param[in] variables - A map from variable names to literals of this graph.
+         * @returns The literal representing the Boolean function on success, an error otherwise.
+         */
+        Result<Literal> add_function(const BooleanFunction& function, const std::unordered_map<std::string, Literal>& variables = {});
+
+        /**
+         * Add a named output to the graph.
+         * 
+         * @param[in] name - The name of the output.
+         * @param[in] literal - The literal driving the output.
+         * @returns OK() on success, an error otherwise.
+         */
+        Result<std::monostate> add_output(const std::string& name, Literal literal);
+
+        /**
+         * Get the literal of a named output.
+         * 
+         * @param[in] name - The name of the output.
+         * @returns The literal of the output on success, an error otherwise.
+         */
+        Result<Literal> get_output(const std::string& name) const;
+
+        /**
+         * Get all outputs as pairs of name and literal in the order they were added.
+         * 
+         * @returns The outputs.
+         */
+        const std::vector<std::pair<std::string, Literal>>& get_outputs() const;
+
+        /**
+         * Convert the function represented by a literal into a `BooleanFunction`. 
+         * Every node is converted only once, but since a `BooleanFunction` is tree-shaped, shared nodes are duplicated in the result.
+         * 
+         * @param[in] literal - The literal.
+         * @returns The Boolean function on success, an error otherwise.
+         */
+        Result<BooleanFunction> to_boolean_function(Literal literal) const;
+
+        /**
+         * Convert the function of a named output into a `BooleanFunction`.
+         * Every node is converted only once, but since a `BooleanFunction` is tree-shaped, shared nodes are duplicated in the result.
+         * 
+         * @param[in] name - The name of the output.
+         * @returns The Boolean function on success, an error otherwise.
+         */
+        Result<BooleanFunction> to_boolean_function(const std::string& name) const;
+
+    private:
+        /// marks the fan-in of nodes that are not AND nodes
+        static constexpr Literal INVALID_LITERAL = 0xFFFFFFFF;
+
+        struct Node
+        {
+            Literal fan_in_0 = INVALID_LITERAL;
+            Literal fan_in_1 = INVALID_LITERAL;
+        };
+
+        /// nodes in topological order, node 0 is the constant zero
+        std::vector<Node> m_nodes;
+        /// structural hash from (ordered) fan-in literals to node index
+        std::unordered_map<u64, u32> m_structural_hash;
+        /// input names in the order they were added
+        std::vector<std::string> m_input_names;
+        /// input name to node index
+        std::unordered_map<std::string, u32> m_inputs;
+        /// node index to input position
+        std::unordered_map<u32, u32> m_input_positions;
+        /// outputs in the order they were added
+        std::vector<std::pair<std::string, Literal>> m_outputs;
+        /// output name to position in m_outputs
+        std::unordered_map<std::string, u32> m_output_positions;
+        /// number of AND nodes
+        u32 m_num_and_nodes = 0;
+    };
+}    // namespace hal
@@ -0,0 +1,183 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/utilities/result.h"
+
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A compiled, bitsliced evaluation form of a Boolean function.
+     * 
+     * The abstract syntax tree of the Boolean function is flattened into a linear program of bit-level instructions operating on 
+     * slots, i.e., every bit of every intermediate value is assigned its own slot and variables are resolved to input slots at 
+     * compile time. Concatenations, slices, and extensions do not produce any instructions but are resolved by rewiring slots.
+     * 
+     * Each slot holds two planes of 64-bit lane words, a value plane and an unknown plane, such that a single evaluation pass 
+     * processes 64 input assignments per lane word. The planes encode ZERO as (0,0), ONE as (1,0), X as (0,1), and Z as (1,1).
+     * The inner loops iterate over contiguous lane words and are hence subject to auto-vectorization (e.g., AVX2 or AVX-512 when enabled).
+     * 
+     * The semantics match those of the symbolic evaluation, i.e., arithmetic operations and comparisons yield X whenever any of their 
+     * operand bits is unknown. Division and remainder operations are not supported.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API CompiledBooleanFunction final
+    {
+    public:
+        /**
+         * Compile a Boolean function into its bitsliced evaluation form.
+         * The input bits of the compiled function are ordered by the given variables, each variable contributing its bits starting at the least significant one.
+         * Variables that are not part of the Boolean function are treated as 1-bit inputs that do not influence the result.
+         * 
+         * @param[in] function - The Boolean function to compile.
+         * @param[in] variables - The ordered input variables. Defaults to the (sorted) variables of the Boolean function.
+         * @returns The compiled function on success, an error otherwise.
+         */
+        static Result<CompiledBooleanFunction> compile(const BooleanFunction& function, const std::vector<std::string>& variables = {});
+
+        /**
+         * Get the ordered input variables of the compiled function.
+         * 
+         * @returns The input variables.
+         */
+        const std::vector<std::string>& get_variables() const;
+
+        /**
+         * Get the bit-sizes of the input variables in the order given by `get_variables()`.
+         * 
+         * @returns The bit-sizes of the input variables.
+         */
+        const std::vector<u16>& get_variable_sizes() const;
+
+        /**
+         * Get the total number of input bits of the compiled function.
+         * 
+         * @returns The number of input bits.
+         */
+        u32 get_num_inputs() const;
+
+        /**
+         * Get the bit-size of the result of the compiled function.
+         * 
+         * @returns The bit-size.
+         */
+        u16 size() const;
+
+        /**
+         * Get the number of bit-level instructions of the compiled function.
+         * 
+         * @returns The number of instructions.
+         */
+        u32 get_num_instructions() const;
+
+        /**
+         * Evaluate the compiled function on `64 * num_words` input assignments at once.
+         * Lane `l` of word `w` of input bit `i` is found at bit `l` of `values[i * num_words + w]` and represents assignment `64 * w + l`. 
+         * The outputs are laid out in the same manner.
+         * 
+         * @param[in] values - The value plane of the input bits.
+         * @param[in] unknowns - The unknown plane of the input bits. May be empty if all inputs are known.
+         * @param[out] output_values - The value plane of the output bits.
+         * @param[out] output_unknowns - The unknown plane of the output bits.
+         * @param[in] num_words - The number of lane words per bit.
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate>
+            evaluate(const std::vector<u64>& values, const std::vector<u64>& unknowns, std::vector<u64>& output_values, std::vector<u64>& output_unknowns, u32 num_words = 1) const;
+
+        /**
+         * Evaluate the compiled function on a single input assignment.
+         * 
+         * @param[in] inputs - The values of all input bits ordered as returned by `get_variables()`.
+         * @returns The resulting bit-vector on success, an error otherwise.
+         */
+        Result<std::vector<BooleanFunction::Value>> evaluate(const std::vector<BooleanFunction::Value>& inputs) const;
+
+        /**
+         * Compute the truth table of the compiled function by enumerating all assignments of the input bits.
+         * The i-th input bit corresponds to the i-th bit of the row index.
+         * 
+         * @returns A vector containing one truth table row per output bit on success, an error otherwise.
+         */
+        Result<std::vector<std::vector<BooleanFunction::Value>>> compute_truth_table() const;
+
+    private:
+        /**
+         * The bit-level instructions of the compiled program.
+         */
+        enum class OpCode : u8
+        {
+            Not,        ///< dst = ~a
+            And,        ///< dst = a & b
+            Or,         ///< dst = a | b
+            Xor,        ///< dst = a ^ b
+            Mux,        ///< dst = a ? b : c
+            Same,       ///< dst = 1 iff a and b hold the identical value (including X and Z), else 0
+            Unknown,    ///< dst = 1 iff a is X or Z, else 0
+            ForceX      ///< dst = b ? X : a
+        };
+
+        struct Instruction
+        {
+            OpCode op;
+            u32 dst;
+            u32 a;
+            u32 b;
+            u32 c;
+        };
+
+        /* reserved slots */
+        static constexpr u32 slot_zero = 0;
+        static constexpr u32 slot_one  = 1;
+        static constexpr u32 slot_x    = 2;
+        static constexpr u32 slot_z    = 3;
+        static constexpr u32 slot_inputs = 4;
+
+        CompiledBooleanFunction() = default;
+
+        u32 emit(OpCode op, u32 a, u32 b = 0, u32 c = 0);
+        u32 emit_any_unknown(const std::vector<u32>& bits);
+        std::vector<u32> emit_force_x(const std::vector<u32>& bits, u32 mask);
+        std::vector<u32> emit_add(const std::vector<u32>& p0, const std::vector<u32>& p1, u32 carry);
+        u32 emit_unsigned_greater_equal(const std::vector<u32>& p0, const std::vector<u32>& p1);
+
+        void execute(std::vector<u64>& registers, u32 num_words) const;
+
+        std::vector<std::string> m_variables;
+        std::vector<u16> m_variable_sizes;
+        u32 m_num_inputs = 0;
+        u32 m_num_slots  = 0;
+        std::vector<Instruction> m_instructions;
+        std::vector<u32> m_outputs;
+    };
+}    // namespace hal
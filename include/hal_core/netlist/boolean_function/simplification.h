@@ -26,6 +26,7 @@
 #pragma once
 
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/and_inverter_graph.h"
 #include "hal_core/utilities/result.h"
 
 #include <string>
@@ -49,5 +50,14 @@ namespace hal
 	 * @returns Simplified boolean function on success, error otherwise.
 	 * */
         Result<BooleanFunction> abc_simplification(const BooleanFunction& function);
+
+        /**
+	 * Implements the interface to simplify all outputs of an and-inverter graph using ABC.
+	 * The graph is handed to ABC node by node without expanding shared logic, and the result is read back into a new graph.
+	 *
+	 * @param[in] graph - And-inverter graph to simplify.
+	 * @returns Simplified and-inverter graph on success, error otherwise.
+	 * */
+        Result<AndInverterGraph> abc_simplification(const AndInverterGraph& graph);
     }    // namespace Simplification
 }    // namespace hal
\ No newline at end of file
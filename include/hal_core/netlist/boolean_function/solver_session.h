@@ -0,0 +1,189 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/netlist/boolean_function/types.h"
+
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace hal
+{
+    namespace SMT
+    {
+        /**
+         * Represents a persistent, incremental session with an SMT solver.
+         *
+         * In contrast to `Solver`, which translates all constraints and starts a new solver process for every query,
+         * a session keeps a single solver alive for its whole lifetime. Constraints are asserted incrementally, scopes
+         * are opened and closed via `push` and `pop`, variable declarations are shared among all queries, and a batch
+         * of independent queries can be pipelined to the solver at once.
+         * A session either communicates with a local solver process via SMT-LIB v2 or uses the Z3 library linked into HAL.
+         */
+        class SolverSession final
+        {
+        public:
+            ////////////////////////////////////////////////////////////////////////
+            // Constructors, Destructors, Operators
+            ////////////////////////////////////////////////////////////////////////
+
+            ~SolverSession();
+
+            SolverSession(const SolverSession&)            = delete;
+            SolverSession& operator=(const SolverSession&) = delete;
+
+            /**
+             * Starts a session with a local solver process of the type specified in the query configuration.
+             * The timeout of the configuration applies to every single check.
+             *
+             * @param[in] config - The SMT solver query configuration.
+             * @returns OK() and the session on success, Err() otherwise.
+             */
+            static Result<std::unique_ptr<SolverSession>> start(const QueryConfig& config = QueryConfig());
+
+            /**
+             * Starts a session using the Z3 library linked into HAL instead of a solver process.
+             * The solver type of the query configuration is ignored.
+             *
+             * @param[in] config - The SMT solver query configuration.
+             * @returns OK() and the session on success, Err() otherwise.
+             */
+            static Result<std::unique_ptr<SolverSession>> start_in_process(const QueryConfig& config = QueryConfig());
+
+            ////////////////////////////////////////////////////////////////////////
+            // Interface
+            ////////////////////////////////////////////////////////////////////////
+
+            /**
+             * Returns the query configuration of the session.
+             *
+             * @returns The query configuration.
+             */
+            const QueryConfig& get_config() const;
+
+            /**
+             * Checks whether the session uses the Z3 library linked into HAL instead of a solver process.
+             *
+             * @returns `true` if the session runs in-process, `false` otherwise.
+             */
+            bool is_in_process() const;
+
+            /**
+             * Checks whether the session can still be used.
+             * A session with a solver process becomes unusable once a request fails after commands have been sent to the process,
+             * e.g., because the solver responded with an error to a query of a batch.
+             * The solver process is terminated in that case and all further requests fail until the session is restarted.
+             *
+             * @returns `true` if the session is usable, `false` otherwise.
+             */
+            bool is_usable() const;
+
+            /**
+             * Restarts the session with a new solver of the same configuration.
+             * All scopes and constraints of the session are discarded.
+             *
+             * @returns OK() on success, Err() otherwise.
+             */
+            Result<std::monostate> restart();
+
+            /**
+             * Returns the number of currently open scopes.
+             *
+             * @returns The number of scopes.
+             */
+            u32 get_num_scopes() const;
+
+            /**
+             * Opens a new scope. All constraints and declarations added afterwards are discarded by the matching `pop`.
+             *
+             * @returns OK() on success, Err() otherwise.
+             */
+            Result<std::monostate> push();
+
+            /**
+             * Closes the given number of scopes and discards all constraints and declarations added within them.
+             *
+             * @param[in] num_scopes - The number of scopes to close.
+             * @returns OK() on success, Err() otherwise.
+             */
+            Result<std::monostate> pop(u32 num_scopes = 1);
+
+            /**
+             * Asserts a constraint within the current scope.
+             *
+             * @param[in] constraint - The constraint.
+             * @returns OK() on success, Err() otherwise.
+             */
+            Result<std::monostate> add_constraint(const Constraint& constraint);
+
+            /**
+             * Asserts a vector of constraints within the current scope.
+             *
+             * @param[in] constraints - The constraints.
+             * @returns OK() on success, Err() otherwise.
+             */
+            Result<std::monostate> add_constraints(const std::vector<Constraint>& constraints);
+
+            /**
+             * Checks the satisfiability of all asserted constraints, optionally under a set of assumptions.
+             * Assumptions only hold for this check and are not asserted permanently.
+             *
+             * @param[in] assumptions - Boolean functions of a single bit that are assumed to evaluate to 1.
+             * @returns OK() and the result on success, Err() otherwise.
+             */
+            Result<SolverResult> check(const std::vector<BooleanFunction>& assumptions = {});
+
+            /**
+             * Checks a batch of independent queries against the asserted constraints.
+             * Each query is checked within its own scope, i.e., the constraints of one query do not affect the others.
+             * For solver processes, all queries are sent at once and the results are collected afterwards.
+             *
+             * @param[in] queries - The queries, each given as a vector of additional constraints.
+             * @returns OK() and one result per query on success, Err() otherwise.
+             */
+            Result<std::vector<SolverResult>> check_batch(const std::vector<std::vector<Constraint>>& queries);
+
+        private:
+            class Backend;
+            class ProcessBackend;
+            class Z3Backend;
+
+            SolverSession(const QueryConfig& config, std::unique_ptr<Backend> backend);
+
+            ////////////////////////////////////////////////////////////////////////
+            // Member
+            ////////////////////////////////////////////////////////////////////////
+
+            /// the query configuration
+            QueryConfig m_config;
+            /// the backend communicating with the solver
+            std::unique_ptr<Backend> m_backend;
+            /// number of open scopes
+            u32 m_num_scopes = 0;
+        };
+    }    // namespace SMT
+}    // namespace hal
@@ -27,6 +27,7 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/and_inverter_graph.h"
 
 #include <string>
 #include <tuple>
@@ -44,6 +45,16 @@ namespace hal
 	 * @returns Ok() and SMT-LIB v2 compatible string on success, Err() otherwise.
 	 */
             Result<std::string> translate_to_smt2(const BooleanFunction& function);
+
+            /**
+	 * Translates an and-inverter graph into a sequence of SMT-LIB commands.
+	 * Each input is declared as a 1-bit constant, each AND node in the fan-in of an output is defined once via `define-fun`,
+	 * and each output is defined via `define-fun` using its name. Hence, shared logic is not duplicated.
+	 *
+	 * @param[in] graph - And-inverter graph to translate.
+	 * @returns Ok() and SMT-LIB v2 compatible commands on success, Err() otherwise.
+	 */
+            Result<std::string> translate_to_smt2(const AndInverterGraph& graph);
         }    // namespace Translator
     }        // namespace SMT
 }    // namespace hal
\ No newline at end of file
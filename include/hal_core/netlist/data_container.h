@@ -26,6 +26,7 @@
 #pragma once
 
 #include "hal_core/defines.h"
+#include "hal_core/utilities/symbol_table.h"
 
 #include <map>
 #include <tuple>
@@ -34,7 +35,8 @@
 namespace hal
 {
     /**
-     * Container to hold data that is associated with an entity.
+     * Container to hold data that is associated with an entity.<br>
+     * Categories, keys, types, and values are interned in a symbol table that is shared by all data containers of a netlist, so that every entry only occupies four symbols.
      *
      * @ingroup netlist
      */
@@ -43,8 +45,10 @@ namespace hal
     public:
         /**
          * Construct a new data container.
+         * 
+         * @param[in] symbol_table - The symbol table to intern the data in. If `nullptr`, a table shared by all data containers that do not belong to a netlist is used.
          */
-        DataContainer() = default;
+        DataContainer(SymbolTable* symbol_table = nullptr);
 
         virtual ~DataContainer() = default;
 
@@ -107,10 +111,11 @@ namespace hal
 
         /**
          * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.
+         * The map is assembled from the interned entries on every call.
          *
          * @returns The stored data as a map.
          */
-        const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& get_data_map() const;
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_data_map() const;
 
         /**
          * Overwrite the existing data with a new map from ((1) category, (2) key) to ((1) type, (2) value).
@@ -120,6 +125,31 @@ namespace hal
         void set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map);
 
     protected:
-        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> m_data;
+        /**
+         * Called after the stored data has been modified through `set_data()`, `delete_data()`, or `set_data_map()`.<br>
+         * Does nothing by default, derived classes override it to notify listeners about the modification.
+         */
+        virtual void notify_data_changed();
+
+        /**
+         * Overwrite the existing data with the data of another container, which may use a different symbol table.
+         *
+         * @param[in] other - The data container to copy from.
+         */
+        void copy_data(const DataContainer& other);
+
+    private:
+        struct Entry
+        {
+            SymbolTable::Symbol category;
+            SymbolTable::Symbol key;
+            SymbolTable::Symbol type;
+            SymbolTable::Symbol value;
+        };
+
+        std::vector<Entry>::const_iterator find_entry(const std::string& category, const std::string& key) const;
+
+        SymbolTable* m_symbol_table;
+        std::vector<Entry> m_data;
     };
 }    // namespace hal
@@ -27,6 +27,7 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/and_inverter_graph.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/result.h"
 
@@ -133,6 +134,42 @@ namespace hal
          */
         Result<BooleanFunction> get_subgraph_function(const Module* subgraph_module, const Net* subgraph_output) const;
 
+        /**
+         * Get the combined Boolean functions of multiple outputs of a subgraph of combinational gates as a single and-inverter graph.
+         * In contrast to the tree-shaped `BooleanFunction`, logic that is shared within the subgraph or among its outputs is represented only once, 
+         * i.e., the size of the result grows linearly with the size of the subgraph.
+         * The inputs of the graph are named after the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable_name`, the outputs are named after the subgraph output nets likewise.
+         * 
+         * @param[in] subgraph_gates - The gates making up the subgraph to consider.
+         * @param[in] subgraph_outputs - The subgraph output nets for which to generate the Boolean functions.
+         * @return The and-inverter graph of the subgraph on success, an error otherwise.
+         */
+        Result<AndInverterGraph> get_subgraph_function(const std::vector<const Gate*>& subgraph_gates, const std::vector<const Net*>& subgraph_outputs) const;
+
+        /**
+         * Get the combined Boolean functions of multiple outputs of a subgraph of combinational gates as a single and-inverter graph.
+         * In contrast to the tree-shaped `BooleanFunction`, logic that is shared within the subgraph or among its outputs is represented only once, 
+         * i.e., the size of the result grows linearly with the size of the subgraph.
+         * The inputs of the graph are named after the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable_name`, the outputs are named after the subgraph output nets likewise.
+         * 
+         * @param[in] subgraph_gates - The gates making up the subgraph to consider.
+         * @param[in] subgraph_outputs - The subgraph output nets for which to generate the Boolean functions.
+         * @return The and-inverter graph of the subgraph on success, an error otherwise.
+         */
+        Result<AndInverterGraph> get_subgraph_function(const std::vector<Gate*>& subgraph_gates, const std::vector<const Net*>& subgraph_outputs) const;
+
+        /**
+         * Get the combined Boolean functions of multiple outputs of a subgraph of combinational gates as a single and-inverter graph.
+         * In contrast to the tree-shaped `BooleanFunction`, logic that is shared within the subgraph or among its outputs is represented only once, 
+         * i.e., the size of the result grows linearly with the size of the subgraph.
+         * The inputs of the graph are named after the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable_name`, the outputs are named after the subgraph output nets likewise.
+         * 
+         * @param[in] subgraph_module - The module making up the subgraph to consider.
+         * @param[in] subgraph_outputs - The subgraph output nets for which to generate the Boolean functions.
+         * @return The and-inverter graph of the subgraph on success, an error otherwise.
+         */
+        Result<AndInverterGraph> get_subgraph_function(const Module* subgraph_module, const std::vector<const Net*>& subgraph_outputs) const;
+
     private:
         const Netlist& m_netlist;
     };
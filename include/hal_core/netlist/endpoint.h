@@ -95,6 +95,7 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistBuilder;
         Endpoint(Gate* gate, GatePin* pin, Net* net, bool is_a_destination);
 
         Endpoint(const Endpoint&)            = delete;
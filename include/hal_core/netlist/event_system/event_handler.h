@@ -71,7 +71,8 @@ namespace hal
             removed,                    ///< no associated_data
             name_changed,               ///< no associated_data
             location_changed,           ///< no associated_data
-            boolean_function_changed    ///< no associated_data
+            boolean_function_changed,   ///< no associated_data
+            data_changed                ///< no associated_data
         };
     };
 
@@ -89,7 +90,8 @@ namespace hal
             src_added,       ///< associated_data = id of src gate
             src_removed,     ///< associated_data = id of src gate
             dst_added,       ///< associated_data = id of dst gate
-            dst_removed      ///< associated_data = id of dst gate
+            dst_removed,     ///< associated_data = id of dst gate
+            data_changed     ///< no associated_data
         };
     };
 
@@ -115,6 +117,7 @@ namespace hal
             gates_remove_end,      ///< associated_data = number of removed gates
             gate_removed,          ///< associated_data = id of removed gate
             pin_changed,           ///< no associated_data
+            data_changed,          ///< no associated_data
         };
     };
 
@@ -155,6 +158,7 @@ namespace hal
         bool gate_event_enabled;
         bool net_event_enabled;
         bool grouping_event_enabled;
+        u64 m_connectivity_stamp;
 
     public:
         EventHandler();
@@ -259,5 +263,14 @@ namespace hal
          */
         NETLIST_API void unregister_callback(const std::string& name);
 
+        /**
+         * Get the current connectivity stamp.<br>
+         * The stamp is incremented whenever a gate or net is created or removed or whenever a source or destination is added to or removed from a net.
+         * It is maintained independently of whether callbacks are enabled and can hence be used to detect stale copies of the netlist connectivity.
+         *
+         * @returns The connectivity stamp.
+         */
+        NETLIST_API u64 get_connectivity_stamp() const;
+
     };    // class event_handler
 }    // namespace hal
@@ -0,0 +1,290 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /** forward declaration */
+    class Netlist;
+    class Gate;
+    class Net;
+    class GatePin;
+
+    /**
+     * Immutable snapshot of the connectivity of a netlist that is intended for read-only analysis passes.<br>
+     * Gates and nets are remapped to contiguous indices and their connections are stored in compressed sparse row (CSR) arrays, so that traversals do not allocate memory and do not chase pointers through endpoints.
+     * Any modification of the gates, nets, or endpoints of the netlist invalidates the view, which can be checked using `is_valid()`.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API FrozenNetlistView
+    {
+    public:
+        /**
+         * Index returned for gates and nets that are not part of the view.
+         */
+        static constexpr u32 invalid_index = std::numeric_limits<u32>::max();
+
+        /**
+         * Non-owning view on a contiguous section of one of the CSR arrays.
+         */
+        template<typename T>
+        class Range
+        {
+        public:
+            Range(const T* begin, const T* end) : m_begin(begin), m_end(end)
+            {
+            }
+
+            const T* begin() const
+            {
+                return m_begin;
+            }
+
+            const T* end() const
+            {
+                return m_end;
+            }
+
+            u32 size() const
+            {
+                return static_cast<u32>(m_end - m_begin);
+            }
+
+            bool empty() const
+            {
+                return m_begin == m_end;
+            }
+
+            const T& operator[](u32 i) const
+            {
+                return m_begin[i];
+            }
+
+            std::vector<T> to_vector() const
+            {
+                return std::vector<T>(m_begin, m_end);
+            }
+
+        private:
+            const T* m_begin;
+            const T* m_end;
+        };
+
+        /**
+         * Construct a frozen view of the current connectivity of the given netlist.
+         * Gate and net indices follow the order of `Netlist::get_gates()` and `Netlist::get_nets()`.
+         *
+         * @param[in] netlist - The netlist to take the snapshot of.
+         */
+        FrozenNetlistView(const Netlist& netlist);
+
+        /**
+         * Get the netlist the view was taken of.
+         *
+         * @returns The netlist.
+         */
+        const Netlist& get_netlist() const;
+
+        /**
+         * Get the connectivity stamp of the netlist at the time the view was constructed.
+         *
+         * @returns The connectivity stamp.
+         */
+        u64 get_stamp() const;
+
+        /**
+         * Check whether the view still reflects the connectivity of the netlist, i.e., no gate, net, or endpoint has been created or removed since its construction.
+         *
+         * @returns True if the view is still valid, false otherwise.
+         */
+        bool is_valid() const;
+
+        /**
+         * Get the number of gates within the view.
+         *
+         * @returns The number of gates.
+         */
+        u32 get_num_gates() const;
+
+        /**
+         * Get the number of nets within the view.
+         *
+         * @returns The number of nets.
+         */
+        u32 get_num_nets() const;
+
+        /**
+         * Get the gate corresponding to the given gate index.
+         *
+         * @param[in] gate_index - The gate index.
+         * @returns The gate on success, a `nullptr` if the index is out of range.
+         */
+        Gate* get_gate(u32 gate_index) const;
+
+        /**
+         * Get the net corresponding to the given net index.
+         *
+         * @param[in] net_index - The net index.
+         * @returns The net on success, a `nullptr` if the index is out of range.
+         */
+        Net* get_net(u32 net_index) const;
+
+        /**
+         * Get the index of the given gate.
+         *
+         * @param[in] gate - The gate.
+         * @returns The gate index on success, `FrozenNetlistView::invalid_index` if the gate is not part of the view.
+         */
+        u32 get_gate_index(const Gate* gate) const;
+
+        /**
+         * Get the index of the gate with the given ID.
+         *
+         * @param[in] gate_id - The ID of the gate.
+         * @returns The gate index on success, `FrozenNetlistView::invalid_index` if the gate is not part of the view.
+         */
+        u32 get_gate_index_by_id(u32 gate_id) const;
+
+        /**
+         * Get the index of the given net.
+         *
+         * @param[in] net - The net.
+         * @returns The net index on success, `FrozenNetlistView::invalid_index` if the net is not part of the view.
+         */
+        u32 get_net_index(const Net* net) const;
+
+        /**
+         * Get the index of the net with the given ID.
+         *
+         * @param[in] net_id - The ID of the net.
+         * @returns The net index on success, `FrozenNetlistView::invalid_index` if the net is not part of the view.
+         */
+        u32 get_net_index_by_id(u32 net_id) const;
+
+        /**
+         * Get the indices of all nets connected to the input pins of a gate.
+         * The i-th net is connected to the i-th pin returned by `get_fan_in_pins()`.
+         *
+         * @param[in] gate_index - The gate index.
+         * @returns The range of net indices.
+         */
+        Range<u32> get_fan_in_nets(u32 gate_index) const;
+
+        /**
+         * Get all input pins of a gate that are connected to a net.
+         *
+         * @param[in] gate_index - The gate index.
+         * @returns The range of pins.
+         */
+        Range<const GatePin*> get_fan_in_pins(u32 gate_index) const;
+
+        /**
+         * Get the indices of all nets connected to the output pins of a gate.
+         * The i-th net is connected to the i-th pin returned by `get_fan_out_pins()`.
+         *
+         * @param[in] gate_index - The gate index.
+         * @returns The range of net indices.
+         */
+        Range<u32> get_fan_out_nets(u32 gate_index) const;
+
+        /**
+         * Get all output pins of a gate that are connected to a net.
+         *
+         * @param[in] gate_index - The gate index.
+         * @returns The range of pins.
+         */
+        Range<const GatePin*> get_fan_out_pins(u32 gate_index) const;
+
+        /**
+         * Get the indices of all source gates of a net.
+         * The i-th gate drives the net through the i-th pin returned by `get_source_pins()`.
+         *
+         * @param[in] net_index - The net index.
+         * @returns The range of gate indices.
+         */
+        Range<u32> get_sources(u32 net_index) const;
+
+        /**
+         * Get the pins through which the source gates drive a net.
+         *
+         * @param[in] net_index - The net index.
+         * @returns The range of pins.
+         */
+        Range<const GatePin*> get_source_pins(u32 net_index) const;
+
+        /**
+         * Get the indices of all destination gates of a net.
+         * The i-th gate is connected to the net through the i-th pin returned by `get_destination_pins()`.
+         *
+         * @param[in] net_index - The net index.
+         * @returns The range of gate indices.
+         */
+        Range<u32> get_destinations(u32 net_index) const;
+
+        /**
+         * Get the pins through which the destination gates are connected to a net.
+         *
+         * @param[in] net_index - The net index.
+         * @returns The range of pins.
+         */
+        Range<const GatePin*> get_destination_pins(u32 net_index) const;
+
+    private:
+        const Netlist& m_netlist;
+        u64 m_stamp;
+
+        /* index to object mapping */
+        std::vector<Gate*> m_gates;
+        std::vector<Net*> m_nets;
+
+        /* object ID to index mapping */
+        std::unordered_map<u32, u32> m_gate_id_to_index;
+        std::unordered_map<u32, u32> m_net_id_to_index;
+
+        /* gate -> net adjacency */
+        std::vector<u32> m_fan_in_offsets;
+        std::vector<u32> m_fan_in_nets;
+        std::vector<const GatePin*> m_fan_in_pins;
+        std::vector<u32> m_fan_out_offsets;
+        std::vector<u32> m_fan_out_nets;
+        std::vector<const GatePin*> m_fan_out_pins;
+
+        /* net -> gate adjacency */
+        std::vector<u32> m_source_offsets;
+        std::vector<u32> m_source_gates;
+        std::vector<const GatePin*> m_source_pins;
+        std::vector<u32> m_destination_offsets;
+        std::vector<u32> m_destination_gates;
+        std::vector<const GatePin*> m_destination_pins;
+    };
+}    // namespace hal
@@ -460,6 +460,8 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistBuilder;
+        friend class Module;
         Gate(NetlistInternalManager* mgr, EventHandler* event_handler, u32 id, GateType* gt, const std::string& name, i32 x, i32 y);
 
         Gate(const Gate&)            = delete;
@@ -469,6 +471,11 @@ namespace hal
 
         BooleanFunction get_lut_function(const GatePin* pin) const;
 
+        void notify_data_changed() override;
+
+        Endpoint* get_pin_endpoint(const GatePin* pin, bool is_destination) const;
+        void set_pin_endpoint(const GatePin* pin, bool is_destination, Endpoint* ep);
+
         /* pointer to corresponding netlist parent */
         NetlistInternalManager* m_internal_manager;
 
@@ -488,6 +495,9 @@ namespace hal
         /* owning module */
         Module* m_module;
 
+        /* position within the gate vector of the owning module */
+        u32 m_module_index = 0;
+
         /* grouping */
         Grouping* m_grouping = nullptr;
 
@@ -497,6 +507,9 @@ namespace hal
         std::vector<Net*> m_in_nets;
         std::vector<Net*> m_out_nets;
 
+        /* connected endpoints indexed by pin, the fan-in endpoint of a pin is stored at twice its index followed by its fan-out endpoint */
+        std::vector<Endpoint*> m_pin_endpoints;
+
         /* dedicated functions */
         std::unordered_map<std::string, BooleanFunction> m_functions;
 
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include "hal_core/defines.h"
 #include "hal_core/utilities/enums.h"
 
 namespace hal
@@ -62,6 +63,11 @@ namespace hal
         c_lut          /**< LUT gate type. **/
     };
 
+    /**
+     * The number of available gate type properties, must be updated when adding properties to the end of `GateTypeProperty`.
+     */
+    constexpr u32 NUM_GATE_TYPE_PROPERTIES = static_cast<u32>(GateTypeProperty::c_lut) + 1;
+
     template<>
     std::map<GateTypeProperty, std::string> EnumStrings<GateTypeProperty>::data;
 }    // namespace hal
\ No newline at end of file
@@ -0,0 +1,84 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <memory>
+
+namespace hal
+{
+    class GateLibrary;
+
+    /**
+     * The gate library cache stores fully constructed gate libraries in a binary file so that they do not have to be parsed again on subsequent loads.
+     * A cache file is keyed by the absolute path, the size, and the last modification time of the gate library file it was created from and is discarded as soon as any of them changes.
+     * A cache file is also discarded if it has been written by a different HAL version, as the gate library parsers may have changed in between.
+     * Cache files are memory-mapped when being read and contain all gate types including their properties, pins, pin groups, components, and pre-parsed Boolean functions.
+     * The cache is written in the byte order of the host and is only valid on machines with the same byte order.
+     *
+     * @ingroup gate_lib
+     */
+    namespace gate_library_cache
+    {
+        /**
+         * Get the path of the cache file belonging to a gate library file.
+         *
+         * @param[in] file_path - The absolute path to the gate library file.
+         * @returns The path of the cache file.
+         */
+        NETLIST_API std::filesystem::path get_cache_file(const std::filesystem::path& file_path);
+
+        /**
+         * Write a gate library to the cache.
+         * The library is keyed by its path, which must point to the gate library file it was parsed from.
+         *
+         * @param[in] gate_lib - The gate library.
+         * @returns OK on success, an error otherwise.
+         */
+        NETLIST_API Result<std::monostate> write(const GateLibrary* gate_lib);
+
+        /**
+         * Read a gate library from the cache.
+         * Fails if there is no cache file for the gate library file or if the gate library file has changed since the cache file was written.
+         *
+         * @param[in] file_path - The absolute path to the gate library file.
+         * @returns The gate library on success, an error otherwise.
+         */
+        NETLIST_API Result<std::unique_ptr<GateLibrary>> read(const std::filesystem::path& file_path);
+
+        /**
+         * Read only the name of a gate library from the cache without constructing the gate library.
+         * Fails if there is no cache file for the gate library file or if the gate library file has changed since the cache file was written.
+         *
+         * @param[in] file_path - The absolute path to the gate library file.
+         * @returns The name of the gate library on success, an error otherwise.
+         */
+        NETLIST_API Result<std::string> read_name(const std::filesystem::path& file_path);
+    }    // namespace gate_library_cache
+}    // namespace hal
@@ -43,6 +43,7 @@ namespace hal
     {
         /**
          * Load a gate library from file.
+         * If the gate library file has not changed since it was last parsed, the gate library is restored from the gate library cache instead of being parsed again.
          *
          * @param[in] file_path - The input path.
          * @param[in] reload - If true, reloads the library in case it is already loaded.
@@ -52,8 +53,9 @@ namespace hal
 
         /**
          * Load all gate libraries available in standard gate library directories.
+         * Unless a reload is requested, the gate library files are only registered and each library is loaded on first access through `get_gate_library`, `get_gate_library_by_name`, or `get_gate_libraries`.
          *
-         * @param[in] reload - If true, reloads all libraries that have already been loaded.
+         * @param[in] reload - If true, immediately reloads all libraries including those that have already been loaded.
          */
         NETLIST_API void load_all(bool reload = false);
 
@@ -91,7 +93,8 @@ namespace hal
         NETLIST_API GateLibrary* get_gate_library(const std::string& file_path);
 
         /**
-         * Get a gate library by name. If no library with the given name is loaded, a nullptr will be returned.
+         * Get a gate library by name. If no library with the given name is loaded, the libraries registered by `load_all` are searched and the matching one is loaded.
+         * Otherwise, a nullptr will be returned.
          *
          * @param[in] lib_name - The name of the gate library.
          * @returns The gate library on success, nullptr otherwise.
@@ -100,6 +103,7 @@ namespace hal
 
         /**
          * Get all loaded gate libraries.
+         * Libraries registered by `load_all` that have not been accessed yet are loaded first.
          *
          * @returns A vector of gate libraries.
          */
@@ -32,6 +32,7 @@
 #include "hal_core/netlist/pins/pin_group.h"
 #include "hal_core/utilities/enums.h"
 
+#include <bitset>
 #include <map>
 #include <set>
 #include <string>
@@ -265,6 +266,23 @@ namespace hal
          */
         GatePin* get_pin_by_id(const u32 id) const;
 
+        /**
+         * Get the number of pins of the gate type.
+         * Pin indices range from 0 to the number of pins minus one.
+         * 
+         * @returns The number of pins.
+         */
+        u32 get_pin_count() const;
+
+        /**
+         * Get the pin corresponding to the given index.
+         * Pins are indexed consecutively in the order of their creation, see `GatePin::get_index`.
+         * 
+         * @param[in] index - The index of the pin.
+         * @returns The pin on success, a `nullptr` otherwise.
+         */
+        GatePin* get_pin_by_index(const u32 index) const;
+
         /**
          * Get the pin corresponding to the given name.
          * 
@@ -383,7 +401,7 @@ namespace hal
         GateLibrary* m_gate_library;
         u32 m_id;
         std::string m_name;
-        std::set<GateTypeProperty> m_properties;
+        std::bitset<NUM_GATE_TYPE_PROPERTIES> m_properties;
         std::unique_ptr<GateTypeComponent> m_component;
 
         // pins
@@ -34,6 +34,7 @@
 #include "hal_core/netlist/pins/module_pin.h"
 #include "hal_core/netlist/pins/pin_group.h"
 #include "hal_core/utilities/enums.h"
+#include "hal_core/utilities/id_allocator.h"
 #include "hal_core/utilities/result.h"
 
 #include <functional>
@@ -659,6 +660,8 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistBuilder;
+        friend class NetlistJournal;
         Module(NetlistInternalManager* internal_manager, EventHandler* event_handler, u32 id, Module* parent, const std::string& name);
 
         Module(const Module&)            = delete;    //disable copy-constructor
@@ -672,7 +675,12 @@ namespace hal
             bool has_external_destination;
         };
 
-        NetConnectivity check_net_endpoints(const Net* net) const;
+        void notify_data_changed() override;
+        NetConnectivity check_net_endpoints(Net* net) const;
+        void insert_gate_internal(Gate* gate);
+        void erase_gate_internal(Gate* gate);
+        void update_net_endpoint_counts(Net* net, i32 num_sources, i32 num_destinations, const Module* stop = nullptr);
+        const Module* get_common_ancestor(const Module* other) const;
         Result<std::monostate> check_net(Net* net, bool recursive = false);
         Result<ModulePin*> assign_pin_net(const u32 pin_id, Net* net, PinDirection direction, const std::string& name = "", PinType type = PinType::none);
         Result<std::monostate> remove_pin_net(Net* net);
@@ -695,12 +703,8 @@ namespace hal
         std::vector<Module*> m_submodules;
 
         // pins
-        u32 m_next_pin_id;
-        std::set<u32> m_used_pin_ids;
-        std::set<u32> m_free_pin_ids;
-        u32 m_next_pin_group_id;
-        std::set<u32> m_used_pin_group_ids;
-        std::set<u32> m_free_pin_group_ids;
+        IdAllocator m_pin_ids;
+        IdAllocator m_pin_group_ids;
 
         u32 m_next_input_index  = 0;
         u32 m_next_inout_index  = 0;
@@ -723,6 +727,9 @@ namespace hal
         std::unordered_set<Net*> m_output_nets;
         std::unordered_set<Net*> m_internal_nets;
 
+        /* number of sources and destinations of a net at gates within the module or its submodules */
+        std::unordered_map<Net*, std::pair<u32, u32>> m_net_endpoint_counts;
+
         EventHandler* m_event_handler;
     };
 }    // namespace hal
@@ -381,6 +381,7 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistBuilder;
         explicit Net(NetlistInternalManager* internal_manager, EventHandler* event_handler, const u32 id, const std::string& name = "");
 
         Net(const Net&) = delete;
@@ -388,6 +389,8 @@ namespace hal
         Net& operator=(const Net&) = delete;
         Net& operator=(Net&&) = delete;
 
+        void notify_data_changed() override;
+
         NetlistInternalManager* m_internal_manager;
 
         /* stores the id of the net */
@@ -399,9 +402,7 @@ namespace hal
         /* grouping */
         Grouping* m_grouping = nullptr;
 
-        /* stores the dst gate and pin id of the dst gate */
-        std::vector<std::unique_ptr<Endpoint>> m_destinations;
-        std::vector<std::unique_ptr<Endpoint>> m_sources;
+        /* stores the dst gate and pin id of the dst gate, endpoints are owned by the internal manager */
         std::vector<Endpoint*> m_destinations_raw;
         std::vector<Endpoint*> m_sources_raw;
 
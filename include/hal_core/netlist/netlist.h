@@ -28,6 +28,8 @@
 #include "hal_core/defines.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/utilities/id_allocator.h"
+#include "hal_core/utilities/id_slot_map.h"
 
 #include <functional>
 #include <memory>
@@ -55,6 +57,7 @@ namespace hal
     class NETLIST_API Netlist
     {
         friend class NetlistInternalManager;
+        friend class NetlistBuilder;
 
     public:
         /**
@@ -156,6 +159,17 @@ namespace hal
          */
         Result<std::unique_ptr<Netlist>> copy() const;
 
+        /**
+         * Pre-allocate storage for the given number of gates, nets, and modules.
+         * Calling this function before building a large netlist avoids repeated growth of the internal object storage.
+         * It does not limit the number of gates, nets, or modules that can be created.
+         * 
+         * @param[in] num_gates - The expected number of gates.
+         * @param[in] num_nets - The expected number of nets.
+         * @param[in] num_modules - The expected number of modules.
+         */
+        void reserve(u32 num_gates, u32 num_nets, u32 num_modules = 0);
+
         /*
          * ################################################################
          *      gate functions
@@ -811,38 +825,30 @@ namespace hal
         /* the event handler associated with the netlist */
         std::unique_ptr<EventHandler> m_event_handler;
 
-        /* stores the auto generated ids for fast next id */
-        u32 m_next_gate_id;
-        std::set<u32> m_used_gate_ids;
-        std::set<u32> m_free_gate_ids;
-        u32 m_next_net_id;
-        std::set<u32> m_used_net_ids;
-        std::set<u32> m_free_net_ids;
-        u32 m_next_module_id;
-        std::set<u32> m_used_module_ids;
-        std::set<u32> m_free_module_ids;
-        u32 m_next_grouping_id;
-        std::set<u32> m_used_grouping_ids;
-        std::set<u32> m_free_grouping_ids;
+        /* stores the used and free ids for fast next id */
+        IdAllocator m_gate_ids;
+        IdAllocator m_net_ids;
+        IdAllocator m_module_ids;
+        IdAllocator m_grouping_ids;
 
         /* stores the modules */
         Module* m_top_module;
-        std::unordered_map<u32, std::unique_ptr<Module>> m_modules_map;
+        IdSlotMap<Module*> m_modules_map;
         std::unordered_set<Module*> m_modules_set;
         std::vector<Module*> m_modules;
 
         /* stores the nets */
-        std::unordered_map<u32, std::unique_ptr<Net>> m_nets_map;
+        IdSlotMap<Net*> m_nets_map;
         std::unordered_set<Net*> m_nets_set;
         std::vector<Net*> m_nets;
 
         /* stores the gates */
-        std::unordered_map<u32, std::unique_ptr<Gate>> m_gates_map;
+        IdSlotMap<Gate*> m_gates_map;
         std::unordered_set<Gate*> m_gates_set;
         std::vector<Gate*> m_gates;
 
         /* stores the groupings */
-        std::unordered_map<u32, std::unique_ptr<Grouping>> m_groupings_map;
+        IdSlotMap<std::unique_ptr<Grouping>> m_groupings_map;
         std::unordered_set<Grouping*> m_groupings_set;
         std::vector<Grouping*> m_groupings;
 
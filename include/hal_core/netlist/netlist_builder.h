@@ -0,0 +1,237 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace hal
+{
+    /** forward declaration */
+    class Netlist;
+    class Gate;
+    class GateType;
+    class GatePin;
+    class Net;
+    class Module;
+    class Endpoint;
+
+    /**
+     * Transaction for constructing large parts of a netlist in bulk.<br>
+     * While the transaction is open, gates, nets, endpoints, and module assignments created through the builder skip the per-item event notifications and module net checks.
+     * Instead, the input, output, and internal nets of all affected modules are determined in a single pass over the affected nets on `commit()`, after which the events of the transaction are emitted.
+     * Until then, the module nets and module pins are not up to date.
+     * If automatic net checks were enabled when the transaction was opened, `commit()` also creates, updates, and removes module pins as the automatic net checks would do.
+     * The transaction is committed automatically on destruction if it has not been committed before.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API NetlistBuilder
+    {
+    public:
+        /**
+         * Open a new transaction on the given netlist.
+         * Automatic net checks are suspended until the transaction is committed.
+         *
+         * @param[in] netlist - The netlist to build.
+         */
+        explicit NetlistBuilder(Netlist* netlist);
+
+        /**
+         * Commit the transaction if it is still open.
+         */
+        ~NetlistBuilder();
+
+        NetlistBuilder(const NetlistBuilder&)            = delete;
+        NetlistBuilder& operator=(const NetlistBuilder&) = delete;
+
+        /**
+         * Get the netlist built by the transaction.
+         *
+         * @returns The netlist.
+         */
+        Netlist* get_netlist() const;
+
+        /**
+         * Check whether the transaction is still open, i.e., has not been committed yet.
+         *
+         * @returns True if the transaction is open, false otherwise.
+         */
+        bool is_open() const;
+
+        /**
+         * Create a new gate and add it to the top module of the netlist.
+         *
+         * @param[in] gate_id - The unique ID of the gate.
+         * @param[in] gate_type - The gate type.
+         * @param[in] name - The name of the gate.
+         * @param[in] x - The x-coordinate of the gate.
+         * @param[in] y - The y-coordinate of the gate.
+         * @returns The new gate on success, a `nullptr` otherwise.
+         */
+        Gate* create_gate(const u32 gate_id, GateType* gate_type, const std::string& name, i32 x = -1, i32 y = -1);
+
+        /**
+         * Create a new gate and add it to the top module of the netlist.
+         * The ID of the gate is set automatically.
+         *
+         * @param[in] gate_type - The gate type.
+         * @param[in] name - The name of the gate.
+         * @param[in] x - The x-coordinate of the gate.
+         * @param[in] y - The y-coordinate of the gate.
+         * @returns The new gate on success, a `nullptr` otherwise.
+         */
+        Gate* create_gate(GateType* gate_type, const std::string& name, i32 x = -1, i32 y = -1);
+
+        /**
+         * Create a new net.
+         *
+         * @param[in] net_id - The unique ID of the net.
+         * @param[in] name - The name of the net.
+         * @returns The new net on success, a `nullptr` otherwise.
+         */
+        Net* create_net(const u32 net_id, const std::string& name);
+
+        /**
+         * Create a new net.
+         * The ID of the net is set automatically.
+         *
+         * @param[in] name - The name of the net.
+         * @returns The new net on success, a `nullptr` otherwise.
+         */
+        Net* create_net(const std::string& name);
+
+        /**
+         * Add a source to a net.
+         *
+         * @param[in] net - The net.
+         * @param[in] gate - The gate.
+         * @param[in] pin - The output pin of the gate.
+         * @returns The new endpoint on success, a `nullptr` otherwise.
+         */
+        Endpoint* add_source(Net* net, Gate* gate, GatePin* pin);
+
+        /**
+         * Add a source to a net.
+         *
+         * @param[in] net - The net.
+         * @param[in] gate - The gate.
+         * @param[in] pin_name - The name of the output pin of the gate.
+         * @returns The new endpoint on success, a `nullptr` otherwise.
+         */
+        Endpoint* add_source(Net* net, Gate* gate, const std::string& pin_name);
+
+        /**
+         * Add a destination to a net.
+         *
+         * @param[in] net - The net.
+         * @param[in] gate - The gate.
+         * @param[in] pin - The input pin of the gate.
+         * @returns The new endpoint on success, a `nullptr` otherwise.
+         */
+        Endpoint* add_destination(Net* net, Gate* gate, GatePin* pin);
+
+        /**
+         * Add a destination to a net.
+         *
+         * @param[in] net - The net.
+         * @param[in] gate - The gate.
+         * @param[in] pin_name - The name of the input pin of the gate.
+         * @returns The new endpoint on success, a `nullptr` otherwise.
+         */
+        Endpoint* add_destination(Net* net, Gate* gate, const std::string& pin_name);
+
+        /**
+         * Create a new module as a submodule of the given parent module and assign the given gates to it.
+         *
+         * @param[in] module_id - The unique ID of the module.
+         * @param[in] name - The name of the module.
+         * @param[in] parent - The parent module.
+         * @param[in] gates - The gates to assign to the module.
+         * @returns The new module on success, a `nullptr` otherwise.
+         */
+        Module* create_module(const u32 module_id, const std::string& name, Module* parent, const std::vector<Gate*>& gates = {});
+
+        /**
+         * Create a new module as a submodule of the given parent module and assign the given gates to it.
+         * The ID of the module is set automatically.
+         *
+         * @param[in] name - The name of the module.
+         * @param[in] parent - The parent module.
+         * @param[in] gates - The gates to assign to the module.
+         * @returns The new module on success, a `nullptr` otherwise.
+         */
+        Module* create_module(const std::string& name, Module* parent, const std::vector<Gate*>& gates = {});
+
+        /**
+         * Move the given gates into a module.
+         * Gates that are already contained in the module are skipped.
+         *
+         * @param[in] module - The module.
+         * @param[in] gates - The gates to assign to the module.
+         * @returns True on success, false otherwise.
+         */
+        bool assign_gates(Module* module, const std::vector<Gate*>& gates);
+
+        /**
+         * Finalize the transaction.<br>
+         * Updates the nets of all affected modules, re-enables automatic net checks if they were enabled before, and emits the events for all objects created or changed during the transaction.
+         *
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate> commit();
+
+    private:
+        Netlist* m_netlist;
+        bool m_open = true;
+        bool m_net_checks_enabled;
+
+        std::vector<Gate*> m_created_gates;
+        std::vector<Net*> m_created_nets;
+        std::vector<Module*> m_created_modules;
+        std::unordered_set<const Gate*> m_created_gates_set;
+        std::unordered_set<const Net*> m_created_nets_set;
+        std::unordered_set<const Module*> m_created_modules_set;
+
+        /* nets whose endpoints or endpoint modules changed */
+        std::unordered_set<Net*> m_touched_nets;
+
+        /* changes to objects that existed before the transaction, replayed as events on commit */
+        std::vector<std::tuple<Net*, u32, bool>> m_added_endpoints;
+        std::vector<std::tuple<Gate*, Module*, Module*>> m_moved_gates;
+
+        /* modules that may have a pin for a net that no longer crosses their boundary */
+        std::vector<std::pair<Module*, Net*>> m_pin_candidates;
+
+        Endpoint* add_endpoint(Net* net, Gate* gate, GatePin* pin, bool is_destination);
+    };
+}    // namespace hal
@@ -27,7 +27,13 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
 #include "hal_core/netlist/pins/gate_pin.h"
+#include "hal_core/utilities/object_pool.h"
+#include "hal_core/utilities/symbol_table.h"
 
 #include <map>
 #include <vector>
@@ -50,6 +56,7 @@ namespace hal
     class NETLIST_API NetlistInternalManager
     {
         friend class Netlist;
+        friend class NetlistBuilder;
         friend class Module;
         friend class Net;
         friend class Gate;
@@ -59,11 +66,21 @@ namespace hal
         Netlist* m_netlist;
         EventHandler* m_event_handler;
 
+        /* interned data of all modules, nets, and gates, declared before the slab storage so that it outlives them */
+        SymbolTable m_symbol_table;
+
+        /* slab storage owning all modules, nets, gates, and endpoints of the netlist */
+        ObjectPool<Module> m_module_pool;
+        ObjectPool<Net> m_net_pool;
+        ObjectPool<Gate> m_gate_pool;
+        ObjectPool<Endpoint> m_endpoint_pool;
+
         explicit NetlistInternalManager(Netlist* nl, EventHandler* eh);
-        ~NetlistInternalManager() = default;
+        ~NetlistInternalManager();
 
         // netlist functions
         Result<std::unique_ptr<Netlist>> copy_netlist(const Netlist* nl) const;
+        void reserve(u32 num_gates, u32 num_nets, u32 num_modules);
 
         // gate functions
         Gate* create_gate(u32 id, GateType* gt, const std::string& name, i32 x, i32 y);
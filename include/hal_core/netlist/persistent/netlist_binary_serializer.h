@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+
+    /**
+     * @file
+     *
+     * \namespace netlist_binary_serializer
+     * @ingroup persistent
+     */
+
+    namespace netlist_binary_serializer
+    {
+        /**
+         * Serializes a netlist into a binary .hal file.
+         * 
+         * Instead of a JSON document, the netlist is stored as a set of fixed-width columns for gates, nets, endpoints, modules, pins, data entries, and Boolean function nodes, with all names and data stored once in a string table.
+         * The resulting file can be memory-mapped and bulk-loaded without any parsing.
+         * The file is written in the byte order of the host and can only be read on machines with the same byte order.
+         *
+         * @param[in] netlist - The netlist to serialize.
+         * @param[in] hal_file - The destination .hal file.
+         * @returns True on success, false otherwise.
+         */
+        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& hal_file);
+
+        /**
+         * Deserializes a netlist from a binary .hal file.
+         *
+         * @param[in] hal_file - The source .hal file.
+         * @returns The deserialized netlist on success, a nullptr otherwise.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file);
+
+        /**
+         * Check whether a file is a binary .hal file by inspecting its header.
+         *
+         * @param[in] hal_file - The file to check.
+         * @returns True if the file is a binary .hal file, false otherwise.
+         */
+        NETLIST_API bool is_binary_file(const std::filesystem::path& hal_file);
+    }    // namespace netlist_binary_serializer
+}    // namespace hal
@@ -0,0 +1,115 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <memory>
+
+namespace hal
+{
+    /** forward declaration */
+    class Module;
+    class Netlist;
+
+    /**
+     * Change journal that records which parts of a netlist were modified since the last full snapshot of the netlist was written.<br>
+     * The journal listens to the gate, net, module, and netlist events of the netlist and only remembers the IDs of created, modified, and removed objects.
+     * On `append_to_file()`, the current state of all modified objects and the IDs of all removed objects are appended to a journal file as a single transaction.
+     * The journal file can be replayed on top of the snapshot using `replay()` to restore the state of the netlist at the time of the last append.
+     * Transactions that were not written completely, e.g., because the application crashed, are discarded during replay.
+     *
+     * Groupings are not part of the journal as they are stored separately by the grouping serializer.
+     *
+     * @ingroup persistent
+     */
+    class NETLIST_API NetlistJournal
+    {
+    public:
+        /**
+         * Start recording the changes of the given netlist.
+         *
+         * @param[in] netlist - The netlist.
+         */
+        explicit NetlistJournal(Netlist* netlist);
+
+        /**
+         * Stop recording changes.
+         */
+        ~NetlistJournal();
+
+        NetlistJournal(const NetlistJournal&)            = delete;
+        NetlistJournal& operator=(const NetlistJournal&) = delete;
+
+        /**
+         * Get the netlist whose changes are recorded.
+         *
+         * @returns The netlist.
+         */
+        Netlist* get_netlist() const;
+
+        /**
+         * Check whether changes have been recorded since the last call to `append_to_file()` or `clear()`.
+         *
+         * @returns True if there are recorded changes, false otherwise.
+         */
+        bool has_changes() const;
+
+        /**
+         * Append all changes recorded since the last call to `append_to_file()` or `clear()` to the given journal file as a single transaction and reset the recorded changes.
+         * Nothing is written if no changes have been recorded.
+         *
+         * @param[in] journal_file - The journal file.
+         * @returns The number of bytes appended on success, an error otherwise.
+         */
+        Result<u64> append_to_file(const std::filesystem::path& journal_file);
+
+        /**
+         * Discard all recorded changes, e.g., after a full snapshot of the netlist has been written.
+         */
+        void clear();
+
+        /**
+         * Replay the transactions of a journal file on a netlist.<br>
+         * The netlist is expected to be in the state of the snapshot that the journal was started from.
+         * An incomplete transaction at the end of the file is ignored.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] journal_file - The journal file.
+         * @returns The number of replayed transactions on success, an error otherwise.
+         */
+        static Result<u32> replay(Netlist* netlist, const std::filesystem::path& journal_file);
+
+    private:
+        struct Changes;
+
+        static void clear_module_pins(Module* module);
+
+        Netlist* m_netlist;
+        std::shared_ptr<Changes> m_changes;
+    };
+}    // namespace hal
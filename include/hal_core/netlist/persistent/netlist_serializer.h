@@ -53,6 +53,7 @@ namespace hal
 
         /**
          * Deserializes a netlist from a .hal file.
+         * Binary .hal files written by `netlist_binary_serializer::serialize_to_file` are detected automatically.
          *
          * @param[in] hal_file - The source .hal file.
          * @returns The deserialized netlist.
@@ -53,7 +53,19 @@ namespace hal
          */
         GatePin(const u32 id, const std::string& name, PinDirection direction, PinType type = PinType::none);
 
+        /**
+         * Get the index of the pin within its gate type.
+         * Pins are indexed consecutively from 0 in the order of their creation, which allows to store per-pin data of a gate in plain arrays.
+         * 
+         * @returns The index of the pin.
+         */
+        u32 get_index() const;
+
     private:
+        friend class GateType;
+
+        u32 m_index = 0;
+
         GatePin(const GatePin&) = delete;
         GatePin(GatePin&&)      = delete;
         GatePin& operator=(const GatePin&) = delete;
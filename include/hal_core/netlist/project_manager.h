@@ -37,6 +37,7 @@
 namespace hal
 {
     class Netlist;
+    class NetlistJournal;
     class ProjectSerializer;
 
     /**
@@ -57,12 +58,22 @@ namespace hal
             SAVED   /**< Represents a saved project state. */
         };
 
+        /**
+         * Represents the file format used to store the netlist of a project.
+         */
+        enum NetlistFormat
+        {
+            JSON,  /**< Represents the JSON .hal file format. */
+            BINARY /**< Represents the binary columnar .hal file format. */
+        };
+
     private:
         ProjectManager();
 
         static ProjectManager* inst;
 
         ProjectStatus m_project_status;
+        NetlistFormat m_netlist_format;
         Netlist* m_netlist_save;
         std::unique_ptr<Netlist> m_netlist_load;
         ProjectDirectory m_proj_dir;
@@ -71,9 +82,20 @@ namespace hal
         std::string m_gatelib_path;
         std::unordered_map<std::string, ProjectSerializer*> m_serializer;
         std::unordered_map<std::string, std::string> m_filename;
+        bool m_autosave_journal_enabled;
+        std::unique_ptr<NetlistJournal> m_journal;
+        std::string m_journal_file;
 
         bool serialize_external(bool shadow);
 
+        /**
+         * Append the changes since the last autosave snapshot to the autosave journal.
+         * Fails if there is no valid snapshot to append to or if the journal is due for compaction.
+         *
+         * @return true if the changes were appended, false if a new snapshot must be written
+         */
+        bool append_to_journal();
+
         /**
          * Internal method to deserialize hal project, called by open_project()
          *
@@ -125,6 +147,40 @@ namespace hal
          */
         void set_project_status(ProjectStatus status);
 
+        /**
+         * Returns the file format used when serializing the netlist of the project.
+         *
+         * @return The netlist file format.
+         */
+        NetlistFormat get_netlist_format() const;
+
+        /**
+         * Set the file format used when serializing the netlist of the project.
+         * Opening a project sets the format to the one of its netlist file.
+         * Both formats are detected automatically when loading a netlist.
+         *
+         * @param[in] format - The netlist file format.
+         */
+        void set_netlist_format(NetlistFormat format);
+
+        /**
+         * Returns whether autosave appends the changes of the netlist to a journal instead of writing the complete netlist.
+         *
+         * @return `true` if the autosave journal is enabled, `false` otherwise.
+         */
+        bool is_autosave_journal_enabled() const;
+
+        /**
+         * Enable or disable the autosave journal.
+         * If enabled, autosave writes a full snapshot of the netlist only once and afterwards appends the gates, nets, and modules changed since the previous autosave to a journal file next to the snapshot.
+         * The journal is compacted into a new snapshot once it has grown to half the size of the snapshot.
+         * Opening the project replays the journal on top of the snapshot.
+         * Enabled by default.
+         *
+         * @param[in] enable - `true` to enable the autosave journal, `false` to disable it.
+         */
+        void set_autosave_journal_enabled(bool enable);
+
         /**
          * Returns the relative path of the file to be parsed by an external serializer.
          *
@@ -184,7 +240,7 @@ namespace hal
         void set_project_directory(const std::string& path);
 
         /**
-         * When copying files from autosave in project directory netlist filename needs to be adjusted.
+         * When copying files from autosave in project directory netlist and journal filenames need to be adjusted.
          */
         void restore_project_file_from_autosave();
 
@@ -27,13 +27,18 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/and_inverter_graph.h"
+#include "hal_core/netlist/boolean_function/simplification.h"
 #include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/solver_session.h"
 #include "hal_core/netlist/boolean_function/symbolic_execution.h"
 #include "hal_core/netlist/boolean_function/symbolic_state.h"
+#include "hal_core/netlist/boolean_function/translator.h"
 #include "hal_core/netlist/boolean_function/types.h"
 #include "hal_core/netlist/decorators/boolean_function_decorator.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/decorators/subgraph_netlist_decorator.h"
+#include "hal_core/netlist/frozen_netlist_view.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/gate_library/enums/async_set_reset_behavior.h"
 #include "hal_core/netlist/gate_library/gate_library.h"
@@ -45,9 +50,11 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_builder.h"
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/netlist/netlist_utils.h"
 #include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/netlist/pins/base_pin.h"
 #include "hal_core/netlist/pins/gate_pin.h"
@@ -171,6 +178,13 @@ namespace hal
      */
     void netlist_init(py::module& m);
 
+    /**
+     * Initializes Python bindings for the HAL netlist builder in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void netlist_builder_init(py::module& m);
+
     /**
      * Initializes Python bindings for the HAL project manager in a python module.
      *
@@ -283,6 +297,13 @@ namespace hal
      */
     void boolean_function_init(py::module& m);
 
+    /**
+     * Initializes Python bindings for the HAL and-inverter graph in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void and_inverter_graph_init(py::module& m);
+
     /**
      * Initializes Python bindings for the HAL SMT solver system in a python module.
      *
@@ -311,6 +332,13 @@ namespace hal
      */
     void boolean_function_decorator_init(py::module& m);
 
+    /**
+     * Initializes Python bindings for the HAL frozen netlist view in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void frozen_netlist_view_init(py::module& m);
+
     /**
      * @}
      */
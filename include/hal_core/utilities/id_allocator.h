@@ -0,0 +1,161 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Bookkeeping of used and free IDs for objects that are identified by a positive 32-bit ID.
+     * 
+     * Used and free IDs are stored in bitmaps indexed by ID, so that checking, acquiring, and releasing an ID takes constant time and no allocation per ID.
+     * IDs that are much larger than the number of used IDs are kept in hash sets instead, so that a few very large IDs do not inflate the bitmaps.
+     * Released IDs are handed out again by `get_unique_id`, smallest first.
+     * 
+     * @ingroup utilities
+     */
+    class CORE_API IdAllocator
+    {
+    public:
+        /**
+         * Construct an allocator without any used or free IDs.
+         */
+        IdAllocator() = default;
+
+        /**
+         * Get an ID that is not in use, preferring the smallest free ID.
+         * The ID is not marked as used before it is acquired.
+         * 
+         * @returns The ID.
+         */
+        u32 get_unique_id();
+
+        /**
+         * Check whether an ID is in use.
+         * 
+         * @param[in] id - The ID.
+         * @returns True if the ID is in use, false otherwise.
+         */
+        bool is_used(u32 id) const;
+
+        /**
+         * Mark an ID as used and remove it from the free IDs.
+         * 
+         * @param[in] id - The ID.
+         * @returns True on success, false if the ID is already in use.
+         */
+        bool acquire(u32 id);
+
+        /**
+         * Mark a used ID as unused and add it to the free IDs.
+         * 
+         * @param[in] id - The ID.
+         */
+        void release(u32 id);
+
+        /**
+         * Make sure that IDs up to the given ID are stored in the bitmaps.
+         * 
+         * @param[in] max_id - The largest ID expected to be used.
+         */
+        void reserve(u32 max_id);
+
+        /**
+         * Get the ID from which `get_unique_id` searches for an unused ID if there are no free IDs.
+         * 
+         * @returns The next ID.
+         */
+        u32 get_next_id() const;
+
+        /**
+         * Set the ID from which `get_unique_id` searches for an unused ID if there are no free IDs.
+         * 
+         * @param[in] id - The next ID.
+         */
+        void set_next_id(u32 id);
+
+        /**
+         * Get all used IDs.
+         * 
+         * @returns A set of used IDs.
+         */
+        std::set<u32> get_used_ids() const;
+
+        /**
+         * Replace the used IDs.
+         * 
+         * @param[in] ids - A set of used IDs.
+         */
+        void set_used_ids(const std::set<u32>& ids);
+
+        /**
+         * Get all free IDs, i.e., IDs that have been released and not been acquired again.
+         * 
+         * @returns A set of free IDs.
+         */
+        std::set<u32> get_free_ids() const;
+
+        /**
+         * Replace the free IDs.
+         * 
+         * @param[in] ids - A set of free IDs.
+         */
+        void set_free_ids(const std::set<u32>& ids);
+
+    private:
+        class IdSet
+        {
+        public:
+            bool contains(u32 id) const;
+            bool insert(u32 id);
+            bool erase(u32 id);
+            void clear();
+            void grow(u64 num_bits);
+            u64 get_num_dense_bits() const;
+            u32 size() const;
+            u32 find_first(u32 from) const;
+            std::set<u32> to_set() const;
+
+        private:
+            std::vector<u64> m_dense;
+            std::unordered_set<u32> m_sparse;
+            u32 m_size = 0;
+        };
+
+        void make_dense(u32 id);
+
+        u32 m_next_id = 1;
+        IdSet m_used;
+        IdSet m_free;
+
+        // no free ID is smaller than this one
+        u32 m_lowest_free = 0;
+    };
+}    // namespace hal
@@ -0,0 +1,169 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A map from 32-bit IDs to pointers that stores the pointers in a vector indexed by ID.
+     * 
+     * Lookups, insertions, and removals take constant time without hashing as long as the IDs are dense, which they are for IDs handed out by an `IdAllocator`.
+     * IDs that are much larger than the number of stored entries are kept in a hash map instead, so that a few very large IDs do not inflate the vector.
+     * The mapped type can be any pointer-like type whose default value is empty, e.g., a raw pointer or a `std::unique_ptr`.
+     * 
+     * @ingroup utilities
+     */
+    template<typename P>
+    class IdSlotMap
+    {
+    public:
+        /**
+         * Get the pointer stored for an ID.
+         * 
+         * @param[in] id - The ID.
+         * @returns The pointer, or an empty pointer if no pointer is stored for the ID.
+         */
+        const P& get(u32 id) const
+        {
+            if (id < m_slots.size())
+            {
+                if (m_slots[id])
+                {
+                    return m_slots[id];
+                }
+            }
+            if (!m_sparse.empty())
+            {
+                if (const auto it = m_sparse.find(id); it != m_sparse.end())
+                {
+                    return it->second;
+                }
+            }
+            return m_empty;
+        }
+
+        /**
+         * Check whether a pointer is stored for an ID.
+         * 
+         * @param[in] id - The ID.
+         * @returns True if a pointer is stored for the ID, false otherwise.
+         */
+        bool contains(u32 id) const
+        {
+            return static_cast<bool>(get(id));
+        }
+
+        /**
+         * Store a pointer for an ID, replacing any pointer previously stored for the ID.
+         * 
+         * @param[in] id - The ID.
+         * @param[in] ptr - The pointer, must not be empty.
+         */
+        void insert(u32 id, P ptr)
+        {
+            erase(id);
+            if (id >= m_slots.size() && id < 2 * u64(m_size) + DENSE_SLACK)
+            {
+                // grow geometrically so that ascending IDs only cause a logarithmic number of reallocations
+                m_slots.resize(std::max<u64>(u64(id) + 1, m_slots.size() + m_slots.size() / 2));
+            }
+
+            if (id < m_slots.size())
+            {
+                m_slots[id] = std::move(ptr);
+            }
+            else
+            {
+                m_sparse.emplace(id, std::move(ptr));
+            }
+            m_size++;
+        }
+
+        /**
+         * Remove the pointer stored for an ID.
+         * 
+         * @param[in] id - The ID.
+         * @returns The removed pointer, or an empty pointer if no pointer was stored for the ID.
+         */
+        P erase(u32 id)
+        {
+            P ptr{};
+            if (id < m_slots.size() && m_slots[id])
+            {
+                std::swap(ptr, m_slots[id]);
+            }
+            else if (const auto it = m_sparse.find(id); it != m_sparse.end())
+            {
+                ptr = std::move(it->second);
+                m_sparse.erase(it);
+            }
+            else
+            {
+                return ptr;
+            }
+            m_size--;
+            return ptr;
+        }
+
+        /**
+         * Make sure that IDs up to the given ID are stored in the vector.
+         * 
+         * @param[in] max_id - The largest ID expected to be stored.
+         */
+        void reserve(u32 max_id)
+        {
+            if (u64(max_id) + 1 > m_slots.size())
+            {
+                m_slots.resize(u64(max_id) + 1);
+            }
+        }
+
+        /**
+         * Get the number of stored pointers.
+         * 
+         * @returns The number of pointers.
+         */
+        u32 size() const
+        {
+            return m_size;
+        }
+
+    private:
+        // IDs below twice the number of stored pointers plus this slack are stored in the vector
+        static constexpr u64 DENSE_SLACK = 1 << 16;
+
+        std::vector<P> m_slots;
+        std::unordered_map<u32, P> m_sparse;
+        u32 m_size = 0;
+        P m_empty{};
+    };
+}    // namespace hal
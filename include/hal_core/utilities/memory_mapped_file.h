@@ -0,0 +1,122 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <string_view>
+
+namespace hal
+{
+    /**
+     * A read-only view of the contents of a file that is mapped into memory.
+     * 
+     * Instead of reading the file into a buffer, the operating system pages in the contents on demand, so that the file can be accessed like a single contiguous string without copying it.
+     * The mapped contents remain valid until the file is closed, i.e., all string views obtained from the mapped file must not outlive it.
+     * 
+     * @ingroup utilities
+     */
+    class CORE_API MemoryMappedFile
+    {
+    public:
+        /**
+         * Construct a memory-mapped file that is not yet associated with any file.
+         */
+        MemoryMappedFile() = default;
+
+        /**
+         * Unmaps the file, if any.
+         */
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&)            = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        /**
+         * Take over the mapping of another memory-mapped file, leaving the other one closed.
+         * 
+         * @param[in] other - The memory-mapped file to move from.
+         */
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+
+        /**
+         * Take over the mapping of another memory-mapped file, leaving the other one closed.
+         * Unmaps the previously mapped file, if any.
+         * 
+         * @param[in] other - The memory-mapped file to move from.
+         * @returns A reference to the memory-mapped file.
+         */
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        /**
+         * Map the given file into memory for reading.
+         * Unmaps the previously mapped file, if any.
+         * 
+         * @param[in] file_path - The path to the file.
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate> open(const std::filesystem::path& file_path);
+
+        /**
+         * Unmap the file.
+         * All string views into the mapped contents become invalid.
+         */
+        void close();
+
+        /**
+         * Check whether a file is currently mapped.
+         * 
+         * @returns True if a file is mapped, false otherwise.
+         */
+        bool is_open() const;
+
+        /**
+         * Get the contents of the mapped file.
+         * 
+         * @returns A view of the contents of the file, which is empty if no file is mapped.
+         */
+        std::string_view get_data() const;
+
+        /**
+         * Get the size of the mapped file in bytes.
+         * 
+         * @returns The size of the file.
+         */
+        u64 get_size() const;
+
+    private:
+        const char* m_data = nullptr;
+        u64 m_size         = 0;
+        bool m_is_open     = false;
+
+#ifdef _WIN32
+        void* m_file_handle    = nullptr;
+        void* m_mapping_handle = nullptr;
+#endif
+    };
+}    // namespace hal
@@ -0,0 +1,235 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A slab allocator for objects of a single type.
+     * 
+     * Objects are placed into large, contiguous slabs instead of being allocated individually on the heap. 
+     * Addresses of objects remain stable for their whole lifetime, memory of destroyed objects is reused by subsequently created objects, 
+     * and all remaining objects are destroyed at once when the pool is cleared or destructed.
+     * The pool only provides the storage, the objects themselves are constructed in-place by the owner of the pool via placement new.
+     * 
+     * @ingroup utilities
+     */
+    template<typename T>
+    class ObjectPool
+    {
+    public:
+        /**
+         * Construct an empty pool.
+         * 
+         * @param[in] min_slab_size - The minimum number of objects a newly allocated slab can hold.
+         */
+        explicit ObjectPool(u32 min_slab_size = 256) : m_min_slab_size(std::max(min_slab_size, 1u))
+        {
+        }
+
+        ObjectPool(const ObjectPool&)            = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /**
+         * Destroys all remaining objects and releases the slabs.
+         */
+        ~ObjectPool()
+        {
+            clear();
+        }
+
+        /**
+         * Get storage for a single object. 
+         * The caller has to construct the object in-place before using it.
+         * 
+         * @returns Pointer to uninitialized storage suitable for an object of type T.
+         */
+        void* allocate()
+        {
+            u32 slab_index;
+            u32 slot_index;
+            if (!m_free_slots.empty())
+            {
+                std::tie(slab_index, slot_index) = m_free_slots.back();
+                m_free_slots.pop_back();
+            }
+            else
+            {
+                if (m_slabs.empty() || m_slabs.back().used == m_slabs.back().capacity)
+                {
+                    // grow geometrically to keep the number of slabs logarithmic in the number of objects
+                    add_slab(std::max(m_min_slab_size, static_cast<u32>(std::min<size_t>(m_capacity, 1u << 20))));
+                }
+                slab_index = m_slabs.size() - 1;
+                slot_index = m_slabs.back().used++;
+            }
+
+            Slab& slab            = m_slabs[slab_index];
+            slab.live[slot_index] = true;
+            m_size++;
+            return &slab.storage[slot_index];
+        }
+
+        /**
+         * Destroy an object that was constructed in storage of this pool and make its storage available for reuse.
+         * 
+         * @param[in] object - The object to destroy.
+         */
+        void destroy(T* object)
+        {
+            if (object == nullptr)
+            {
+                return;
+            }
+
+            const auto address = reinterpret_cast<const Storage*>(object);
+            for (u32 slab_index = m_slabs.size(); slab_index-- > 0;)
+            {
+                Slab& slab = m_slabs[slab_index];
+                if (address >= slab.storage.get() && address < slab.storage.get() + slab.capacity)
+                {
+                    const u32 slot_index = address - slab.storage.get();
+                    object->~T();
+                    slab.live[slot_index] = false;
+                    m_free_slots.emplace_back(slab_index, slot_index);
+                    m_size--;
+                    return;
+                }
+            }
+        }
+
+        /**
+         * Ensure that the pool can hold at least the given number of objects without allocating further slabs.
+         * 
+         * @param[in] num_objects - The number of objects.
+         */
+        void reserve(size_t num_objects)
+        {
+            if (num_objects > m_size + m_free_slots.size() + unused_bump_slots())
+            {
+                add_slab(std::max<size_t>(num_objects - m_size - m_free_slots.size() - unused_bump_slots(), m_min_slab_size));
+            }
+        }
+
+        /**
+         * Destroy all objects and release all slabs.
+         */
+        void clear()
+        {
+            // destroy in reverse order of allocation
+            for (auto slab_it = m_slabs.rbegin(); slab_it != m_slabs.rend(); ++slab_it)
+            {
+                Slab& slab = *slab_it;
+                for (u32 slot_index = slab.used; slot_index-- > 0;)
+                {
+                    if (slab.live[slot_index])
+                    {
+                        reinterpret_cast<T*>(&slab.storage[slot_index])->~T();
+                    }
+                }
+            }
+            m_slabs.clear();
+            m_free_slots.clear();
+            m_size     = 0;
+            m_capacity = 0;
+        }
+
+        /**
+         * Get the number of live objects.
+         * 
+         * @returns The number of objects.
+         */
+        size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * Get the number of objects the pool can hold without allocating further slabs.
+         * 
+         * @returns The capacity.
+         */
+        size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+    private:
+        using Storage = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+        struct Slab
+        {
+            std::unique_ptr<Storage[]> storage;
+            std::vector<bool> live;
+            u32 capacity;
+            u32 used;
+        };
+
+        void add_slab(size_t capacity)
+        {
+            Slab slab;
+            slab.storage.reset(new Storage[capacity]);
+            slab.live.assign(capacity, false);
+            slab.capacity = capacity;
+            slab.used     = 0;
+
+            // slots that were never handed out by the previous bump slab become free slots
+            if (!m_slabs.empty())
+            {
+                Slab& last = m_slabs.back();
+                for (u32 slot_index = last.capacity; slot_index-- > last.used;)
+                {
+                    m_free_slots.emplace_back(m_slabs.size() - 1, slot_index);
+                }
+                last.used = last.capacity;
+            }
+
+            m_slabs.push_back(std::move(slab));
+            m_capacity += capacity;
+        }
+
+        size_t unused_bump_slots() const
+        {
+            return m_slabs.empty() ? 0 : m_slabs.back().capacity - m_slabs.back().used;
+        }
+
+        u32 m_min_slab_size;
+        std::vector<Slab> m_slabs;
+        std::vector<std::pair<u32, u32>> m_free_slots;
+        size_t m_size     = 0;
+        size_t m_capacity = 0;
+    };
+}    // namespace hal
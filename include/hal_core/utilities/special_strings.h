@@ -26,6 +26,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 namespace hal
 {
@@ -51,7 +52,7 @@ namespace hal
             }
             else
             {
-                return S(str.data());
+                return S(str.data(), str.size());
             }
         }
 
@@ -141,6 +142,8 @@ namespace hal
         };
 
         using CaseInsensitiveString = std::basic_string<char, CaseInsensitiveCharTraits>;
+
+        using CaseInsensitiveStringView = std::basic_string_view<char, CaseInsensitiveCharTraits>;
     }    // namespace core_strings
 }    // namespace hal
 
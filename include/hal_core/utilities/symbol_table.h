@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A table of interned strings that maps every distinct string to a compact symbol ID.
+     * 
+     * Each distinct string is stored exactly once in an append-only arena, so that objects holding many repeated strings can store 4-byte symbols instead of string copies.
+     * Strings are never removed from the table and views returned by `get` remain valid for the lifetime of the table.
+     * All functions may be called concurrently.
+     * 
+     * @ingroup utilities
+     */
+    class CORE_API SymbolTable
+    {
+    public:
+        /**
+         * The ID of an interned string.
+         */
+        using Symbol = u32;
+
+        /**
+         * The symbol returned for strings that have not been interned.
+         */
+        static constexpr Symbol INVALID_SYMBOL = ~Symbol(0);
+
+        /**
+         * Construct an empty symbol table.
+         */
+        SymbolTable() = default;
+
+        SymbolTable(const SymbolTable&)            = delete;
+        SymbolTable& operator=(const SymbolTable&) = delete;
+
+        /**
+         * Get the symbol of a string, adding the string to the table if it has not been interned before.
+         * 
+         * @param[in] str - The string.
+         * @returns The symbol of the string.
+         */
+        Symbol intern(std::string_view str);
+
+        /**
+         * Get the symbol of a string without adding it to the table.
+         * 
+         * @param[in] str - The string.
+         * @returns The symbol of the string if it has been interned, `SymbolTable::INVALID_SYMBOL` otherwise.
+         */
+        Symbol find(std::string_view str) const;
+
+        /**
+         * Get the string of a symbol.
+         * 
+         * @param[in] symbol - The symbol.
+         * @returns A view of the interned string, which is empty if the symbol is invalid.
+         */
+        std::string_view get(Symbol symbol) const;
+
+        /**
+         * Get the number of interned strings.
+         * 
+         * @returns The number of strings.
+         */
+        u32 size() const;
+
+        /**
+         * Get the number of bytes allocated for the interned strings and the index.
+         * 
+         * @returns The approximate memory usage of the table in bytes.
+         */
+        u64 get_memory_usage() const;
+
+    private:
+        mutable std::shared_mutex m_mutex;
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        u64 m_block_size = 0;
+        u64 m_block_fill = 0;
+        u64 m_allocated  = 0;
+        std::vector<std::string_view> m_strings;
+        std::unordered_map<std::string_view, Symbol> m_symbols;
+    };
+}    // namespace hal
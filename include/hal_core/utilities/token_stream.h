@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <map>
+#include <string>
 #include <vector>
 
 namespace hal
@@ -119,12 +120,20 @@ namespace hal
     /**
      * A token stream comprises a sequence of tokens that may, for example, have been read from a file.
      * 
+     * The tokens may either own their strings (e.g., std::string) or only reference them (e.g., std::string_view).
+     * In the latter case, the referenced strings must outlive the token stream, and all operations that create new strings, such as joining tokens, return owning strings instead.
+     * 
      * @ingroup utilities
      */
     template<typename T>
     class NETLIST_API TokenStream
     {
     public:
+        /**
+         * The owning string type corresponding to the token type, i.e., T itself for strings and the respective string for string views.
+         */
+        using string_type = std::basic_string<typename T::value_type, typename T::traits_type>;
+
         /**
          * The exception that is raised on any kind of error that occurs while working on the tokens of the stream.
          */
@@ -133,7 +142,7 @@ namespace hal
             /**
              * The message that is displayed to the user.
              */
-            T message;
+            string_type message;
 
             /**
              * The affected line number.
@@ -233,7 +242,7 @@ namespace hal
             {
                 if (throw_on_error)
                 {
-                    throw TokenStreamException({"expected Token '" + expected + "' but reached the end of the stream", get_current_line_number()});
+                    throw TokenStreamException({"expected Token '" + string_type(expected) + "' but reached the end of the stream", get_current_line_number()});
                 }
                 return false;
             }
@@ -242,7 +251,7 @@ namespace hal
             {
                 if (throw_on_error)
                 {
-                    throw TokenStreamException({"expected Token '" + expected + "' but got '" + at(m_pos).string + "'", get_current_line_number()});
+                    throw TokenStreamException({"expected Token '" + string_type(expected) + "' but got '" + string_type(at(m_pos).string) + "'", get_current_line_number()});
                 }
                 return false;
             }
@@ -268,7 +277,7 @@ namespace hal
             auto found = find_next(expected, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"expected Token '" + expected + "' not found", get_current_line_number()});
+                throw TokenStreamException({"expected Token '" + string_type(expected) + "' not found", get_current_line_number()});
             }
             m_pos = std::min(size(), found);
             return at(m_pos - 1);
@@ -310,7 +319,7 @@ namespace hal
             auto found = find_next(expected, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"expected Token '" + expected + "' not found", get_current_line_number()});
+                throw TokenStreamException({"expected Token '" + string_type(expected) + "' not found", get_current_line_number()});
             }
             auto end_pos = std::min(size(), found);
             TokenStream res(m_increase_level_tokens, m_decrease_level_tokens);
@@ -320,6 +329,24 @@ namespace hal
             return res;
         }
 
+        /**
+         * Consume the next tokens in the stream up to the given absolute end position.<br>
+         * The token at the end position is not consumed, i.e., it is now the next token in the stream.<br>
+         * All consumed tokens are returned as a new token stream.<br>
+         * Consumes all remaining tokens if the end position lies beyond the end of the stream.
+         *
+         * @param[in] end - The absolute position in the stream on which to stop.
+         * @returns All consumed tokens in form of a new token stream.
+         */
+        TokenStream<T> extract(u32 end)
+        {
+            auto end_pos = std::max(m_pos, std::min(size(), end));
+            TokenStream res(m_increase_level_tokens, m_decrease_level_tokens);
+            res.m_data.insert(res.m_data.begin(), m_data.begin() + m_pos, m_data.begin() + end_pos);
+            m_pos = end_pos;
+            return res;
+        }
+
         /**
          * Consume the next tokens in the stream until a token matches the given \p expected string.<br>
          * This final token is not consumed, i.e., it is now the next token in the stream.<br>
@@ -335,23 +362,23 @@ namespace hal
          * @param[in] throw_on_error - If true, throws an TokenStreamException instead of returning false on error.
          * @returns The joined token.
          */
-        Token<T> join_until(const T& match, const T& joiner, u32 end = END_OF_STREAM, bool level_aware = true, bool throw_on_error = false)
+        Token<string_type> join_until(const T& match, const T& joiner, u32 end = END_OF_STREAM, bool level_aware = true, bool throw_on_error = false)
         {
             u32 start_line = get_current_line_number();
             auto found     = find_next(match, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"match Token '" + match + "' not found", start_line});
+                throw TokenStreamException({"match Token '" + string_type(match) + "' not found", start_line});
             }
             auto end_pos = std::min(size(), found);
-            T result;
+            string_type result;
             while (m_pos < end_pos && remaining() > 0)
             {
                 if (!result.empty())
                 {
                     result += joiner;
                 }
-                result += consume();
+                result += consume().string;
             }
             return {start_line, result};
         }
@@ -364,17 +391,17 @@ namespace hal
          * @param[in] joiner - The string used to join consumed tokens.
          * @returns The joined token.
          */
-        Token<T> join(const T& joiner)
+        Token<string_type> join(const T& joiner)
         {
             u32 start_line = get_current_line_number();
-            T result;
+            string_type result;
             while (remaining() > 0)
             {
                 if (!result.empty())
                 {
                     result += joiner;
                 }
-                result += consume();
+                result += consume().string;
             }
             return {start_line, result};
         }
@@ -83,7 +83,7 @@ elif [[ "$platform" == 'linux' ]]; then
         libpython3-dev ccache autoconf autotools-dev libsodium-dev \
         libqt5svg5-dev libqt5svg5* ninja-build lcov gcovr python3-sphinx \
         doxygen python3-sphinx-rtd-theme python3-jedi python3-pip \
-        pybind11-dev python3-pybind11 rapidjson-dev libspdlog-dev libz3-dev libreadline-dev \
+        pybind11-dev python3-pybind11 rapidjson-dev libspdlog-dev libz3-dev libreadline-dev zlib1g-dev \
         $additional_deps \
         graphviz libomp-dev libsuitesparse-dev # For documentation
         sudo pip3 install -r requirements.txt
@@ -92,7 +92,7 @@ elif [[ "$platform" == 'linux' ]]; then
         qt5-base python ccache autoconf libsodium igraph qt5-svg ninja lcov \
         gcovr python-sphinx doxygen python-sphinx_rtd_theme python-jedi \
         python-pip pybind11 rapidjson spdlog graphviz boost \
-        python-dateutil z3
+        python-dateutil z3 zlib
     else
        echo "Unsupported Linux distribution: abort!"
        exit 255
@@ -104,7 +104,7 @@ elif [[ "$platform" == 'docker' ]]; then
     libpython3-dev ccache autoconf autotools-dev libsodium-dev \
     libqt5svg5-dev libqt5svg5* ninja-build lcov gcovr python3-sphinx \
     doxygen python3-sphinx-rtd-theme python3-jedi python3-pip \
-    pybind11-dev python3-pybind11 rapidjson-dev libspdlog-dev libz3-dev libreadline-dev \
+    pybind11-dev python3-pybind11 rapidjson-dev libspdlog-dev libz3-dev libreadline-dev zlib1g-dev \
     libigraph-dev \
     graphviz libomp-dev libsuitesparse-dev # For documentation
     pip3 install -r requirements.txt
@@ -43,27 +43,39 @@ namespace hal
 
         /**
          * Generates the Boolean influence of each input variable of a Boolean function.
+         * The influence is estimated in-process by evaluating the function on random input patterns, 64 patterns per machine word.
+         * If enumerating all input assignments requires no more than `num_evaluations` evaluations, the exact influence is computed instead.
          *
          * @param[in] bf - The Boolean function.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi threadin.
+         * @param[in] unique_identifier - Unused, only kept for compatibility.
          * @returns A mapping of the variables that appear in the function to their boolean influence in said function.
          */
         static Result<std::unordered_map<std::string, double>> get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations=32000, const std::string& unique_identifier="");
 
         /**
          * Generates the Boolean influence of each input variable of a Boolean function.
+         * The z3 expression is translated to a Boolean function before the influence is estimated.
          *
          * @param[in] e - The z3 expression representing a Boolean function.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi threadin.
+         * @param[in] unique_identifier - Unused, only kept for compatibility.
          * @returns A mapping of the variables that appear in the function to their boolean influence in said function.
          */
         static Result<std::unordered_map<std::string, double>> get_boolean_influence(const z3::expr& e, const u32 num_evaluations=32000, const std::string& unique_identifier="");
 
+        /**
+         * Computes the exact Boolean influence of each input variable of a Boolean function by enumerating its truth table.
+         * Only supports functions with up to 24 input variables.
+         *
+         * @param[in] bf - The Boolean function.
+         * @returns A mapping of the variables that appear in the function to their boolean influence in said function.
+         */
+        static Result<std::unordered_map<std::string, double>> get_boolean_influence_exact(const BooleanFunction& bf);
+
         /**
          * Generates the function of the net using only the given gates.
-         * Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evaluated.
+         * Afterwards the Boolean influence of each input of the generated function is estimated.
          *
          * @param[in] gates - The gates of the subcircuit.
          * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
@@ -73,7 +85,7 @@ namespace hal
 
         /**
          * Generates the function of the dataport net of the given flip-flop.
-         * Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evaluated.
+         * Afterwards the Boolean influence of each input of the generated function is estimated.
          *
          * @param[in] gate - Pointer to the flip-flop which data input net is used to build the Boolean function.
          * @returns A mapping of the gates that appear in the function of the data net to their Boolean influence in said function.
@@ -82,6 +94,7 @@ namespace hal
 
         /**
          * Get the FF dependency matrix of a netlist.
+         * The Boolean influences of the flip-flops are computed in parallel.
          *
          * @param[in] netlist - The netlist to extract the dependency matrix from.
          * @param[in] with_boolean_influence - True -- set Boolean influence, False -- sets 1.0 if connection between FFs
@@ -40,15 +40,35 @@ namespace hal
                     log_error("python_context", "{}", res.get_error().get());
                     return std::nullopt;
                 }
-            }, py::arg("gates"), py::arg("start_net"), R"(
-                The Boolean function gets translated to a z3::expr and afterwards efficent c code.
-                The program is compiled and executed many times to meassure the Boolean influence of each input variable.
+            }, py::arg("bf"), py::arg("num_evaluations") = 32000, R"(
+                Generates the Boolean influence of each input variable of a Boolean function.
+                The influence is estimated by evaluating the function on random input patterns, 64 patterns per machine word.
+                If enumerating all input assignments requires no more than num_evaluations evaluations, the exact influence is computed instead.
 
                 :param hal_py.BooleanFunction bf: The Boolean function.
                 :param int num_evaluations: Amount specifying how often to evaluate the function for each input.
                 :returns: A mapping of the input variable of the function to their boolean influence.
                 :rtype: dict
             )")
+            .def_static("get_boolean_influence_exact", [](const BooleanFunction& bf) -> std::optional<std::unordered_map<std::string, double>> {
+                const auto res = BooleanInfluencePlugin::get_boolean_influence_exact(bf);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            }, py::arg("bf"), R"(
+                Computes the exact Boolean influence of each input variable of a Boolean function by enumerating its truth table.
+                Only supports functions with up to 24 input variables.
+
+                :param hal_py.BooleanFunction bf: The Boolean function.
+                :returns: A mapping of the input variable of the function to their boolean influence.
+                :rtype: dict
+            )")
             .def_static("get_boolean_influences_of_subcircuit", [](const std::vector<Gate*>& gates, const Net* start_net) -> std::optional<std::map<Net*, double>> {
                 const auto res = BooleanInfluencePlugin::get_boolean_influences_of_subcircuit(gates, start_net);
                 if (res.is_ok())
@@ -62,7 +82,7 @@ namespace hal
                 }
             }, py::arg("gates"), py::arg("start_net"), R"(
                 Generates the function of the net using only the given gates.
-                Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evalated.
+                Afterwards the Boolean influence of each input of the generated function is estimated.
 
                 :param list[hal_py.Gate] gates: The gates of the subcircuit.
                 :param hal_py.Net start_net: The output net of the subcircuit at which to start the analysis.
@@ -82,7 +102,7 @@ namespace hal
                 }
             }, py::arg("gate"), R"(
                 Generates the function of the dataport net of the given flip-flop.
-                Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evalated.
+                Afterwards the Boolean influence of each input of the generated function is estimated.
 
                 :param hal_py.Gate gate: The flip-flop which data input net is used to build the boolean function.
                 :returns: A mapping of the nets that appear in the function of the data net to their boolean influence in said function.
@@ -101,6 +121,7 @@ namespace hal
                 }
             }, py::arg("netlist"), py::arg("with_boolean_influence"), R"(
                 Get the FF dependency matrix of a netlist, with or without boolean influences.
+                The Boolean influences of the flip-flops are computed in parallel.
 
                 :param hal_py.Netlist netlist: The netlist to extract the dependency matrix from.
                 :param bool with_boolean_influence: True -- set boolean influence, False -- sets 1.0 if connection between FFs
@@ -1,13 +1,17 @@
 #include "boolean_influence/plugin_boolean_influence.h"
 
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
+#include "hal_core/netlist/decorators/subgraph_netlist_decorator.h"
 #include "hal_core/netlist/netlist_utils.h"
 
 #include "z3_utils/include/plugin_z3_utils.h"
 
-#include <filesystem>
-#include <fstream>
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <random>
 
 namespace hal
 {
@@ -62,157 +66,201 @@ namespace hal
 
             return {function_gates.begin(), function_gates.end()};
         }
-    }  // namespace
-
-    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations, const std::string& unique_identifier)
-    {
-        auto ctx = z3::context();
-        const auto z3_bf = z3_utils::to_z3(bf, ctx);
 
-        return get_boolean_influence(z3_bf, num_evaluations, unique_identifier);
-    }
+        // maximum number of input variables for which the influence is computed by enumerating the whole truth table
+        const u32 max_exact_variables = 24;
 
-    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const z3::expr& expr, const u32 num_evaluations, const std::string& unique_identifier)
-    {
-        const auto to_replacement_var = [](const u32 var_idx) -> std::string {
-            return "var_" + std::to_string(var_idx);
-        };
+        // number of 64-lane words evaluated per pass of the compiled function
+        const u32 words_per_pass = 16;
 
-        const auto extract_index = [](const std::string& var) -> Result<u32> {
-            if (!utils::starts_with(var, std::string("var_")))
+        Result<CompiledBooleanFunction> compile_function(const BooleanFunction& bf)
+        {
+            if (bf.size() != 1)
             {
-                return ERR("variable " + var + " does not start with prefix 'var_', so we cannot extract an index.");
+                return ERR("can only handle Boolean functions of size 1, but function '" + bf.to_string() + "' is of size " + std::to_string(bf.size()) + ".");
             }
 
-            try
+            const auto compiled_res = CompiledBooleanFunction::compile(bf);
+            if (compiled_res.is_error())
             {
-                return OK(u32(std::stoul(var.substr(4))));
+                return ERR_APPEND(compiled_res.get_error(), "could not compile Boolean function '" + bf.to_string() + "'.");
             }
-            catch (const std::invalid_argument& e)
+
+            for (u32 var_idx = 0; var_idx < compiled_res.get().get_variables().size(); var_idx++)
             {
-                return ERR("could not get index from string '" + var + "': " + e.what());
+                if (compiled_res.get().get_variable_sizes().at(var_idx) != 1)
+                {
+                    return ERR("can only handle single-bit variables, but variable '" + compiled_res.get().get_variables().at(var_idx) + "' is of size "
+                               + std::to_string(compiled_res.get().get_variable_sizes().at(var_idx)) + ".");
+                }
             }
-            catch (const std::out_of_range& e)
+
+            return compiled_res;
+        }
+
+        Result<std::unordered_map<std::string, double>> get_exact_influence(const CompiledBooleanFunction& compiled)
+        {
+            const auto table_res = compiled.compute_truth_table();
+            if (table_res.is_error())
             {
-                return ERR("could not get index from string '" + var + "': " + e.what());
+                return ERR_APPEND(table_res.get_error(), "unable to generate exact Boolean influence: failed to compute truth table.");
             }
-        };
+            const std::vector<BooleanFunction::Value>& table = table_res.get().front();
+
+            // row r of the truth table assigns bit i of r to variable i, so flipping variable i corresponds to flipping bit i of the row index
+            const std::vector<std::string>& input_vars = compiled.get_variables();
+            const u32 num_vars                         = input_vars.size();
+            const u64 num_rows                         = table.size();
+            std::vector<u64> counts(num_vars, 0);
 
-        const auto to_original_var = [extract_index](const std::string& replacement_var, const std::vector<std::string>& original_vars) -> Result<std::string> {
-            const auto var_idx_res = extract_index(replacement_var);
-            if (var_idx_res.is_error())
+#pragma omp parallel for schedule(dynamic)
+            for (u32 var_idx = 0; var_idx < num_vars; var_idx++)
             {
-                return ERR_APPEND(var_idx_res.get_error(), "unable to reconstruct original variable from replacement variable" + replacement_var + ": failed to extract index.");
+                const u64 flip = u64(1) << var_idx;
+                for (u64 row = 0; row < num_rows; row++)
+                {
+                    if (table[row] != table[row ^ flip])
+                    {
+                        counts[var_idx]++;
+                    }
+                }
             }
-            const auto var_idx = var_idx_res.get();
 
-            if (var_idx > original_vars.size())
+            std::unordered_map<std::string, double> influences;
+            for (u32 var_idx = 0; var_idx < num_vars; var_idx++)
             {
-                return ERR("unable to reconstruct original variable from replacement variable" + replacement_var + ": extracted index " + std::to_string(var_idx) + " is bigger than the size of the original vars (" + std::to_string(original_vars.size()) + ").");
+                influences.insert({input_vars.at(var_idx), (double)(counts[var_idx]) / (double)(num_rows)});
             }
 
-            return OK(original_vars.at(var_idx));
-        };
-
-        std::unordered_map<std::string, double> influences;
-
-        // substitute all variables in the expression to be of the format var_<INDEX>.
-        // This allows for a more efficient translation into a c function
-        std::vector<std::string> input_vars = utils::to_vector(z3_utils::get_variable_names(expr));
-        std::vector<std::string> replacement_vars;
+            return OK(influences);
+        }
+    }  // namespace
 
-        z3::expr_vector from_vec(expr.ctx());
-        z3::expr_vector to_vec(expr.ctx());
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations, const std::string& unique_identifier)
+    {
+        UNUSED(unique_identifier);
 
-        for (u32 var_idx = 0; var_idx < input_vars.size(); var_idx++)
+        const auto compiled_res = compile_function(bf);
+        if (compiled_res.is_error())
         {
-            replacement_vars.push_back(to_replacement_var(var_idx));
-
-            z3::expr from = expr.ctx().bv_const(input_vars.at(var_idx).c_str(), 1);
-            z3::expr to   = expr.ctx().bv_const(to_replacement_var(var_idx).c_str(), 1);
-
-            from_vec.push_back(from);
-            to_vec.push_back(to);
+            return ERR_APPEND(compiled_res.get_error(), "unable to generate Boolean influence: failed to compile Boolean function.");
         }
+        const auto& compiled = compiled_res.get();
 
-        auto replaced_e = expr;
-        replaced_e = replaced_e.substitute(from_vec, to_vec);
+        const std::vector<std::string>& input_vars = compiled.get_variables();
+        const u32 num_vars                         = input_vars.size();
 
-        // translate expression into a c program
-        const std::filesystem::path directory = "/tmp/boolean_influence_tmp/";
-        std::filesystem::create_directory(directory);
-
-        const std::filesystem::path file_path = directory / (unique_identifier.empty() ? ("boolean_func.cpp") :  ("boolean_func_" + unique_identifier + ".cpp"));
-
-        const auto c_func    = z3_utils::to_cpp(replaced_e);
-
-        // write c program to file
-        std::ofstream ofs(file_path);
-        if (!ofs.is_open())
+        // enumerating all assignments is cheaper than sampling and yields the exact influence
+        if (num_vars <= max_exact_variables && (u64(1) << num_vars) <= num_evaluations)
         {
-            return ERR("unable to generate Boolean influence: could not open file " + file_path.string() + ".");
+            return get_exact_influence(compiled);
         }
-        ofs << c_func;
 
-        ofs.close();
+        if (num_evaluations == 0)
+        {
+            return ERR("unable to generate Boolean influence: number of evaluations must be greater than zero.");
+        }
 
-        // compile the c file
-        const std::string program_name    = file_path.string().substr(0, file_path.string().size() - 4);
-        const std::string compile_command = "g++ -o " + program_name + " " + file_path.string() + " -O3";
-        int res                           = system(compile_command.c_str());
-        UNUSED(res);
+        // every input variable is evaluated independently in 64 lanes per word with a fixed seed to keep results reproducible
+        const u32 num_words    = (num_evaluations + 63) / 64;
+        const u64 last_mask    = (num_evaluations % 64 == 0) ? ~u64(0) : ((u64(1) << (num_evaluations % 64)) - 1);
+        std::vector<u64> counts(num_vars, 0);
+        std::vector<u8> failed(num_vars, 0);
 
-        // run boolean function program for every input
-        for (const auto& var : replacement_vars)
+#pragma omp parallel for schedule(dynamic)
+        for (u32 var_idx = 0; var_idx < num_vars; var_idx++)
         {
-            const auto idx_res = extract_index(var);
-            if (idx_res.is_error())
+            // exceptions must not escape the parallel region, they mark the variable as failed instead
+            try
             {
-                return ERR_APPEND(idx_res.get_error(), "unable to generate Boolean influence: failed to extract index from variable " + var + ".");
-            }
-            const auto idx = idx_res.get();
+                std::mt19937_64 rng(0x9E3779B97F4A7C15ull ^ var_idx);
 
-            const std::string run_command = program_name + " " + std::to_string(idx) + " " + std::to_string(num_evaluations) + " 2>&1";
+                std::vector<u64> values((size_t)num_vars * words_per_pass);
+                std::vector<u64> output_values_1, output_unknowns_1, output_values_0, output_unknowns_0;
 
-            std::array<char, 128> buffer;
-            std::string result;
+                for (u32 word_offset = 0; word_offset < num_words; word_offset += words_per_pass)
+                {
+                    const u32 pass_words = std::min(words_per_pass, num_words - word_offset);
+                    values.resize((size_t)num_vars * pass_words);
+                    for (auto& word : values)
+                    {
+                        word = rng();
+                    }
 
-            FILE* pipe = popen(run_command.c_str(), "r");
-            if (!pipe)
-            {
-                return ERR("unable to generate Boolean influence: error during execution of compiled boolean program");
+                    // evaluate with the variable set to one and to zero in all lanes
+                    std::fill_n(values.begin() + (size_t)var_idx * pass_words, pass_words, ~u64(0));
+                    if (compiled.evaluate(values, {}, output_values_1, output_unknowns_1, pass_words).is_error())
+                    {
+                        failed[var_idx] = 1;
+                        break;
+                    }
+                    std::fill_n(values.begin() + (size_t)var_idx * pass_words, pass_words, u64(0));
+                    if (compiled.evaluate(values, {}, output_values_0, output_unknowns_0, pass_words).is_error())
+                    {
+                        failed[var_idx] = 1;
+                        break;
+                    }
+
+                    for (u32 w = 0; w < pass_words; w++)
+                    {
+                        u64 diff = (output_values_1[w] ^ output_values_0[w]) & ~(output_unknowns_1[w] | output_unknowns_0[w]);
+                        if (word_offset + w == num_words - 1)
+                        {
+                            diff &= last_mask;
+                        }
+                        counts[var_idx] += __builtin_popcountll(diff);
+                    }
+                }
             }
-            while (fgets(buffer.data(), 128, pipe) != NULL)
+            catch (const std::exception&)
             {
-                result += buffer.data();
+                failed[var_idx] = 1;
             }
+        }
 
-            pclose(pipe);
-
-            const u32 count = std::stoi(result);
-            double cv       = (double)(count) / (double)(num_evaluations);
-
-            const auto org_var_res = to_original_var(var, input_vars);
-            if (org_var_res.is_error())
+        std::unordered_map<std::string, double> influences;
+        for (u32 var_idx = 0; var_idx < num_vars; var_idx++)
+        {
+            if (failed[var_idx])
             {
-                return ERR_APPEND(org_var_res.get_error(), "unable to generate Boolean influence: failed to reconstruct original variable from replacement variable " + var + ".");
+                return ERR("unable to generate Boolean influence: failed to evaluate Boolean function for variable " + input_vars.at(var_idx) + ".");
             }
-            const auto org_var = org_var_res.get();
-
-            influences.insert({org_var, cv});
+            influences.insert({input_vars.at(var_idx), (double)(counts[var_idx]) / (double)(num_evaluations)});
         }
 
-        // delete files and temp directory
-        std::remove(file_path.string().c_str());
-        std::remove(program_name.c_str());
+        return OK(influences);
+    }
 
-        //std::filesystem::remove(directory);
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const z3::expr& expr, const u32 num_evaluations, const std::string& unique_identifier)
+    {
+        return get_boolean_influence(z3_utils::to_hal(expr), num_evaluations, unique_identifier);
+    }
 
-        return OK(influences);
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence_exact(const BooleanFunction& bf)
+    {
+        const auto compiled_res = compile_function(bf);
+        if (compiled_res.is_error())
+        {
+            return ERR_APPEND(compiled_res.get_error(), "unable to generate exact Boolean influence: failed to compile Boolean function.");
+        }
+        const auto& compiled = compiled_res.get();
+
+        if (compiled.get_variables().size() > max_exact_variables)
+        {
+            return ERR("unable to generate exact Boolean influence: function has " + std::to_string(compiled.get_variables().size()) + " input variables, but at most "
+                       + std::to_string(max_exact_variables) + " are supported.");
+        }
+
+        return get_exact_influence(compiled);
     }
 
     Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net)
     {
+        if (start_net == nullptr)
+        {
+            return ERR("unable to get Boolean influence for sub circuit: start net is a nullptr.");
+        }
+
         for (const auto* gate : gates)
         {
             if (!gate->get_type()->has_property(GateTypeProperty::combinational) || gate->is_vcc_gate() || gate->is_gnd_gate())
@@ -222,12 +270,11 @@ namespace hal
         }
 
         // Generate function for the data port
-        auto ctx  = z3::context();
-        auto func = z3::expr(ctx);
+        BooleanFunction func;
 
         if (!gates.empty())
         {
-            const auto func_res = z3_utils::get_subgraph_z3_function(gates, start_net, ctx);
+            const auto func_res = SubgraphNetlistDecorator(*start_net->get_netlist()).get_subgraph_function(gates, start_net);
             if (func_res.is_error())
             {
                 return ERR_APPEND(func_res.get_error(), "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ": failed to build subgraph function");
@@ -237,7 +284,7 @@ namespace hal
         // edge case if the gates are empty
         else
         {
-            func = ctx.bv_const(BooleanFunctionNetDecorator(*start_net).get_boolean_variable_name().c_str(), 1);
+            func = BooleanFunctionNetDecorator(*start_net).get_boolean_variable();
         }
 
         // Generate Boolean influences
@@ -282,9 +329,14 @@ namespace hal
         }
         const GatePin* data_pin = d_pins.front();
 
+        const auto in_net = gate->get_fan_in_net(data_pin);
+        if (in_net == nullptr)
+        {
+            return ERR("unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ": data pin " + data_pin->get_name() + " is not connected to a net.");
+        }
+
         // Extract all gates in front of the data port and iterate backwards until another flip flop is found.
         const auto function_gates = extract_function_gates(gate, data_pin);
-        const auto in_net = gate->get_fan_in_net(data_pin);
 
         // Generate Boolean influences
         const auto inf_res = get_boolean_influences_of_subcircuit(function_gates, in_net);
@@ -316,14 +368,38 @@ namespace hal
             matrix_gates++;
         }
 
-        u32 status_counter = 0;
-        for (const auto& [id, gate] : matrix_id_to_gate)
+        // the Boolean influences of the flip-flops are independent of each other and are therefore computed in parallel
+        std::vector<std::optional<Result<std::map<Net*, double>>>> influences(matrix_gates);
+        if (with_boolean_influence)
         {
-            if (status_counter % 100 == 0)
+            u32 status_counter = 0;
+
+#pragma omp parallel for schedule(dynamic)
+            for (u32 id = 0; id < matrix_gates; id++)
             {
-                log_info("boolean_influence", "status {}/{} processed", status_counter, matrix_id_to_gate.size());
+                // exceptions must not escape the parallel region, they are reported as error of the respective gate instead
+                try
+                {
+                    influences[id] = get_boolean_influences_of_gate(matrix_id_to_gate.at(id));
+                }
+                catch (const std::exception& e)
+                {
+                    influences[id] = ERR("unable to get Boolean influence for gate with ID " + std::to_string(matrix_id_to_gate.at(id)->get_id()) + ": " + e.what());
+                }
+
+#pragma omp critical
+                {
+                    if (status_counter % 100 == 0)
+                    {
+                        log_info("boolean_influence", "status {}/{} processed", status_counter, matrix_gates);
+                    }
+                    status_counter++;
+                }
             }
-            status_counter++;
+        }
+
+        for (const auto& [id, gate] : matrix_id_to_gate)
+        {
             std::vector<double> line_of_matrix;
 
             std::set<u32> gates_to_add;
@@ -334,7 +410,7 @@ namespace hal
             std::map<Net*, double> boolean_influence_for_gate;
             if (with_boolean_influence)
             {
-                const auto inf_res = get_boolean_influences_of_gate(gate);
+                const auto& inf_res = influences.at(id).value();
                 if (inf_res.is_error())
                 {
                     return ERR_APPEND(inf_res.get_error(), "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ".");
@@ -0,0 +1,154 @@
+#include "boolean_influence/plugin_boolean_influence.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "netlist_test_utils.h"
+
+namespace hal {
+
+    class BooleanInfluenceTest : public ::testing::Test {
+    protected:
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /*
+     *        .-----------------------------------------------.
+     *        |                                               |
+     *        '-= D ff_0 Q =--+--= I0                         |
+     *                        |        AND2 =--= D ff_2 Q =---'
+     *                        '--= D ff_1 Q =--= I1
+     *
+     *  followed by a shift register ff_0 -> sr_0 -> sr_1 -> ... -> sr_15
+     */
+    /**
+     * Testing the Boolean influences of several flip-flops, which are computed in parallel when generating the flip-flop dependency matrix.
+     *
+     * Functions: get_boolean_influences_of_gate, get_ff_dependency_matrix
+     */
+    TEST_F(BooleanInfluenceTest, check_multiple_flip_flops)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* ff_0     = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_0");
+            Gate* ff_1     = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_1");
+            Gate* ff_2     = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_2");
+            Gate* and_gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and_gate");
+
+            Net* net_0 = test_utils::connect(nl.get(), ff_0, "Q", and_gate, "I0");
+            test_utils::connect(nl.get(), ff_0, "Q", ff_1, "D");
+            Net* net_1 = test_utils::connect(nl.get(), ff_1, "Q", and_gate, "I1");
+            test_utils::connect(nl.get(), and_gate, "O", ff_2, "D");
+            Net* net_2 = test_utils::connect(nl.get(), ff_2, "Q", ff_0, "D");
+
+            std::vector<Gate*> shift_register;
+            Gate* prev = ff_0;
+            for (u32 i = 0; i < 16; i++)
+            {
+                Gate* sr = nl->create_gate(gl->get_gate_type_by_name("DFF"), "sr_" + std::to_string(i));
+                test_utils::connect(nl.get(), prev, "Q", sr, "D");
+                shift_register.push_back(sr);
+                prev = sr;
+            }
+
+            // single flip-flops
+            {
+                const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate(ff_2);
+                ASSERT_TRUE(res.is_ok());
+                std::map<Net*, double> expected = {{net_0, 0.5}, {net_1, 0.5}};
+                EXPECT_EQ(res.get(), expected);
+            }
+            {
+                const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate(ff_0);
+                ASSERT_TRUE(res.is_ok());
+                std::map<Net*, double> expected = {{net_2, 1.0}};
+                EXPECT_EQ(res.get(), expected);
+            }
+            {
+                const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate(ff_1);
+                ASSERT_TRUE(res.is_ok());
+                std::map<Net*, double> expected = {{net_0, 1.0}};
+                EXPECT_EQ(res.get(), expected);
+            }
+            {
+                const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate(and_gate);
+                EXPECT_TRUE(res.is_error());
+            }
+
+            // dependency matrix, row of a flip-flop holds the influences of its predecessor flip-flops
+            std::map<Gate*, std::map<Gate*, double>> expected_influences = {{ff_0, {{ff_2, 1.0}}}, {ff_1, {{ff_0, 1.0}}}, {ff_2, {{ff_0, 0.5}, {ff_1, 0.5}}}};
+            prev = ff_0;
+            for (Gate* sr : shift_register)
+            {
+                expected_influences[sr] = {{prev, 1.0}};
+                prev = sr;
+            }
+
+            for (bool with_boolean_influence : {true, false})
+            {
+                const auto res = BooleanInfluencePlugin::get_ff_dependency_matrix(nl.get(), with_boolean_influence);
+                ASSERT_TRUE(res.is_ok());
+                const auto& [matrix_id_to_gate, matrix] = res.get();
+                ASSERT_EQ(matrix_id_to_gate.size(), expected_influences.size());
+                ASSERT_EQ(matrix.size(), expected_influences.size());
+
+                for (const auto& [row, gate] : matrix_id_to_gate)
+                {
+                    ASSERT_EQ(matrix.at(row).size(), expected_influences.size());
+                    for (const auto& [col, pred_gate] : matrix_id_to_gate)
+                    {
+                        const auto& expected_row = expected_influences.at(gate);
+                        double expected          = 0.0;
+                        if (const auto it = expected_row.find(pred_gate); it != expected_row.end())
+                        {
+                            expected = with_boolean_influence ? it->second : 1.0;
+                        }
+                        EXPECT_EQ(matrix.at(row).at(col), expected) << "influence of " << pred_gate->get_name() << " on " << gate->get_name();
+                    }
+                }
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that a flip-flop with an unconnected data pin is reported as error instead of being dereferenced.
+     *
+     * Functions: get_boolean_influences_of_gate, get_ff_dependency_matrix
+     */
+    TEST_F(BooleanInfluenceTest, check_unconnected_data_pin)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* ff_0 = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_0");
+            Gate* ff_1 = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_1");
+            test_utils::connect(nl.get(), ff_0, "Q", ff_1, "D");
+
+            EXPECT_TRUE(BooleanInfluencePlugin::get_boolean_influences_of_gate(ff_0).is_error());
+            EXPECT_TRUE(BooleanInfluencePlugin::get_boolean_influences_of_gate(ff_1).is_ok());
+
+            EXPECT_TRUE(BooleanInfluencePlugin::get_ff_dependency_matrix(nl.get(), true).is_error());
+            EXPECT_TRUE(BooleanInfluencePlugin::get_ff_dependency_matrix(nl.get(), false).is_ok());
+        }
+        TEST_END
+    }
+} // namespace hal
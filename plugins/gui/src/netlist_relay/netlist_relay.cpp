@@ -346,6 +346,10 @@ namespace hal
 
         handleNetlistModified();
 
+        // data changes only affect the modification state, there is nothing to relay
+        if (ev == ModuleEvent::event::data_changed)
+            return;
+
         if (dynamic_cast<PythonThread*>(QThread::currentThread()))
         {
             Q_EMIT signalThreadEvent(TetModule, (int) ev, mod, associated_data);
@@ -486,6 +490,10 @@ namespace hal
 
         handleNetlistModified();
 
+        // data changes only affect the modification state, there is nothing to relay
+        if (ev == GateEvent::event::data_changed)
+            return;
+
         if (dynamic_cast<PythonThread*>(QThread::currentThread()))
         {
             Q_EMIT signalThreadEvent(TetGate, (int) ev, gat, associated_data);
@@ -546,6 +554,10 @@ namespace hal
 
         handleNetlistModified();
 
+        // data changes only affect the modification state, there is nothing to relay
+        if (ev == NetEvent::event::data_changed)
+            return;
+
         if (dynamic_cast<PythonThread*>(QThread::currentThread()))
         {
             Q_EMIT signalThreadEvent(TetNet, (int) ev, net, associated_data);
@@ -31,11 +31,14 @@
 #include "hal_core/netlist/gate_library/enums/pin_direction.h"
 #include "hal_core/netlist/gate_library/gate_library_parser/gate_library_parser.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/token_stream.h"
 
+#include <deque>
 #include <filesystem>
 #include <map>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 
 namespace hal
@@ -150,26 +153,34 @@ namespace hal
         };
 
         std::unique_ptr<GateLibrary> m_gate_lib;
-        std::stringstream m_fs;
+        MemoryMappedFile m_file;
         std::filesystem::path m_path;
 
-        TokenStream<std::string> m_token_stream;
+        // token stream of entire input file, tokens reference the mapped file or the token storage
+        TokenStream<std::string_view> m_token_stream;
+        std::deque<std::string> m_token_storage;
+
         std::map<std::string, type_group> m_bus_types;
         std::set<std::string> m_cell_names;
 
+        // many cells share the same functions, so every distinct function string is only parsed once
+        std::unordered_map<std::string, BooleanFunction> m_function_cache;
+
         void tokenize();
         Result<std::monostate> parse_tokens();
 
-        Result<cell_group> parse_cell(TokenStream<std::string>& library_stream);
-        Result<type_group> parse_type(TokenStream<std::string>& str);
-        Result<pin_group> parse_pin(TokenStream<std::string>& str, cell_group& cell, PinDirection direction = PinDirection::none, const std::string& external_pin_name = "");
-        Result<pin_group> parse_pg_pin(TokenStream<std::string>& str, cell_group& cell);
-        Result<bus_group> parse_bus(TokenStream<std::string>& str, cell_group& cell);
-        Result<ff_group> parse_ff(TokenStream<std::string>& str);
-        Result<latch_group> parse_latch(TokenStream<std::string>& str);
+        Result<std::monostate> parse_cell(TokenStream<std::string_view>& cell_str, cell_group& cell) const;
+        Result<type_group> parse_type(TokenStream<std::string_view>& str) const;
+        Result<pin_group> parse_pin(TokenStream<std::string_view>& str, cell_group& cell, PinDirection direction = PinDirection::none, const std::string& external_pin_name = "") const;
+        Result<pin_group> parse_pg_pin(TokenStream<std::string_view>& str, cell_group& cell) const;
+        Result<bus_group> parse_bus(TokenStream<std::string_view>& str, cell_group& cell) const;
+        Result<ff_group> parse_ff(TokenStream<std::string_view>& str) const;
+        Result<latch_group> parse_latch(TokenStream<std::string_view>& str) const;
         Result<std::monostate> construct_gate_type(cell_group&& cell);
 
-        void remove_comments(std::string& line, bool& multi_line_comment);
+        void collect_functions(const cell_group& cell, std::vector<std::string>& functions) const;
+        void cache_functions(std::vector<std::string>&& functions);
+        Result<BooleanFunction> parse_function(const std::string& function);
         std::vector<std::string> tokenize_function(const std::string& function);
         std::map<std::string, std::string> expand_bus_function(const std::map<std::string, bus_group>& buses, const std::vector<std::string>& pin_names, const std::string& function);
         std::string prepare_pin_function(const std::map<std::string, bus_group>& buses, const std::string& function);
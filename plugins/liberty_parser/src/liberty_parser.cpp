@@ -5,7 +5,8 @@
 #include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
 #include "hal_core/utilities/log.h"
 
-#include <fstream>
+#include <algorithm>
+#include <exception>
 
 // TODO remove LUT parsing
 
@@ -15,15 +16,9 @@ namespace hal
     {
         m_path = file_path;
 
+        if (auto res = m_file.open(file_path); res.is_error())
         {
-            std::ifstream ifs;
-            ifs.open(m_path.string(), std::ifstream::in);
-            if (!ifs.is_open())
-            {
-                return ERR("could not parse Liberty file '" + m_path.string() + "' : unable to open file");
-            }
-            m_fs << ifs.rdbuf();
-            ifs.close();
+            return ERR_APPEND(res.get_error(), "could not parse Liberty file '" + m_path.string() + "' : unable to open file");
         }
 
         // tokenize file
@@ -37,7 +32,7 @@ namespace hal
                 return ERR_APPEND(res.get_error(), "could not parse Liberty file '" + file_path.string() + "': unable to parse tokens");
             }
         }
-        catch (TokenStream<std::string>::TokenStreamException& e)
+        catch (TokenStream<std::string_view>::TokenStreamException& e)
         {
             if (e.line_number != (u32)-1)
             {
@@ -49,68 +44,203 @@ namespace hal
             }
         }
 
+        // release the tokens, the file, and the cached functions, all gate types have been constructed
+        m_token_stream = TokenStream<std::string_view>();
+        m_token_storage.clear();
+        m_file.close();
+        m_function_cache.clear();
+
         return OK(std::move(m_gate_lib));
     }
 
     void LibertyParser::tokenize()
     {
-        std::string delimiters = "{}()[];:\",";
-        std::string current_token;
-        u32 line_number = 0;
+        m_token_storage.clear();
+
+        // groups that are not listed here (e.g., timing, power, or noise tables) are skipped while tokenizing, as they make up most of a typical Liberty file
+        static const std::set<std::string_view> parsed_groups = {"library", "cell", "type", "pin", "pg_pin", "bus", "ff", "latch"};
+
+        const std::string_view data       = m_file.get_data();
+        const std::string_view delimiters = "{}()[];:\",";
+        u32 line_number                   = 1;
+
+        // the current token usually is a contiguous range of the file, it is only copied if characters within the token are skipped (e.g., whitespace or comments)
+        size_t token_begin = 0;
+        size_t token_end   = 0;
+        std::string token_copy;
+        bool is_copied = false;
 
-        std::string line;
         bool in_string          = false;
         bool was_in_string      = false;
         bool multi_line_comment = false;
 
-        std::vector<Token<std::string>> parsed_tokens;
-
-        while (std::getline(m_fs, line))
-        {
-            line_number++;
-            this->remove_comments(line, multi_line_comment);
+        std::vector<Token<std::string_view>> parsed_tokens;
 
-            for (char c : line)
+        const auto append_to_token = [&](size_t pos) {
+            if (token_begin == token_end && !is_copied)
+            {
+                token_begin = pos;
+                token_end   = pos + 1;
+            }
+            else if (!is_copied && token_end == pos)
             {
-                if (c == '\"')
+                token_end++;
+            }
+            else
+            {
+                if (!is_copied)
                 {
-                    was_in_string = true;
-                    in_string     = !in_string;
-                    continue;
+                    token_copy.assign(data.substr(token_begin, token_end - token_begin));
+                    is_copied = true;
                 }
+                token_copy += data[pos];
+            }
+        };
 
-                if (std::isspace(c) && !in_string)
-                {
-                    continue;
-                }
+        const auto has_token = [&]() { return is_copied || token_begin != token_end; };
+
+        const auto take_token = [&]() {
+            std::string_view token;
+            if (is_copied)
+            {
+                token = m_token_storage.emplace_back(std::move(token_copy));
+                token_copy.clear();
+                is_copied = false;
+            }
+            else
+            {
+                token = data.substr(token_begin, token_end - token_begin);
+            }
+            token_begin = token_end;
+            return token;
+        };
 
-                if (delimiters.find(c) == std::string::npos || in_string)
+        // skips the body of a group starting after the given opening brace and returns the position of the matching closing brace
+        const auto skip_group = [&](size_t pos) {
+            u32 level              = 1;
+            bool in_skipped_string = false;
+            while (++pos < data.size())
+            {
+                const char c = data[pos];
+                if (c == '\n')
                 {
-                    current_token += c;
+                    line_number++;
                 }
-                else
+                else if (multi_line_comment)
                 {
-                    if (was_in_string || !current_token.empty())
+                    if (c == '*' && pos + 1 < data.size() && data[pos + 1] == '/')
                     {
-                        parsed_tokens.emplace_back(line_number, current_token);
-                        current_token.clear();
-                        was_in_string = false;
+                        multi_line_comment = false;
+                        pos++;
                     }
+                }
+                else if (c == '/' && pos + 1 < data.size() && data[pos + 1] == '*')
+                {
+                    multi_line_comment = true;
+                    pos++;
+                }
+                else if (c == '\"')
+                {
+                    in_skipped_string = !in_skipped_string;
+                }
+                else if (!in_skipped_string && c == '{')
+                {
+                    level++;
+                }
+                else if (!in_skipped_string && c == '}' && --level == 0)
+                {
+                    break;
+                }
+            }
+            return pos;
+        };
 
-                    if (!std::isspace(c))
-                    {
-                        parsed_tokens.emplace_back(line_number, std::string(1, c));
-                    }
+        for (size_t pos = 0; pos < data.size(); pos++)
+        {
+            const char c = data[pos];
+
+            // tokens end at line breaks, even within strings
+            if (c == '\n')
+            {
+                if (has_token())
+                {
+                    parsed_tokens.emplace_back(line_number, take_token());
                 }
+                line_number++;
+                continue;
+            }
+
+            // comments are removed before strings are considered
+            if (multi_line_comment)
+            {
+                if (c == '*' && pos + 1 < data.size() && data[pos + 1] == '/')
+                {
+                    multi_line_comment = false;
+                    pos++;
+                }
+                continue;
+            }
+            if (c == '/' && pos + 1 < data.size() && data[pos + 1] == '*')
+            {
+                multi_line_comment = true;
+                pos++;
+                continue;
+            }
+
+            if (c == '\"')
+            {
+                was_in_string = true;
+                in_string     = !in_string;
+                continue;
+            }
+
+            if (in_string)
+            {
+                append_to_token(pos);
+                continue;
             }
-            if (!current_token.empty())
+
+            if (std::isspace(static_cast<unsigned char>(c)))
             {
-                parsed_tokens.emplace_back(line_number, current_token);
-                current_token.clear();
+                continue;
             }
+
+            if (delimiters.find(c) == std::string_view::npos)
+            {
+                append_to_token(pos);
+                continue;
+            }
+
+            if (was_in_string || has_token())
+            {
+                parsed_tokens.emplace_back(line_number, take_token());
+                was_in_string = false;
+            }
+
+            // drop groups that are never parsed, i.e., their header and their entire body
+            if (c == '{' && !parsed_tokens.empty() && parsed_tokens.back() == ")")
+            {
+                size_t header_begin = parsed_tokens.size() - 1;
+                while (header_begin > 0 && parsed_tokens.at(header_begin) != "(")
+                {
+                    header_begin--;
+                }
+                if (header_begin > 0 && parsed_groups.find(parsed_tokens.at(header_begin - 1).string) == parsed_groups.end())
+                {
+                    parsed_tokens.erase(parsed_tokens.begin() + (header_begin - 1), parsed_tokens.end());
+                    pos = skip_group(pos);
+                    continue;
+                }
+            }
+
+            parsed_tokens.emplace_back(line_number, data.substr(pos, 1));
+        }
+        if (has_token())
+        {
+            parsed_tokens.emplace_back(line_number, take_token());
         }
 
-        m_token_stream = TokenStream<std::string>(parsed_tokens, {"(", "{"}, {")", "}"});
+        m_token_stream = TokenStream(parsed_tokens, {"(", "{"}, {")", "}"});
     }
 
     Result<std::monostate> LibertyParser::parse_tokens()
@@ -120,10 +250,13 @@ namespace hal
         auto lib_name = m_token_stream.consume();
         m_token_stream.consume(")", true);
         m_token_stream.consume("{", true);
-        m_gate_lib       = std::make_unique<GateLibrary>(m_path, lib_name.string);
-        auto library_str = m_token_stream.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, false);
+        m_gate_lib       = std::make_unique<GateLibrary>(m_path, std::string(lib_name.string));
+        auto library_str = m_token_stream.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, false);
         m_token_stream.consume("}", false);
 
+        // (1) locate all cells, types are parsed right away as cells may depend on them
+        std::vector<cell_group> cells;
+        std::vector<TokenStream<std::string_view>> cell_streams;
         do
         {
             auto next_token = library_str.consume();
@@ -134,17 +267,15 @@ namespace hal
             }
             else if (next_token == "cell" && library_str.peek() == "(")
             {
-                if (auto cell = parse_cell(library_str); cell.is_error())
-                {
-                    return ERR_APPEND(cell.get_error(), "could not parse tokens: unable to parse cell (line " + std::to_string(next_token.number) + ")");
-                }
-                else
-                {
-                    if (auto res = construct_gate_type(cell.get()); res.is_error())
-                    {
-                        return ERR_APPEND(res.get_error(), "could not parse tokens: unable to construct gate type (line " + std::to_string(next_token.number) + ")");
-                    }
-                }
+                cell_group cell;
+                cell.line_number = library_str.peek().number;
+                library_str.consume("(", true);
+                cell.name = std::string(library_str.consume().string);
+                library_str.consume(")", true);
+                library_str.consume("{", true);
+                cell_streams.push_back(library_str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true));
+                library_str.consume("}", true);
+                cells.push_back(std::move(cell));
             }
             else if (next_token == "type" && library_str.peek() == "(")
             {
@@ -160,6 +291,63 @@ namespace hal
             }
         } while (library_str.remaining() > 0);
 
+        // (2) parse cells in parallel, they do not depend on each other
+        std::vector<std::optional<Result<std::monostate>>> results(cells.size());
+        std::vector<std::exception_ptr> exceptions(cells.size());
+
+#pragma omp parallel for schedule(dynamic)
+        for (i64 i = 0; i < (i64)cells.size(); i++)
+        {
+            try
+            {
+                results[i] = parse_cell(cell_streams[i], cells[i]);
+            }
+            catch (...)
+            {
+                exceptions[i] = std::current_exception();
+            }
+        }
+        cell_streams.clear();
+
+        // (3) parse all distinct functions of the cells in parallel
+        std::vector<std::string> functions;
+        for (u32 i = 0; i < cells.size(); i++)
+        {
+            if (exceptions.at(i) == nullptr && results.at(i).value().is_ok())
+            {
+                collect_functions(cells.at(i), functions);
+            }
+        }
+        cache_functions(std::move(functions));
+
+        // (4) construct gate types in the order of their definition
+        for (u32 i = 0; i < cells.size(); i++)
+        {
+            cell_group& cell = cells.at(i);
+
+            if (exceptions.at(i) != nullptr)
+            {
+                std::rethrow_exception(exceptions.at(i));
+            }
+
+            if (auto& res = results.at(i).value(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not parse tokens: unable to parse cell (line " + std::to_string(cell.line_number) + ")");
+            }
+
+            if (const auto cell_it = m_cell_names.find(cell.name); cell_it != m_cell_names.end())
+            {
+                return ERR("could not parse tokens: unable to parse cell '" + cell.name + "' (line " + std::to_string(cell.line_number) + "): a cell with that name already exists");
+            }
+            m_cell_names.insert(cell.name);
+
+            const u32 line_number = cell.line_number;
+            if (auto res = construct_gate_type(std::move(cell)); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not parse tokens: unable to construct gate type (line " + std::to_string(line_number) + ")");
+            }
+        }
+
         if (const u32 unparsed = m_token_stream.remaining(); unparsed == 0)
         {
             return OK({});
@@ -170,7 +358,7 @@ namespace hal
         }
     }
 
-    Result<LibertyParser::type_group> LibertyParser::parse_type(TokenStream<std::string>& str)
+    Result<LibertyParser::type_group> LibertyParser::parse_type(TokenStream<std::string_view>& str) const
     {
         type_group type;
         type.line_number = str.peek().number;
@@ -178,7 +366,7 @@ namespace hal
         type.name = str.consume().string;
         str.consume(")", true);
         str.consume("{", true);
-        auto type_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto type_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         type.start_index = 0;
@@ -205,12 +393,12 @@ namespace hal
             else if (next_token == "bit_width")
             {
                 type_str.consume(":", true);
-                type.width = std::stol(type_str.consume().string);
+                type.width = std::stol(std::string(type_str.consume().string));
             }
             else if (next_token == "bit_from")
             {
                 type_str.consume(":", true);
-                type.start_index = std::stol(type_str.consume().string);
+                type.start_index = std::stol(std::string(type_str.consume().string));
             }
             else if (next_token == "bit_to")
             {
@@ -230,37 +418,20 @@ namespace hal
                 }
                 else
                 {
-                    return ERR("could not parse type '" + type.name + "': invalid Boolean value '" + bval.string + "' (line " + std::to_string(bval.number) + ")");
+                    return ERR("could not parse type '" + type.name + "': invalid Boolean value '" + std::string(bval.string) + "' (line " + std::to_string(bval.number) + ")");
                 }
             }
             else
             {
-                return ERR("could not parse type '" + type.name + "': invalid token '" + next_token.string + "' (line " + std::to_string(next_token.number) + ")");
+                return ERR("could not parse type '" + type.name + "': invalid token '" + std::string(next_token.string) + "' (line " + std::to_string(next_token.number) + ")");
             }
             type_str.consume(";", true);
         }
         return OK(type);
     }
 
-    Result<LibertyParser::cell_group> LibertyParser::parse_cell(TokenStream<std::string>& str)
+    Result<std::monostate> LibertyParser::parse_cell(TokenStream<std::string_view>& cell_str, cell_group& cell) const
     {
-        cell_group cell;
-
-        cell.line_number = str.peek().number;
-        str.consume("(", true);
-        cell.name = str.consume().string;
-        str.consume(")", true);
-        str.consume("{", true);
-        auto cell_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
-        str.consume("}", true);
-
-        if (const auto cell_it = m_cell_names.find(cell.name); cell_it != m_cell_names.end())
-        {
-            return ERR("could not parse cell '" + cell.name + "': a cell with that name already exists");
-        }
-
-        m_cell_names.insert(cell.name);
-
         while (cell_str.remaining() > 0)
         {
             auto next_token = cell_str.consume();
@@ -327,19 +498,19 @@ namespace hal
             }
         }
 
-        return OK(cell);
+        return OK({});
     }
 
-    Result<LibertyParser::pin_group> LibertyParser::parse_pin(TokenStream<std::string>& str, cell_group& cell, PinDirection direction, const std::string& external_pin_name)
+    Result<LibertyParser::pin_group> LibertyParser::parse_pin(TokenStream<std::string_view>& str, cell_group& cell, PinDirection direction, const std::string& external_pin_name) const
     {
         pin_group pin;
 
         pin.line_number = str.peek().number;
         str.consume("(", true);
-        auto pin_names_str = str.extract_until(")", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto pin_names_str = str.extract_until(")", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume(")", true);
         str.consume("{", true);
-        auto pin_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto pin_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         if (pin_names_str.size() == 0)
@@ -349,7 +520,7 @@ namespace hal
 
         do
         {
-            std::string name = pin_names_str.consume().string;
+            std::string name(pin_names_str.consume().string);
             if (!external_pin_name.empty() && name != external_pin_name)
             {
                 return ERR("could not parse pin '" + name + "': pin name does not match external pin name '" + external_pin_name + "' (line " + std::to_string(pin.line_number) + ")");
@@ -359,9 +530,9 @@ namespace hal
             {
                 if (pin_names_str.peek(1) == ":")
                 {
-                    i32 start = std::stol(pin_names_str.consume().string);
+                    i32 start = std::stol(std::string(pin_names_str.consume().string));
                     pin_names_str.consume(":", true);
-                    i32 end = std::stol(pin_names_str.consume().string);
+                    i32 end = std::stol(std::string(pin_names_str.consume().string));
                     i32 dir = (start <= end) ? 1 : -1;
 
                     for (int i = start; i != (end + dir); i += dir)
@@ -379,7 +550,7 @@ namespace hal
                 }
                 else
                 {
-                    u32 index     = std::stoul(pin_names_str.consume().string);
+                    u32 index     = std::stoul(std::string(pin_names_str.consume().string));
                     auto new_name = name + "(" + std::to_string(index) + ")";
 
                     if (const auto pin_it = cell.pin_names.find(new_name); pin_it != cell.pin_names.end())
@@ -415,7 +586,7 @@ namespace hal
             if (next_token == "direction")
             {
                 pin_str.consume(":", true);
-                auto direction_str = pin_str.consume().string;
+                const std::string direction_str(pin_str.consume().string);
                 try
                 {
                     pin.direction = enum_from_string<PinDirection>(direction_str);
@@ -463,16 +634,16 @@ namespace hal
         return OK(pin);
     }
 
-    Result<LibertyParser::pin_group> LibertyParser::parse_pg_pin(TokenStream<std::string>& str, cell_group& cell)
+    Result<LibertyParser::pin_group> LibertyParser::parse_pg_pin(TokenStream<std::string_view>& str, cell_group& cell) const
     {
         pin_group pin;
 
         pin.line_number = str.peek().number;
         str.consume("(", true);
-        TokenStream<std::string> pin_names_str = str.extract_until(")", TokenStream<std::string>::END_OF_STREAM, true, true);
+        TokenStream<std::string_view> pin_names_str = str.extract_until(")", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume(")", true);
         str.consume("{", true);
-        TokenStream<std::string> pin_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        TokenStream<std::string_view> pin_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         if (pin_names_str.size() == 0)
@@ -484,7 +655,7 @@ namespace hal
             return ERR("could not parse power/ground pins '" + pin_names_str.join("").string + "': more than one pin name given (line " + std::to_string(pin.line_number) + ")");
         }
 
-        std::string name = pin_names_str.consume().string;
+        std::string name(pin_names_str.consume().string);
         if (const auto pin_it = cell.pin_names.find(name); pin_it != cell.pin_names.end())
         {
             return ERR("could not parse power/ground pin '" + name + "': a pin with that name already exists (line " + std::to_string(pin.line_number) + ")");
@@ -496,7 +667,7 @@ namespace hal
             if (next_token == "pg_type")
             {
                 pin_str.consume(":", true);
-                std::string type = pin_str.consume().string;
+                std::string type(pin_str.consume().string);
                 if (type == "primary_power")
                 {
                     pin.power = true;
@@ -520,7 +691,7 @@ namespace hal
         return OK(pin);
     }
 
-    Result<LibertyParser::bus_group> LibertyParser::parse_bus(TokenStream<std::string>& str, cell_group& cell)
+    Result<LibertyParser::bus_group> LibertyParser::parse_bus(TokenStream<std::string_view>& str, cell_group& cell) const
     {
         bus_group bus;
         std::vector<u32> range;
@@ -530,7 +701,7 @@ namespace hal
         bus.name = str.consume().string;
         str.consume(")", true);
         str.consume("{", true);
-        auto bus_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto bus_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         do
@@ -539,7 +710,7 @@ namespace hal
             if (next_token == "bus_type")
             {
                 bus_str.consume(":", true);
-                auto bus_type_str = bus_str.consume().string;
+                const std::string bus_type_str(bus_str.consume().string);
                 if (const auto& it = m_bus_types.find(bus_type_str); it == m_bus_types.end())
                 {
                     return ERR("could not parse bus '" + bus.name + "': invalid bus type '" + bus_type_str + "' (line " + std::to_string(bus.line_number) + ")");
@@ -560,7 +731,7 @@ namespace hal
             else if (next_token == "direction")
             {
                 bus_str.consume(":", true);
-                auto direction_str = bus_str.consume().string;
+                const std::string direction_str(bus_str.consume().string);
                 if (direction_str == "input")
                 {
                     bus.direction = PinDirection::input;
@@ -613,7 +784,7 @@ namespace hal
         return OK(bus);
     }
 
-    Result<LibertyParser::ff_group> LibertyParser::parse_ff(TokenStream<std::string>& str)
+    Result<LibertyParser::ff_group> LibertyParser::parse_ff(TokenStream<std::string_view>& str) const
     {
         ff_group ff;
 
@@ -624,7 +795,7 @@ namespace hal
         ff.state2 = str.consume().string;
         str.consume(")", true);
         str.consume("{", true);
-        auto ff_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto ff_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         do
@@ -657,10 +828,10 @@ namespace hal
             else if (next_token == "clear_preset_var1" || next_token == "clear_preset_var2")
             {
                 ff_str.consume(":", true);
-                Token<std::string> behav_str = ff_str.consume();
+                Token<std::string_view> behav_str = ff_str.consume();
                 ff_str.consume(";", true);
 
-                if (auto behav = enum_from_string<AsyncSetResetBehavior>(behav_str, AsyncSetResetBehavior::undef); behav != AsyncSetResetBehavior::undef)
+                if (auto behav = enum_from_string<AsyncSetResetBehavior>(std::string(behav_str.string), AsyncSetResetBehavior::undef); behav != AsyncSetResetBehavior::undef)
                 {
                     if (next_token == "clear_preset_var1")
                     {
@@ -673,7 +844,7 @@ namespace hal
                 }
                 else
                 {
-                    return ERR("could not parse 'ff' group: invalid clear_preset behavior '" + behav_str.string + "' (line " + std::to_string(behav_str.number) + ")");
+                    return ERR("could not parse 'ff' group: invalid clear_preset behavior '" + std::string(behav_str.string) + "' (line " + std::to_string(behav_str.number) + ")");
                 }
             }
         } while (ff_str.remaining() > 0);
@@ -681,7 +852,7 @@ namespace hal
         return OK(ff);
     }
 
-    Result<LibertyParser::latch_group> LibertyParser::parse_latch(TokenStream<std::string>& str)
+    Result<LibertyParser::latch_group> LibertyParser::parse_latch(TokenStream<std::string_view>& str) const
     {
         latch_group latch;
 
@@ -692,7 +863,7 @@ namespace hal
         latch.state2 = str.consume().string;
         str.consume(")", true);
         str.consume("{", true);
-        auto latch_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto latch_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         do
@@ -725,10 +896,10 @@ namespace hal
             else if (next_token == "clear_preset_var1" || next_token == "clear_preset_var2")
             {
                 latch_str.consume(":", true);
-                Token<std::string> behav_str = latch_str.consume();
+                Token<std::string_view> behav_str = latch_str.consume();
                 latch_str.consume(";", true);
 
-                if (auto behav = enum_from_string<AsyncSetResetBehavior>(behav_str, AsyncSetResetBehavior::undef); behav != AsyncSetResetBehavior::undef)
+                if (auto behav = enum_from_string<AsyncSetResetBehavior>(std::string(behav_str.string), AsyncSetResetBehavior::undef); behav != AsyncSetResetBehavior::undef)
                 {
                     if (next_token == "clear_preset_var1")
                     {
@@ -741,7 +912,7 @@ namespace hal
                 }
                 else
                 {
-                    return ERR("could not parse 'latch' group: invalid clear_preset behavior '" + behav_str.string + "' (line " + std::to_string(behav_str.number) + ")");
+                    return ERR("could not parse 'latch' group: invalid clear_preset behavior '" + std::string(behav_str.string) + "' (line " + std::to_string(behav_str.number) + ")");
                 }
             }
         } while (latch_str.remaining() > 0);
@@ -794,12 +965,12 @@ namespace hal
 
             std::unique_ptr<GateTypeComponent> state_component = GateTypeComponent::create_state_component(nullptr, cell.ff->state1, cell.ff->state2);
 
-            auto next_state_function = BooleanFunction::from_string(cell.ff->next_state);
+            auto next_state_function = parse_function(cell.ff->next_state);
             if (next_state_function.is_error())
             {
                 return ERR_APPEND(next_state_function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing 'next_state' function from string");
             }
-            auto clocked_on_function = BooleanFunction::from_string(cell.ff->clocked_on);
+            auto clocked_on_function = parse_function(cell.ff->clocked_on);
             if (clocked_on_function.is_error())
             {
                 return ERR_APPEND(next_state_function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing 'clocked_on' function from string");
@@ -809,7 +980,7 @@ namespace hal
             FFComponent* ff_component = parent_component->convert_to<FFComponent>();
             if (!cell.ff->clear.empty())
             {
-                auto clear_function = BooleanFunction::from_string(cell.ff->clear);
+                auto clear_function = parse_function(cell.ff->clear);
                 if (clear_function.is_error())
                 {
                     return ERR_APPEND(next_state_function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing 'clear' function from string");
@@ -818,7 +989,7 @@ namespace hal
             }
             if (!cell.ff->preset.empty())
             {
-                auto preset_function = BooleanFunction::from_string(cell.ff->preset);
+                auto preset_function = parse_function(cell.ff->preset);
                 if (preset_function.is_error())
                 {
                     return ERR_APPEND(next_state_function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing 'preset' function from string");
@@ -854,7 +1025,7 @@ namespace hal
 
             if (!cell.latch->data_in.empty())
             {
-                auto res = BooleanFunction::from_string(cell.latch->data_in);
+                auto res = parse_function(cell.latch->data_in);
                 if (res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not construct gate type '" + cell.name + "': failed parsing 'data_in' function from string");
@@ -863,7 +1034,7 @@ namespace hal
             }
             if (!cell.latch->enable.empty())
             {
-                auto res = BooleanFunction::from_string(cell.latch->enable);
+                auto res = parse_function(cell.latch->enable);
                 if (res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not construct gate type '" + cell.name + "': failed parsing 'enable' function from string");
@@ -872,7 +1043,7 @@ namespace hal
             }
             if (!cell.latch->clear.empty())
             {
-                auto res = BooleanFunction::from_string(cell.latch->clear);
+                auto res = parse_function(cell.latch->clear);
                 if (res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not construct gate type '" + cell.name + "': failed parsing 'clear' function from string");
@@ -881,7 +1052,7 @@ namespace hal
             }
             if (!cell.latch->preset.empty())
             {
-                auto res = BooleanFunction::from_string(cell.latch->preset);
+                auto res = parse_function(cell.latch->preset);
                 if (res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not construct gate type '" + cell.name + "': failed parsing 'preset' function from string");
@@ -974,7 +1145,7 @@ namespace hal
                 {
                     for (const auto& name : pin.pin_names)
                     {
-                        auto function = BooleanFunction::from_string(pin.function);
+                        auto function = parse_function(pin.function);
                         if (function.is_error())
                         {
                             return ERR_APPEND(function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing output function from string");
@@ -987,7 +1158,7 @@ namespace hal
                 {
                     for (const auto& name : pin.pin_names)
                     {
-                        auto function = BooleanFunction::from_string(pin.x_function);
+                        auto function = parse_function(pin.x_function);
                         if (function.is_error())
                         {
                             return ERR_APPEND(function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing undefined function from string");
@@ -1000,7 +1171,7 @@ namespace hal
                 {
                     for (const auto& name : pin.pin_names)
                     {
-                        auto function = BooleanFunction::from_string(pin.z_function);
+                        auto function = parse_function(pin.z_function);
                         if (function.is_error())
                         {
                             return ERR_APPEND(function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing tristate function from string");
@@ -1014,57 +1185,77 @@ namespace hal
         return OK({});
     }
 
-    void LibertyParser::remove_comments(std::string& line, bool& multi_line_comment)
+    void LibertyParser::collect_functions(const cell_group& cell, std::vector<std::string>& functions) const
     {
-        bool repeat = true;
-
-        while (repeat)
+        if (cell.ff.has_value())
         {
-            repeat = false;
+            functions.insert(functions.end(), {cell.ff->next_state, cell.ff->clocked_on, cell.ff->clear, cell.ff->preset});
+        }
+        if (cell.latch.has_value())
+        {
+            functions.insert(functions.end(), {cell.latch->data_in, cell.latch->enable, cell.latch->clear, cell.latch->preset});
+        }
 
-            // skip empty lines
-            if (line.empty())
+        // functions of cells with buses are only known after expanding the buses
+        if (cell.buses.empty())
+        {
+            for (const auto& pin : cell.pins)
             {
-                break;
+                functions.insert(functions.end(), {pin.function, pin.x_function, pin.z_function});
             }
-            auto multi_line_comment_begin = line.find("/*");
-            auto multi_line_comment_end   = line.find("*/");
-
-            std::string begin = "";
-            std::string end   = "";
+        }
+    }
 
-            if (multi_line_comment == true)
+    void LibertyParser::cache_functions(std::vector<std::string>&& functions)
+    {
+        std::sort(functions.begin(), functions.end());
+        functions.erase(std::unique(functions.begin(), functions.end()), functions.end());
+        functions.erase(std::remove_if(functions.begin(), functions.end(), [this](const std::string& f) { return f.empty() || m_function_cache.find(f) != m_function_cache.end(); }),
+                        functions.end());
+
+        std::vector<std::optional<BooleanFunction>> parsed_functions(functions.size());
+#pragma omp parallel for schedule(dynamic)
+        for (i64 i = 0; i < (i64)functions.size(); i++)
+        {
+            // exceptions must not escape the parallel region, the function is parsed again for the gate type that uses it
+            try
             {
-                if (multi_line_comment_end != std::string::npos)
-                {
-                    // multi-line comment ends in current line
-                    multi_line_comment = false;
-                    line               = line.substr(multi_line_comment_end + 2);
-                    repeat             = true;
-                }
-                else
+                if (auto res = BooleanFunction::from_string(functions[i]); res.is_ok())
                 {
-                    // current line entirely within multi-line comment
-                    line = "";
-                    break;
+                    parsed_functions[i] = res.get();
                 }
             }
-            else if (multi_line_comment_begin != std::string::npos)
+            catch (...)
             {
-                if (multi_line_comment_end != std::string::npos)
-                {
-                    // multi-line comment entirely in current line
-                    line   = line.substr(0, multi_line_comment_begin) + line.substr(multi_line_comment_end + 2);
-                    repeat = true;
-                }
-                else
-                {
-                    // multi-line comment starts in current line
-                    multi_line_comment = true;
-                    line               = line.substr(0, multi_line_comment_begin);
-                }
+                parsed_functions[i].reset();
             }
         }
+
+        // invalid functions are not cached, so that the error is reported for the gate type that uses them
+        for (u32 i = 0; i < functions.size(); i++)
+        {
+            if (parsed_functions.at(i).has_value())
+            {
+                m_function_cache.emplace(std::move(functions.at(i)), std::move(parsed_functions.at(i).value()));
+            }
+        }
+    }
+
+    Result<BooleanFunction> LibertyParser::parse_function(const std::string& function)
+    {
+        if (const auto it = m_function_cache.find(function); it != m_function_cache.end())
+        {
+            return OK(it->second);
+        }
+
+        if (auto res = BooleanFunction::from_string(function); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        else
+        {
+            return OK(m_function_cache.emplace(function, res.get()).first->second);
+        }
     }
 
     std::vector<std::string> LibertyParser::tokenize_function(const std::string& function)
@@ -1224,7 +1415,7 @@ namespace hal
                 {
                     for (auto [pin_name, function] : expand_bus_function(cell.buses, pin.pin_names, pin.function))
                     {
-                        auto bf = BooleanFunction::from_string(function);
+                        auto bf = parse_function(function);
                         if (bf.is_error())
                         {
                             return ERR_APPEND(bf.get_error(), "could not construct gate type '" + cell.name + "': failed parsing output function from string");
@@ -1237,7 +1428,7 @@ namespace hal
                 {
                     for (auto [pin_name, function] : expand_bus_function(cell.buses, pin.pin_names, pin.x_function))
                     {
-                        auto bf = BooleanFunction::from_string(function);
+                        auto bf = parse_function(function);
                         if (bf.is_error())
                         {
                             return ERR_APPEND(bf.get_error(), "could not construct gate type '" + cell.name + "': failed parsing undefined function from string");
@@ -1250,7 +1441,7 @@ namespace hal
                 {
                     for (auto [pin_name, function] : expand_bus_function(cell.buses, pin.pin_names, pin.z_function))
                     {
-                        auto bf = BooleanFunction::from_string(function);
+                        auto bf = parse_function(function);
                         if (bf.is_error())
                         {
                             return ERR_APPEND(bf.get_error(), "could not construct gate type '" + cell.name + "': failed parsing tristate function from string");
@@ -1269,7 +1460,7 @@ namespace hal
                 {
                     for (const auto& pin_name : pin.pin_names)
                     {
-                        auto bf = BooleanFunction::from_string(function);
+                        auto bf = parse_function(function);
                         if (bf.is_error())
                         {
                             return ERR_APPEND(bf.get_error(), "could not construct gate type '" + cell.name + "': failed parsing output function from string");
@@ -1285,7 +1476,7 @@ namespace hal
                 {
                     for (const auto& pin_name : pin.pin_names)
                     {
-                        auto bf = BooleanFunction::from_string(function);
+                        auto bf = parse_function(function);
                         if (bf.is_error())
                         {
                             return ERR_APPEND(bf.get_error(), "could not construct gate type '" + cell.name + "': failed parsing undefined function from string");
@@ -1301,7 +1492,7 @@ namespace hal
                 {
                     for (const auto& pin_name : pin.pin_names)
                     {
-                        auto bf = BooleanFunction::from_string(function);
+                        auto bf = parse_function(function);
                         if (bf.is_error())
                         {
                             return ERR_APPEND(bf.get_error(), "could not construct gate type '" + cell.name + "': failed parsing tristate function from string");
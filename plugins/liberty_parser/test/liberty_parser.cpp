@@ -12,9 +12,11 @@ namespace hal {
     protected:
         virtual void SetUp() {
             test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
         }
 
         virtual void TearDown() {
+            test_utils::remove_sandbox_directory();
         }
     };
 
@@ -481,4 +483,199 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing that groups that are not required to construct gate types (e.g., timing and power tables) are skipped, including braces within their strings and comments.
+     *
+     * Functions: parse
+     */
+    TEST_F(LibertyParserTest, check_skipped_groups) {
+        TEST_START
+            {
+                std::string lib_input("library (TEST_GATE_LIBRARY) {\n"
+                                      "    lu_table_template (delay_template_2x2) {\n"
+                                      "        variable_1 : input_net_transition;\n"
+                                      "        index_1 (\"0.1, 0.2\");\n"
+                                      "    }\n"
+                                      "    operating_conditions (typical) { process : 1; voltage : 1.2; }\n"
+                                      "    cell (TEST_AND) {\n"
+                                      "        area : 1;\n"
+                                      "        leakage_power () { when : \"!A\"; value : 0.1; }\n"
+                                      "        pin (A) { direction : input; capacitance : 0.1; }\n"
+                                      "        pin (B) {\n"
+                                      "            direction : input;\n"
+                                      "            internal_power () {\n"
+                                      "                rise_power (scalar) { values (\"0.1\"); }\n"
+                                      "            }\n"
+                                      "        }\n"
+                                      "        pin (O) {\n"
+                                      "            direction : output;\n"
+                                      "            function : \"(A & B)\";\n"
+                                      "            timing () {\n"
+                                      "                related_pin : \"A B\";\n"
+                                      "                /* { unbalanced brace in comment */\n"
+                                      "                cell_rise (delay_template_2x2) {\n"
+                                      "                    values (\"1.0, 2.0\", \\\n"
+                                      "                            \"3.0, } 4.0\");\n"
+                                      "                }\n"
+                                      "            }\n"
+                                      "        }\n"
+                                      "        test_cell () {\n"
+                                      "            pin (T) { direction : output; function : \"A\"; }\n"
+                                      "        }\n"
+                                      "    }\n"
+                                      "    cell (TEST_FF) {\n"
+                                      "        ff (IQ, IQN) { next_state : \"D\"; clocked_on : \"CLK\"; }\n"
+                                      "        pin (CLK) { direction : input; clock : true; }\n"
+                                      "        pin (D) {\n"
+                                      "            direction : input;\n"
+                                      "            timing () { timing_type : setup_rising; rise_constraint (scalar) { values (\"0.1\"); } }\n"
+                                      "        }\n"
+                                      "        pin (Q) { direction : output; function : \"IQ\"; }\n"
+                                      "    }\n"
+                                      "}\n");
+                auto path_lib = test_utils::create_sandbox_file("skipped_groups.lib", lib_input);
+                LibertyParser liberty_parser;
+                auto gl_res = liberty_parser.parse(path_lib);
+                ASSERT_TRUE(gl_res.is_ok());
+                std::unique_ptr<GateLibrary> gl = gl_res.get();
+                ASSERT_NE(gl, nullptr);
+
+                auto gate_types = gl->get_gate_types();
+                ASSERT_EQ(gate_types.size(), 2);
+
+                ASSERT_TRUE(gate_types.find("TEST_AND") != gate_types.end());
+                GateType* and_gt = gate_types.at("TEST_AND");
+                EXPECT_EQ(and_gt->get_pin_names(), std::vector<std::string>({"A", "B", "O"}));
+                EXPECT_EQ(and_gt->get_boolean_function("O"), BooleanFunction::from_string("(A & B)").get());
+                EXPECT_EQ(and_gt->get_boolean_functions().size(), 1);
+
+                ASSERT_TRUE(gate_types.find("TEST_FF") != gate_types.end());
+                GateType* ff_gt = gate_types.at("TEST_FF");
+                EXPECT_TRUE(ff_gt->has_property(GateTypeProperty::ff));
+                EXPECT_EQ(ff_gt->get_pin_names(), std::vector<std::string>({"CLK", "D", "Q"}));
+                EXPECT_EQ(ff_gt->get_pin_by_name("CLK")->get_type(), PinType::clock);
+                EXPECT_EQ(ff_gt->get_pin_by_name("Q")->get_type(), PinType::state);
+                FFComponent* ff_component = ff_gt->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
+                ASSERT_NE(ff_component, nullptr);
+                EXPECT_EQ(ff_component->get_next_state_function(), BooleanFunction::from_string("D").get());
+                EXPECT_EQ(ff_component->get_clock_function(), BooleanFunction::from_string("CLK").get());
+            }
+            {
+                // Unterminated group that would be skipped
+                NO_COUT_TEST_BLOCK;
+                std::string lib_input("library (TEST_GATE_LIBRARY) {\n"
+                                      "    cell (TEST_BUF) {\n"
+                                      "        pin (I) { direction : input; }\n"
+                                      "        pin (O) { direction : output; function : \"I\"; timing () { related_pin : \"I\";\n"
+                                      "    }\n"
+                                      "}\n");
+                auto path_lib = test_utils::create_sandbox_file("unterminated.lib", lib_input);
+                LibertyParser liberty_parser;
+                auto gl_res = liberty_parser.parse(path_lib);
+                ASSERT_TRUE(gl_res.is_error());
+            }
+            {
+                // Duplicate cells are reported even though cells are parsed in parallel
+                NO_COUT_TEST_BLOCK;
+                std::string lib_input("library (TEST_GATE_LIBRARY) {\n"
+                                      "    cell (TEST_BUF) { pin (I) { direction : input; } pin (O) { direction : output; function : \"I\"; } }\n"
+                                      "    cell (TEST_BUF) { pin (I) { direction : input; } pin (O) { direction : output; function : \"I\"; } }\n"
+                                      "}\n");
+                auto path_lib = test_utils::create_sandbox_file("duplicate.lib", lib_input);
+                LibertyParser liberty_parser;
+                auto gl_res = liberty_parser.parse(path_lib);
+                ASSERT_TRUE(gl_res.is_error());
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the parsing of a large synthetic library, in which most of the file consists of timing tables and most cells share their functions.
+     *
+     * Functions: parse
+     */
+    TEST_F(LibertyParserTest, check_large_library) {
+        TEST_START
+            {
+                const u32 num_cells = 2000;
+                std::string timing_table = "                cell_rise (delay_template_7x7) {\n"
+                                           "                    index_1 (\"0.01, 0.02, 0.04, 0.08, 0.16, 0.32, 0.64\");\n"
+                                           "                    index_2 (\"0.001, 0.002, 0.004, 0.008, 0.016, 0.032, 0.064\");\n"
+                                           "                    values ( \\\n";
+                for (u32 row = 0; row < 7; row++)
+                {
+                    timing_table += "                        \"0.011, 0.012, 0.013, 0.014, 0.015, 0.016, 0.017\"" + std::string((row < 6) ? ", \\\n" : " \\\n");
+                }
+                timing_table += "                    );\n"
+                                "                }\n";
+
+                std::stringstream lib_input;
+                lib_input << "library (LARGE_LIBRARY) {\n";
+                for (u32 i = 0; i < num_cells; i++)
+                {
+                    lib_input << "    cell (CELL_" << i << ") {\n"
+                              << "        area : " << i << ";\n";
+                    if (i % 10 == 9)
+                    {
+                        lib_input << "        ff (IQ, IQN) { next_state : \"D\"; clocked_on : \"CLK\"; clear : \"!RN\"; }\n"
+                                  << "        pin (CLK) { direction : input; clock : true; }\n"
+                                  << "        pin (D) { direction : input; }\n"
+                                  << "        pin (RN) { direction : input; }\n"
+                                  << "        pin (Q) {\n"
+                                  << "            direction : output;\n"
+                                  << "            function : \"IQ\";\n"
+                                  << "            timing () {\n"
+                                  << "                related_pin : \"CLK\";\n"
+                                  << timing_table << "            }\n"
+                                  << "        }\n";
+                    }
+                    else
+                    {
+                        lib_input << "        pin (A) { direction : input; }\n"
+                                  << "        pin (B) { direction : input; }\n"
+                                  << "        pin (C) { direction : input; }\n"
+                                  << "        pin (O) {\n"
+                                  << "            direction : output;\n"
+                                  << "            function : \"" << ((i % 2 == 0) ? "((A & B) | !C)" : "(A ^ (B & C))") << "\";\n"
+                                  << "            timing () {\n"
+                                  << "                related_pin : \"A\";\n"
+                                  << timing_table << "            }\n"
+                                  << "            timing () {\n"
+                                  << "                related_pin : \"B\";\n"
+                                  << timing_table << "            }\n"
+                                  << "        }\n";
+                    }
+                    lib_input << "    }\n";
+                }
+                lib_input << "}\n";
+
+                auto path_lib = test_utils::create_sandbox_file("large.lib", lib_input.str());
+                LibertyParser liberty_parser;
+                auto gl_res = liberty_parser.parse(path_lib);
+                ASSERT_TRUE(gl_res.is_ok());
+                std::unique_ptr<GateLibrary> gl = gl_res.get();
+                ASSERT_NE(gl, nullptr);
+
+                auto gate_types = gl->get_gate_types();
+                ASSERT_EQ(gate_types.size(), num_cells);
+
+                // gate types are created in the order of their definition
+                for (u32 i = 0; i < num_cells; i++)
+                {
+                    ASSERT_TRUE(gate_types.find("CELL_" + std::to_string(i)) != gate_types.end());
+                    EXPECT_EQ(gate_types.at("CELL_" + std::to_string(i))->get_id(), i + 1);
+                }
+
+                EXPECT_EQ(gate_types.at("CELL_0")->get_boolean_function("O"), BooleanFunction::from_string("((A & B) | !C)").get());
+                EXPECT_EQ(gate_types.at("CELL_1")->get_boolean_function("O"), BooleanFunction::from_string("(A ^ (B & C))").get());
+
+                GateType* ff_gt = gate_types.at("CELL_1999");
+                EXPECT_TRUE(ff_gt->has_property(GateTypeProperty::ff));
+                FFComponent* ff_component = ff_gt->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
+                ASSERT_NE(ff_component, nullptr);
+                EXPECT_EQ(ff_component->get_async_reset_function(), BooleanFunction::from_string("!RN").get());
+            }
+        TEST_END
+    }
+
 } //namespace hal
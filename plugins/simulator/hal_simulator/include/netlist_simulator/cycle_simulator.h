@@ -0,0 +1,251 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/enums/async_set_reset_behavior.h"
+#include "hal_core/netlist/net.h"
+#include "netlist_simulator_controller/simulation_engine.h"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    class SimulationInput;
+
+    /**
+     * Zero-delay, cycle-based simulation engine for synchronous designs.
+     *
+     * The combinational logic between flip-flops is levelized once and every gate function is compiled into a flat tape of 
+     * bitsliced programs operating on net-indexed value arrays. Each input event is processed by a single sweep over the tape, 
+     * followed by clocking all flip-flops at once and a second sweep propagating their new states.
+     * Every net holds a word of 64 lanes, such that 64 independent stimuli are advanced within the same sweep.
+     * Regular input values are broadcast to all lanes, lane specific input values override them for a single lane.
+     *
+     * RAM gates, latches, and combinational loops are not supported; use the event-driven `hal_simulator` engine for such designs.
+     */
+    class CycleSimulator : public SimulationEngineEventDriven
+    {
+        friend class CycleSimulatorFactory;
+
+    public:
+        /**
+         * Configure the sequential gates matching the (optional) user-defined filter condition with initialization data specified within the netlist.
+         * The actual configuration is applied during initialization of the simulator.
+         * This function can only be called before the simulation has started.
+         *
+         * @param[in] filter - The optional filter to be applied before initialization.
+         */
+        void initialize_sequential_gates(const std::function<bool(const Gate*)>& filter = nullptr);
+
+        /**
+         * Configure the sequential gates matching the (optional) user-defined filter condition with the specified value.
+         * The actual configuration is applied during initialization of the simulator.
+         * This function can only be called before the simulation has started.
+         *
+         * @param[in] value - The value to initialize the selected gates with.
+         * @param[in] filter - The optional filter to be applied before initialization.
+         */
+        void initialize_sequential_gates(BooleanFunction::Value value, const std::function<bool(const Gate*)>& filter = nullptr);
+
+        /**
+         * Initialize the simulation, i.e., levelize the combinational logic and compile all gate functions.
+         * No additional gates or clocks can be added after this point.
+         *
+         * @returns True on success, false if the simulation set contains unsupported gates or combinational loops.
+         */
+        bool initialize();
+
+        /**
+         * Set the signal for a specific input net. The value is applied at the beginning of the next call to `simulate`.
+         *
+         * @param[in] net - The net to set a signal value for.
+         * @param[in] value - The value to set.
+         */
+        void set_input(const Net* net, BooleanFunction::Value value);
+
+        /**
+         * Set the signal for a specific input net in a single lane. The value is applied at the beginning of the next call to `simulate`.
+         * From then on, the lane ignores values set for the net via `set_input`.
+         *
+         * @param[in] net - The net to set a signal value for.
+         * @param[in] lane - The lane, must be smaller than 64.
+         * @param[in] value - The value to set.
+         */
+        void set_lane_input(const Net* net, u32 lane, BooleanFunction::Value value);
+
+        /**
+         * Apply all pending input values, evaluate one sweep of the design at the current point in time, and advance the time afterwards.
+         * Automatically initializes the simulation if 'initialize' has not yet been called.
+         *
+         * @param[in] picoseconds - The duration to advance the time by.
+         * @returns True on success, false otherwise.
+         */
+        bool simulate(u64 picoseconds);
+
+        /**
+         * Reset the simulator state, i.e., treat all signals as unknown and discard all recorded events.
+         */
+        void reset();
+
+        /**
+         * Get the current value of a net.
+         *
+         * @param[in] net - The net.
+         * @returns The current value of the net.
+         */
+        BooleanFunction::Value get_net_value(const Net* net) const;
+
+        /**
+         * Get the current value of a net in a single lane.
+         *
+         * @param[in] net - The net.
+         * @param[in] lane - The lane, must be smaller than 64.
+         * @returns The current value of the net in the given lane.
+         */
+        BooleanFunction::Value get_net_value(const Net* net, u32 lane) const;
+
+        /**
+         * Get the number of levels of the levelized combinational logic.
+         *
+         * @returns The number of levels.
+         */
+        u32 get_num_levels() const;
+
+        /**
+         * Get vector of simulated events for net
+         *
+         * @param[in] netId - The ID of the net for which events where simulated
+         * @return Vector of events
+         */
+        std::vector<WaveEvent> get_simulation_events(u32 netId) const override;
+
+        /**
+         * Get the number of lanes simulated side by side.
+         *
+         * @returns The number of lanes, i.e., 64.
+         */
+        u32 get_num_lanes() const override;
+
+        /**
+         * Get vector of simulated events for net in a single lane
+         *
+         * @param[in] netId - The ID of the net for which events where simulated
+         * @param[in] lane - The lane, must be smaller than 64.
+         * @return Vector of events
+         */
+        std::vector<WaveEvent> get_lane_simulation_events(u32 netId, u32 lane) const override;
+
+        bool setSimulationInput(SimulationInput* simInput) override;
+
+        bool inputEvent(const SimulationInputNetEvent& netEv) override;
+
+    private:
+        /**
+         * 64 lanes of a net value in two-plane encoding, i.e., ZERO as (0,0), ONE as (1,0), X as (0,1), and Z as (1,1).
+         */
+        struct LaneWord
+        {
+            u64 value;
+            u64 unknown;
+        };
+
+        struct PendingInput
+        {
+            u32 net_index;
+            u64 lanes;
+            BooleanFunction::Value value;
+        };
+
+        struct CombinationalNode
+        {
+            CompiledBooleanFunction function;
+            std::vector<u32> inputs;
+            u32 output;
+        };
+
+        struct SequentialNode
+        {
+            const Gate* gate;
+            std::vector<u32> inputs;
+            CompiledBooleanFunction clock_function;
+            CompiledBooleanFunction next_state_function;
+            CompiledBooleanFunction preset_function;
+            CompiledBooleanFunction clear_function;
+            std::vector<u32> state_outputs;
+            std::vector<u32> inverted_state_outputs;
+            AsyncSetResetBehavior sr_behavior_out;
+            AsyncSetResetBehavior sr_behavior_out_inverted;
+            LaneWord state;
+            LaneWord inverted_state;
+            u64 previous_clock;
+        };
+
+        /* net index 0 is reserved for unconnected pins and always holds X */
+        static constexpr u32 unconnected_net = 0;
+
+        bool m_is_initialized = false;
+        std::vector<std::tuple<bool, BooleanFunction::Value, const std::function<bool(const Gate*)>>> m_init_seq_gates;
+
+        u64 m_current_time = 0;
+        u32 m_num_levels   = 0;
+
+        std::vector<const Net*> m_nets;
+        std::unordered_map<const Net*, u32> m_net_indices;
+        std::unordered_map<u32, u32> m_net_indices_by_id;
+        std::vector<LaneWord> m_values;
+        std::vector<CombinationalNode> m_combinational_tape;
+        std::vector<SequentialNode> m_sequential_nodes;
+        std::vector<u64> m_lane_overrides;
+        std::vector<PendingInput> m_pending_inputs;
+
+        /* value changes of all lanes per net, events of a single lane are extracted on request */
+        std::vector<std::vector<std::pair<u64, LaneWord>>> m_history;
+
+        CycleSimulator(const std::string& nam);
+
+        u32 get_net_index(const Net* net);
+        Result<CompiledBooleanFunction> compile_gate_function(const Gate* gate, const BooleanFunction& function, const std::vector<std::string>& input_pins) const;
+        LaneWord evaluate(const CompiledBooleanFunction& function, const std::vector<u32>& inputs) const;
+        void initialize_sequential_node(SequentialNode& node, bool from_netlist, BooleanFunction::Value value);
+        void propagate();
+        void clock();
+        void record_history();
+    };
+
+    class CycleSimulatorFactory : public SimulationEngineFactory
+    {
+    public:
+        CycleSimulatorFactory() : SimulationEngineFactory("hal_cycle_sim")
+        {
+            ;
+        }
+        SimulationEngine* createEngine() const override;
+    };
+}    // namespace hal
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/gate_library/enums/async_set_reset_behavior.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
@@ -194,6 +195,8 @@ namespace hal
             std::vector<GatePin*> m_output_pins;
             std::vector<const Net*> m_output_nets;
             std::unordered_map<const Net*, BooleanFunction> m_functions;
+            std::unordered_map<const Net*, CompiledBooleanFunction> m_compiled_functions;
+            std::vector<BooleanFunction::Value> m_input_vector;
 
             SimulationGateCombinational(const Gate* gate);
 
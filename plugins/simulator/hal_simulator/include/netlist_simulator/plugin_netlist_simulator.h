@@ -26,6 +26,7 @@
 #pragma once
 
 #include "hal_core/plugin_system/plugin_interface_base.h"
+#include "netlist_simulator/cycle_simulator.h"
 #include "netlist_simulator/netlist_simulator.h"
 #include <unordered_map>
 #include <memory>
@@ -35,6 +36,7 @@ namespace hal
     class PLUGIN_API NetlistSimulatorPlugin : public BasePluginInterface
     {
         static std::string s_engine_name;
+        static std::string s_cycle_engine_name;
 
     public:
         /**
@@ -58,7 +60,7 @@ namespace hal
         std::set<std::string> get_dependencies() const override;
 
         /**
-         * Creates instance and registers with NetlistSimulatorController
+         * Creates instances of the event-driven and the cycle-based engine factories and registers them with NetlistSimulatorController
          */
         void on_load() override;
 
@@ -1,5 +1,6 @@
 #include "hal_core/python_bindings/python_bindings.h"
 
+#include "netlist_simulator/cycle_simulator.h"
 #include "netlist_simulator/netlist_simulator.h"
 #include "netlist_simulator/plugin_netlist_simulator.h"
 #include "pybind11/operators.h"
@@ -188,6 +189,92 @@ namespace hal
                 :rtype: bool
             )");
 
+        py::class_<CycleSimulator>(m, "CycleSimulator")
+            .def("set_input", &CycleSimulator::set_input, py::arg("net"), py::arg("value"), R"(
+                Set the signal for a specific input net. The value is applied at the beginning of the next call to simulate.
+
+                :param hal_py.Net net: The net to set a signal value for.
+                :param hal_py.BooleanFunction.Value value: The value to set.
+            )")
+
+            .def("initialize_sequential_gates", py::overload_cast<const std::function<bool(const Gate*)>&>(&CycleSimulator::initialize_sequential_gates), py::arg("filter") = nullptr, R"(
+                Configure the sequential gates matching the (optional) user-defined filter condition with initialization data specified within the netlist.
+                The actual configuration is applied during initialization of the simulator.
+                This function can only be called before the simulation has started.
+
+                :param lambda filter: The optional filter to be applied before initialization.
+            )")
+
+            .def("initialize_sequential_gates", py::overload_cast<BooleanFunction::Value, const std::function<bool(const Gate*)>&>(&CycleSimulator::initialize_sequential_gates), py::arg("value"), py::arg("filter") = nullptr, R"(
+                Configure the sequential gates matching the (optional) user-defined filter condition with the specified value.
+                The actual configuration is applied during initialization of the simulator.
+                This function can only be called before the simulation has started.
+
+                :param hal_py.BooleanFunction.Value value: The value to initialize the selected gates with.
+                :param lambda filter: The optional filter to be applied before initialization.
+            )")
+
+            .def("initialize", &CycleSimulator::initialize, R"(
+                Initialize the simulation, i.e., levelize the combinational logic and compile all gate functions.
+                No additional gates or clocks can be added after this point.
+
+                :returns: True on success, False if the simulation set contains unsupported gates or combinational loops.
+                :rtype: bool
+            )")
+
+            .def("simulate", &CycleSimulator::simulate, py::arg("picoseconds"), R"(
+                Apply all pending input values, evaluate one sweep of the design at the current point in time, and advance the time afterwards.
+                Automatically initializes the simulation if 'initialize' has not yet been called.
+
+                :param int picoseconds: The duration to advance the time by.
+                :returns: True on success, False otherwise.
+                :rtype: bool
+            )")
+
+            .def("reset", &CycleSimulator::reset, R"(
+                Reset the simulator state, i.e., treat all signals as unknown and discard all recorded events.
+            )")
+
+            .def("set_lane_input", &CycleSimulator::set_lane_input, py::arg("net"), py::arg("lane"), py::arg("value"), R"(
+                Set the signal for a specific input net in a single lane. The value is applied at the beginning of the next call to simulate.
+                From then on, the lane ignores values set for the net via set_input.
+
+                :param hal_py.Net net: The net to set a signal value for.
+                :param int lane: The lane, must be smaller than 64.
+                :param hal_py.BooleanFunction.Value value: The value to set.
+            )")
+
+            .def("get_net_value", py::overload_cast<const Net*>(&CycleSimulator::get_net_value, py::const_), py::arg("net"), R"(
+                Get the current value of a net.
+
+                :param hal_py.Net net: The net.
+                :returns: The current value of the net.
+                :rtype: hal_py.BooleanFunction.Value
+            )")
+
+            .def("get_net_value", py::overload_cast<const Net*, u32>(&CycleSimulator::get_net_value, py::const_), py::arg("net"), py::arg("lane"), R"(
+                Get the current value of a net in a single lane.
+
+                :param hal_py.Net net: The net.
+                :param int lane: The lane, must be smaller than 64.
+                :returns: The current value of the net in the given lane.
+                :rtype: hal_py.BooleanFunction.Value
+            )")
+
+            .def("get_num_lanes", &CycleSimulator::get_num_lanes, R"(
+                Get the number of lanes simulated side by side.
+
+                :returns: The number of lanes, i.e., 64.
+                :rtype: int
+            )")
+
+            .def("get_num_levels", &CycleSimulator::get_num_levels, R"(
+                Get the number of levels of the levelized combinational logic.
+
+                :returns: The number of levels.
+                :rtype: int
+            )");
+
         py::class_<Simulation>(m, "Simulation")
             .def(py::init<>())
 
@@ -0,0 +1,701 @@
+#include "netlist_simulator/cycle_simulator.h"
+
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/log.h"
+#include "netlist_simulator_controller/simulation_input.h"
+
+#include <algorithm>
+#include <deque>
+
+namespace hal
+{
+    namespace
+    {
+        const u64 all_lanes = ~u64(0);
+
+        const u32 num_lanes = 64;
+
+        BooleanFunction::Value to_value(u64 value, u64 unknown, u32 lane)
+        {
+            if ((unknown >> lane) & 1)
+            {
+                return ((value >> lane) & 1) ? BooleanFunction::Value::Z : BooleanFunction::Value::X;
+            }
+            return ((value >> lane) & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
+        }
+    }    // namespace
+
+    CycleSimulator::CycleSimulator(const std::string& nam) : SimulationEngineEventDriven(nam)
+    {
+        // clock changes are passed as regular input events, every event triggers exactly one sweep
+        mRequireClockEvents = true;
+    }
+
+    void CycleSimulator::initialize_sequential_gates(const std::function<bool(const Gate*)>& filter)
+    {
+        if (m_is_initialized)
+        {
+            log_error("netlist_simulator", "cannot initialize sequential gates after the simulation was started.");
+            return;
+        }
+        m_init_seq_gates.push_back(std::make_tuple(true, BooleanFunction::Value::X, filter));
+    }
+
+    void CycleSimulator::initialize_sequential_gates(BooleanFunction::Value value, const std::function<bool(const Gate*)>& filter)
+    {
+        if (m_is_initialized)
+        {
+            log_error("netlist_simulator", "cannot initialize sequential gates after the simulation was started.");
+            return;
+        }
+        m_init_seq_gates.push_back(std::make_tuple(false, value, filter));
+    }
+
+    u32 CycleSimulator::get_net_index(const Net* net)
+    {
+        if (net == nullptr)
+        {
+            return unconnected_net;
+        }
+
+        if (const auto it = m_net_indices.find(net); it != m_net_indices.end())
+        {
+            return it->second;
+        }
+
+        const u32 index = m_nets.size();
+        m_nets.push_back(net);
+        m_net_indices[net]                   = index;
+        m_net_indices_by_id[net->get_id()] = index;
+        return index;
+    }
+
+    Result<CompiledBooleanFunction> CycleSimulator::compile_gate_function(const Gate* gate, const BooleanFunction& function, const std::vector<std::string>& input_pins) const
+    {
+        // missing functions, e.g., an unused asynchronous reset, are treated as constant zero
+        const BooleanFunction& source = function.is_empty() ? BooleanFunction::Const(0, 1) : function;
+
+        if (auto res = CompiledBooleanFunction::compile(source, input_pins); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(),
+                              "could not compile function '" + source.to_string() + "' of gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + " for cycle-based simulation");
+        }
+        else if (res.get().size() != 1)
+        {
+            return ERR("could not compile function '" + source.to_string() + "' of gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id())
+                       + " for cycle-based simulation: function does not evaluate to a single bit");
+        }
+        else
+        {
+            return res;
+        }
+    }
+
+    bool CycleSimulator::initialize()
+    {
+        m_is_initialized = false;
+        m_num_levels     = 0;
+        m_nets.clear();
+        m_net_indices.clear();
+        m_net_indices_by_id.clear();
+        m_combinational_tape.clear();
+        m_sequential_nodes.clear();
+
+        if (mSimulationInput == nullptr)
+        {
+            log_error("netlist_simulator", "no simulation input has been set.");
+            return false;
+        }
+
+        m_nets.push_back(nullptr);
+
+        // process gates ordered by ID to keep the simulation deterministic
+        std::vector<const Gate*> gates(mSimulationInput->get_gates().begin(), mSimulationInput->get_gates().end());
+        std::sort(gates.begin(), gates.end(), [](const Gate* a, const Gate* b) { return a->get_id() < b->get_id(); });
+
+        std::vector<CombinationalNode> combinational_nodes;
+        for (const Gate* gate : gates)
+        {
+            const GateType* gate_type = gate->get_type();
+
+            std::vector<std::string> input_pin_names;
+            std::vector<u32> input_indices;
+            for (const GatePin* pin : gate_type->get_input_pins())
+            {
+                input_pin_names.push_back(pin->get_name());
+                input_indices.push_back(get_net_index(gate->get_fan_in_net(pin)));
+            }
+
+            if (gate_type->has_property(GateTypeProperty::ff))
+            {
+                const FFComponent* ff_component = gate_type->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
+                if (ff_component == nullptr)
+                {
+                    log_error("netlist_simulator", "cannot find flip-flop component of gate '{}' with ID {} of type '{}'.", gate->get_name(), gate->get_id(), gate_type->get_name());
+                    return false;
+                }
+
+                auto clock_res      = compile_gate_function(gate, ff_component->get_clock_function(), input_pin_names);
+                auto next_state_res = compile_gate_function(gate, ff_component->get_next_state_function(), input_pin_names);
+                auto preset_res     = compile_gate_function(gate, ff_component->get_async_set_function(), input_pin_names);
+                auto clear_res      = compile_gate_function(gate, ff_component->get_async_reset_function(), input_pin_names);
+                for (const auto* res : {&clock_res, &next_state_res, &preset_res, &clear_res})
+                {
+                    if (res->is_error())
+                    {
+                        log_error("netlist_simulator", "{}", res->get_error().get());
+                        return false;
+                    }
+                }
+
+                std::vector<u32> state_outputs;
+                std::vector<u32> inverted_state_outputs;
+                for (const GatePin* pin : gate_type->get_output_pins())
+                {
+                    const Net* net = gate->get_fan_out_net(pin);
+                    if (net == nullptr)
+                    {
+                        continue;
+                    }
+                    if (pin->get_type() == PinType::state)
+                    {
+                        state_outputs.push_back(get_net_index(net));
+                    }
+                    else if (pin->get_type() == PinType::neg_state)
+                    {
+                        inverted_state_outputs.push_back(get_net_index(net));
+                    }
+                }
+
+                const auto behavior = ff_component->get_async_set_reset_behavior();
+                m_sequential_nodes.push_back(SequentialNode{gate,
+                                                            input_indices,
+                                                            clock_res.get(),
+                                                            next_state_res.get(),
+                                                            preset_res.get(),
+                                                            clear_res.get(),
+                                                            state_outputs,
+                                                            inverted_state_outputs,
+                                                            behavior.first,
+                                                            behavior.second,
+                                                            LaneWord{0, all_lanes},
+                                                            LaneWord{0, all_lanes},
+                                                            0});
+            }
+            else if (gate_type->has_property(GateTypeProperty::combinational))
+            {
+                std::unordered_map<std::string, BooleanFunction> functions = gate->get_boolean_functions();
+
+                const std::vector<GatePin*> output_pins = gate_type->get_output_pins();
+                for (const GatePin* pin : output_pins)
+                {
+                    const Net* out_net = gate->get_fan_out_net(pin);
+                    if (out_net == nullptr)
+                    {
+                        continue;
+                    }
+
+                    auto func_it = functions.find(pin->get_name());
+                    if (func_it == functions.end())
+                    {
+                        log_error("netlist_simulator", "no function for output pin '{}' of gate '{}' with ID {} of type '{}'.", pin->get_name(), gate->get_name(), gate->get_id(), gate_type->get_name());
+                        return false;
+                    }
+
+                    // resolve recursion within output functions
+                    BooleanFunction func = func_it->second;
+                    while (true)
+                    {
+                        auto vars = func.get_variable_names();
+                        bool exit = true;
+                        for (const GatePin* other_pin : output_pins)
+                        {
+                            if (const std::string& other_pin_name = other_pin->get_name(); vars.find(other_pin_name) != vars.end() && functions.find(other_pin_name) != functions.end())
+                            {
+                                func = func.substitute(other_pin_name, functions.at(other_pin_name)).get();
+                                exit = false;
+                            }
+                        }
+                        if (exit)
+                        {
+                            break;
+                        }
+                    }
+
+                    auto compiled_res = compile_gate_function(gate, func, input_pin_names);
+                    if (compiled_res.is_error())
+                    {
+                        log_error("netlist_simulator", "{}", compiled_res.get_error().get());
+                        return false;
+                    }
+
+                    combinational_nodes.push_back(CombinationalNode{compiled_res.get(), input_indices, get_net_index(out_net)});
+                }
+            }
+            else
+            {
+                log_error("netlist_simulator",
+                          "cycle-based simulation does not support gate type '{}' of gate '{}' with ID {}, use the event-driven engine instead.",
+                          gate_type->get_name(),
+                          gate->get_name(),
+                          gate->get_id());
+                return false;
+            }
+        }
+
+        for (const Net* net : mSimulationInput->get_input_nets())
+        {
+            get_net_index(net);
+        }
+
+        // levelize the combinational logic, i.e., order the nodes such that every node is evaluated after all nodes driving its inputs
+        std::vector<std::vector<u32>> driven_by(m_nets.size());
+        for (u32 node_index = 0; node_index < combinational_nodes.size(); node_index++)
+        {
+            driven_by[combinational_nodes[node_index].output].push_back(node_index);
+        }
+
+        std::vector<u32> num_pending(combinational_nodes.size(), 0);
+        std::vector<std::vector<u32>> successors(combinational_nodes.size());
+        for (u32 node_index = 0; node_index < combinational_nodes.size(); node_index++)
+        {
+            for (u32 input : combinational_nodes[node_index].inputs)
+            {
+                for (u32 driver : driven_by[input])
+                {
+                    successors[driver].push_back(node_index);
+                    num_pending[node_index]++;
+                }
+            }
+        }
+
+        std::vector<u32> levels(combinational_nodes.size(), 0);
+        std::deque<u32> queue;
+        for (u32 node_index = 0; node_index < combinational_nodes.size(); node_index++)
+        {
+            if (num_pending[node_index] == 0)
+            {
+                queue.push_back(node_index);
+            }
+        }
+
+        std::vector<u32> order;
+        order.reserve(combinational_nodes.size());
+        while (!queue.empty())
+        {
+            const u32 node_index = queue.front();
+            queue.pop_front();
+            order.push_back(node_index);
+            m_num_levels = std::max(m_num_levels, levels[node_index] + 1);
+
+            for (u32 successor : successors[node_index])
+            {
+                levels[successor] = std::max(levels[successor], levels[node_index] + 1);
+                if (--num_pending[successor] == 0)
+                {
+                    queue.push_back(successor);
+                }
+            }
+        }
+
+        if (order.size() != combinational_nodes.size())
+        {
+            log_error("netlist_simulator", "cycle-based simulation does not support combinational loops, use the event-driven engine instead.");
+            return false;
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&levels](u32 a, u32 b) { return levels[a] < levels[b]; });
+        m_combinational_tape.reserve(order.size());
+        for (u32 node_index : order)
+        {
+            m_combinational_tape.push_back(std::move(combinational_nodes[node_index]));
+        }
+
+        // all nets start as unknown
+        m_values.assign(m_nets.size(), LaneWord{0, all_lanes});
+        m_lane_overrides.assign(m_nets.size(), 0);
+        m_history.assign(m_nets.size(), {});
+        m_pending_inputs.clear();
+
+        for (auto& node : m_sequential_nodes)
+        {
+            for (const auto& [from_netlist, value, filter] : m_init_seq_gates)
+            {
+                if (!filter || filter(node.gate))
+                {
+                    initialize_sequential_node(node, from_netlist, value);
+                }
+            }
+            for (u32 output : node.state_outputs)
+            {
+                m_values[output] = node.state;
+            }
+            for (u32 output : node.inverted_state_outputs)
+            {
+                m_values[output] = node.inverted_state;
+            }
+        }
+
+        log_info("netlist_simulator", "levelized {} combinational functions into {} levels between {} flip-flops.", m_combinational_tape.size(), m_num_levels, m_sequential_nodes.size());
+
+        m_is_initialized = true;
+        return true;
+    }
+
+    void CycleSimulator::initialize_sequential_node(SequentialNode& node, bool from_netlist, BooleanFunction::Value value)
+    {
+        if (from_netlist)
+        {
+            const GateType* gate_type           = node.gate->get_type();
+            const InitComponent* init_component = gate_type->get_component_as<InitComponent>([](const GateTypeComponent* c) { return InitComponent::is_class_of(c); });
+            if (init_component == nullptr || init_component->get_init_identifiers().empty())
+            {
+                log_error("netlist_simulator", "cannot find initialization data for flip-flop '{}' with ID {} of type '{}'.", node.gate->get_name(), node.gate->get_id(), gate_type->get_name());
+                return;
+            }
+
+            const std::string init_str = std::get<1>(node.gate->get_data(init_component->get_init_category(), init_component->get_init_identifiers().front()));
+            if (init_str.empty())
+            {
+                return;
+            }
+
+            value = BooleanFunction::Value::X;
+            if (init_str == "1")
+            {
+                value = BooleanFunction::Value::ONE;
+            }
+            else if (init_str == "0")
+            {
+                value = BooleanFunction::Value::ZERO;
+            }
+            else
+            {
+                log_error("netlist_simulator", "init value of flip-flop '{}' with ID {} of type '{}' is neither '1' or '0'.", node.gate->get_name(), node.gate->get_id(), gate_type->get_name());
+            }
+        }
+
+        const u64 v = (value == BooleanFunction::Value::ONE || value == BooleanFunction::Value::Z) ? all_lanes : 0;
+        const u64 u = (value == BooleanFunction::Value::X || value == BooleanFunction::Value::Z) ? all_lanes : 0;
+
+        node.state          = LaneWord{v, u};
+        node.inverted_state = LaneWord{v ^ ~u, u};
+    }
+
+    CycleSimulator::LaneWord CycleSimulator::evaluate(const CompiledBooleanFunction& function, const std::vector<u32>& inputs) const
+    {
+        thread_local std::vector<u64> values, unknowns, output_values, output_unknowns;
+
+        values.resize(inputs.size());
+        unknowns.resize(inputs.size());
+        for (u32 i = 0; i < inputs.size(); i++)
+        {
+            const LaneWord& word = m_values[inputs[i]];
+            values[i]            = word.value;
+            unknowns[i]          = word.unknown;
+        }
+
+        if (function.evaluate(values, unknowns, output_values, output_unknowns).is_error())
+        {
+            return LaneWord{0, all_lanes};
+        }
+        return LaneWord{output_values.front(), output_unknowns.front()};
+    }
+
+    void CycleSimulator::propagate()
+    {
+        for (const auto& node : m_combinational_tape)
+        {
+            m_values[node.output] = evaluate(node.function, node.inputs);
+        }
+    }
+
+    void CycleSimulator::clock()
+    {
+        const auto select = [](u64 mask, const LaneWord& a, const LaneWord& b) -> LaneWord { return LaneWord{(a.value & mask) | (b.value & ~mask), (a.unknown & mask) | (b.unknown & ~mask)}; };
+        const auto toggle = [](const LaneWord& a) -> LaneWord { return LaneWord{a.value ^ ~a.unknown, a.unknown}; };
+        const auto behave = [&toggle](AsyncSetResetBehavior behavior, const LaneWord& previous) -> LaneWord {
+            switch (behavior)
+            {
+                case AsyncSetResetBehavior::L:
+                    return LaneWord{0, 0};
+                case AsyncSetResetBehavior::H:
+                    return LaneWord{all_lanes, 0};
+                case AsyncSetResetBehavior::N:
+                    return previous;
+                case AsyncSetResetBehavior::T:
+                    return toggle(previous);
+                default:
+                    return LaneWord{0, all_lanes};
+            }
+        };
+
+        // compute all new states before committing any of them, all flip-flops are clocked simultaneously
+        std::vector<std::pair<LaneWord, LaneWord>> new_states;
+        new_states.reserve(m_sequential_nodes.size());
+        for (auto& node : m_sequential_nodes)
+        {
+            LaneWord state          = node.state;
+            LaneWord inverted_state = node.inverted_state;
+
+            const LaneWord clock = evaluate(node.clock_function, node.inputs);
+            const u64 clock_one  = clock.value & ~clock.unknown;
+            const u64 edge       = clock_one & ~node.previous_clock;
+            node.previous_clock  = clock_one;
+
+            if (edge != 0)
+            {
+                const LaneWord next_state = evaluate(node.next_state_function, node.inputs);
+                state                     = select(edge, next_state, state);
+                inverted_state            = select(edge, toggle(next_state), inverted_state);
+            }
+
+            // asynchronous set and reset take precedence over the clock
+            const LaneWord preset = evaluate(node.preset_function, node.inputs);
+            const LaneWord clear  = evaluate(node.clear_function, node.inputs);
+            const u64 preset_one  = preset.value & ~preset.unknown;
+            const u64 clear_one   = clear.value & ~clear.unknown;
+            if ((preset_one | clear_one) != 0)
+            {
+                const u64 both = preset_one & clear_one;
+                state          = select(preset_one & ~clear_one, LaneWord{all_lanes, 0}, state);
+                state          = select(clear_one & ~preset_one, LaneWord{0, 0}, state);
+                state          = select(both, behave(node.sr_behavior_out, node.state), state);
+                inverted_state = select(preset_one & ~clear_one, LaneWord{0, 0}, inverted_state);
+                inverted_state = select(clear_one & ~preset_one, LaneWord{all_lanes, 0}, inverted_state);
+                inverted_state = select(both, behave(node.sr_behavior_out_inverted, node.inverted_state), inverted_state);
+            }
+
+            new_states.emplace_back(state, inverted_state);
+        }
+
+        for (u32 i = 0; i < m_sequential_nodes.size(); i++)
+        {
+            auto& node          = m_sequential_nodes[i];
+            node.state          = new_states[i].first;
+            node.inverted_state = new_states[i].second;
+            for (u32 output : node.state_outputs)
+            {
+                m_values[output] = node.state;
+            }
+            for (u32 output : node.inverted_state_outputs)
+            {
+                m_values[output] = node.inverted_state;
+            }
+        }
+    }
+
+    void CycleSimulator::record_history()
+    {
+        for (u32 index = 1; index < m_nets.size(); index++)
+        {
+            const LaneWord& word                           = m_values[index];
+            std::vector<std::pair<u64, LaneWord>>& history = m_history[index];
+
+            if (!history.empty())
+            {
+                const LaneWord& last = history.back().second;
+                if (last.value == word.value && last.unknown == word.unknown)
+                {
+                    continue;
+                }
+                if (history.back().first == m_current_time)
+                {
+                    history.back().second = word;
+                    continue;
+                }
+            }
+
+            history.emplace_back(m_current_time, word);
+        }
+    }
+
+    void CycleSimulator::set_input(const Net* net, BooleanFunction::Value value)
+    {
+        if (net == nullptr)
+        {
+            log_error("netlist_simulator", "net is a nullptr.");
+            return;
+        }
+
+        if (!m_is_initialized && !initialize())
+        {
+            return;
+        }
+
+        const auto it = m_net_indices.find(net);
+        if (it == m_net_indices.end())
+        {
+            log_warning("netlist_simulator", "net '{}' with ID {} is not part of the simulation, ignoring input value.", net->get_name(), net->get_id());
+            return;
+        }
+
+        m_pending_inputs.push_back(PendingInput{it->second, 0, value});
+    }
+
+    void CycleSimulator::set_lane_input(const Net* net, u32 lane, BooleanFunction::Value value)
+    {
+        if (net == nullptr)
+        {
+            log_error("netlist_simulator", "net is a nullptr.");
+            return;
+        }
+
+        if (lane >= num_lanes)
+        {
+            log_error("netlist_simulator", "lane {} exceeds the number of lanes {}.", lane, num_lanes);
+            return;
+        }
+
+        if (!m_is_initialized && !initialize())
+        {
+            return;
+        }
+
+        const auto it = m_net_indices.find(net);
+        if (it == m_net_indices.end())
+        {
+            log_warning("netlist_simulator", "net '{}' with ID {} is not part of the simulation, ignoring input value.", net->get_name(), net->get_id());
+            return;
+        }
+
+        m_pending_inputs.push_back(PendingInput{it->second, u64(1) << lane, value});
+    }
+
+    bool CycleSimulator::simulate(u64 picoseconds)
+    {
+        if (!m_is_initialized && !initialize())
+        {
+            return false;
+        }
+
+        for (const auto& input : m_pending_inputs)
+        {
+            // regular inputs are broadcast to all lanes that have not been assigned a lane specific value
+            u64 lanes = input.lanes;
+            if (lanes == 0)
+            {
+                lanes = ~m_lane_overrides[input.net_index];
+            }
+            else
+            {
+                m_lane_overrides[input.net_index] |= lanes;
+            }
+
+            const u64 v    = (input.value == BooleanFunction::Value::ONE || input.value == BooleanFunction::Value::Z) ? all_lanes : 0;
+            const u64 u    = (input.value == BooleanFunction::Value::X || input.value == BooleanFunction::Value::Z) ? all_lanes : 0;
+            LaneWord& word = m_values[input.net_index];
+            word.value     = (word.value & ~lanes) | (v & lanes);
+            word.unknown   = (word.unknown & ~lanes) | (u & lanes);
+        }
+        m_pending_inputs.clear();
+
+        propagate();
+        if (!m_sequential_nodes.empty())
+        {
+            clock();
+            propagate();
+        }
+        record_history();
+
+        m_current_time += picoseconds;
+        return true;
+    }
+
+    void CycleSimulator::reset()
+    {
+        m_current_time = 0;
+        m_pending_inputs.clear();
+        m_lane_overrides.assign(m_nets.size(), 0);
+        m_history.assign(m_nets.size(), {});
+        m_is_initialized = false;
+    }
+
+    BooleanFunction::Value CycleSimulator::get_net_value(const Net* net) const
+    {
+        if (const auto it = m_net_indices.find(net); it != m_net_indices.end())
+        {
+            return to_value(m_values[it->second].value, m_values[it->second].unknown, 0);
+        }
+        return BooleanFunction::Value::X;
+    }
+
+    BooleanFunction::Value CycleSimulator::get_net_value(const Net* net, u32 lane) const
+    {
+        if (const auto it = m_net_indices.find(net); it != m_net_indices.end() && lane < num_lanes)
+        {
+            return to_value(m_values[it->second].value, m_values[it->second].unknown, lane);
+        }
+        return BooleanFunction::Value::X;
+    }
+
+    u32 CycleSimulator::get_num_levels() const
+    {
+        return m_num_levels;
+    }
+
+    std::vector<WaveEvent> CycleSimulator::get_simulation_events(u32 netId) const
+    {
+        return get_lane_simulation_events(netId, 0);
+    }
+
+    u32 CycleSimulator::get_num_lanes() const
+    {
+        return num_lanes;
+    }
+
+    std::vector<WaveEvent> CycleSimulator::get_lane_simulation_events(u32 netId, u32 lane) const
+    {
+        std::vector<WaveEvent> events;
+
+        const auto it = m_net_indices_by_id.find(netId);
+        if (it == m_net_indices_by_id.end() || lane >= num_lanes)
+        {
+            return events;
+        }
+
+        for (const auto& [time, word] : m_history[it->second])
+        {
+            const BooleanFunction::Value value = to_value(word.value, word.unknown, lane);
+            if (!events.empty() && events.back().new_value == value)
+            {
+                continue;
+            }
+
+            WaveEvent e;
+            e.affected_net = m_nets[it->second];
+            e.new_value    = value;
+            e.time         = time;
+            e.id           = events.size();
+            events.push_back(e);
+        }
+        return events;
+    }
+
+    bool CycleSimulator::setSimulationInput(SimulationInput* simInput)
+    {
+        mSimulationInput = simInput;
+        return initialize();
+    }
+
+    bool CycleSimulator::inputEvent(const SimulationInputNetEvent& netEv)
+    {
+        for (auto it = netEv.begin(); it != netEv.end(); ++it)
+        {
+            set_input(it->first, it->second);
+        }
+        for (const SimulationInputLaneValue& lv : netEv.get_lane_values())
+        {
+            set_lane_input(lv.net, lv.lane, lv.value);
+        }
+        return simulate(netEv.get_simulation_duration());
+    }
+
+    SimulationEngine* CycleSimulatorFactory::createEngine() const
+    {
+        return new CycleSimulator(mName);
+    }
+}    // namespace hal
@@ -4,6 +4,7 @@
 namespace hal
 {
     std::string NetlistSimulatorPlugin::s_engine_name;
+    std::string NetlistSimulatorPlugin::s_cycle_engine_name;
 
     extern std::unique_ptr<BasePluginInterface> create_plugin_instance()
     {
@@ -30,11 +31,13 @@ namespace hal
     void NetlistSimulatorPlugin::on_load()
     {
         // constructor will register with controller
-        s_engine_name = (new NetlistSimulatorFactory)->name();
+        s_engine_name       = (new NetlistSimulatorFactory)->name();
+        s_cycle_engine_name = (new CycleSimulatorFactory)->name();
     }
 
     void NetlistSimulatorPlugin::on_unload()
     {
         SimulationEngineFactories::instance()->deleteFactory(s_engine_name);
+        SimulationEngineFactories::instance()->deleteFactory(s_cycle_engine_name);
     }
 }
@@ -32,8 +32,22 @@ namespace hal
                     break;
                 }
             }
+
+            // compile the function once so that it can be evaluated without traversing the expression tree
+            std::vector<std::string> input_pin_names;
+            for (const GatePin* pin : m_input_pins)
+            {
+                input_pin_names.push_back(pin->get_name());
+            }
+            if (auto res = CompiledBooleanFunction::compile(func, input_pin_names); res.is_ok() && res.get().get_num_inputs() == m_input_pins.size())
+            {
+                m_compiled_functions.emplace(out_net, res.get());
+            }
+
             m_functions.emplace(out_net, func);
         }
+
+        m_input_vector.resize(m_input_pins.size(), BooleanFunction::Value::X);
     }
 
     bool NetlistSimulator::SimulationGateCombinational::simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
@@ -43,9 +57,25 @@ namespace hal
         // compute delay, currently just a placeholder
         u64 delay = 0;
 
+        if (!m_compiled_functions.empty())
+        {
+            for (u32 i = 0; i < m_input_pins.size(); i++)
+            {
+                m_input_vector[i] = m_input_values.at(m_input_pins[i]->get_name());
+            }
+        }
+
         for (auto out_net : m_output_nets)
         {
-            BooleanFunction::Value result = m_functions[out_net].evaluate(m_input_values).get();
+            BooleanFunction::Value result;
+            if (const auto it = m_compiled_functions.find(out_net); it != m_compiled_functions.end())
+            {
+                result = it->second.evaluate(m_input_vector).get().front();
+            }
+            else
+            {
+                result = m_functions[out_net].evaluate(m_input_values).get();
+            }
 
             new_events[std::make_pair(out_net, event.time + delay)] = result;
         }
@@ -193,6 +193,72 @@ public:
      */
     void reset();
 
+    /**
+     * Get the number of independent stimuli (lanes) the simulation engine advances side by side.
+     *
+     * @returns The number of lanes, 1 if no engine has been created or the engine does not support multi-lane simulation.
+     */
+    u32 get_num_lanes() const;
+
+    /**
+     * Set the signal for a specific wire in a single lane of a multi-lane simulation.
+     * Once a lane value has been assigned, the lane ignores the regular input waveform of that net set by 'set_input' or imported from file.
+     *
+     * @param[in] lane - The lane, must be smaller than 'get_num_lanes'.
+     * @param[in] net - The net to set a signal value for.
+     * @param[in] value - The value to set.
+     */
+    void set_lane_input(u32 lane, const Net* net, BooleanFunction::Value value);
+
+    /**
+     * Set the signal for a specific wire in several lanes of a multi-lane simulation at once.
+     * The i-th value is assigned to lane i.
+     *
+     * @param[in] net - The net to set signal values for.
+     * @param[in] values - The values to set, at most 'get_num_lanes' values.
+     */
+    void set_lane_inputs(const Net* net, const std::vector<BooleanFunction::Value>& values);
+
+    /**
+     * Import input waveforms for a single lane of a multi-lane simulation from VCD file.
+     * Only the time span already covered by the regular input waveforms is simulated.
+     *
+     * @param[in] lane - The lane, must be smaller than 'get_num_lanes'.
+     * @param[in] filename - The filename to read.
+     * @returns True on success, false otherwise.
+     */
+    bool import_lane_vcd(u32 lane, const std::string& filename);
+
+    /**
+     * Import input waveforms for a single lane of a multi-lane simulation from CSV file.
+     * Only the time span already covered by the regular input waveforms is simulated.
+     *
+     * @param[in] lane - The lane, must be smaller than 'get_num_lanes'.
+     * @param[in] filename - The filename to read.
+     * @param[in] timescale - Multiplication factor for time value in first column.
+     * @returns True on success, false otherwise.
+     */
+    bool import_lane_csv(u32 lane, const std::string& filename, u64 timescale = 1000000000);
+
+    /**
+     * Get the simulated events of a net in a single lane of a multi-lane simulation.
+     * The simulation engine must have finished successfully.
+     *
+     * @param[in] net - The net.
+     * @param[in] lane - The lane, must be smaller than 'get_num_lanes'.
+     * @returns The events ordered by time.
+     */
+    std::vector<WaveEvent> get_lane_events(const Net* net, u32 lane) const;
+
+    /**
+     * Get the value of a net at the end of the simulation for all lanes of a multi-lane simulation.
+     * The simulation engine must have finished successfully.
+     *
+     * @param[in] net - The net.
+     * @returns The final values, one per lane.
+     */
+    std::vector<BooleanFunction::Value> get_lane_final_values(const Net* net) const;
+
     /**
      * Shortcut to SimulationInput::get_gates
      */
@@ -290,6 +356,7 @@ public:
 
     /**
      * Generates the a partial VCD file for parts the simulated netlist.
+     * The file gets gzip-compressed if the path ends with '.gz'.
      *
      * @param[in] path - The path to the VCD file.
      * @param[in] start_time - Start of the timeframe to write to the file (in picoseconds).
@@ -405,6 +472,8 @@ private:
     bool isClockSet() const;
     bool isInputSet() const;
     void checkReadyState();
+    bool isLaneValid(u32 lane) const;
+    bool importLaneInputs(u32 lane, const QString& laneDir);
     void restoreComposed(const SaleaeDirectory& sd);
     void loadStoredController(const QDir& workDir);
 
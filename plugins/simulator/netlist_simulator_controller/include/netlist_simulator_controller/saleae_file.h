@@ -27,10 +27,12 @@
 
 #include <fstream>
 #include <functional>
+#include <vector>
 #ifdef STANDALONE_PARSER
 #include "saleae_directory.h"
 #else
 #include "netlist_simulator_controller/saleae_directory.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #endif
 
 namespace hal
@@ -54,7 +56,8 @@ namespace hal
         /// SALEAE storage format for transition time values
         enum StorageFormat { Double = 0,          /// Double values,
                              Uint64 = 0x206c6168,
-                             Coded = 0x786c6168 };
+                             Coded = 0x786c6168,
+                             Compressed = 0x7a6c6168 };  /// Bit-packed blocks of time differences and values, see SaleaeBlockEntry
         char mIdent[9];
         int32_t mVersion;
         StorageFormat mStorageFormat;
@@ -162,6 +165,249 @@ namespace hal
         bool readError() const { return mValue == sReadError; }
     };
 
+    /**
+     * Summary of all transitions within one time bucket of the SALEAE index.
+     * Buckets are consecutive time intervals of equal power-of-two width starting at the begin time of the waveform.
+     * Bucket records are stored on disk exactly as laid out here.
+     */
+    class SaleaeIndexBucket
+    {
+    public:
+        /// File position of the first transition at or after bucket begin time. Transitions inside bucket = difference to position of next bucket.
+        uint64_t mFirstTransition;
+
+        /// Accumulated time within bucket the waveform had value 0 respectively 1
+        uint64_t mDuration[2];
+
+        /// Waveform value at bucket begin time
+        int32_t mFirstValue;
+
+        /// Waveform value at bucket end time
+        int32_t mLastValue;
+    };
+
+    /**
+     * Trailer appended to SALEAE data file behind transition data and index buckets.
+     * Readers which are not aware of the index ignore everything behind the last transition.
+     */
+    class SaleaeIndexTrailer
+    {
+    public:
+        char mIdent[9];
+        int32_t mVersion;
+        uint32_t mNumLevels;
+        uint32_t mShift;
+        uint64_t mNumBuckets;
+        uint64_t mNumTransitions;
+        uint64_t mOffset;
+
+        static const char* sIdent;
+
+        /// Size of trailer on disk
+        static const int sSize = 44;
+    public:
+        SaleaeIndexTrailer();
+
+        /**
+         * Read index trailer from the end of open input stream
+         * @param ff The file stream to read trailer from
+         * @return Ok=0 on success, negative error code otherwise
+         */
+        SaleaeStatus::ErrorCode read(std::ifstream& ff);
+
+        /**
+         * Write index trailer at current position of open output stream
+         * @param of The file stream to write trailer into
+         * @return currently always Ok=0
+         */
+        SaleaeStatus::ErrorCode write(std::ofstream& of) const;
+
+        /// Width of buckets at given level, level 0 is the finest resolution
+        uint64_t bucketWidth(int level) const { return 1ull << (mShift + level); }
+
+        /// Number of buckets at given level, each level merges pairs of buckets from level below
+        uint64_t numBuckets(int level) const { return ((mNumBuckets - 1) >> level) + 1; }
+    };
+
+    /**
+     * Builds the multi-resolution index while transitions get written to a SALEAE data file.
+     * The width of level 0 buckets is adapted on the fly by merging neighboring buckets,
+     * so that the index stays small compared to transition data regardless of simulation length.
+     */
+    class SaleaeIndexBuilder
+    {
+        std::vector<SaleaeIndexBucket> mBuckets;
+        uint64_t mBeginTime;
+        uint64_t mLastTime;
+        uint64_t mNumTransitions;
+        uint32_t mShift;
+        int32_t mValue;
+
+        uint64_t relativeTime(uint64_t t) const { return t < mBeginTime ? 0 : t - mBeginTime; }
+        void coarsen();
+        void extendTo(uint64_t ibucket);
+        void accumulate(uint64_t t0, uint64_t t1);
+    public:
+        /// Fewest level 0 buckets to merge if index grows too large
+        static const uint64_t sMinBuckets = 16;
+
+        /// Average number of transitions per level 0 bucket to aim at
+        static const uint64_t sTransitionsPerBucket = 128;
+
+        SaleaeIndexBuilder();
+
+        /// Discard all buckets and start new index with initial value at begin time
+        void reset(uint64_t beginTime, int32_t value);
+
+        /// Add transition at time t to new value val. Transitions must be added in chronological order.
+        void addTransition(uint64_t t, int32_t val);
+
+        /// Write all index levels and trailer at current position of output stream which must be the end of transition data
+        void write(std::ofstream& of) const;
+    };
+
+    /**
+     * Directory entry for one block of transitions in a SALEAE data file with compressed storage format.
+     * All blocks but the last one hold the same number of transitions. The packed block data consists of the
+     * time differences between subsequent transitions, each stored with the bit width needed for the largest
+     * difference within the block, followed by the values stored with two bits each unless they alternate between 0 and 1.
+     * Directory entries are stored on disk exactly as laid out here.
+     */
+    class SaleaeBlockEntry
+    {
+    public:
+        /// File offset of packed block data
+        uint64_t mOffset;
+
+        /// Time of first transition in block
+        uint64_t mFirstTime;
+
+        /// Value of first transition in block
+        int32_t mFirstValue;
+
+        /// Number of bits per time difference, 0 if all transitions within block happen at the same time
+        uint8_t mTimeBits;
+
+        /// Number of bits per value, 0 if values alternate between 0 and 1
+        uint8_t mValueBits;
+
+        uint16_t mReserved;
+    };
+
+    /**
+     * Trailer written behind the block directory of a SALEAE data file with compressed storage format.
+     * It is followed by the multi-resolution index, the offset of the index trailer thus points right behind this trailer.
+     */
+    class SaleaeBlockTrailer
+    {
+    public:
+        char mIdent[9];
+        int32_t mVersion;
+        uint32_t mBlockSize;
+        uint64_t mNumBlocks;
+        uint64_t mNumTransitions;
+        uint64_t mDirectoryOffset;
+
+        static const char* sIdent;
+
+        /// Size of trailer on disk
+        static const int sSize = 40;
+    public:
+        SaleaeBlockTrailer();
+
+        /**
+         * Read block trailer from open input stream
+         * @param ff The file stream to read trailer from
+         * @param pos File offset of trailer
+         * @return Ok=0 on success, negative error code otherwise
+         */
+        SaleaeStatus::ErrorCode read(std::ifstream& ff, uint64_t pos);
+
+        /**
+         * Write block trailer at current position of open output stream
+         * @param of The file stream to write trailer into
+         * @return currently always Ok=0
+         */
+        SaleaeStatus::ErrorCode write(std::ofstream& of) const;
+    };
+
+    /**
+     * Encodes transitions into blocks while they get written to a SALEAE data file with compressed storage format.
+     */
+    class SaleaeBlockWriter
+    {
+        std::vector<uint64_t> mTimes;
+        std::vector<int32_t> mValues;
+        std::vector<uint64_t> mPacked;
+        std::vector<SaleaeBlockEntry> mDirectory;
+        uint64_t mNumTransitions;
+
+        void writeBlock(std::ofstream& of);
+    public:
+        /// Number of transitions per block
+        static const uint32_t sBlockSize = 1024;
+
+        /// File offset of first block, header gets padded to keep packed data aligned
+        static const int sDataOffset = 48;
+
+        SaleaeBlockWriter();
+
+        /// Discard all blocks, next block gets written at current position of output stream
+        void reset();
+
+        /// Add transition at time t to new value val, writes block to output stream once it is complete
+        void addTransition(std::ofstream& of, uint64_t t, int32_t val);
+
+        /// Write incomplete last block, block directory, and trailer at current position of output stream
+        void write(std::ofstream& of);
+    };
+
+    /**
+     * Decodes transitions from a memory-mapped SALEAE data file with compressed storage format.
+     * The most recently decoded block is kept, so that sequential reads decode every block only once.
+     */
+    class SaleaeBlockReader
+    {
+#ifdef STANDALONE_PARSER
+        std::vector<char> mFileContent;
+#else
+        MemoryMappedFile mMappedFile;
+#endif
+        const char* mData;
+        uint64_t mSize;
+        SaleaeBlockTrailer mTrailer;
+        std::vector<SaleaeBlockEntry> mDirectory;
+
+        int64_t mCacheBlock;
+        std::vector<uint64_t> mCacheTimes;
+        std::vector<int> mCacheValues;
+
+        uint64_t blockTransitions(uint64_t iblock) const;
+        uint64_t packedWords(uint64_t iblock) const;
+        void decodeBlock(uint64_t iblock, uint64_t* times, int* values) const;
+        void cacheBlock(uint64_t iblock);
+    public:
+        SaleaeBlockReader();
+
+        /**
+         * Map data file into memory and read block directory
+         * @param filename The name of the data file
+         * @param ff The file stream the header has been read from
+         * @param header The header of the data file
+         * @return Ok=0 on success, negative error code otherwise
+         */
+        SaleaeStatus::ErrorCode open(const std::string& filename, std::ifstream& ff, const SaleaeHeader& header);
+
+        /// Get transition, transitions are numbered from 1 to numTransitions since position 0 is the start value from header
+        SaleaeDataTuple get_transition(uint64_t itrans);
+
+        /// Decode n transitions starting with transition itrans into given buffers
+        void get_transitions(uint64_t itrans, uint64_t n, uint64_t* times, int* values);
+
+        /// Number of last transition at or before time t, 0 if first transition happens after t
+        uint64_t find_transition(uint64_t t);
+    };
+
     class SaleaeInputFile : public std::ifstream
     {
         SaleaeHeader mHeader;
@@ -170,7 +416,10 @@ namespace hal
 
         std::function<uint64_t(bool*)> mReader;
 
-        void seekTransition(uint64_t pos) { seekg(pos*sizeof(uint64_t) + 44); }
+        SaleaeBlockReader mBlockReader;
+        uint64_t mBlockCursor;
+
+        void seekTransition(uint64_t pos);
     public:
         SaleaeInputFile(const std::string& filename);
 
@@ -200,6 +449,57 @@ namespace hal
     };
 
 
+    /**
+     * Read access to the multi-resolution index appended to a SALEAE data file.
+     * Buckets are read on demand, so that summarizing a long waveform for display touches only the buckets in view.
+     */
+    class SaleaeIndexFile : public std::ifstream
+    {
+        SaleaeHeader mHeader;
+        SaleaeIndexTrailer mTrailer;
+        SaleaeStatus::ErrorCode mStatus;
+        bool mValid;
+
+        static const int sCacheSize = 256;
+        std::vector<SaleaeIndexBucket> mCache;
+        int mCacheLevel;
+        uint64_t mCacheBegin;
+
+        uint64_t levelOffset(int level) const;
+    public:
+        SaleaeIndexFile(const std::string& filename);
+
+        /// Returns whether file contains an index matching the transition data
+        bool has_index() const { return mValid; }
+
+        /// Number of index levels, level 0 has the finest resolution and the top level a single bucket
+        int number_levels() const { return mValid ? mTrailer.mNumLevels : 0; }
+
+        /// Coarsest level with bucket width not exceeding dt, -1 if even level 0 buckets are wider
+        int get_level(uint64_t dt) const;
+
+        /// Number of buckets at given level
+        uint64_t number_buckets(int level) const { return mTrailer.numBuckets(level); }
+
+        /// Width of buckets at given level
+        uint64_t bucket_width(int level) const { return mTrailer.bucketWidth(level); }
+
+        /// Begin time of bucket
+        uint64_t bucket_begin(int level, uint64_t ibucket) const { return mHeader.beginTime() + ibucket * bucket_width(level); }
+
+        /// Index of bucket containing time t, the last bucket also contains all times beyond
+        uint64_t bucket_index(int level, uint64_t t) const;
+
+        /// Get bucket summary, returns zero initialized bucket if arguments are out of range
+        SaleaeIndexBucket get_bucket(int level, uint64_t ibucket);
+
+        /// Number of transitions inside bucket
+        uint64_t get_bucket_transitions(int level, uint64_t ibucket);
+
+        /// Getter for header information
+        const SaleaeHeader* header() const { return &mHeader; }
+    };
+
     class SaleaeOutputFile : public std::ofstream
     {
         int mIndex;
@@ -209,16 +509,26 @@ namespace hal
         bool mFirstValue;
         int mLastWrittenValue;
         uint64_t mLastWrittenTime;
+        SaleaeIndexBuilder mIndexBuilder;
 
+        SaleaeBlockWriter mBlockWriter;
+
+        void writeHeader();
         void convertToCoded();
     public:
-        SaleaeOutputFile(const std::string& filename, int index_);
+        /**
+         * Open SALEAE data file for writing
+         * @param filename The name of the data file
+         * @param index_ The data file index (XXX in digital_XXX.bin)
+         * @param sf The storage format, either Uint64 (converted to Coded once undefined values are written) or Compressed
+         */
+        SaleaeOutputFile(const std::string& filename, int index_, SaleaeHeader::StorageFormat sf = SaleaeHeader::Compressed);
         ~SaleaeOutputFile();
 
         /// Write single data tuple to disk
         void writeTimeValue(uint64_t t, int32_t val);
 
-        /// Update header on disk and close file
+        /// Append index, update header on disk and close file
         void close();
 
         /// Getter for data file index (XXX in digital_XXX.bin)
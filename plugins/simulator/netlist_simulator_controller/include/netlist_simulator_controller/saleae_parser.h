@@ -24,10 +24,10 @@
 // SOFTWARE.
 
 #pragma once
-#include <map>
 #include <unordered_map>
 #include <functional>
 #include <string>
+#include <vector>
 #ifdef STANDALONE_PARSER
 #include "saleae_directory.h"
 #include "saleae_file.h"
@@ -74,18 +74,44 @@ namespace hal
         struct DataFileHandle {
             std::function<void(void*obj, uint64_t, int)> callback;
             SaleaeInputFile* file;
+            SaleaeDataBuffer* buffer;
+            uint64_t index;
             int value;
             void* obj;
         };
-        std::multimap<uint64_t,DataFileHandle> mNextValueMap;
+
+        /// Heap entry for next event of a data file, events with equal time are delivered in order of insertion
+        struct NextEvent {
+            uint64_t time;
+            uint64_t sequence;
+            size_t handle;
+
+            bool operator<(const NextEvent& other) const { return time < other.time || (time == other.time && sequence < other.sequence); }
+        };
+        std::vector<DataFileHandle> mDataFiles;
+        std::vector<NextEvent> mNextEventHeap;
+        uint64_t mSequence;
+
+        bool readNextEvent(DataFileHandle& dfh, uint64_t& t);
+        void siftDown(size_t i);
+        void siftUp(size_t i);
 
     public:
+        /// Number of events read at once from each data file
+        static const uint64_t sReadBatchSize = 4096;
+
         /**
          * Constructor for SaleaeParser
          * @param filename Full path and filename of SALEAE directory file
          */
         SaleaeParser(const std::string& filename);
 
+        /// Destructor closes all data files with pending events
+        ~SaleaeParser();
+
+        SaleaeParser(const SaleaeParser&) = delete;
+        SaleaeParser& operator=(const SaleaeParser&) = delete;
+
         /// Get last simulated time from SALEAE directory
         uint64_t get_max_time() const;
 
@@ -242,6 +242,26 @@ namespace hal
          * @return Vector of events
          */
         virtual std::vector<WaveEvent> get_simulation_events(u32 netId) const;
+
+        /**
+         * Can be overwritten by derived class
+         *
+         * Number of independent stimuli (lanes) simulated side by side. Lane specific input values
+         * passed by input events are ignored for lanes beyond this number.
+         * @return number of lanes, 1 if engine does not support multi-lane simulation
+         */
+        virtual u32 get_num_lanes() const;
+
+        /**
+         * Can be overwritten by derived class
+         *
+         * Get vector of simulated events for net in a single lane
+         *
+         * @param[in] netId - The net for which events where simulated
+         * @param[in] lane - The lane, must be smaller than get_num_lanes()
+         * @return Vector of events
+         */
+        virtual std::vector<WaveEvent> get_lane_simulation_events(u32 netId, u32 lane) const;
     };
 
     class SimulationEngineScripted : public SimulationEngine
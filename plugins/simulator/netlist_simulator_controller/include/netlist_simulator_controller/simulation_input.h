@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <map>
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
@@ -35,12 +36,32 @@ namespace hal {
     class Gate;
     class Net;
 
+    /**
+     * Input value assigned to a single lane of a multi-lane simulation engine.
+     */
+    struct SimulationInputLaneValue
+    {
+        const Net* net;
+        u32 lane;
+        BooleanFunction::Value value;
+    };
+
     class SimulationInputNetEvent : public std::unordered_map<const Net*,BooleanFunction::Value>
     {
         u64 mSimulationDuration;
+        std::vector<SimulationInputLaneValue> mLaneValues;
     public:
         u64 get_simulation_duration() const { return mSimulationDuration; }
         void set_simulation_duration(u64 t) { mSimulationDuration = t; }
+
+        /**
+         * Lane specific input values. They override the values from the map above for the given lane only.
+         * Engines without multi-lane support ignore them.
+         * @return reference to lane values
+         */
+        const std::vector<SimulationInputLaneValue>& get_lane_values() const { return mLaneValues; }
+        void add_lane_value(const SimulationInputLaneValue& lv) { mLaneValues.push_back(lv); }
+        void clear_lane_values() { mLaneValues.clear(); }
     };
 
     class SimulationInput {
@@ -62,6 +83,8 @@ namespace hal {
         std::vector<const Net*> m_output_nets;
         std::vector<const Net*> m_partial_nets;
 
+        std::map<u64,std::vector<SimulationInputLaneValue>> m_lane_inputs;
+
         bool mNoClockUsed;
 
         void compute_input_nets();
@@ -137,6 +160,26 @@ namespace hal {
 
         void clear();
 
+        /**
+         * Adds a lane specific input value for multi-lane simulation engines.
+         * The value overrides the regular input waveform of the net for the given lane from time t on.
+         *
+         * @param[in] t - The time in picoseconds.
+         * @param[in] lv - The net, lane, and value.
+         */
+        void add_lane_input(u64 t, const SimulationInputLaneValue& lv);
+
+        /**
+         * Returns all lane specific input values ordered by time.
+         * @return reference to lane input map
+         */
+        const std::map<u64,std::vector<SimulationInputLaneValue>>& get_lane_inputs() const { return m_lane_inputs; }
+
+        /**
+         * Removes all lane specific input values.
+         */
+        void clear_lane_inputs();
+
         /**
          * Get all nets that are considered inputs, i.e., not driven by a gate in the simulation set or global inputs.
          *
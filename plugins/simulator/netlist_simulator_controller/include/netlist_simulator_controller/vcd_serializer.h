@@ -65,11 +65,8 @@ namespace hal {
         Q_OBJECT
         int mTime;
         u64 mFirstTimestamp;
-        u64 mLastTimestamp;
-        u64 mTimeShift;
         QMap<QString,SaleaeOutputFile*> mSaleaeFiles;
         SaleaeWriter* mSaleaeWriter;
-        QList<VcdSerializerElement*> mWriteElements;
         QString mWorkdir;
         QString mSaleaeDirectoryFilename;
         QMap<QString,QString> mAbbrevByName;
@@ -78,22 +75,20 @@ namespace hal {
         bool mSaleae;
         int mLastProgress;
 
-        bool parseVcdDataline(char* buf, int len);
-        bool parseVcdDataNonDecimal(const QByteArray& line, int base);
-        void storeValue(int val, const QByteArray& abrev);
         bool parseCsvHeader(char* buf);
         bool parseCsvDataline(char* buf, int dataLineIndex);
         bool parseVcdInternal(QFile& ff, const QList<const Net *>& onlyNets);
         bool parseCsvInternal(QFile& ff, const QList<const Net *>& onlyNets);
 
-        void writeVcdEvent(QFile& of);
-
         void deleteFiles();
         void createSaleaeDirectory();
         void emitProgress(double step, double max);
         void emitImportDone();
 
     public:
+        /// Approximate number of bytes of VCD data lines parsed by a single thread at once
+        static const u64 sVcdChunkSize = 4 << 20;
+
         VcdSerializer(const QString& workdir=QString(), bool saleae_cli=false, QObject* parent = nullptr);
         std::string get_saleae_directory_filename() const { return mSaleaeDirectoryFilename.toStdString(); }
         bool exportVcd(const QString& filename, const QList<const WaveData*>& waves, u32 startTime, u32 endTime, u32 timeShift=0);
@@ -34,6 +34,7 @@
 #include "hal_core/netlist/boolean_function.h"
 #include "netlist_simulator_controller/simulation_input.h"
 #include "netlist_simulator_controller/saleae_directory.h"
+#include <functional>
 #include <set>
 
 namespace hal {
@@ -272,6 +273,15 @@ namespace hal {
         WaveDataBoolean(WaveDataList* wdList, const QList<WaveData*>& boolInput, const QList<int>& acceptMask);
         ~WaveDataBoolean();
         void recalcData();
+
+        /**
+         * Computes the boolean waveform in a single pass merging the sorted transitions of all inputs.
+         * Inputs which are not completely loaded are read from their SALEAE file in batches.
+         *
+         * @param[in] callback - Invoked with time and new value (0, 1, or -1 if any input is undefined) for every change of value, evaluation stops if it returns false.
+         * @param[in] memoryOnly - If true, only transitions in memory are evaluated, e.g., those loaded for the current timeframe.
+         */
+        void evaluate(const std::function<bool(u64,int)>& callback, bool memoryOnly = false) const;
         virtual LoadPolicy loadPolicy() const override;
         QList<WaveData*> children() const;
         const char* truthTable() const { return mTruthTable; }
@@ -289,6 +299,15 @@ namespace hal {
         WaveDataTrigger(WaveDataList* wdList, const QList<WaveData*>& wdTrigger, const QList<int>& toVal = QList<int>());
         ~WaveDataTrigger();
         void recalcData();
+
+        /**
+         * Computes the trigger times in a single pass merging the sorted transitions of all trigger waves.
+         * Waves which are not completely loaded are read from their SALEAE file in batches.
+         *
+         * @param[in] callback - Invoked with time and value 1 for every trigger time in ascending order, evaluation stops if it returns false.
+         * @param[in] memoryOnly - If true, only transitions in memory are evaluated, e.g., those loaded for the current timeframe.
+         */
+        void evaluate(const std::function<bool(u64,int)>& callback, bool memoryOnly = false) const;
         virtual LoadPolicy loadPolicy() const override;
         QList<WaveData*> children() const;
         virtual u64 neighborTransition(double t, bool next) const override;
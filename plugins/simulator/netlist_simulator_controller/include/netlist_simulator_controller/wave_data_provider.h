@@ -49,6 +49,7 @@ namespace hal {
         virtual ~WaveDataProvider() {;}
         virtual SaleaeDataTuple startValue(u64 t) = 0;
         virtual SaleaeDataTuple nextPoint() = 0;
+        virtual void setTimeResolution(u64 dt) { Q_UNUSED(dt); }
         bool isGroup()   const { return mWaveType == WaveData::NetGroup; }
         bool isBoolean() const { return mWaveType == WaveData::BooleanNet; }
         bool isTrigger() const { return mWaveType == WaveData::TriggerTime; }
@@ -91,6 +92,27 @@ namespace hal {
         const QMap<u64,int>& dataMap() const { return mDataMap; }
     };
 
+    /**
+     * Provider for SALEAE data files with multi-resolution index.
+     * Where the time resolution of the display does not allow to resolve single transitions,
+     * all transitions within an index bucket are summarized by two data points reflecting the
+     * time spent at either value, so that only a few bytes need to be read per pixel column.
+     */
+    class WaveDataProviderIndex : public WaveDataProvider
+    {
+        SaleaeInputFile mInputFile;
+        SaleaeIndexFile mIndexFile;
+        u64 mTimeResolution;
+        SaleaeDataTuple mNextTransition;
+        SaleaeDataTuple mPendingPoint;
+    public:
+        WaveDataProviderIndex(const std::string& filename);
+        bool hasIndex() const { return mInputFile.good() && mIndexFile.has_index(); }
+        virtual SaleaeDataTuple startValue(u64 t) override;
+        virtual SaleaeDataTuple nextPoint() override;
+        virtual void setTimeResolution(u64 dt) override { mTimeResolution = dt; }
+    };
+
     class WaveDataProviderClock : public WaveDataProvider
     {
         const SimulationInput::Clock& mClock;
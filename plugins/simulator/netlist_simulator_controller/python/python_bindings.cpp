@@ -187,6 +187,66 @@ namespace hal
                 :param hal_py.BooleanFunction.Value value: The value to set.
             )")
 
+            .def("get_num_lanes", &NetlistSimulatorController::get_num_lanes, R"(
+                Get the number of independent stimuli (lanes) the simulation engine advances side by side.
+
+                :returns: The number of lanes, 1 if no engine has been created or the engine does not support multi-lane simulation.
+                :rtype: int
+            )")
+
+            .def("set_lane_input", &NetlistSimulatorController::set_lane_input, py::arg("lane"), py::arg("net"), py::arg("value"), R"(
+                Set the signal for a specific wire in a single lane of a multi-lane simulation.
+                Once a lane value has been assigned, the lane ignores the regular input waveform of that net.
+
+                :param int lane: The lane, must be smaller than the number of lanes.
+                :param hal_py.Net net: The net to set a signal value for.
+                :param hal_py.BooleanFunction.Value value: The value to set.
+            )")
+
+            .def("set_lane_inputs", &NetlistSimulatorController::set_lane_inputs, py::arg("net"), py::arg("values"), R"(
+                Set the signal for a specific wire in several lanes of a multi-lane simulation at once.
+                The i-th value is assigned to lane i.
+
+                :param hal_py.Net net: The net to set signal values for.
+                :param list[hal_py.BooleanFunction.Value] values: The values to set, at most one per lane.
+            )")
+
+            .def("import_lane_vcd", &NetlistSimulatorController::import_lane_vcd, py::arg("lane"), py::arg("filename"), R"(
+                Import input waveforms for a single lane of a multi-lane simulation from VCD file.
+
+                :param int lane: The lane, must be smaller than the number of lanes.
+                :param str filename: filename of VCD file to be parsed.
+                :returns: True on success, False otherwise.
+                :rtype: bool
+            )")
+
+            .def("import_lane_csv", &NetlistSimulatorController::import_lane_csv, py::arg("lane"), py::arg("filename"), py::arg("timescale") = 1000000000, R"(
+                Import input waveforms for a single lane of a multi-lane simulation from CSV file.
+
+                :param int lane: The lane, must be smaller than the number of lanes.
+                :param str filename: filename of CSV file to be parsed.
+                :param int timescale: Multiplication factor for time value in first column.
+                :returns: True on success, False otherwise.
+                :rtype: bool
+            )")
+
+            .def("get_lane_events", &NetlistSimulatorController::get_lane_events, py::arg("net"), py::arg("lane"), R"(
+                Get the simulated events of a net in a single lane of a multi-lane simulation.
+
+                :param hal_py.Net net: The net.
+                :param int lane: The lane, must be smaller than the number of lanes.
+                :returns: The events ordered by time.
+                :rtype: list[netlist_simulator_controller.WaveEvent]
+            )")
+
+            .def("get_lane_final_values", &NetlistSimulatorController::get_lane_final_values, py::arg("net"), R"(
+                Get the value of a net at the end of the simulation for all lanes of a multi-lane simulation.
+
+                :param hal_py.Net net: The net.
+                :returns: The final values, one per lane.
+                :rtype: list[hal_py.BooleanFunction.Value]
+            )")
+
             .def("set_timeframe", &NetlistSimulatorController::set_timeframe, py::arg("tmin") = 0, py::arg("tmax") = 0, R"(
                 Set timeframe for viewer.
 
@@ -331,6 +391,7 @@ namespace hal
 
             .def("generate_vcd", &NetlistSimulatorController::generate_vcd, py::arg("path"), py::arg("start_time") = 0, py::arg("end_time") = 0, py::arg("nets") = std::set<u32>(), R"(
                 Generates the a VCD file for parts the simulated netlist.
+                The file gets gzip-compressed if the path ends with '.gz'.
 
                 :param hal_py.hal_path path: The path to the VCD file.
                 :param int start_time: Start of the timeframe to write to the file (in picoseconds).
@@ -330,6 +330,9 @@ void saleae_cat(std::string path, std::string file_name, bool dump_header, bool
         case SaleaeHeader::Coded:
             data_format = "Coded";
             break;
+        case SaleaeHeader::Compressed:
+            data_format = "Compressed";
+            break;
         }
 
         // collect length for better formatting
@@ -846,6 +846,125 @@ namespace hal
             mWaveDataList->insertBooleanValue(wd,t,value);
     }
 
+    u32 NetlistSimulatorController::get_num_lanes() const
+    {
+        if (!mSimulationEngine || !mSimulationEngine->can_share_memory()) return 1;
+        return static_cast<const SimulationEngineEventDriven*>(mSimulationEngine)->get_num_lanes();
+    }
+
+    bool NetlistSimulatorController::isLaneValid(u32 lane) const
+    {
+        u32 numLanes = get_num_lanes();
+        if (lane < numLanes) return true;
+        log_warning(get_name(), "lane {} out of range, selected engine simulates {} lane(s).", lane, numLanes);
+        return false;
+    }
+
+    void NetlistSimulatorController::set_lane_input(u32 lane, const Net* net, BooleanFunction::Value value)
+    {
+        Q_ASSERT(net);
+        if (!isLaneValid(lane)) return;
+        if (!mSimulationInput->is_input_net(net))
+        {
+            if (mBadAssignInputWarnings[net->get_id()]++ < 3)
+                log_warning(get_name(), "net[{}] '{}' is not an input net, value not assigned.", net->get_id(), net->get_name());
+            return;
+        }
+        mSimulationInput->add_lane_input(mWaveDataList->timeFrame().simulateMaxTime(), SimulationInputLaneValue{net, lane, value});
+    }
+
+    void NetlistSimulatorController::set_lane_inputs(const Net* net, const std::vector<BooleanFunction::Value>& values)
+    {
+        if (!values.empty() && !isLaneValid(values.size() - 1)) return;
+        for (u32 lane = 0; lane < values.size(); lane++)
+            set_lane_input(lane, net, values.at(lane));
+    }
+
+    bool NetlistSimulatorController::importLaneInputs(u32 lane, const QString& laneDir)
+    {
+        SaleaeParser sp(QDir(laneDir).absoluteFilePath("saleae/saleae.json").toStdString());
+
+        int count = 0;
+        for (const Net* net : mSimulationInput->get_input_nets())
+        {
+            void* registerObj = (void*) net;
+            sp.register_callback(net,[this,lane,&count](const void* obj, uint64_t t, int val) {
+                mSimulationInput->add_lane_input(t, SimulationInputLaneValue{static_cast<const Net*>(obj), lane, static_cast<BooleanFunction::Value>(val)});
+                ++count;
+            }, registerObj);
+        }
+
+        while (sp.next_event())
+            ;
+
+        if (!count)
+        {
+            log_warning(get_name(), "no input waveform found for lane {}.", lane);
+            return false;
+        }
+        return true;
+    }
+
+    bool NetlistSimulatorController::import_lane_vcd(u32 lane, const std::string& filename)
+    {
+        if (!isLaneValid(lane)) return false;
+
+        QString laneDir = QDir(mWorkDir).absoluteFilePath(QString("lane_%1").arg(lane));
+        VcdSerializer reader(laneDir,this);
+
+        QList<const Net*> inputNets;
+        for (const Net* n: mSimulationInput->get_input_nets()) inputNets.append(n);
+
+        if (!reader.importVcd(QString::fromStdString(filename),laneDir,inputNets))
+            return false;
+        return importLaneInputs(lane, laneDir);
+    }
+
+    bool NetlistSimulatorController::import_lane_csv(u32 lane, const std::string& filename, u64 timescale)
+    {
+        if (!isLaneValid(lane)) return false;
+
+        QString laneDir = QDir(mWorkDir).absoluteFilePath(QString("lane_%1").arg(lane));
+        VcdSerializer reader(laneDir,this);
+
+        QList<const Net*> inputNets;
+        for (const Net* n: mSimulationInput->get_input_nets()) inputNets.append(n);
+
+        if (!reader.importCsv(QString::fromStdString(filename),laneDir,inputNets,timescale))
+            return false;
+        return importLaneInputs(lane, laneDir);
+    }
+
+    std::vector<WaveEvent> NetlistSimulatorController::get_lane_events(const Net* net, u32 lane) const
+    {
+        Q_ASSERT(net);
+        if (!mSimulationEngine || mSimulationEngine->state() != SimulationEngine::Done)
+        {
+            log_warning(get_name(), "no simulation results available.");
+            return std::vector<WaveEvent>();
+        }
+        if (!isLaneValid(lane)) return std::vector<WaveEvent>();
+        return static_cast<const SimulationEngineEventDriven*>(mSimulationEngine)->get_lane_simulation_events(net->get_id(), lane);
+    }
+
+    std::vector<BooleanFunction::Value> NetlistSimulatorController::get_lane_final_values(const Net* net) const
+    {
+        std::vector<BooleanFunction::Value> retval;
+        if (!mSimulationEngine || mSimulationEngine->state() != SimulationEngine::Done)
+        {
+            log_warning(get_name(), "no simulation results available.");
+            return retval;
+        }
+        const SimulationEngineEventDriven* sevd = static_cast<const SimulationEngineEventDriven*>(mSimulationEngine);
+        u32 numLanes = get_num_lanes();
+        for (u32 lane = 0; lane < numLanes; lane++)
+        {
+            std::vector<WaveEvent> events = sevd->get_lane_simulation_events(net->get_id(), lane);
+            retval.push_back(events.empty() ? BooleanFunction::Value::X : events.back().new_value);
+        }
+        return retval;
+    }
+
     void NetlistSimulatorController::set_timeframe(u64 tmin, u64 tmax)
     {
         mWaveDataList->setUserTimeframe(tmin, tmax);
@@ -858,6 +977,7 @@ namespace hal
     void NetlistSimulatorController::reset()
     {
         mWaveDataList->clearAll();
+        mSimulationInput->clear_lane_inputs();
     }
 
     void NetlistSimulatorController::simulate(u64 picoseconds)
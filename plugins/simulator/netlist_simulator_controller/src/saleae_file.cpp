@@ -6,6 +6,7 @@
 #include "netlist_simulator_controller/saleae_parser.h"
 #endif
 
+#include <algorithm>
 #include <stdio.h>
 #include <iostream>
 #include <math.h>
@@ -16,6 +17,10 @@ namespace hal
 
     const char* SaleaeHeader::sIdent = "<SALEAE>";
 
+    const char* SaleaeIndexTrailer::sIdent = "<SALIDX>";
+
+    const char* SaleaeBlockTrailer::sIdent = "<SALBLK>";
+
     SaleaeDataBuffer::SaleaeDataBuffer(uint64_t cnt)
         : mCount(cnt), mTimeArray(nullptr), mValueArray(nullptr)
     {
@@ -56,6 +61,7 @@ namespace hal
         case Double:
         case Uint64:
         case Coded:
+        case Compressed:
             mStorageFormat = (StorageFormat) type;
             break;
         default:
@@ -97,13 +103,16 @@ namespace hal
 
     SaleaeInputFile::SaleaeInputFile(const std::string &filename)
         : std::ifstream(filename, std::ios::binary), mReadPointer(0),
-          mStatus(SaleaeStatus::Ok)
+          mStatus(SaleaeStatus::Ok), mBlockCursor(0)
     {
         if (good())
             mStatus = mHeader.read(*this);
         else
             mStatus = SaleaeStatus::ErrorOpenFile;
 
+        if (!mStatus && mHeader.storageFormat() == SaleaeHeader::Compressed && mHeader.numTransitions())
+            mStatus = mBlockReader.open(filename, *this, mHeader);
+
         if (mStatus)
             setstate(failbit);
 
@@ -130,6 +139,14 @@ namespace hal
                 return timeVal;
             };
             break;
+        case SaleaeHeader::Compressed:
+            mReader = [this](bool* ok) {
+                SaleaeDataTuple sdt = this->mBlockReader.get_transition(++this->mBlockCursor);
+                *ok = !sdt.readError();
+                // same layout as coded format
+                return (((uint64_t) (sdt.mValue + 2)) << 62) | sdt.mTime;
+            };
+            break;
         }
 
         // printf("<%s> %d %d %d %.7f %.7f %lu\n", mIdent, mVersion, mType, mValue, mBeginTime, mEndTime, mNumTransitions );
@@ -191,6 +208,10 @@ namespace hal
                 retval->mTimeArray[i+j] &= 0x3fffffffffffffffull;
             }
             break;
+        case SaleaeHeader::Compressed:
+            mBlockReader.get_transitions(mReadPointer, n, retval->mTimeArray+i, retval->mValueArray+i);
+            mBlockCursor = mReadPointer + n - 1;
+            break;
         }
 
         mReadPointer += n;
@@ -226,6 +247,13 @@ namespace hal
             return retval;
         }
 
+        // do not read index data appended behind last transition
+        if (mReadPointer > mHeader.numTransitions())
+        {
+            setstate(eofbit);
+            return retval;
+        }
+
         bool ok = true;
         retval.mTime = mReader(&ok);
         if (!ok)
@@ -234,7 +262,7 @@ namespace hal
             return retval;
         }
 
-        if (mHeader.storageFormat() == SaleaeHeader::Coded)
+        if (mHeader.storageFormat() == SaleaeHeader::Coded || mHeader.storageFormat() == SaleaeHeader::Compressed)
         {
             retval.mValue = ((retval.mTime >> 62) & 0x3) - 2;
             retval.mTime  &= 0x3fffffffffffffffull;
@@ -248,6 +276,14 @@ namespace hal
         return retval;
     }
 
+    void SaleaeInputFile::seekTransition(uint64_t pos)
+    {
+        if (mHeader.storageFormat() == SaleaeHeader::Compressed)
+            mBlockCursor = pos;
+        else
+            seekg(pos*sizeof(uint64_t) + 44);
+    }
+
     void SaleaeInputFile::skip_transitions(int64_t delta)
     {
         if (!delta) return;
@@ -295,9 +331,20 @@ namespace hal
                 setstate(eofbit);
                 return -1;
             }
+            seekTransition(max ? max-1 : 0);
             return max;
         }
 
+        if (mHeader.storageFormat() == SaleaeHeader::Compressed)
+        {
+            // block directory allows binary search without reading transitions from other blocks
+            int64_t pos = mBlockReader.find_transition(t);
+            if (successor && (!pos || mBlockReader.get_transition(pos).mTime < t)) ++pos;
+            mReadPointer = pos;
+            seekTransition(pos ? pos-1 : 0);
+            return pos;
+        }
+
         int64_t pos   = 0;
         int64_t delta = max > 4 ? max / 4 : 1;
         bool loop = true;
@@ -345,6 +392,9 @@ namespace hal
         if (pos < 0) return -1;
         bool ok = true;
 
+        if (mHeader.storageFormat() == SaleaeHeader::Compressed)
+            return pos ? mBlockReader.get_transition(pos).mValue : mHeader.value();
+
         if (mHeader.storageFormat() == SaleaeHeader::Coded)
         {
             seekTransition(pos);
@@ -355,14 +405,629 @@ namespace hal
         return (pos%2==0) ? mHeader.value() : 1 - mHeader.value();
     }
 
-    SaleaeOutputFile::SaleaeOutputFile(const std::string &filename, int index_)
+    SaleaeIndexTrailer::SaleaeIndexTrailer()
+        : mVersion(1), mNumLevels(0), mShift(0), mNumBuckets(0), mNumTransitions(0), mOffset(0)
+    {
+        strcpy(mIdent,sIdent);
+    }
+
+    SaleaeStatus::ErrorCode SaleaeIndexTrailer::read(std::ifstream& ff)
+    {
+        ff.seekg(-sSize, std::ios_base::end);
+        ff.read(mIdent,8);
+        mIdent[8] = 0;
+        if (!ff.good() || mIdent != std::string(sIdent))
+            return SaleaeStatus::BadIndentifier;
+
+        ff.read((char*)&mVersion,sizeof(mVersion));
+        if (mVersion != 1)
+            return SaleaeStatus::UnsupportedType;
+
+        ff.read((char*)&mNumLevels,sizeof(mNumLevels));
+        ff.read((char*)&mShift,sizeof(mShift));
+        ff.read((char*)&mNumBuckets,sizeof(mNumBuckets));
+        ff.read((char*)&mNumTransitions,sizeof(mNumTransitions));
+        ff.read((char*)&mOffset,sizeof(mOffset));
+        if (!ff.good())
+            return SaleaeStatus::UnexpectedEof;
+
+        return SaleaeStatus::Ok;
+    }
+
+    SaleaeStatus::ErrorCode SaleaeIndexTrailer::write(std::ofstream& of) const
+    {
+        of.write(mIdent,8);
+        of.write((char*)&mVersion,sizeof(mVersion));
+        of.write((char*)&mNumLevels,sizeof(mNumLevels));
+        of.write((char*)&mShift,sizeof(mShift));
+        of.write((char*)&mNumBuckets,sizeof(mNumBuckets));
+        of.write((char*)&mNumTransitions,sizeof(mNumTransitions));
+        of.write((char*)&mOffset,sizeof(mOffset));
+        return SaleaeStatus::Ok;
+    }
+
+    static_assert(sizeof(SaleaeIndexBucket) == 32, "SALEAE index bucket must match size on disk");
+
+    SaleaeIndexBuilder::SaleaeIndexBuilder()
+        : mBeginTime(0), mLastTime(0), mNumTransitions(0), mShift(0), mValue(-1)
+    {;}
+
+    void SaleaeIndexBuilder::reset(uint64_t beginTime, int32_t value)
+    {
+        mBuckets.clear();
+        mBeginTime = beginTime;
+        mLastTime = beginTime;
+        mNumTransitions = 0;
+        mShift = 0;
+        mValue = value;
+    }
+
+    void SaleaeIndexBuilder::coarsen()
+    {
+        uint64_t n = (mBuckets.size() + 1) / 2;
+        for (uint64_t i = 0; i < n; i++)
+        {
+            SaleaeIndexBucket merged = mBuckets[2*i];
+            if (2*i+1 < mBuckets.size())
+            {
+                const SaleaeIndexBucket& right = mBuckets[2*i+1];
+                merged.mDuration[0] += right.mDuration[0];
+                merged.mDuration[1] += right.mDuration[1];
+                merged.mLastValue = right.mLastValue;
+            }
+            mBuckets[i] = merged;
+        }
+        mBuckets.resize(n);
+        ++mShift;
+    }
+
+    void SaleaeIndexBuilder::extendTo(uint64_t ibucket)
+    {
+        // buckets without transitions start with the transition to be added next
+        SaleaeIndexBucket empty;
+        empty.mFirstTransition = mNumTransitions + 1;
+        empty.mDuration[0] = 0;
+        empty.mDuration[1] = 0;
+        empty.mFirstValue = mValue;
+        empty.mLastValue = mValue;
+        if (mBuckets.size() <= ibucket)
+            mBuckets.resize(ibucket + 1, empty);
+    }
+
+    void SaleaeIndexBuilder::accumulate(uint64_t t0, uint64_t t1)
+    {
+        if (mValue < 0 || mValue > 1) return;
+        uint64_t r0 = relativeTime(t0);
+        uint64_t r1 = relativeTime(t1);
+        if (r1 <= r0) return;
+        for (uint64_t i = r0 >> mShift; i <= (r1-1) >> mShift && i < mBuckets.size(); i++)
+        {
+            uint64_t b0 = i << mShift;
+            uint64_t b1 = b0 + (1ull << mShift);
+            mBuckets[i].mDuration[mValue] += (r1 < b1 ? r1 : b1) - (r0 > b0 ? r0 : b0);
+        }
+    }
+
+    void SaleaeIndexBuilder::addTransition(uint64_t t, int32_t val)
+    {
+        uint64_t ibucket = relativeTime(t) >> mShift;
+        if (ibucket >= mBuckets.size())
+        {
+            uint64_t maxBuckets = mNumTransitions / sTransitionsPerBucket;
+            if (maxBuckets < sMinBuckets) maxBuckets = sMinBuckets;
+            while (ibucket >= 2 * maxBuckets)
+            {
+                coarsen();
+                ibucket = relativeTime(t) >> mShift;
+            }
+            extendTo(ibucket);
+        }
+        accumulate(mLastTime, t);
+
+        ++mNumTransitions;
+        mBuckets[ibucket].mLastValue = val;
+        mValue = val;
+        mLastTime = t;
+    }
+
+    void SaleaeIndexBuilder::write(std::ofstream& of) const
+    {
+        SaleaeIndexTrailer trailer;
+        trailer.mShift = mShift;
+        trailer.mNumTransitions = mNumTransitions;
+        trailer.mOffset = of.tellp();
+
+        std::vector<SaleaeIndexBucket> level = mBuckets;
+        if (level.empty())
+        {
+            SaleaeIndexBucket bucket;
+            bucket.mFirstTransition = mNumTransitions + 1;
+            bucket.mDuration[0] = 0;
+            bucket.mDuration[1] = 0;
+            bucket.mFirstValue = mValue;
+            bucket.mLastValue = mValue;
+            level.push_back(bucket);
+        }
+        trailer.mNumBuckets = level.size();
+
+        for (;;)
+        {
+            of.write((char*) level.data(), level.size() * sizeof(SaleaeIndexBucket));
+            ++trailer.mNumLevels;
+            if (level.size() <= 1) break;
+
+            // next level merges pairs of buckets
+            uint64_t n = (level.size() + 1) / 2;
+            for (uint64_t i = 0; i < n; i++)
+            {
+                SaleaeIndexBucket merged = level[2*i];
+                if (2*i+1 < level.size())
+                {
+                    merged.mDuration[0] += level[2*i+1].mDuration[0];
+                    merged.mDuration[1] += level[2*i+1].mDuration[1];
+                    merged.mLastValue = level[2*i+1].mLastValue;
+                }
+                level[i] = merged;
+            }
+            level.resize(n);
+        }
+
+        trailer.write(of);
+    }
+
+    SaleaeBlockTrailer::SaleaeBlockTrailer()
+        : mVersion(1), mBlockSize(SaleaeBlockWriter::sBlockSize), mNumBlocks(0), mNumTransitions(0), mDirectoryOffset(0)
+    {
+        strcpy(mIdent,sIdent);
+    }
+
+    SaleaeStatus::ErrorCode SaleaeBlockTrailer::read(std::ifstream& ff, uint64_t pos)
+    {
+        ff.seekg(pos);
+        ff.read(mIdent,8);
+        mIdent[8] = 0;
+        if (!ff.good() || mIdent != std::string(sIdent))
+            return SaleaeStatus::BadIndentifier;
+
+        ff.read((char*)&mVersion,sizeof(mVersion));
+        if (mVersion != 1)
+            return SaleaeStatus::UnsupportedType;
+
+        ff.read((char*)&mBlockSize,sizeof(mBlockSize));
+        ff.read((char*)&mNumBlocks,sizeof(mNumBlocks));
+        ff.read((char*)&mNumTransitions,sizeof(mNumTransitions));
+        ff.read((char*)&mDirectoryOffset,sizeof(mDirectoryOffset));
+        if (!ff.good())
+            return SaleaeStatus::UnexpectedEof;
+
+        return SaleaeStatus::Ok;
+    }
+
+    SaleaeStatus::ErrorCode SaleaeBlockTrailer::write(std::ofstream& of) const
+    {
+        of.write(mIdent,8);
+        of.write((char*)&mVersion,sizeof(mVersion));
+        of.write((char*)&mBlockSize,sizeof(mBlockSize));
+        of.write((char*)&mNumBlocks,sizeof(mNumBlocks));
+        of.write((char*)&mNumTransitions,sizeof(mNumTransitions));
+        of.write((char*)&mDirectoryOffset,sizeof(mDirectoryOffset));
+        return SaleaeStatus::Ok;
+    }
+
+    static_assert(sizeof(SaleaeBlockEntry) == 24, "SALEAE block directory entry must match size on disk");
+
+    namespace
+    {
+        int bitWidth(uint64_t x)
+        {
+            int retval = 0;
+            while (x)
+            {
+                ++retval;
+                x >>= 1;
+            }
+            return retval;
+        }
+
+        uint64_t numberWords(uint64_t nbits)
+        {
+            return (nbits + 63) / 64;
+        }
+
+        // packed data is only guaranteed to be aligned in memory-mapped files
+        uint64_t loadWord(const char* data, uint64_t iword)
+        {
+            uint64_t retval;
+            memcpy(&retval, data + iword * sizeof(uint64_t), sizeof(uint64_t));
+            return retval;
+        }
+    }
+
+    SaleaeBlockWriter::SaleaeBlockWriter()
+        : mNumTransitions(0)
+    {;}
+
+    void SaleaeBlockWriter::reset()
+    {
+        mTimes.clear();
+        mValues.clear();
+        mDirectory.clear();
+        mNumTransitions = 0;
+    }
+
+    void SaleaeBlockWriter::addTransition(std::ofstream& of, uint64_t t, int32_t val)
+    {
+        mTimes.push_back(t);
+        mValues.push_back(val);
+        ++mNumTransitions;
+        if (mTimes.size() >= sBlockSize)
+            writeBlock(of);
+    }
+
+    void SaleaeBlockWriter::writeBlock(std::ofstream& of)
+    {
+        if (mTimes.empty()) return;
+        uint64_t n = mTimes.size();
+
+        SaleaeBlockEntry entry;
+        entry.mOffset = of.tellp();
+        entry.mFirstTime = mTimes[0];
+        entry.mFirstValue = mValues[0];
+        entry.mReserved = 0;
+
+        // bit width of largest difference equals bit width of all differences or'ed together
+        uint64_t deltaBits = 0;
+        for (uint64_t i = 1; i < n; i++)
+            deltaBits |= mTimes[i] - mTimes[i-1];
+        bool alternating = true;
+        for (uint64_t i = 0; alternating && i < n; i++)
+            alternating = (mValues[i] == 0 || mValues[i] == 1) && (!i || mValues[i] != mValues[i-1]);
+        entry.mTimeBits = bitWidth(deltaBits);
+        entry.mValueBits = alternating ? 0 : 2;
+
+        uint64_t timeWords = numberWords((n-1) * entry.mTimeBits);
+        mPacked.assign(timeWords + numberWords(n * entry.mValueBits), 0);
+        if (entry.mTimeBits)
+        {
+            for (uint64_t i = 1; i < n; i++)
+            {
+                uint64_t delta = mTimes[i] - mTimes[i-1];
+                uint64_t bitpos = (i-1) * entry.mTimeBits;
+                uint64_t iword = bitpos / 64;
+                int shift = bitpos % 64;
+                mPacked[iword] |= delta << shift;
+                if (shift + entry.mTimeBits > 64)
+                    mPacked[iword+1] |= delta >> (64 - shift);
+            }
+        }
+        if (entry.mValueBits)
+        {
+            for (uint64_t i = 0; i < n; i++)
+            {
+                uint64_t code = (mValues[i] + 2) & 0x3;
+                mPacked[timeWords + i / 32] |= code << (2 * (i % 32));
+            }
+        }
+
+        of.write((char*) mPacked.data(), mPacked.size() * sizeof(uint64_t));
+        mDirectory.push_back(entry);
+        mTimes.clear();
+        mValues.clear();
+    }
+
+    void SaleaeBlockWriter::write(std::ofstream& of)
+    {
+        writeBlock(of);
+        SaleaeBlockTrailer trailer;
+        trailer.mNumBlocks = mDirectory.size();
+        trailer.mNumTransitions = mNumTransitions;
+        trailer.mDirectoryOffset = of.tellp();
+        of.write((char*) mDirectory.data(), mDirectory.size() * sizeof(SaleaeBlockEntry));
+        trailer.write(of);
+    }
+
+    SaleaeBlockReader::SaleaeBlockReader()
+        : mData(nullptr), mSize(0), mCacheBlock(-1)
+    {;}
+
+    SaleaeStatus::ErrorCode SaleaeBlockReader::open(const std::string& filename, std::ifstream& ff, const SaleaeHeader& header)
+    {
+        // index trailer at end of file points right behind block trailer
+        SaleaeIndexTrailer indexTrailer;
+        SaleaeStatus::ErrorCode status = indexTrailer.read(ff);
+        if (status) return status;
+        if (indexTrailer.mOffset < SaleaeBlockWriter::sDataOffset + SaleaeBlockTrailer::sSize)
+            return SaleaeStatus::UnexpectedEof;
+        status = mTrailer.read(ff, indexTrailer.mOffset - SaleaeBlockTrailer::sSize);
+        if (status) return status;
+
+        if (mTrailer.mNumTransitions != header.numTransitions() || !mTrailer.mBlockSize
+                || mTrailer.mNumBlocks != (header.numTransitions() + mTrailer.mBlockSize - 1) / mTrailer.mBlockSize
+                || mTrailer.mDirectoryOffset + mTrailer.mNumBlocks * sizeof(SaleaeBlockEntry) + SaleaeBlockTrailer::sSize != indexTrailer.mOffset)
+            return SaleaeStatus::UnexpectedEof;
+
+#ifdef STANDALONE_PARSER
+        std::ifstream content(filename, std::ios::binary | std::ios::ate);
+        if (!content.good())
+            return SaleaeStatus::ErrorOpenFile;
+        mFileContent.resize(content.tellg());
+        content.seekg(0);
+        content.read(mFileContent.data(), mFileContent.size());
+        if (!content.good())
+            return SaleaeStatus::ErrorOpenFile;
+        mData = mFileContent.data();
+        mSize = mFileContent.size();
+#else
+        if (mMappedFile.open(filename).is_error())
+            return SaleaeStatus::ErrorOpenFile;
+        mData = mMappedFile.get_data().data();
+        mSize = mMappedFile.get_size();
+#endif
+        if (mSize < indexTrailer.mOffset)
+            return SaleaeStatus::UnexpectedEof;
+
+        mDirectory.resize(mTrailer.mNumBlocks);
+        memcpy(mDirectory.data(), mData + mTrailer.mDirectoryOffset, mDirectory.size() * sizeof(SaleaeBlockEntry));
+
+        // reject directory pointing outside of block data, so that decoding needs no further checks
+        uint64_t offset = SaleaeBlockWriter::sDataOffset;
+        for (uint64_t i = 0; i < mDirectory.size(); i++)
+        {
+            const SaleaeBlockEntry& entry = mDirectory.at(i);
+            if (entry.mOffset != offset || entry.mTimeBits > 64 || (entry.mValueBits != 0 && entry.mValueBits != 2))
+                return SaleaeStatus::UnexpectedEof;
+            offset += packedWords(i) * sizeof(uint64_t);
+        }
+        if (offset != mTrailer.mDirectoryOffset)
+            return SaleaeStatus::UnexpectedEof;
+
+        mCacheTimes.resize(mTrailer.mBlockSize);
+        mCacheValues.resize(mTrailer.mBlockSize);
+        return SaleaeStatus::Ok;
+    }
+
+    uint64_t SaleaeBlockReader::blockTransitions(uint64_t iblock) const
+    {
+        uint64_t begin = iblock * mTrailer.mBlockSize;
+        return mTrailer.mNumTransitions - begin < mTrailer.mBlockSize ? mTrailer.mNumTransitions - begin : mTrailer.mBlockSize;
+    }
+
+    uint64_t SaleaeBlockReader::packedWords(uint64_t iblock) const
+    {
+        uint64_t n = blockTransitions(iblock);
+        const SaleaeBlockEntry& entry = mDirectory.at(iblock);
+        return numberWords((n-1) * entry.mTimeBits) + numberWords(n * entry.mValueBits);
+    }
+
+    void SaleaeBlockReader::decodeBlock(uint64_t iblock, uint64_t* times, int* values) const
+    {
+        const SaleaeBlockEntry& entry = mDirectory.at(iblock);
+        const char* data = mData + entry.mOffset;
+        uint64_t n = blockTransitions(iblock);
+        int bits = entry.mTimeBits;
+
+        uint64_t t = entry.mFirstTime;
+        times[0] = t;
+        if (bits)
+        {
+            uint64_t mask = bits < 64 ? (1ull << bits) - 1 : ~0ull;
+            for (uint64_t i = 1; i < n; i++)
+            {
+                uint64_t bitpos = (i-1) * bits;
+                uint64_t iword = bitpos / 64;
+                int shift = bitpos % 64;
+                uint64_t delta = loadWord(data, iword) >> shift;
+                if (shift + bits > 64)
+                    delta |= loadWord(data, iword+1) << (64 - shift);
+                t += delta & mask;
+                times[i] = t;
+            }
+        }
+        else
+        {
+            for (uint64_t i = 1; i < n; i++)
+                times[i] = t;
+        }
+
+        if (entry.mValueBits)
+        {
+            uint64_t timeWords = numberWords((n-1) * bits);
+            for (uint64_t i = 0; i < n; i++)
+                values[i] = ((loadWord(data, timeWords + i / 32) >> (2 * (i % 32))) & 0x3) - 2;
+        }
+        else
+        {
+            int val = entry.mFirstValue;
+            for (uint64_t i = 0; i < n; i++)
+            {
+                values[i] = val;
+                val = val ? 0 : 1;
+            }
+        }
+    }
+
+    void SaleaeBlockReader::cacheBlock(uint64_t iblock)
+    {
+        if (mCacheBlock == (int64_t) iblock) return;
+        decodeBlock(iblock, mCacheTimes.data(), mCacheValues.data());
+        mCacheBlock = iblock;
+    }
+
+    SaleaeDataTuple SaleaeBlockReader::get_transition(uint64_t itrans)
+    {
+        if (!itrans || itrans > mTrailer.mNumTransitions) return SaleaeDataTuple();
+        uint64_t iblock = (itrans-1) / mTrailer.mBlockSize;
+        cacheBlock(iblock);
+        uint64_t i = (itrans-1) % mTrailer.mBlockSize;
+        return SaleaeDataTuple(mCacheTimes[i], mCacheValues[i]);
+    }
+
+    void SaleaeBlockReader::get_transitions(uint64_t itrans, uint64_t n, uint64_t* times, int* values)
+    {
+        while (n)
+        {
+            uint64_t iblock = (itrans-1) / mTrailer.mBlockSize;
+            uint64_t i = (itrans-1) % mTrailer.mBlockSize;
+            uint64_t nblock = blockTransitions(iblock);
+            uint64_t m = nblock - i < n ? nblock - i : n;
+            if (!i && m == nblock && mCacheBlock != (int64_t) iblock)
+            {
+                // complete block requested, decode without detour through cache
+                decodeBlock(iblock, times, values);
+            }
+            else
+            {
+                cacheBlock(iblock);
+                memcpy(times, mCacheTimes.data() + i, m * sizeof(uint64_t));
+                memcpy(values, mCacheValues.data() + i, m * sizeof(int));
+            }
+            times += m;
+            values += m;
+            itrans += m;
+            n -= m;
+        }
+    }
+
+    uint64_t SaleaeBlockReader::find_transition(uint64_t t)
+    {
+        // binary search for last block starting at or before t, then within block
+        uint64_t lower = 0;
+        uint64_t upper = mDirectory.size();
+        while (lower < upper)
+        {
+            uint64_t mid = (lower + upper) / 2;
+            if (mDirectory[mid].mFirstTime <= t)
+                lower = mid + 1;
+            else
+                upper = mid;
+        }
+        if (!lower) return 0;
+        uint64_t iblock = lower - 1;
+        cacheBlock(iblock);
+        uint64_t n = blockTransitions(iblock);
+        uint64_t i = std::upper_bound(mCacheTimes.begin(), mCacheTimes.begin() + n, t) - mCacheTimes.begin();
+        return iblock * mTrailer.mBlockSize + i;
+    }
+
+    SaleaeIndexFile::SaleaeIndexFile(const std::string &filename)
+        : std::ifstream(filename, std::ios::binary), mStatus(SaleaeStatus::Ok), mValid(false),
+          mCacheLevel(-1), mCacheBegin(0)
+    {
+        if (good())
+            mStatus = mHeader.read(*this);
+        else
+            mStatus = SaleaeStatus::ErrorOpenFile;
+
+        if (!mStatus && mHeader.storageFormat() != SaleaeHeader::Double)
+            mStatus = mTrailer.read(*this);
+
+        if (mStatus)
+        {
+            setstate(failbit);
+            return;
+        }
+
+        // index must match transition data, otherwise data file was replaced by writer unaware of index
+        uint64_t dataEnd = 44 + mHeader.numTransitions() * sizeof(uint64_t);
+        if (mHeader.storageFormat() == SaleaeHeader::Compressed)
+        {
+            // index follows block directory and trailer
+            SaleaeBlockTrailer blockTrailer;
+            if (mTrailer.mOffset < (uint64_t) SaleaeBlockTrailer::sSize
+                    || blockTrailer.read(*this, mTrailer.mOffset - SaleaeBlockTrailer::sSize)
+                    || blockTrailer.mNumTransitions != mHeader.numTransitions())
+                return;
+            dataEnd = mTrailer.mOffset;
+        }
+        if (mTrailer.mNumTransitions != mHeader.numTransitions()
+                || mTrailer.mOffset != dataEnd
+                || !mTrailer.mNumLevels || mTrailer.mShift + mTrailer.mNumLevels > 64 || !mTrailer.mNumBuckets)
+            return;
+        seekg(0, std::ios_base::end);
+        mValid = (uint64_t) tellg() == levelOffset(mTrailer.mNumLevels) + SaleaeIndexTrailer::sSize;
+    }
+
+    uint64_t SaleaeIndexFile::levelOffset(int level) const
+    {
+        uint64_t retval = mTrailer.mOffset;
+        for (int i=0; i<level; i++)
+            retval += mTrailer.numBuckets(i) * sizeof(SaleaeIndexBucket);
+        return retval;
+    }
+
+    int SaleaeIndexFile::get_level(uint64_t dt) const
+    {
+        if (!mValid || dt < bucket_width(0)) return -1;
+        int retval = 0;
+        while (retval + 1 < (int) mTrailer.mNumLevels && bucket_width(retval + 1) <= dt)
+            ++retval;
+        return retval;
+    }
+
+    uint64_t SaleaeIndexFile::bucket_index(int level, uint64_t t) const
+    {
+        if (t <= mHeader.beginTime()) return 0;
+        uint64_t retval = (t - mHeader.beginTime()) >> (mTrailer.mShift + level);
+        uint64_t n = number_buckets(level);
+        return retval < n ? retval : n - 1;
+    }
+
+    SaleaeIndexBucket SaleaeIndexFile::get_bucket(int level, uint64_t ibucket)
+    {
+        if (!mValid || level < 0 || level >= (int) mTrailer.mNumLevels || ibucket >= number_buckets(level))
+            return SaleaeIndexBucket();
+
+        if (level != mCacheLevel || ibucket < mCacheBegin || ibucket >= mCacheBegin + mCache.size())
+        {
+            // read block of consecutive buckets since caller is likely to walk along time axis
+            uint64_t n = number_buckets(level) - ibucket;
+            if (n > sCacheSize) n = sCacheSize;
+            mCache.resize(n);
+            clear();
+            seekg(levelOffset(level) + ibucket * sizeof(SaleaeIndexBucket));
+            read((char*) mCache.data(), n * sizeof(SaleaeIndexBucket));
+            if (!good())
+            {
+                mCacheLevel = -1;
+                mCache.clear();
+                return SaleaeIndexBucket();
+            }
+            mCacheLevel = level;
+            mCacheBegin = ibucket;
+        }
+        return mCache.at(ibucket - mCacheBegin);
+    }
+
+    uint64_t SaleaeIndexFile::get_bucket_transitions(int level, uint64_t ibucket)
+    {
+        uint64_t first = get_bucket(level, ibucket).mFirstTransition;
+        uint64_t next = (ibucket + 1 < number_buckets(level))
+                ? get_bucket(level, ibucket + 1).mFirstTransition
+                : mHeader.numTransitions() + 1;
+        return next - first;
+    }
+
+    SaleaeOutputFile::SaleaeOutputFile(const std::string &filename, int index_, SaleaeHeader::StorageFormat sf)
         : std::ofstream(filename, std::ios::binary), mIndex(index_), mFilename(filename), mStatus(SaleaeStatus::Ok),
           mFirstValue(true), mLastWrittenValue(0), mLastWrittenTime(0)
     {
+        if (sf == SaleaeHeader::Compressed)
+            mHeader.setStorageFormat(sf);
         if (!good())
             mStatus = SaleaeStatus::ErrorOpenFile;
         else
-            mHeader.write(*this);
+            writeHeader();
+    }
+
+    void SaleaeOutputFile::writeHeader()
+    {
+        mHeader.write(*this);
+        if (mHeader.storageFormat() == SaleaeHeader::Compressed)
+        {
+            // pad header so that blocks start at aligned offset
+            const char padding[SaleaeBlockWriter::sDataOffset - 44] = {0};
+            write(padding, sizeof(padding));
+        }
     }
 
     void SaleaeOutputFile::convertToCoded()
@@ -384,8 +1049,28 @@ namespace hal
     void SaleaeOutputFile::put_data(SaleaeDataBuffer *buf)
     {
         if (!buf->mCount) return;
-        SaleaeHeader::StorageFormat sf = SaleaeHeader::Uint64;
-        for (uint64_t i = 0; i<buf->mCount; i++)
+        mHeader.setBeginTime(buf->mTimeArray[0]);
+        if (mHeader.storageFormat() == SaleaeHeader::Compressed)
+        {
+            uint64_t n = buf->mCount - 1;
+            mHeader.setValue(buf->mValueArray[0]);
+            mHeader.setEndTime(buf->mTimeArray[n]);
+            mHeader.setNumTransitions(n);
+            mIndexBuilder.reset(mHeader.beginTime(), buf->mValueArray[0]);
+            mBlockWriter.reset();
+            seekp(SaleaeBlockWriter::sDataOffset);
+            for (uint64_t i = 1; i<buf->mCount; i++)
+            {
+                mIndexBuilder.addTransition(buf->mTimeArray[i], buf->mValueArray[i]);
+                mBlockWriter.addTransition(*this, buf->mTimeArray[i], buf->mValueArray[i]);
+            }
+            // close will write header info
+            return;
+        }
+
+        // keep coded format when called from convertToCoded() even if buffer has no undefined values yet
+        SaleaeHeader::StorageFormat sf = mHeader.storageFormat() == SaleaeHeader::Coded ? SaleaeHeader::Coded : SaleaeHeader::Uint64;
+        for (uint64_t i = 0; sf != SaleaeHeader::Coded && i<buf->mCount; i++)
         {
             if (buf->mValueArray[i] < 0)
             {
@@ -398,6 +1083,9 @@ namespace hal
         mHeader.setValue(buf->mValueArray[0]);
         mHeader.setEndTime(buf->mTimeArray[n]);
         mHeader.setNumTransitions(n);
+        mIndexBuilder.reset(mHeader.beginTime(), buf->mValueArray[0]);
+        for (uint64_t i = 1; i<buf->mCount; i++)
+            mIndexBuilder.addTransition(buf->mTimeArray[i], buf->mValueArray[i]);
         if (sf == SaleaeHeader::Coded)
             buf->convertCoded();
         this->write((char*) (buf->mTimeArray+1), n * sizeof(uint64_t));
@@ -414,6 +1102,7 @@ namespace hal
             mFirstValue = false;
             mLastWrittenValue = val;
             mLastWrittenTime = t;
+            mIndexBuilder.reset(t, val);
         }
         else
         {
@@ -424,7 +1113,9 @@ namespace hal
             mLastWrittenValue = val;
             mLastWrittenTime  = t;
 
-            if (mHeader.storageFormat() == SaleaeHeader::Coded)
+            if (mHeader.storageFormat() == SaleaeHeader::Compressed)
+                mBlockWriter.addTransition(*this, t, val);
+            else if (mHeader.storageFormat() == SaleaeHeader::Coded)
             {
                 uint64_t buf = val + 2;
                 buf <<= 62;
@@ -435,6 +1126,7 @@ namespace hal
                 write((char*)&t,sizeof(t));
             mHeader.incrementTransitions();
             mHeader.setEndTime(t);
+            mIndexBuilder.addTransition(t, val);
         }
     }
 
@@ -447,6 +1139,13 @@ namespace hal
     void SaleaeOutputFile::close()
     {
         if (!good()) return;
+        if (!mFirstValue || mHeader.numTransitions())
+        {
+            seekp(0, std::ios_base::end);
+            if (mHeader.storageFormat() == SaleaeHeader::Compressed)
+                mBlockWriter.write(*this);
+            mIndexBuilder.write(*this);
+        }
         seekp(std::ios_base::beg);
         mHeader.write(*this);
         std::ofstream::close();
@@ -17,9 +17,19 @@ namespace hal
     uint64_t SaleaeParser::sTimeScaleFactor = 1000000000;
 
         SaleaeParser::SaleaeParser(const std::string& filename)
-        : mSaleaeDirectory(filename)
+        : mSaleaeDirectory(filename), mSequence(0)
     {;}
 
+    SaleaeParser::~SaleaeParser()
+    {
+        for (const NextEvent& nev : mNextEventHeap)
+        {
+            DataFileHandle& dfh = mDataFiles[nev.handle];
+            delete dfh.buffer;
+            delete dfh.file;
+        }
+    }
+
     std::string SaleaeParser::strim(std::string s)
     {
         if (s.empty()) return s;
@@ -35,28 +45,76 @@ namespace hal
         return s.substr(p0,p1-p0+1);
     }
 
+    bool SaleaeParser::readNextEvent(DataFileHandle& dfh, uint64_t& t)
+    {
+        if (!dfh.buffer || dfh.index >= dfh.buffer->mCount)
+        {
+            delete dfh.buffer;
+            dfh.buffer = dfh.file->good() ? dfh.file->get_buffered_data(sReadBatchSize) : nullptr;
+            dfh.index = 0;
+            if (!dfh.buffer) return false;
+        }
+        t = dfh.buffer->mTimeArray[dfh.index];
+        dfh.value = dfh.buffer->mValueArray[dfh.index];
+        ++dfh.index;
+        return true;
+    }
+
+    void SaleaeParser::siftDown(size_t i)
+    {
+        size_t n = mNextEventHeap.size();
+        NextEvent nev = mNextEventHeap[i];
+        for (;;)
+        {
+            size_t child = 2*i+1;
+            if (child >= n) break;
+            if (child+1 < n && mNextEventHeap[child+1] < mNextEventHeap[child]) ++child;
+            if (!(mNextEventHeap[child] < nev)) break;
+            mNextEventHeap[i] = mNextEventHeap[child];
+            i = child;
+        }
+        mNextEventHeap[i] = nev;
+    }
+
+    void SaleaeParser::siftUp(size_t i)
+    {
+        NextEvent nev = mNextEventHeap[i];
+        while (i)
+        {
+            size_t parent = (i-1) / 2;
+            if (!(nev < mNextEventHeap[parent])) break;
+            mNextEventHeap[i] = mNextEventHeap[parent];
+            i = parent;
+        }
+        mNextEventHeap[i] = nev;
+    }
+
     bool SaleaeParser::next_event()
     {
-        auto it = mNextValueMap.begin();
-        if (it == mNextValueMap.end()) return false;
-        DataFileHandle wff = it->second;
-        mNextValueMap.erase(it);
-//        std::cerr << "SaleaeParser::callback o=" << std::hex << (uintptr_t)wff.obj << " t=" << std::dec << it->first << " v=" << wff.value << " size=" << mNextValueMap.size() << std::endl;
-        wff.callback(wff.obj,it->first,wff.value);
-        if (wff.file->good())
+        if (mNextEventHeap.empty()) return false;
+        NextEvent nev = mNextEventHeap.front();
+//        std::cerr << "SaleaeParser::callback o=" << std::hex << (uintptr_t)mDataFiles[nev.handle].obj << " t=" << std::dec << nev.time << " v=" << mDataFiles[nev.handle].value << " size=" << mNextEventHeap.size() << std::endl;
+        {
+            const DataFileHandle& dfh = mDataFiles[nev.handle];
+            dfh.callback(dfh.obj,nev.time,dfh.value);
+        }
+
+        // callback might have registered further data files, thus get handle again
+        DataFileHandle& dfh = mDataFiles[nev.handle];
+        uint64_t nextT;
+        if (readNextEvent(dfh, nextT))
         {
-            SaleaeDataTuple sdt = wff.file->get_next_value();
-            if (!sdt.readError())
-            {
-                wff.value = sdt.mValue;
-                uint64_t nextT = sdt.mTime;
-                mNextValueMap.insert(std::pair<uint64_t,DataFileHandle>(nextT,wff));
-            }
-            else
-                delete wff.file;
+            // replace top of heap by next event from same file
+            mNextEventHeap.front() = {nextT, mSequence++, nev.handle};
         }
         else
-            delete wff.file;
+        {
+            delete dfh.file;
+            dfh.file = nullptr;
+            mNextEventHeap.front() = mNextEventHeap.back();
+            mNextEventHeap.pop_back();
+        }
+        if (!mNextEventHeap.empty()) siftDown(0);
         return true;
     }
 
@@ -83,7 +141,9 @@ namespace hal
             delete datafile;
             return false;
         }
-        mNextValueMap.insert(std::pair<uint64_t,DataFileHandle>(0,{callback, datafile, datafile->get_next_value().mValue, obj}));
+        mDataFiles.push_back({callback, datafile, nullptr, 0, datafile->get_next_value().mValue, obj});
+        mNextEventHeap.push_back({0, mSequence++, mDataFiles.size()-1});
+        siftUp(mNextEventHeap.size()-1);
         return true;
     }
 }
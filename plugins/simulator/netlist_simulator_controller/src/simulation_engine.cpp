@@ -87,6 +87,17 @@ namespace hal
         return std::vector<WaveEvent>();
     }
 
+    u32 SimulationEngineEventDriven::get_num_lanes() const
+    {
+        return 1;
+    }
+
+    std::vector<WaveEvent> SimulationEngineEventDriven::get_lane_simulation_events(u32 netId, u32 lane) const
+    {
+        if (lane) return std::vector<WaveEvent>();
+        return get_simulation_events(netId);
+    }
+
     bool SimulationEngineEventDriven::setSimulationInput(SimulationInput* simInput)
     {
         mSimulationInput = simInput;
@@ -44,6 +44,17 @@ namespace hal {
         m_input_nets.clear();
         m_output_nets.clear();
         m_partial_nets.clear();
+        m_lane_inputs.clear();
+    }
+
+    void SimulationInput::add_lane_input(u64 t, const SimulationInputLaneValue& lv)
+    {
+        m_lane_inputs[t].push_back(lv);
+    }
+
+    void SimulationInput::clear_lane_inputs()
+    {
+        m_lane_inputs.clear();
     }
 
     bool SimulationInput::is_ready() const
@@ -4,6 +4,7 @@
 #include "hal_core/utilities/log.h"
 #include <QProcess>
 #include <QThread>
+#include <map>
 #include <vector>
 
 namespace hal {
@@ -31,20 +32,41 @@ namespace hal {
         mSimulTime = 0;
         SaleaeParser sp(mSaleaeDirectoryFilename);
 
+        const std::map<u64,std::vector<SimulationInputLaneValue>>& laneInputs = mSimulationInput->get_lane_inputs();
+        auto laneIt = laneInputs.begin();
+
+        // merge lane specific input values up to current time into sequence of input events
+        auto mergeLaneValues = [this,&laneInputs,&laneIt]() {
+            for (; laneIt != laneInputs.end() && laneIt->first <= mSimulTime; ++laneIt)
+                for (const SimulationInputLaneValue& lv : laneIt->second)
+                    mSimulationInputNetEvent.add_lane_value(lv);
+        };
+
+        // send pending input event to engine and advance simulation time to tNext
+        auto advanceTo = [this](u64 tNext) {
+            mSimulationInputNetEvent.set_simulation_duration(tNext - mSimulTime);
+            if (!mEngine->inputEvent(mSimulationInputNetEvent))
+            {
+                mEngine->failed();
+                return false;
+            }
+            mSimulTime = tNext;
+            mSimulationInputNetEvent.clear();
+            mSimulationInputNetEvent.clear_lane_values();
+            return true;
+        };
+
         for (const Net* net : mSimulationInput->get_input_nets())
         {
             void* registerObj = (void*) net;
-            sp.register_callback(net,[this](const void* obj, uint64_t t, int val) {
-                if (t != mSimulTime)
+            sp.register_callback(net,[this,&laneInputs,&laneIt,&mergeLaneValues,&advanceTo](const void* obj, uint64_t t, int val) {
+                while (t != mSimulTime)
                 {
-                    mSimulationInputNetEvent.set_simulation_duration(t - mSimulTime);
-                    if (!mEngine->inputEvent(mSimulationInputNetEvent))
-                    {
-                        mEngine->failed();
-                        return;
-                    }
-                    mSimulTime = t;
-                    mSimulationInputNetEvent.clear();
+                    mergeLaneValues();
+                    u64 tNext = t;
+                    if (laneIt != laneInputs.end() && laneIt->first < t)
+                        tNext = laneIt->first;
+                    if (!advanceTo(tNext)) return;
                 }
                 mSimulationInputNetEvent.insert(std::make_pair(static_cast<const Net*>(obj),static_cast<BooleanFunction::Value>(val)));
             }, registerObj);
@@ -56,6 +78,17 @@ namespace hal {
                 return terminateThread(false, "run");
         }
 
+        // lane specific values at or after last regular input event, the last of them is applied without advancing time
+        mergeLaneValues();
+        while (laneIt != laneInputs.end())
+        {
+            if (!advanceTo(laneIt->first))
+                return terminateThread(false, "run");
+            mergeLaneValues();
+        }
+        if (!mSimulationInputNetEvent.get_lane_values().empty() && !advanceTo(mSimulTime))
+            return terminateThread(false, "run");
+
         terminateThread(mEngine->finalize(), "finalize");
     }
 }
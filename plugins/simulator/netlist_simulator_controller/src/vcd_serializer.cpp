@@ -13,11 +13,22 @@
 #include <QDir>
 #include <math.h>
 #include <QCoreApplication>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <zlib.h>
 
 namespace hal {
 
     const int maxErrorMessages = 3;
 
+    /// Number of transitions per block merged and written at once during VCD export
+    const u64 sExportBufferedEvents = 1 << 20;
+
+    /// Maximum number of transitions buffered for a single waveform during VCD export
+    const u64 sExportMaxBatchSize = 1 << 16;
+
     VcdSerializerElement::VcdSerializerElement(int inx, const WaveData* wd)
         : mIndex(inx), mData(wd), mTime(0), mValue(SaleaeDataTuple::sReadError)
     {;}
@@ -75,160 +86,481 @@ namespace hal {
         memset(mErrorCount, 0, sizeof(mErrorCount));
     }
 
-    void VcdSerializer::writeVcdEvent(QFile&of)
-    {
-        if (mTime < mFirstTimestamp || mTime > mLastTimestamp) return;
-        bool first = true;
-        for (VcdSerializerElement* vse : mWriteElements)
+    namespace {
+
+        /**
+         * Preallocated output buffer for VCD export. Content is written to file when the buffer is full,
+         * files with suffix '.gz' get gzip-compressed.
+         */
+        class VcdWriteBuffer
+        {
+            static const size_t sBufferSize = 1 << 20;
+            std::vector<char> mBuffer;
+            size_t mSize;
+            QFile mFile;
+            gzFile mGzFile;
+            bool mOk;
+
+            char* reserve(size_t n)
+            {
+                if (mSize + n > mBuffer.size())
+                {
+                    flush();
+                    if (n > mBuffer.size()) mBuffer.resize(n);
+                }
+                return mBuffer.data() + mSize;
+            }
+
+        public:
+            VcdWriteBuffer() : mBuffer(sBufferSize), mSize(0), mGzFile(nullptr), mOk(false) {;}
+            ~VcdWriteBuffer() { close(); }
+
+            bool open(const QString& filename)
+            {
+                if (filename.endsWith(".gz"))
+                {
+                    // fast compression level, VCD text compresses well anyway
+                    mGzFile = gzopen(filename.toLocal8Bit().constData(), "wb1");
+                    mOk = (mGzFile != nullptr);
+                }
+                else
+                {
+                    mFile.setFileName(filename);
+                    mOk = mFile.open(QIODevice::WriteOnly);
+                }
+                return mOk;
+            }
+
+            void flush()
+            {
+                if (mSize && mOk)
+                {
+                    if (mGzFile)
+                        mOk = (gzwrite(mGzFile, mBuffer.data(), mSize) == (int) mSize);
+                    else
+                        mOk = (mFile.write(mBuffer.data(), mSize) == (qint64) mSize);
+                }
+                mSize = 0;
+            }
+
+            bool close()
+            {
+                flush();
+                if (mGzFile)
+                {
+                    if (gzclose(mGzFile) != Z_OK) mOk = false;
+                    mGzFile = nullptr;
+                }
+                else if (mFile.isOpen())
+                    mFile.close();
+                return mOk;
+            }
+
+            void append(const char* s, size_t len)
+            {
+                memcpy(reserve(len), s, len);
+                mSize += len;
+            }
+
+            void append(const QByteArray& s) { append(s.constData(), s.size()); }
+
+            void appendTime(u64 t)
+            {
+                char tmp[21];
+                int len = 0;
+                do
+                {
+                    tmp[len++] = '0' + t % 10;
+                    t /= 10;
+                } while (t);
+                char* p = reserve(len + 2);
+                *(p++) = '#';
+                for (int i = len - 1; i >= 0; i--)
+                    *(p++) = tmp[i];
+                *p = '\n';
+                mSize += len + 2;
+            }
+
+            void appendValue(int val, const QByteArray& code)
+            {
+                char* p = reserve(code.size() + 2);
+                switch (val)
+                {
+                case 0:  *p = '0'; break;
+                case 1:  *p = '1'; break;
+                case -2: *p = 'z'; break;
+                default: *p = 'x'; break;
+                }
+                memcpy(p + 1, code.constData(), code.size());
+                p[code.size() + 1] = '\n';
+                mSize += code.size() + 2;
+            }
+        };
+
+        /// Waveform to be exported, transitions are read in batches from SALEAE file
+        struct VcdExportWave
         {
-            if (vse->hasData())
+            QByteArray mCode;
+            SaleaeInputFile* mFile;
+            std::vector<u64> mTimes;
+            std::vector<int> mValues;
+            size_t mHead;
+            u64 mBatchSize;
+            int mLastValue;
+            bool mMoreData;
+
+            VcdExportWave() : mFile(nullptr), mHead(0), mBatchSize(0), mLastValue(SaleaeDataTuple::sReadError), mMoreData(false) {;}
+            ~VcdExportWave() { delete mFile; }
+            VcdExportWave(const VcdExportWave&) = delete;
+            VcdExportWave& operator=(const VcdExportWave&) = delete;
+
+            /// Number of buffered transitions not processed yet
+            size_t remaining() const { return mTimes.size() - mHead; }
+
+            /// Append next batch of transitions from file to buffer, returns false if there are no more transitions
+            bool refill()
             {
-                qulonglong ts = (vse->time() == 0) ? 0 : vse->time() - mTimeShift;
-                if (first)
+                SaleaeDataBuffer* sdb = (mMoreData && mFile->good()) ? mFile->get_buffered_data(mBatchSize) : nullptr;
+                if (!sdb)
                 {
-                    of.write('#' + QByteArray::number(ts) + '\n');
-                    first = false;
+                    mMoreData = false;
+                    return false;
                 }
-                of.write(QByteArray::number(vse->value()) + vse->charCode() + '\n');
-                vse->value();
-                vse->reset();
+                mTimes.erase(mTimes.begin(), mTimes.begin() + mHead);
+                mValues.erase(mValues.begin(), mValues.begin() + mHead);
+                mHead = 0;
+                mTimes.insert(mTimes.end(), sdb->mTimeArray, sdb->mTimeArray + sdb->mCount);
+                mValues.insert(mValues.end(), sdb->mValueArray, sdb->mValueArray + sdb->mCount);
+                delete sdb;
+                return true;
+            }
+        };
+
+        struct VcdExportEvent
+        {
+            u64 mTime;
+            int mWave;
+            int mValue;
+        };
 
+        /// Stable LSD radix sort of events by time, all times must be in range [base, base+span] with span < 2^32
+        void sortExportEvents(std::vector<VcdExportEvent>& events, std::vector<VcdExportEvent>& tmp, u64 base, u64 span)
+        {
+            tmp.resize(events.size());
+            for (int shift = 0; shift < 32 && (span >> shift); shift += 8)
+            {
+                size_t offset[257] = {0};
+                for (const VcdExportEvent& evt : events)
+                    ++offset[((evt.mTime - base) >> shift & 0xff) + 1];
+                for (int i = 1; i < 257; i++)
+                    offset[i] += offset[i-1];
+                for (const VcdExportEvent& evt : events)
+                    tmp[offset[(evt.mTime - base) >> shift & 0xff]++] = evt;
+                events.swap(tmp);
             }
         }
     }
 
     bool VcdSerializer::exportVcd(const QString &filename, const QList<const WaveData*>& waves, u32 startTime, u32 endTime, u32 timeSift)
     {
-        mTimeShift = timeSift;
-        mFirstTimestamp = startTime;
-        mLastTimestamp  = endTime - mTimeShift;
         if (waves.isEmpty()) return false;
-        SaleaeParser parser(mSaleaeDirectoryFilename.toStdString());
-        QFile of(filename);
-        if (!of.open(QIODevice::WriteOnly)) return false;
+        u64 tBeg = (u64) startTime + timeSift;
+        u64 tEnd = endTime;
 
-        mTime = 0;
-        of.write(QByteArray("$scope module top_module $end\n"));
+        VcdWriteBuffer vwb;
+        if (!vwb.open(filename)) return false;
+
+        SaleaeDirectory sd(mSaleaeDirectoryFilename.toStdString());
 
         int n = waves.size();
+        std::vector<VcdExportWave> exportWaves(n);
+        u64 batchSize = std::min(std::max(sExportBufferedEvents / n, (u64) 64), sExportMaxBatchSize);
 
+        vwb.append(QByteArray("$scope module top_module $end\n"));
         for (int i=0; i<n; i++)
         {
             const WaveData* wd = waves.at(i);
-            VcdSerializerElement* vse = new VcdSerializerElement(i,wd);
-            mWriteElements.append(vse);
-            parser.register_callback(wd->name().toStdString(),wd->id(),[this,&of](const void* obj, uint64_t t, int val) {
-                VcdSerializerElement* vse = (VcdSerializerElement*) obj;
-                if ((int)t - (int)mTimeShift < 0) {
-                    vse->setEvent(0,val);
-                }
-                else {
-                    if (t != mTime)
+            VcdSerializerElement vse(i,wd);
+            VcdExportWave& vew = exportWaves[i];
+            vew.mCode = vse.charCode();
+            vwb.append(QString("$var wire 1 %1 %2 $end\n").arg(QString::fromUtf8(vew.mCode), vse.name()).toUtf8());
+
+            std::string path = sd.get_datafile_path(wd->name().toStdString(),wd->id());
+            if (path.empty()) continue;
+            vew.mFile = new SaleaeInputFile(path);
+            if (!vew.mFile->good()) continue;
+            vew.mMoreData = true;
+            vew.mBatchSize = batchSize;
+            // skip transitions before start of export time frame
+            if (tBeg > vew.mFile->header()->beginTime())
+                vew.mFile->get_file_position(tBeg);
+        }
+        vwb.append(QByteArray("$upscope $end\n$enddefinitions $end\n"));
+
+        // initial values at begin of time frame
+        vwb.appendTime(tBeg - timeSift);
+        for (VcdExportWave& vew : exportWaves)
+        {
+            int val = SaleaeDataTuple::sReadError;
+            while (vew.remaining() || vew.refill())
+            {
+                if (vew.mTimes[vew.mHead] > tBeg) break;
+                val = vew.mValues[vew.mHead++];
+            }
+            if (val != SaleaeDataTuple::sReadError)
+            {
+                vwb.appendValue(val, vew.mCode);
+                vew.mLastValue = val;
+            }
+        }
+
+        // Merge transitions in blocks: all transitions within time frame (limit, horizon] are buffered
+        // for every wave, they get collected, sorted by time, and written. Time frame size gets adjusted
+        // to number of transitions found in previous block.
+        std::vector<VcdExportEvent> events;
+        std::vector<VcdExportEvent> tmp;
+        u64 limit = tBeg;
+        u64 lastTime = tBeg;
+        u64 delta = 1024;
+        while (limit < tEnd)
+        {
+            u64 horizon = (tEnd - limit > delta) ? limit + delta : tEnd;
+            for (VcdExportWave& vew : exportWaves)
+            {
+                // further transitions at time of last buffered transition might follow in file
+                while (vew.mMoreData && (!vew.remaining() || vew.mTimes.back() <= horizon))
+                {
+                    if (vew.remaining() >= sExportMaxBatchSize && vew.mTimes.back() - 1 > limit)
                     {
-                        writeVcdEvent(of);
-                        mTime = t - mTimeShift;
+                        // too many transitions, reduce time frame
+                        horizon = vew.mTimes.back() - 1;
+                        break;
                     }
-                    vse->setEvent(t,val);
+                    vew.refill();
                 }
-            },vse);
-            QString line = QString("$var wire 1 %1 %2 $end\n").arg(QString::fromUtf8(vse->charCode())).arg(vse->name());
-            of.write(line.toUtf8());
-        }
-
-        of.write(QByteArray("$upscope $end\n$enddefinitions $end\n"));
+                if (vew.mMoreData && vew.mTimes.back() > tEnd)
+                    vew.mMoreData = false; // no need to read transitions behind end of time frame
+            }
 
-        while (parser.next_event()) {;}
-        for (VcdSerializerElement* vse : mWriteElements)
-            delete vse;
-        mWriteElements.clear();
+            events.clear();
+            for (int i=0; i<n; i++)
+            {
+                VcdExportWave& vew = exportWaves[i];
+                while (vew.mHead < vew.mTimes.size() && vew.mTimes[vew.mHead] <= horizon)
+                {
+                    events.push_back({vew.mTimes[vew.mHead], i, vew.mValues[vew.mHead]});
+                    ++vew.mHead;
+                }
+            }
+            sortExportEvents(events, tmp, limit + 1, horizon - limit - 1);
 
-        return true;
-    }
+            for (const VcdExportEvent& evt : events)
+            {
+                VcdExportWave& vew = exportWaves[evt.mWave];
+                if (evt.mValue == vew.mLastValue) continue;
+                if (evt.mTime != lastTime)
+                {
+                    vwb.appendTime(evt.mTime - timeSift);
+                    lastTime = evt.mTime;
+                }
+                vwb.appendValue(evt.mValue, vew.mCode);
+                vew.mLastValue = evt.mValue;
+            }
+            delta = horizon - limit;
+            if (events.size() < sExportBufferedEvents / 2 && delta <= 0x7fffffffull)
+                delta *= 2;
+            else if (events.size() > sExportBufferedEvents * 2 && delta > 1)
+                delta /= 2;
+            limit = horizon;
+        }
 
-    bool VcdSerializer::parseVcdDataNonDecimal(const QByteArray &line, int base)
-    {
-        QList<QByteArray> sl = line.split(' ');
-        if (sl.size()!=2) return false;
-        bool ok;
-        int val = sl.at(0).toUInt(&ok,base);
-        if (!ok)
+        // open files are kept in a list by the C library with the latest first, closing
+        // them in reverse order avoids a list traversal for each file
+        for (auto it = exportWaves.rbegin(); it != exportWaves.rend(); ++it)
         {
-            if (mErrorCount[0]++ < maxErrorMessages)
-                log_warning("waveform_viewer", "Cannot parse VCD data value '{}'", std::string(sl.at(0).data()));
-            val = 0;
+            delete it->mFile;
+            it->mFile = nullptr;
         }
-        storeValue(val, sl.at(1));
-        // [return ok] return statement if we want to bail out upon data parse error
-        return true; // ignore parse errors
+
+        return vwb.close();
     }
 
-    bool VcdSerializer::parseVcdDataline(char *buf, int len)
-    {
-        int pos = 0;
-        while (len)
+    namespace {
+
+        /**
+         * Section of VCD data lines starting with a timestamp line (with the exception of the first
+         * section) and the value changes parsed from it sorted by waveform index.
+         */
+        struct VcdDataChunk
+        {
+            const char* mBegin;
+            const char* mEnd;
+            u64 mTime;
+            bool mOk;
+            std::string mErrorLine;
+            std::vector<std::vector<std::pair<u64,int>>> mEvents;
+
+            void reset(const char* beg, const char* end, u64 t, int nwaves)
+            {
+                mBegin = beg;
+                mEnd   = end;
+                mTime  = t;
+                mOk    = true;
+                mErrorLine.clear();
+                mEvents.resize(nwaves);
+                for (std::vector<std::pair<u64,int>>& evts : mEvents)
+                    evts.clear();
+            }
+        };
+
+        /**
+         * Maps VCD identifier codes to waveform index. Short codes consisting of printable characters
+         * (as generated by most simulators) are resolved by direct table lookup.
+         */
+        class VcdAbbrevLookup
         {
-            int val = -1;
-            switch(*(buf+pos))
+            static const int sMaxDirectLength = 3;
+            static const int sNumChars = 94; // printable ASCII characters '!' ... '~'
+            std::vector<int> mDirect;
+            int mOffset[sMaxDirectLength+1];
+            std::unordered_map<std::string,int> mIndexByAbbrev;
+
+            int directIndex(const char* abbrev, int len) const
             {
-            case 'b': return true; // parseVcdDataNonDecimal(QByteArray(buf+pos+1,len-1),2);
-            case 'o': return true; //parseVcdDataNonDecimal(QByteArray(buf+pos+1,len-1),8);
-            case 'h': return true; // parseVcdDataNonDecimal(QByteArray(buf+pos+1,len-1),16);
-            case '$':
+                if (len > sMaxDirectLength) return -1;
+                int retval = 0;
+                for (int i = 0; i < len; i++)
+                {
+                    int c = abbrev[i] - '!';
+                    if (c < 0 || c >= sNumChars) return -1;
+                    retval = retval * sNumChars + c;
+                }
+                return mOffset[len-1] + retval;
+            }
+
+        public:
+            VcdAbbrevLookup()
             {
-                QByteArray testKeyword = QByteArray(buf+pos+1,len-1);
-                if (testKeyword.startsWith("dumpvars") || testKeyword.startsWith("end"))
-                    return true;
-                return false;
+                mOffset[0] = 0;
+                for (int i = 1, n = sNumChars; i <= sMaxDirectLength; i++, n *= sNumChars)
+                    mOffset[i] = mOffset[i-1] + n;
             }
-            case '#':
+
+            void insert(const std::string& abbrev, int index)
             {
-                bool ok;
-                mTime = QByteArray(buf+pos+1,len-1).toULongLong(&ok);
-                Q_ASSERT(ok);
-                return true;
+                int inx = directIndex(abbrev.data(), abbrev.size());
+                if (inx < 0)
+                {
+                    mIndexByAbbrev[abbrev] = index;
+                    return;
+                }
+                if (inx >= (int) mDirect.size())
+                    mDirect.resize(mOffset[abbrev.size()], -1);
+                mDirect[inx] = index;
             }
-            case 'x':
-                val = -1;
-                break;
-            case 'z':
-                val = -2;
-                break;
-            case '0':
-            case '1':
-            case '2':
-            case '3':
-            case '4':
-            case '5':
-            case '6':
-            case '7':
-                val = *(buf+pos)-'0';
-                break;
-            default:
-                qDebug() << "cannot parse dataline entries starting with" << *(buf+pos) << buf;
-                return false;
+
+            /// Returns waveform index or -1 if identifier code not registered
+            int find(const char* abbrev, int len) const
+            {
+                int inx = directIndex(abbrev, len);
+                if (inx >= 0) return inx < (int) mDirect.size() ? mDirect[inx] : -1;
+                if (mIndexByAbbrev.empty()) return -1;
+                auto it = mIndexByAbbrev.find(std::string(abbrev, len));
+                return it == mIndexByAbbrev.end() ? -1 : it->second;
             }
-            int p = pos+1;
-            while (p<len && buf[p]>' ') ++p;
-            Q_ASSERT(p > pos+1);
-            int abbrevLen = p - pos - 1;
-            storeValue(val,QByteArray(buf+pos+1,abbrevLen));
-            pos = p;
-            len -= (abbrevLen+1) ;
-            while (buf[pos]==' ' && len > 0)
+        };
+
+        /// Returns start of first line beginning with a timestamp at or behind pos, or end if there is none
+        const char* findVcdChunkEnd(const char* pos, const char* end)
+        {
+            if (pos >= end) return end;
+            for (;;)
             {
-                pos++;
-                len--;
+                const char* nl = (const char*) memchr(pos, '\n', end - pos);
+                if (!nl || nl + 1 >= end) return end;
+                pos = nl + 1;
+                if (*pos == '#') return pos;
             }
         }
-        return true;
-    }
 
-    void VcdSerializer::storeValue(int val, const QByteArray& abrev)
-    {
-        SaleaeOutputFile* sof = mSaleaeFiles.value(abrev);
-        if (!sof) return;
-    //    Q_ASSERT(wd);
-        sof->writeTimeValue(mTime,val);
+        /// Parse a single VCD data line, value changes for unknown waveforms are skipped
+        bool parseVcdDataline(const char* buf, const char* end, const VcdAbbrevLookup& abbrevLookup, VcdDataChunk& chunk)
+        {
+            const char* pos = buf;
+            while (pos < end)
+            {
+                int val = -1;
+                switch(*pos)
+                {
+                case 'b':
+                case 'o':
+                case 'h':
+                    return true; // multi-bit values not supported yet
+                case '$':
+                {
+                    std::string keyword(pos+1, end-pos-1);
+                    return keyword.compare(0, 8, "dumpvars") == 0 || keyword.compare(0, 3, "end") == 0;
+                }
+                case '#':
+                {
+                    u64 t = 0;
+                    const char* p = pos + 1;
+                    if (p >= end || *p < '0' || *p > '9') return false;
+                    for (; p < end && *p >= '0' && *p <= '9'; ++p)
+                        t = t * 10 + (*p - '0');
+                    chunk.mTime = t;
+                    return true;
+                }
+                case 'x':
+                    val = -1;
+                    break;
+                case 'z':
+                    val = -2;
+                    break;
+                case '0':
+                case '1':
+                case '2':
+                case '3':
+                case '4':
+                case '5':
+                case '6':
+                case '7':
+                    val = *pos - '0';
+                    break;
+                default:
+                    return false;
+                }
+                const char* p = pos + 1;
+                while (p < end && *p > ' ') ++p;
+                if (p == pos + 1) return false;
+                int iwave = abbrevLookup.find(pos+1, p-pos-1);
+                if (iwave >= 0)
+                    chunk.mEvents[iwave].emplace_back(chunk.mTime, val);
+                pos = p;
+                while (pos < end && *pos == ' ') ++pos;
+            }
+            return true;
+        }
+
+        /// Parse all lines of chunk, stops at first line which cannot be parsed
+        void parseVcdChunk(const VcdAbbrevLookup& abbrevLookup, VcdDataChunk& chunk)
+        {
+            const char* pos = chunk.mBegin;
+            while (pos < chunk.mEnd)
+            {
+                const char* nl = (const char*) memchr(pos, '\n', chunk.mEnd - pos);
+                const char* eol = nl ? nl : chunk.mEnd;
+                const char* next = nl ? nl + 1 : chunk.mEnd;
+                if (eol > pos && *(eol-1) == '\r') --eol;
+                if (eol > pos && !parseVcdDataline(pos, eol, abbrevLookup, chunk))
+                {
+                    chunk.mOk = false;
+                    chunk.mErrorLine = std::string(pos, eol-pos);
+                    return;
+                }
+                pos = next;
+            }
+        }
     }
 
     bool VcdSerializer::parseCsvHeader(char *buf)
@@ -487,8 +819,6 @@ namespace hal {
 
     bool VcdSerializer::parseVcdInternal(QFile& ff, const QList<const Net*>& onlyNets)
     {
-        bool parseHeader = true;
-
         QMap<QString, const Net*> netNames;
         for (const Net* n : onlyNets)
             netNames.insert(QString::fromStdString(n->get_name()),n);
@@ -497,89 +827,133 @@ namespace hal {
         QRegularExpression reWire("wire\\s+(\\d+) ([^ ]+) (.*) $");
 
         quint64 fileSize = ff.size();
-        quint64 totalRead = 0;
-
-        static const int bufsize = 4095;
-        char buf[bufsize+1];
 
-        int iline = 0;
-        while(!ff.atEnd())
+        // map file into memory if possible, read entire content otherwise
+        QByteArray content;
+        const char* data = (const char*) ff.map(0, fileSize);
+        if (!data)
         {
-            int sizeRead = ff.readLine(buf,bufsize);
-            ++iline;
-            totalRead += sizeRead;
-            emitProgress(totalRead,fileSize);
-            if (sizeRead >= bufsize)
-            {
-                if (mErrorCount[5]++ < maxErrorMessages)
-                    log_warning("waveform_viewer", "VCD line {} exceeds buffer size {}.", iline, bufsize);
-                return false;
-            }
-
-            if (sizeRead < 0)
+            content = ff.readAll();
+            if ((quint64) content.size() != fileSize)
             {
                 if (mErrorCount[6]++ < maxErrorMessages)
-                    log_warning("waveform_viewer", "VCD parse error reading line {} from file '{}'.", iline, ff.fileName().toStdString());
+                    log_warning("waveform_viewer", "VCD parse error reading file '{}'.", ff.fileName().toStdString());
                 return false;
             }
-            if (sizeRead > 0 && buf[sizeRead-1]=='\n') --sizeRead;
+            data = content.constData();
+        }
+        const char* dataEnd = data + fileSize;
+        const char* pos = data;
+
+        bool parseHeader = true;
+        while (parseHeader && pos < dataEnd)
+        {
+            const char* nl = (const char*) memchr(pos, '\n', dataEnd - pos);
+            const char* eol = nl ? nl : dataEnd;
+            int sizeRead = eol - pos;
+            const char* buf = pos;
+            pos = nl ? nl + 1 : dataEnd;
             if (sizeRead > 0 && buf[sizeRead-1]=='\r') --sizeRead;
             if (!sizeRead) continue;
 
-
-            if (parseHeader)
+            QByteArray line(buf,sizeRead);
+            QRegularExpressionMatch mHead = reHead.match(line);
+            if (mHead.hasMatch())
             {
-                QByteArray line(buf,sizeRead);
-                QRegularExpressionMatch mHead = reHead.match(line);
-                if (mHead.hasMatch())
+                if (mHead.captured(1) == "enddefinitions")
+                    parseHeader = false;
+                else if (mHead.captured(1) == "var")
                 {
-                    if (mHead.captured(1) == "enddefinitions")
-                        parseHeader = false;
-                    else if (mHead.captured(1) == "var")
+                    QRegularExpressionMatch mWire = reWire.match(mHead.captured(2));
+                    bool ok;
+                    QString wireName   = mWire.captured(3);
+                    const Net* net = netNames.value(wireName);
+                    if (!netNames.isEmpty() && !net) continue; // net not found in given name list
+                    if (mAbbrevByName.contains(wireName))
                     {
-                        QRegularExpressionMatch mWire = reWire.match(mHead.captured(2));
-                        bool ok;
-                        QString wireName   = mWire.captured(3);
-                        const Net* net = netNames.value(wireName);
-                        if (!netNames.isEmpty() && !net) continue; // net not found in given name list
-                        if (mAbbrevByName.contains(wireName))
-                        {
-                            if (mErrorCount[7]++ < maxErrorMessages)
-                                log_warning("waveform_viewer", "Waveform duplicate for '{}' in VCD file '{}'.", wireName.toStdString(), ff.fileName().toStdString());
-                            continue;
-                        }
-                        QString wireAbbrev = mWire.captured(2);
-                        mAbbrevByName.insert(wireName,wireAbbrev);
-                        int     wireBits   = mWire.captured(1).toUInt(&ok);
-                        if (!ok) wireBits = 1;
-                        if (wireBits > 1) continue; // TODO : decision whether we will be able to handle VCD with more bits
+                        if (mErrorCount[7]++ < maxErrorMessages)
+                            log_warning("waveform_viewer", "Waveform duplicate for '{}' in VCD file '{}'.", wireName.toStdString(), ff.fileName().toStdString());
+                        continue;
+                    }
+                    QString wireAbbrev = mWire.captured(2);
+                    mAbbrevByName.insert(wireName,wireAbbrev);
+                    int     wireBits   = mWire.captured(1).toUInt(&ok);
+                    if (!ok) wireBits = 1;
+                    if (wireBits > 1) continue; // TODO : decision whether we will be able to handle VCD with more bits
 
-                        u32 netId = net ? net->get_id() : 0;
+                    u32 netId = net ? net->get_id() : 0;
 
-                        SaleaeOutputFile* sof = nullptr;
-                        if (mSaleaeFiles.contains(wireAbbrev))
-                        {
-                            // output file already exists, need name entry
-                            sof = mSaleaeFiles.value(wireAbbrev);
-                            if (sof) mSaleaeWriter->add_directory_entry(sof->index(), wireName.toStdString(), netId);
-                        }
-                        else
-                        {
-                            sof = mSaleaeWriter->add_or_replace_waveform(wireName.toStdString(), netId);
-                            if (sof) mSaleaeFiles.insert(wireAbbrev,sof);
-                        }
+                    SaleaeOutputFile* sof = nullptr;
+                    if (mSaleaeFiles.contains(wireAbbrev))
+                    {
+                        // output file already exists, need name entry
+                        sof = mSaleaeFiles.value(wireAbbrev);
+                        if (sof) mSaleaeWriter->add_directory_entry(sof->index(), wireName.toStdString(), netId);
+                    }
+                    else
+                    {
+                        sof = mSaleaeWriter->add_or_replace_waveform(wireName.toStdString(), netId);
+                        if (sof) mSaleaeFiles.insert(wireAbbrev,sof);
                     }
                 }
             }
-            else
+        }
+
+        // waveforms are addressed by index while parsing data lines
+        VcdAbbrevLookup abbrevLookup;
+        std::vector<SaleaeOutputFile*> outputFiles;
+        for (auto it = mSaleaeFiles.constBegin(); it != mSaleaeFiles.constEnd(); ++it)
+        {
+            if (!it.value()) continue;
+            abbrevLookup.insert(it.key().toStdString(), outputFiles.size());
+            outputFiles.push_back(it.value());
+        }
+        int nwaves = outputFiles.size();
+
+        // data lines are split into chunks starting with a timestamp, chunks get parsed in parallel
+        // and value changes are written to waveform files in chunk order
+        const int numberChunks = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<VcdDataChunk> chunks(numberChunks);
+        u64 t = 0;
+        while (pos < dataEnd)
+        {
+            int nchunks = 0;
+            while (nchunks < numberChunks && pos < dataEnd)
             {
-                if (!parseVcdDataline(buf,sizeRead))
-                {
-                    if (mErrorCount[8]++ < maxErrorMessages)
-                        log_warning("waveform_viewer", "Cannot parse VCD data line '{}'.", QByteArray(buf,sizeRead).data());
-                    return false;
-                }
+                const char* chunkEnd = (quint64)(dataEnd - pos) > sVcdChunkSize
+                        ? findVcdChunkEnd(pos + sVcdChunkSize, dataEnd)
+                        : dataEnd;
+                chunks[nchunks++].reset(pos, chunkEnd, t, nwaves);
+                pos = chunkEnd;
+            }
+
+#pragma omp parallel for schedule(dynamic)
+            for (int i = 0; i < nchunks; i++)
+                parseVcdChunk(abbrevLookup, chunks[i]);
+
+            int nvalid = 0;
+            while (nvalid < nchunks && chunks.at(nvalid).mOk) ++nvalid;
+            int nflush = nvalid < nchunks ? nvalid + 1 : nchunks; // events parsed before error get written as well
+
+#pragma omp parallel for schedule(dynamic)
+            for (int iwave = 0; iwave < nwaves; iwave++)
+            {
+                SaleaeOutputFile* sof = outputFiles.at(iwave);
+                for (int i = 0; i < nflush; i++)
+                    for (const std::pair<u64,int>& evt : chunks.at(i).mEvents.at(iwave))
+                        sof->writeTimeValue(evt.first, evt.second);
             }
+
+            if (nvalid < nchunks)
+            {
+                if (mErrorCount[8]++ < maxErrorMessages)
+                    log_warning("waveform_viewer", "Cannot parse VCD data line '{}'.", chunks.at(nvalid).mErrorLine);
+                return false;
+            }
+
+            t = chunks.at(nchunks-1).mTime;
+            mTime = t;
+            emitProgress(pos - data, fileSize);
         }
         return true;
     }
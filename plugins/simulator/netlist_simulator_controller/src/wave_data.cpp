@@ -4,6 +4,7 @@
 #include "netlist_simulator_controller/simulation_settings.h"
 #include "netlist_simulator_controller/wave_data_provider.h"
 #include "hal_core/netlist/net.h"
+#include <limits>
 #include <math.h>
 #include <vector>
 #include <QString>
@@ -200,6 +201,19 @@ namespace hal {
     std::vector<std::pair<u64,int>> WaveData::get_events(u64 t0) const
     {
         std::vector<std::pair<u64,int>> retval;
+        if (mNetType == BooleanNet || mNetType == TriggerTime)
+        {
+            // single pass over transitions of all inputs, no need to load them into memory
+            auto collect = [&retval,t0](u64 t, int val) {
+                if (t >= t0) retval.push_back(std::make_pair(t,val));
+                return true;
+            };
+            if (mNetType == BooleanNet)
+                static_cast<const WaveDataBoolean*>(this)->evaluate(collect);
+            else
+                static_cast<const WaveDataTrigger*>(this)->evaluate(collect);
+            return retval;
+        }
         if (loadPolicy() == LoadAllData)
         {       
             for (auto it = mData.lowerBound(t0); it != mData.constEnd(); ++it)
@@ -217,18 +231,6 @@ namespace hal {
                 wdp = new WaveDataProviderGroup(saleaeDirectory, wdGrp->children());
                 break;
             }
-            case WaveData::BooleanNet:
-            {
-                const WaveDataBoolean* wdBool = static_cast<const WaveDataBoolean*>(this);
-                wdp = new WaveDataProviderBoolean(saleaeDirectory, wdBool->children(), wdBool->truthTable());
-                break;
-            }
-            case WaveData::TriggerTime:
-            {
-                const WaveDataTrigger* wdTrig = static_cast<const WaveDataTrigger*>(this);
-                wdp = new WaveDataProviderTrigger(saleaeDirectory, wdTrig->children(), wdTrig->toValueList(), wdTrig->get_filter_wave());
-                break;
-            }
             default:
                 break;
             }
@@ -285,9 +287,18 @@ namespace hal {
         u64 t1 = tframe.hasUserTimeframe() ? tframe.sceneMaxTime() : 0;
         Q_ASSERT(t0 <= t1);
 
+        // skip transitions before user timeframe except for the last one which provides the value at t0
+        if (t0)
+        {
+            int64_t pos = sif.get_file_position(t0);
+            sif.clear();
+            sif.set_file_position(pos > 0 ? pos : 0);
+        }
+
         int lastVal = BooleanFunction::X;
         bool valuePending = false;
-        while (sif.good())
+        bool beyondTimeframe = false;
+        while (sif.good() && !beyondTimeframe)
         {
             SaleaeDataBuffer* sdb = sif.get_buffered_data(NetlistSimulatorControllerPlugin::sSimulationSettings->maxSizeLoadable());
             if (!sdb) break;
@@ -314,6 +325,7 @@ namespace hal {
                 {
                     if (valuePending) mData.insert(t0,lastVal);
                     valuePending = false;
+                    beyondTimeframe = true;
                     break;
                 }
             }
@@ -555,6 +567,159 @@ namespace hal {
 
     uint qHash(const WaveDataGroupIndex& wdgi) { return wdgi.mCode; }
 
+    //--------------------------------------------
+    namespace {
+
+        /// Number of transitions read at once from SALEAE file when evaluating boolean or trigger waveforms
+        const u64 sStreamBatchSize = 1 << 16;
+
+        /// True if all transitions of waveform are available in memory, data loaded for a timeframe covers only part of them
+        bool isLoaded(const WaveData* wd)
+        {
+            return wd->fileIndex() < 0 || (u64) wd->data().size() >= wd->fileSize();
+        }
+
+        /**
+         * Sequential reader for the transitions of a waveform in ascending time order. Transitions are taken
+         * from memory if loaded or if restricted to memory, otherwise they are read in batches from the SALEAE file.
+         */
+        class WaveTransitionStream
+        {
+            QMap<u64,int>::const_iterator mIter;
+            QMap<u64,int>::const_iterator mEnd;
+            SaleaeInputFile* mFile;
+            SaleaeDataBuffer* mBuffer;
+            u64 mIndex;
+        public:
+            WaveTransitionStream(const WaveData* wd, bool memoryOnly)
+                : mIter(wd->data().constBegin()), mEnd(wd->data().constEnd()), mFile(nullptr), mBuffer(nullptr), mIndex(0)
+            {
+                if (memoryOnly || isLoaded(wd)) return;
+                std::string path = wd->fileName();
+                if (path.empty()) return;
+                mFile = new SaleaeInputFile(path);
+                if (!mFile->good())
+                {
+                    delete mFile;
+                    mFile = nullptr;
+                }
+            }
+
+            ~WaveTransitionStream()
+            {
+                delete mBuffer;
+                delete mFile;
+            }
+
+            WaveTransitionStream(const WaveTransitionStream&) = delete;
+            WaveTransitionStream& operator=(const WaveTransitionStream&) = delete;
+
+            /// Get next transition, returns false if there are no more transitions
+            bool next(u64& t, int& val)
+            {
+                if (!mFile)
+                {
+                    if (mIter == mEnd) return false;
+                    t   = mIter.key();
+                    val = mIter.value();
+                    ++mIter;
+                    return true;
+                }
+                if (!mBuffer || mIndex >= mBuffer->mCount)
+                {
+                    delete mBuffer;
+                    mBuffer = mFile->good() ? mFile->get_buffered_data(sStreamBatchSize) : nullptr;
+                    mIndex = 0;
+                    if (!mBuffer) return false;
+                }
+                t   = mBuffer->mTimeArray[mIndex];
+                val = mBuffer->mValueArray[mIndex];
+                ++mIndex;
+                return true;
+            }
+        };
+
+        /// Merges the transitions of several waveforms in ascending time order
+        class WaveTransitionMerge
+        {
+            struct Head
+            {
+                WaveTransitionStream* mStream;
+                u64 mTime;
+                int mValue;
+                bool mValid;
+            };
+            std::vector<Head> mHeads;
+        public:
+            WaveTransitionMerge(WaveData* const* waves, int n, bool memoryOnly) : mHeads(n)
+            {
+                for (int i=0; i<n; i++)
+                {
+                    Head& hd = mHeads[i];
+                    hd.mStream = new WaveTransitionStream(waves[i], memoryOnly);
+                    hd.mValid = hd.mStream->next(hd.mTime, hd.mValue);
+                }
+            }
+
+            ~WaveTransitionMerge()
+            {
+                for (Head& hd : mHeads)
+                    delete hd.mStream;
+            }
+
+            WaveTransitionMerge(const WaveTransitionMerge&) = delete;
+            WaveTransitionMerge& operator=(const WaveTransitionMerge&) = delete;
+
+            /// Time of next transition of any waveform, returns false if all waveforms are exhausted
+            bool nextTime(u64& t) const
+            {
+                bool found = false;
+                for (const Head& hd : mHeads)
+                {
+                    if (!hd.mValid) continue;
+                    if (!found || hd.mTime < t) t = hd.mTime;
+                    found = true;
+                }
+                return found;
+            }
+
+            /// Consume transition of waveform <i> at time <t>, returns false if waveform has no transition at that time
+            bool take(int i, u64 t, int& val)
+            {
+                Head& hd = mHeads[i];
+                if (!hd.mValid || hd.mTime != t) return false;
+                val = hd.mValue;
+                hd.mValid = hd.mStream->next(hd.mTime, hd.mValue);
+                return true;
+            }
+        };
+
+        /**
+         * Looks up transition of waveform exactly at time <t>, reads SALEAE file unless loaded or within loaded timeframe.
+         * First entry of timeframe data might just carry the value from before the timeframe, thus it is looked up in file.
+         */
+        bool transitionAt(const WaveData* wd, u64 t, int& val)
+        {
+            const QMap<u64,int>& data = wd->data();
+            if (isLoaded(wd) || (!data.isEmpty() && t > data.firstKey() && t <= data.lastKey()))
+            {
+                auto it = wd->data().find(t);
+                if (it == wd->data().constEnd()) return false;
+                val = it.value();
+                return true;
+            }
+            SaleaeInputFile sif(wd->fileName());
+            if (!sif.good()) return false;
+            int64_t pos = sif.get_file_position(t);
+            if (pos < 0) return false;
+            sif.set_file_position(pos);
+            SaleaeDataTuple sdt = sif.get_next_value();
+            if (sdt.readError() || sdt.mTime != t) return false;
+            val = sdt.mValue;
+            return true;
+        }
+    }
+
     //--------------------------------------------
     WaveDataBoolean::WaveDataBoolean(WaveDataList* wdList, const QList<WaveData*>& boolInput, const QList<int>& acceptMask)
         : WaveData(wdList->nextBooleanId(),"",WaveData::BooleanNet), mInputCount(boolInput.size()),
@@ -687,55 +852,74 @@ namespace hal {
     void WaveDataBoolean::recalcData()
     {
         mData.clear();
-        switch (loadPolicy())
+        LoadPolicy lpol = loadPolicy();
+        switch (lpol)
         {
         case WaveData::TooBigToLoad:
-            return;
+            // inputs get streamed from file, result is kept only if small enough to be loaded
+            break;
         case WaveData::LoadTimeframe:
             for (int i=0; i<mInputCount; i++)
                 if (mInputWaves[i]->data().isEmpty())
                     return;
             break;
         default:
+            for (int i=0; i<mInputCount; i++)
+                mInputWaves[i]->loadDataUnlessAlreadyLoaded();
             break;
         }
 
-        QMap<u64,int> transitionTime;
-        // TODO : not loadable
-        for (int i=0; i<mInputCount; i++)
-        {
-            mInputWaves[i]->loadDataUnlessAlreadyLoaded();
-            for (u64 t : mInputWaves[i]->data().keys())
-                ++transitionTime[t];
-        }
+        // transitions are computed in ascending order, insert at end without searching
+        u64 maxSize = (lpol == WaveData::TooBigToLoad)
+                ? NetlistSimulatorControllerPlugin::sSimulationSettings->maxSizeLoadable()
+                : std::numeric_limits<u64>::max();
+        bool tooBig = false;
+        evaluate([this,maxSize,&tooBig](u64 t, int val) {
+            if ((u64) mData.size() >= maxSize)
+            {
+                tooBig = true;
+                return false;
+            }
+            mData.insert(mData.constEnd(),t,val);
+            return true;
+        }, lpol == WaveData::LoadTimeframe);
+
+        // waveform gets rendered by streaming provider
+        if (tooBig) mData.clear();
+    }
+
+    void WaveDataBoolean::evaluate(const std::function<bool(u64,int)>& callback, bool memoryOnly) const
+    {
+        if (!mInputCount || !mTruthTable) return;
+        WaveTransitionMerge merge(mInputWaves,mInputCount,memoryOnly);
 
+        // input values as bit masks, truth table index is given by inputs with value 1
+        u32 ones = 0;
+        u32 undefined = (1u << mInputCount) - 1;
         int lastval = SaleaeDataTuple::sReadError;
-        for (u64 t : transitionTime.keys())
+        u64 t;
+        while (merge.nextTime(t))
         {
-            int ttInx = 0;
             for (int i=0; i<mInputCount; i++)
             {
-                int val = mInputWaves[i]->get_value_at(t);
-                if (val < 0 || val > 1)
+                u32 mask = 1u << i;
+                int val;
+                while (merge.take(i,t,val))
                 {
-                    ttInx = 1;
-                    break;
+                    if (val == 1)
+                        ones |= mask;
+                    else
+                        ones &= ~mask;
+                    if (val == 0 || val == 1)
+                        undefined &= ~mask;
+                    else
+                        undefined |= mask;
                 }
-                if (val == 1)
-                    ttInx |= (1<<i);
-            }
-            int nextval = SaleaeDataTuple::sReadError;
-            if (ttInx < 0)
-                nextval = -1;
-            else
-            {
-                int j = ttInx / 8;
-                int k = ttInx % 8;
-                nextval = (mTruthTable[j] & (1<<k)) ? 1 : 0;
             }
+            int nextval = undefined ? -1 : ((mTruthTable[ones/8] >> (ones%8)) & 1);
             if (nextval != lastval)
             {
-                mData.insert(t,nextval);
+                if (!callback(t,nextval)) return;
                 lastval = nextval;
             }
         }
@@ -825,30 +1009,32 @@ namespace hal {
 
     int WaveDataTrigger::intValue(double t) const
     {
-        if (loadPolicy() == LoadAllData)
+        if (t < 0) return 0;
+        u64 tt = floor(t+0.5);
+        bool triggered = false;
+        for (int i=0; i<mTriggerCount && !triggered; i++)
         {
-            for (int i=0; i<mTriggerCount; i++)
-            {
+            if (mTriggerWaves[i]->loadPolicy() == LoadAllData)
                 mTriggerWaves[i]->loadDataUnlessAlreadyLoaded();
-                auto it = mTriggerWaves[i]->data().find(floor(t+0.5));
-                if (it != mTriggerWaves[i]->data().constEnd())
-                {
-                    if (mToValue[i] < 0 || mToValue[i] == it.value()) return 1;
-                }
-            }
-            return 0;
+            int val;
+            if (transitionAt(mTriggerWaves[i],tt,val))
+                if (mToValue[i] < 0 || mToValue[i] == val)
+                    triggered = true;
         }
-        // TODO : check disk file
-        return 0;
+        if (!triggered) return 0;
+        if (mFilterWave && mFilterWave->intValue(tt) != 1) return 0;
+        return 1;
     }
 
     void WaveDataTrigger::recalcData()
     {
         mData.clear();
-        switch (loadPolicy())
+        LoadPolicy lpol = loadPolicy();
+        switch (lpol)
         {
         case TooBigToLoad:
-            return;
+            // trigger waves get streamed from file, result is kept only if small enough to be loaded
+            break;
         case LoadTimeframe:
             for (int i=0; i<mTriggerCount; i++)
                 if (mTriggerWaves[i]->data().isEmpty())
@@ -860,11 +1046,67 @@ namespace hal {
             break;
         }
 
-        for (int i=0; i<mTriggerCount; i++)
-            for (auto it = mTriggerWaves[i]->data().constBegin(); it != mTriggerWaves[i]->data().constEnd(); ++it)
-                if (mToValue[i] < 0 || mToValue[i] == it.value())
-                    if (!mFilterWave || mFilterWave->intValue(it.key())==1)
-                        mData.insert(it.key(),1);
+        // trigger times are computed in ascending order, insert at end without searching
+        u64 maxSize = (lpol == TooBigToLoad)
+                ? NetlistSimulatorControllerPlugin::sSimulationSettings->maxSizeLoadable()
+                : std::numeric_limits<u64>::max();
+        bool tooBig = false;
+        evaluate([this,maxSize,&tooBig](u64 t, int val) {
+            if ((u64) mData.size() >= maxSize)
+            {
+                tooBig = true;
+                return false;
+            }
+            mData.insert(mData.constEnd(),t,val);
+            return true;
+        }, lpol == LoadTimeframe);
+
+        // waveform gets rendered by streaming provider
+        if (tooBig) mData.clear();
+    }
+
+    void WaveDataTrigger::evaluate(const std::function<bool(u64,int)>& callback, bool memoryOnly) const
+    {
+        if (!mTriggerCount) return;
+        WaveTransitionMerge merge(mTriggerWaves,mTriggerCount,memoryOnly);
+
+        // filter value at trigger time, trigger times are ascending thus filter transitions are read sequentially;
+        // composed filter waveforms without data get evaluated for each trigger time
+        bool filterComposed = mFilterWave && mFilterWave->fileIndex() < 0 && mFilterWave->data().isEmpty();
+        WaveTransitionStream* filterStream = (mFilterWave && !filterComposed) ? new WaveTransitionStream(mFilterWave,memoryOnly) : nullptr;
+        u64 filterNextTime = 0;
+        int filterNextValue = 0;
+        bool filterMore = filterStream && filterStream->next(filterNextTime,filterNextValue);
+        int filterValue = SaleaeDataTuple::sReadError;
+
+        u64 t;
+        while (merge.nextTime(t))
+        {
+            bool triggered = false;
+            for (int i=0; i<mTriggerCount; i++)
+            {
+                int val;
+                while (merge.take(i,t,val))
+                    if (mToValue[i] < 0 || mToValue[i] == val)
+                        triggered = true;
+            }
+            if (!triggered) continue;
+            if (filterComposed)
+            {
+                if (mFilterWave->intValue(t) != 1) continue;
+            }
+            else if (filterStream)
+            {
+                while (filterMore && filterNextTime <= t)
+                {
+                    filterValue = filterNextValue;
+                    filterMore = filterStream->next(filterNextTime,filterNextValue);
+                }
+                if (filterValue != 1) continue;
+            }
+            if (!callback(t,1)) break;
+        }
+        delete filterStream;
     }
 
     WaveData::LoadPolicy WaveDataTrigger::loadPolicy() const
@@ -902,7 +1144,8 @@ namespace hal {
 
     u64 WaveDataTrigger::neighborTransition(double t, bool next) const
     {
-        if (!mData.empty() && loadPolicy() != TooBigToLoad)
+        // trigger times of waveform too big to load are kept only if complete
+        if (!mData.empty())
         {
             if (next)
             {
@@ -72,6 +72,15 @@ namespace hal {
 
         int loadCycle = 0;
 
+        // seek to last transition before requested time (or begin of user timeframe to be recorded) instead of scanning all transitions
+        u64 tSeek = (isRecording() && mTimeframe.sceneMinTime() < t) ? mTimeframe.sceneMinTime() : t;
+        int64_t pos = mInputFile.get_file_position(tSeek);
+        mInputFile.clear();
+        if (pos > 0)
+            mInputFile.set_file_position(pos);
+        else
+            mInputFile.set_file_position(0);
+
         while (skipData && mInputFile.good())
         {
             if (mBuffer) delete mBuffer;
@@ -151,6 +160,89 @@ namespace hal {
         return retval;
     }
 
+    //-----------------------------------------------------
+    WaveDataProviderIndex::WaveDataProviderIndex(const std::string& filename)
+        : mInputFile(filename), mIndexFile(filename), mTimeResolution(0)
+    {;}
+
+    SaleaeDataTuple WaveDataProviderIndex::startValue(u64 t)
+    {
+        mPendingPoint = SaleaeDataTuple();
+        mNextTransition = SaleaeDataTuple();
+        // previous pass might have read up to end of file
+        mInputFile.clear();
+        if (!hasIndex()) return SaleaeDataTuple();
+
+        SaleaeDataTuple retval;
+        int64_t pos = mInputFile.get_file_position(t);
+        mInputFile.clear();
+        if (pos < 0)
+        {
+            // no data before t, first transition is start value
+            retval.mTime = t;
+            retval.mValue = -1;
+            mInputFile.set_file_position(0);
+        }
+        else
+        {
+            mInputFile.set_file_position(pos);
+            retval = mInputFile.get_next_value();
+        }
+        mNextTransition = mInputFile.get_next_value();
+        return retval;
+    }
+
+    SaleaeDataTuple WaveDataProviderIndex::nextPoint()
+    {
+        if (!mPendingPoint.readError())
+        {
+            SaleaeDataTuple retval = mPendingPoint;
+            mPendingPoint = SaleaeDataTuple();
+            return retval;
+        }
+
+        SaleaeDataTuple retval = mNextTransition;
+        if (retval.readError()) return retval;
+
+        int level = mIndexFile.get_level(mTimeResolution);
+        if (level >= 0)
+        {
+            u64 ibucket = mIndexFile.bucket_index(level, retval.mTime);
+            u64 ntrans  = mIndexFile.get_bucket_transitions(level, ibucket);
+            if (ntrans > 2)
+            {
+                // too many transitions to be resolved, summarize bucket by time spent at either value
+                SaleaeIndexBucket bucket = mIndexFile.get_bucket(level, ibucket);
+                u64 tEnd = mIndexFile.bucket_begin(level, ibucket) + mIndexFile.bucket_width(level);
+                int other = bucket.mLastValue < 0
+                        ? (bucket.mDuration[1] > bucket.mDuration[0] ? 1 : 0)
+                        : 1 - bucket.mLastValue;
+                u64 total = bucket.mLastValue < 0
+                        ? mIndexFile.bucket_width(level)
+                        : bucket.mDuration[0] + bucket.mDuration[1];
+                u64 tSplit = retval.mTime;
+                if (total && tEnd > retval.mTime)
+                    tSplit += (u64) ((double) (tEnd - retval.mTime) * bucket.mDuration[other] / total);
+
+                if (tSplit > retval.mTime)
+                {
+                    retval.mValue = other;
+                    mPendingPoint = SaleaeDataTuple(tSplit, bucket.mLastValue);
+                }
+                else
+                    retval.mValue = bucket.mLastValue;
+
+                mInputFile.clear();
+                mInputFile.set_file_position(bucket.mFirstTransition + ntrans);
+                mNextTransition = mInputFile.get_next_value();
+                return retval;
+            }
+        }
+
+        mNextTransition = mInputFile.get_next_value();
+        return retval;
+    }
+
     //-----------------------------------------------------
     int WaveDataProviderClock::valueForTransition() const
     {
@@ -9,17 +9,29 @@
 #include "hal_core/utilities/log.h"
 #include "netlist_simulator_controller/netlist_simulator_controller.h"
 #include "netlist_simulator_controller/plugin_netlist_simulator_controller.h"
+#include "netlist_simulator_controller/saleae_file.h"
+#include "netlist_simulator_controller/saleae_parser.h"
+#include "netlist_simulator_controller/saleae_writer.h"
 #include "netlist_simulator_controller/simulation_engine.h"
 #include "netlist_simulator_controller/simulation_input.h"
+#include "netlist_simulator_controller/simulation_settings.h"
+#include "netlist_simulator_controller/vcd_serializer.h"
 #include "netlist_simulator_controller/wave_data.h"
+#include "netlist_simulator_controller/wave_data_provider.h"
 #include "test_utils/include/test_def.h"
 
+#include <algorithm>
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
 #include <string>
 #include <thread>
+#include <zlib.h>
 
 namespace hal
 {
@@ -443,6 +455,80 @@ namespace hal
 
         //Test if maps are equal
         EXPECT_TRUE(cmp_sim_data(sim_ctrl_reference.get(), sim_ctrl_verilator.get()));
+
+        //export simulation result and read it back
+        std::filesystem::path path_export = std::filesystem::temp_directory_path() / "hal_half_adder_export.vcd";
+        EXPECT_TRUE(sim_ctrl_verilator->generate_vcd(path_export));
+        EXPECT_TRUE(sim_ctrl_verilator->generate_vcd(path_export.string() + ".gz"));
+        //compressed export decompresses to the plain export
+        std::string plain_export;
+        {
+            std::ifstream ifs(path_export, std::ios::binary);
+            plain_export.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+        std::string decompressed_export;
+        if (gzFile gz = gzopen((path_export.string() + ".gz").c_str(), "rb"); gz != nullptr)
+        {
+            char gz_buffer[4096];
+            for (int n = gzread(gz, gz_buffer, sizeof(gz_buffer)); n > 0; n = gzread(gz, gz_buffer, sizeof(gz_buffer)))
+            {
+                decompressed_export.append(gz_buffer, n);
+            }
+            gzclose(gz);
+        }
+        EXPECT_FALSE(plain_export.empty());
+        EXPECT_TRUE(decompressed_export == plain_export);
+
+        auto sim_ctrl_export = plugin->create_simulator_controller("half_adder_export");
+        sim_ctrl_export->add_gates(nl->get_gates());
+        sim_ctrl_export->set_no_clock_used();
+        EXPECT_TRUE(sim_ctrl_export->import_vcd(path_export.string(), NetlistSimulatorController::FilterInputFlag::CompleteNetlist));
+        EXPECT_TRUE(cmp_sim_data(sim_ctrl_verilator.get(), sim_ctrl_export.get()));
+
+        std::filesystem::remove(path_export);
+        std::filesystem::remove(path_export.string() + ".gz");
+
+        //boolean waveform and trigger time derived from simulation result
+        WaveData* wdA = sim_ctrl_verilator->get_waveform_by_net(A);
+        WaveData* wdB = sim_ctrl_verilator->get_waveform_by_net(B);
+        ASSERT_NE(wdA, nullptr);
+        ASSERT_NE(wdB, nullptr);
+        WaveDataBoolean* wdBool = sim_ctrl_verilator->get_waveform_boolean_by_id(sim_ctrl_verilator->add_boolean_expression_waveform("A & B"));
+        ASSERT_NE(wdBool, nullptr);
+        std::vector<std::pair<u64,int>> bool_events = wdBool->get_events();
+        EXPECT_FALSE(bool_events.empty());
+        for (const std::pair<u64,int>& evt : bool_events)
+        {
+            int expected = (wdA->get_value_at(evt.first) == 1 && wdB->get_value_at(evt.first) == 1) ? 1 : 0;
+            EXPECT_EQ(evt.second, expected);
+        }
+        wdBool->recalcData();
+        EXPECT_EQ(wdBool->data().size(), (int) bool_events.size());
+
+        WaveDataTrigger* wdTrig = sim_ctrl_verilator->get_trigger_time_by_id(sim_ctrl_verilator->add_trigger_time({wdA}, {1}));
+        ASSERT_NE(wdTrig, nullptr);
+        std::vector<std::pair<u64,int>> trig_events = wdTrig->get_events();
+        EXPECT_EQ(trig_events.size(), (size_t) 1);
+        for (const std::pair<u64,int>& evt : trig_events)
+        {
+            EXPECT_EQ(wdA->get_value_at(evt.first), 1);
+            EXPECT_EQ(wdTrig->intValue(evt.first), 1);
+        }
+
+        //inputs loaded only for timeframe behind trigger time, events must still cover complete simulation
+        ASSERT_FALSE(trig_events.empty());
+        WaveDataTimeframe tframe;
+        tframe.setUserTimeframe(trig_events.front().first + 1, trig_events.front().first + 1);
+        EXPECT_TRUE(wdA->loadSaleae(tframe));
+        EXPECT_TRUE(wdB->loadSaleae(tframe));
+        EXPECT_LT((u64) wdA->data().size(), wdA->fileSize());
+        EXPECT_FALSE(wdA->data().contains(trig_events.front().first));
+        EXPECT_EQ(wdBool->get_events(), bool_events);
+        EXPECT_EQ(wdTrig->get_events(), trig_events);
+        EXPECT_EQ(wdTrig->intValue(trig_events.front().first), 1);
+        EXPECT_EQ(wdTrig->intValue(trig_events.front().first + 1), 0);
+        EXPECT_TRUE(wdA->loadSaleae());
+        EXPECT_TRUE(wdB->loadSaleae());
         TEST_END
     }
 
@@ -563,6 +649,958 @@ namespace hal
         TEST_END
     }
 
+    TEST_F(SimulatorTest, counter_cycle_sim)
+    {
+        TEST_START
+
+        auto plugin = plugin_manager::get_plugin_instance<NetlistSimulatorControllerPlugin>("netlist_simulator_controller");
+
+        auto sim_ctrl_cycle = plugin->create_simulator_controller("counter_cycle_simulator");
+        auto cycle_engine   = sim_ctrl_cycle->create_simulation_engine("hal_cycle_sim");
+        EXPECT_TRUE(sim_ctrl_cycle->get_state() == NetlistSimulatorController::SimulationState::NoGatesSelected);
+        EXPECT_TRUE(cycle_engine->get_state() == SimulationEngine::State::Preparing);
+
+        auto sim_ctrl_reference = plugin->create_simulator_controller("counter_cycle_reference");
+
+        //path to netlist
+        std::string path_netlist = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/counter/counternetlist_flattened_by_hal.vhd";
+        if (!utils::file_exists(path_netlist))
+            FAIL() << "netlist for counter-test not found: " << path_netlist;
+
+        //create netlist from path
+        auto lib = gate_library_manager::get_gate_library_by_name("XILINX_UNISIM");
+        if (lib == nullptr)
+        {
+            FAIL() << "XILINX_UNISIM gate library not found";
+        }
+
+        std::unique_ptr<Netlist> nl;
+        {
+            NO_COUT_BLOCK;
+            nl = netlist_parser_manager::parse(path_netlist, lib);
+            if (nl == nullptr)
+            {
+                FAIL() << "netlist couldn't be parsed";
+            }
+        }
+
+        //path to vcd
+        std::string path_vcd = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/counter/dump.vcd";
+        if (!utils::file_exists(path_vcd))
+            FAIL() << "dump for counter-test not found: " << path_vcd;
+
+        //prepare simulation
+        sim_ctrl_cycle->add_gates(nl->get_gates());
+        sim_ctrl_cycle->set_no_clock_used();
+        EXPECT_TRUE(sim_ctrl_cycle->get_state() == NetlistSimulatorController::SimulationState::ParameterSetup);
+
+        sim_ctrl_reference->add_gates(nl->get_gates());
+
+        Net* clock = *(nl->get_nets([](const Net* net) { return net->get_name() == "Clock"; }).begin());
+        sim_ctrl_cycle->add_clock_period(clock, 10000);
+
+        //read vcd
+        EXPECT_TRUE(sim_ctrl_reference->import_vcd(path_vcd, NetlistSimulatorController::FilterInputFlag::CompleteNetlist));
+
+        // retrieve nets
+        Net* reset          = *(nl->get_nets([](const Net* net) { return net->get_name() == "Reset"; }).begin());
+        Net* Clock_enable_B = *(nl->get_nets([](const Net* net) { return net->get_name() == "Clock_enable_B"; }).begin());
+
+        //start simulation
+        {
+            measure_block_time("simulation");
+            //testbench
+            sim_ctrl_cycle->set_input(Clock_enable_B, BooleanFunction::Value::ONE);    //#Clock_enable_B <= '1';
+            sim_ctrl_cycle->set_input(reset, BooleanFunction::Value::ZERO);            //#Reset <= '0';
+            sim_ctrl_cycle->simulate(40 * 1000);                                       //#WAIT FOR 40 NS; -> simulate 4 clock cycle  - cycle 0, 1, 2, 3
+
+            sim_ctrl_cycle->set_input(Clock_enable_B, BooleanFunction::Value::ZERO);    //#Clock_enable_B <= '0';
+            sim_ctrl_cycle->simulate(110 * 1000);                                       //#WAIT FOR 110 NS; -> simulate 11 clock cycle  - cycle 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14
+
+            sim_ctrl_cycle->set_input(reset, BooleanFunction::Value::ONE);    //#Reset <= '1';
+            sim_ctrl_cycle->simulate(20 * 1000);                              //#WAIT FOR 20 NS; -> simulate 2 clock cycle  - cycle 15, 16
+
+            sim_ctrl_cycle->set_input(reset, BooleanFunction::Value::ZERO);    //#Reset <= '0';
+            sim_ctrl_cycle->simulate(70 * 1000);                               //#WAIT FOR 70 NS; -> simulate 7 clock cycle  - cycle 17, 18, 19, 20, 21, 22, 23
+
+            sim_ctrl_cycle->set_input(Clock_enable_B, BooleanFunction::Value::ONE);    //#Clock_enable_B <= '1';
+            sim_ctrl_cycle->simulate(23 * 1000);                                       //#WAIT FOR 20 NS; -> simulate 2 clock cycle  - cycle 24, 25
+
+            sim_ctrl_cycle->set_input(reset, BooleanFunction::Value::ONE);    //#Reset <= '1';
+            sim_ctrl_cycle->simulate(20 * 1000);                              //#WAIT FOR 20 NS; -> simulate 2 clock cycle  - cycle 26, 27
+            sim_ctrl_cycle->simulate(17 * 1000);                              //# remaining 17 NS to simulate 300 NS in total
+
+            sim_ctrl_cycle->run_simulation();
+
+            EXPECT_FALSE(cycle_engine->get_state() == SimulationEngine::State::Failed);
+
+            while (cycle_engine->get_state() == SimulationEngine::State::Running)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+
+        if (cycle_engine->get_state() == SimulationEngine::State::Failed)
+        {
+            FAIL() << "engine failed";
+        }
+
+        EXPECT_TRUE(cycle_engine->get_state() == SimulationEngine::State::Done);
+        EXPECT_FALSE(sim_ctrl_cycle->get_state() == NetlistSimulatorController::SimulationState::EngineFailed);
+
+        sim_ctrl_cycle->get_results();
+
+        EXPECT_TRUE(sim_ctrl_cycle->get_waves()->size() == (int)nl->get_nets().size());
+        EXPECT_TRUE(sim_ctrl_reference->get_waves()->size() == (int)nl->get_nets().size());
+
+        //Test if maps are equal
+        bool equal = cmp_sim_data(sim_ctrl_reference.get(), sim_ctrl_cycle.get());
+        EXPECT_TRUE(equal);
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, counter_cycle_sim_lanes)
+    {
+        TEST_START
+
+        auto plugin = plugin_manager::get_plugin_instance<NetlistSimulatorControllerPlugin>("netlist_simulator_controller");
+
+        auto sim_ctrl_cycle = plugin->create_simulator_controller("counter_cycle_lanes");
+        auto cycle_engine   = sim_ctrl_cycle->create_simulation_engine("hal_cycle_sim");
+        EXPECT_EQ(sim_ctrl_cycle->get_num_lanes(), 64u);
+
+        //path to netlist
+        std::string path_netlist = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/counter/counternetlist_flattened_by_hal.vhd";
+        if (!utils::file_exists(path_netlist))
+            FAIL() << "netlist for counter-test not found: " << path_netlist;
+
+        //create netlist from path
+        auto lib = gate_library_manager::get_gate_library_by_name("XILINX_UNISIM");
+        if (lib == nullptr)
+        {
+            FAIL() << "XILINX_UNISIM gate library not found";
+        }
+
+        std::unique_ptr<Netlist> nl;
+        {
+            NO_COUT_BLOCK;
+            nl = netlist_parser_manager::parse(path_netlist, lib);
+            if (nl == nullptr)
+            {
+                FAIL() << "netlist couldn't be parsed";
+            }
+        }
+
+        //prepare simulation
+        sim_ctrl_cycle->add_gates(nl->get_gates());
+        sim_ctrl_cycle->set_no_clock_used();
+
+        Net* clock = *(nl->get_nets([](const Net* net) { return net->get_name() == "Clock"; }).begin());
+        sim_ctrl_cycle->add_clock_period(clock, 10000);
+
+        Net* reset          = *(nl->get_nets([](const Net* net) { return net->get_name() == "Reset"; }).begin());
+        Net* Clock_enable_B = *(nl->get_nets([](const Net* net) { return net->get_name() == "Clock_enable_B"; }).begin());
+
+        //testbench, lane 1 never gets reset
+        sim_ctrl_cycle->set_input(Clock_enable_B, BooleanFunction::Value::ONE);
+        sim_ctrl_cycle->set_input(reset, BooleanFunction::Value::ZERO);
+        sim_ctrl_cycle->set_lane_input(1, reset, BooleanFunction::Value::ZERO);
+        sim_ctrl_cycle->simulate(40 * 1000);
+
+        sim_ctrl_cycle->set_input(Clock_enable_B, BooleanFunction::Value::ZERO);
+        sim_ctrl_cycle->simulate(110 * 1000);
+
+        sim_ctrl_cycle->set_input(reset, BooleanFunction::Value::ONE);
+        sim_ctrl_cycle->simulate(20 * 1000);
+
+        sim_ctrl_cycle->set_input(reset, BooleanFunction::Value::ZERO);
+        sim_ctrl_cycle->simulate(70 * 1000);
+
+        sim_ctrl_cycle->set_input(reset, BooleanFunction::Value::ONE);
+        sim_ctrl_cycle->simulate(20 * 1000);
+
+        sim_ctrl_cycle->run_simulation();
+
+        while (cycle_engine->get_state() == SimulationEngine::State::Running)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        if (cycle_engine->get_state() == SimulationEngine::State::Failed)
+        {
+            FAIL() << "engine failed";
+        }
+
+        bool lanes_differ = false;
+        for (const Net* output : nl->get_nets([](const Net* net) { return net->get_name().rfind("Output_", 0) == 0; }))
+        {
+            std::vector<BooleanFunction::Value> final_values = sim_ctrl_cycle->get_lane_final_values(output);
+            ASSERT_EQ(final_values.size(), 64u);
+            EXPECT_EQ(final_values.at(0), BooleanFunction::Value::ZERO);
+            for (u32 lane = 2; lane < 64; lane++)
+            {
+                EXPECT_EQ(final_values.at(lane), final_values.at(0));
+            }
+            EXPECT_EQ(sim_ctrl_cycle->get_lane_events(output, 0), static_cast<SimulationEngineEventDriven*>(cycle_engine)->get_simulation_events(output->get_id()));
+            lanes_differ |= final_values.at(1) != final_values.at(0);
+        }
+        EXPECT_TRUE(lanes_differ);
+
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, half_adder_cycle_sim_lane_import)
+    {
+        TEST_START
+
+        auto plugin = plugin_manager::get_plugin_instance<NetlistSimulatorControllerPlugin>("netlist_simulator_controller");
+
+        auto sim_ctrl_cycle = plugin->create_simulator_controller("half_adder_cycle_lanes");
+        auto cycle_engine   = sim_ctrl_cycle->create_simulation_engine("hal_cycle_sim");
+        ASSERT_EQ(sim_ctrl_cycle->get_num_lanes(), 64u);
+
+        std::string path_netlist = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/half_adder/halfaddernetlist_flattened_by_hal.v";
+        if (!utils::file_exists(path_netlist))
+        {
+            FAIL() << "netlist for half_adder-test not found: " << path_netlist;
+        }
+
+        //create netlist from path
+        auto lib = gate_library_manager::get_gate_library_by_name("XILINX_UNISIM");
+        if (lib == nullptr)
+        {
+            FAIL() << "XILINX_UNISIM gate library not found";
+        }
+
+        std::unique_ptr<Netlist> nl;
+        {
+            NO_COUT_BLOCK;
+            nl = netlist_parser_manager::parse(path_netlist, lib);
+            if (nl == nullptr)
+            {
+                FAIL() << "netlist couldn't be parsed";
+            }
+        }
+
+        sim_ctrl_cycle->add_gates(nl->get_gates());
+        sim_ctrl_cycle->set_no_clock_used();
+
+        Net* A = *(nl->get_nets([](auto net) { return net->get_name() == "A"; }).begin());
+        Net* B = *(nl->get_nets([](auto net) { return net->get_name() == "B"; }).begin());
+        Net* C = *(nl->get_nets([](auto net) { return net->get_name() == "C"; }).begin());
+
+        //lane 2 from VCD and lane 3 from CSV, both with events after the last regular input event at 10000
+        std::filesystem::path path_vcd = std::filesystem::temp_directory_path() / "hal_lane_import_test.vcd";
+        {
+            std::ofstream ofs(path_vcd);
+            ofs << "$timescale 1ps $end\n"
+                << "$scope module Half_Adder_TB $end\n"
+                << "$var wire 1 ! A $end\n"
+                << "$var wire 1 \" B $end\n"
+                << "$upscope $end\n"
+                << "$enddefinitions $end\n"
+                << "#0\n0!\n1\"\n"
+                << "#5000\n1!\n"
+                << "#15000\n0\"\n";
+        }
+        std::filesystem::path path_csv = std::filesystem::temp_directory_path() / "hal_lane_import_test.csv";
+        {
+            std::ofstream ofs(path_csv);
+            ofs << "Time [ps],\"A\",\"B\"\n"
+                << "0,1,1\n"
+                << "10000,1,0\n"
+                << "20000,1,1\n";
+        }
+
+        //testbench, lane 1 keeps B=1 while lane 0 and lanes without assignment follow the regular inputs
+        u64 timeScaleFactor = SaleaeParser::sTimeScaleFactor;
+        sim_ctrl_cycle->set_input(A, BooleanFunction::Value::ZERO);
+        sim_ctrl_cycle->set_input(B, BooleanFunction::Value::ZERO);
+        sim_ctrl_cycle->set_lane_inputs(B, {BooleanFunction::Value::ZERO, BooleanFunction::Value::ONE});
+        EXPECT_TRUE(sim_ctrl_cycle->import_lane_vcd(2, path_vcd.string()));
+        EXPECT_TRUE(sim_ctrl_cycle->import_lane_csv(3, path_csv.string(), 1));
+        EXPECT_FALSE(sim_ctrl_cycle->import_lane_csv(64, path_csv.string(), 1));
+        SaleaeParser::sTimeScaleFactor = timeScaleFactor;
+        sim_ctrl_cycle->simulate(10 * 1000);
+
+        sim_ctrl_cycle->set_input(A, BooleanFunction::Value::ONE);
+        sim_ctrl_cycle->simulate(10 * 1000);
+
+        sim_ctrl_cycle->run_simulation();
+
+        while (cycle_engine->get_state() == SimulationEngine::State::Running)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        std::filesystem::remove(path_vcd);
+        std::filesystem::remove(path_csv);
+
+        if (cycle_engine->get_state() == SimulationEngine::State::Failed)
+        {
+            FAIL() << "engine failed";
+        }
+
+        auto lane_events = [&](u32 lane) {
+            std::vector<std::pair<u64,BooleanFunction::Value>> retval;
+            for (const WaveEvent& evt : sim_ctrl_cycle->get_lane_events(C, lane))
+                retval.push_back(std::make_pair(evt.time, evt.new_value));
+            return retval;
+        };
+
+        std::vector<std::pair<u64,BooleanFunction::Value>> expected_lane_0 = {{0, BooleanFunction::Value::ZERO}};
+        std::vector<std::pair<u64,BooleanFunction::Value>> expected_lane_1 = {{0, BooleanFunction::Value::ZERO}, {10000, BooleanFunction::Value::ONE}};
+        std::vector<std::pair<u64,BooleanFunction::Value>> expected_lane_2 = {{0, BooleanFunction::Value::ZERO}, {5000, BooleanFunction::Value::ONE}, {15000, BooleanFunction::Value::ZERO}};
+        std::vector<std::pair<u64,BooleanFunction::Value>> expected_lane_3 = {{0, BooleanFunction::Value::ONE}, {10000, BooleanFunction::Value::ZERO}, {20000, BooleanFunction::Value::ONE}};
+        EXPECT_EQ(lane_events(0), expected_lane_0);
+        EXPECT_EQ(lane_events(1), expected_lane_1);
+        EXPECT_EQ(lane_events(2), expected_lane_2);
+        EXPECT_EQ(lane_events(3), expected_lane_3);
+        EXPECT_EQ(lane_events(63), expected_lane_0);
+
+        std::vector<BooleanFunction::Value> final_values = sim_ctrl_cycle->get_lane_final_values(C);
+        ASSERT_EQ(final_values.size(), 64u);
+        EXPECT_EQ(final_values.at(1), BooleanFunction::Value::ONE);
+        EXPECT_EQ(final_values.at(2), BooleanFunction::Value::ZERO);
+        EXPECT_EQ(final_values.at(3), BooleanFunction::Value::ONE);
+
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, saleae_index)
+    {
+        TEST_START
+
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "hal_saleae_index_test.bin";
+
+        // bursts of short pulses separated by long idle phases, with a few undefined values
+        std::vector<u64> times;
+        std::vector<int> values;
+        {
+            SaleaeOutputFile sof(path.string(), 0);
+            u64 t = 1000;
+            int v = 0;
+            for (u32 i = 0; i < 50000; i++)
+            {
+                if (i)
+                {
+                    t += (i % 5000 < 4000) ? 1 + (i * 7919) % 7 : 1 + (i * 7919) % 2000;
+                    v = (i % 97 == 0) ? -1 : (values.back() == 1 ? 0 : 1);
+                }
+                sof.writeTimeValue(t, v);
+                times.push_back(t);
+                values.push_back(v);
+            }
+            sof.close();
+        }
+
+        // every level of the index must account for all transitions after the initial value and their durations within its buckets
+        SaleaeIndexFile sif(path.string());
+        ASSERT_TRUE(sif.has_index());
+        EXPECT_GT(sif.number_levels(), 1);
+        for (int level = 0; level < sif.number_levels(); level++)
+        {
+            u64 width       = sif.bucket_width(level);
+            u64 num_buckets = sif.number_buckets(level);
+            u64 sum         = 0;
+            for (u64 ibucket = 0; ibucket < num_buckets; ibucket++)
+            {
+                SaleaeIndexBucket bucket = sif.get_bucket(level, ibucket);
+                u64 ntrans               = sif.get_bucket_transitions(level, ibucket);
+                u64 begin                = sif.bucket_begin(level, ibucket);
+                u64 end                  = begin + width;
+                if (ntrans)
+                {
+                    u64 first = bucket.mFirstTransition;
+                    ASSERT_GE(first, 1u);
+                    ASSERT_LT(first + ntrans - 1, times.size());
+                    EXPECT_GE(times.at(first), begin);
+                    EXPECT_TRUE(ibucket + 1 == num_buckets || times.at(first + ntrans - 1) < end);
+                    EXPECT_TRUE(first == 1 || times.at(first - 1) < begin);
+                    EXPECT_EQ(bucket.mLastValue, values.at(first + ntrans - 1));
+                }
+                if (ibucket + 1 < num_buckets)
+                {
+                    EXPECT_LE(bucket.mDuration[0] + bucket.mDuration[1], width);
+                }
+                sum += ntrans;
+            }
+            EXPECT_EQ(sum, times.size() - 1);
+            EXPECT_EQ(sif.get_level(width), level);
+        }
+
+        // readers that do not know about the index still see the plain transitions
+        SaleaeInputFile sif_plain(path.string());
+        SaleaeDataBuffer* buf = sif_plain.get_buffered_data(times.size() + 10);
+        ASSERT_EQ(buf->mCount, times.size());
+        for (u64 i = 0; i < times.size(); i++)
+        {
+            EXPECT_EQ(buf->mTimeArray[i], times.at(i));
+            EXPECT_EQ(buf->mValueArray[i], values.at(i));
+        }
+        delete buf;
+
+        std::filesystem::remove(path);
+
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, saleae_index_provider)
+    {
+        TEST_START
+
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "hal_saleae_index_provider_test.bin";
+
+        // bursts of short pulses separated by long idle phases, with a few undefined values
+        std::vector<u64> times;
+        std::vector<int> values;
+        {
+            SaleaeOutputFile sof(path.string(), 0);
+            u64 t = 1000;
+            int v = 0;
+            for (u32 i = 0; i < 50000; i++)
+            {
+                if (i)
+                {
+                    t += (i % 5000 < 4000) ? 1 + (i * 7919) % 7 : 1 + (i * 7919) % 2000;
+                    v = (i % 97 == 0) ? -1 : (values.back() == 1 ? 0 : 1);
+                }
+                sof.writeTimeValue(t, v);
+                times.push_back(t);
+                values.push_back(v);
+            }
+            sof.close();
+        }
+
+        auto value_at = [](const std::vector<SaleaeDataTuple>& points, u64 t) {
+            auto it = std::upper_bound(points.begin(), points.end(), t, [](u64 tt, const SaleaeDataTuple& sdt) { return tt < sdt.mTime; });
+            return it == points.begin() ? -1 : std::prev(it)->mValue;
+        };
+
+        WaveDataTimeframe tframe;
+        WaveDataProviderIndex wdp_index(path.string());
+        ASSERT_TRUE(wdp_index.hasIndex());
+
+        // without time resolution the index provider must return the same points as the file provider, also when reused for another pass
+        u64 step = (times.back() - times.front()) / 7;
+        for (u64 t0 = times.front() - 10; t0 < times.back(); t0 += step)
+        {
+            SaleaeInputFile sif_file(path.string());
+            WaveDataProviderFile wdp_file(sif_file, tframe);
+            u64 remaining = times.end() - std::upper_bound(times.begin(), times.end(), t0);
+            wdp_index.setTimeResolution(0);
+            SaleaeDataTuple sdt_file  = wdp_file.startValue(t0);
+            SaleaeDataTuple sdt_index = wdp_index.startValue(t0);
+            EXPECT_EQ(sdt_index.mTime, sdt_file.mTime);
+            EXPECT_EQ(sdt_index.mValue, sdt_file.mValue);
+            for (u64 i = 0; i < remaining; i++)
+            {
+                sdt_file  = wdp_file.nextPoint();
+                sdt_index = wdp_index.nextPoint();
+                ASSERT_FALSE(sdt_index.readError()) << "t0 " << t0 << " i " << i << " remaining " << remaining << " file " << sdt_file.mTime << "," << sdt_file.mValue;
+                ASSERT_EQ(sdt_index.mTime, sdt_file.mTime);
+                ASSERT_EQ(sdt_index.mValue, sdt_file.mValue);
+            }
+            EXPECT_TRUE(wdp_index.nextPoint().readError());
+        }
+
+        // zoomed out the index provider summarizes busy buckets but must agree with the file provider at bucket boundaries
+        SaleaeInputFile sif_file(path.string());
+        WaveDataProviderFile wdp_file(sif_file, tframe);
+        std::vector<SaleaeDataTuple> points_file;
+        points_file.push_back(wdp_file.startValue(times.front()));
+        for (u64 i = 1; i < times.size(); i++)
+            points_file.push_back(wdp_file.nextPoint());
+
+        SaleaeIndexFile sif_index(path.string());
+        for (int level = 0; level < sif_index.number_levels(); level++)
+        {
+            wdp_index.setTimeResolution(sif_index.bucket_width(level));
+            std::vector<SaleaeDataTuple> points_index;
+            points_index.push_back(wdp_index.startValue(times.front()));
+            for (SaleaeDataTuple sdt = wdp_index.nextPoint(); !sdt.readError(); sdt = wdp_index.nextPoint())
+            {
+                ASSERT_GE(sdt.mTime, points_index.back().mTime);
+                points_index.push_back(sdt);
+            }
+            EXPECT_LT(points_index.size(), points_file.size());
+            EXPECT_LE(points_index.size(), 2 * sif_index.number_buckets(level) + 1);
+            EXPECT_EQ(points_index.back().mValue, values.back());
+
+            for (u64 ibucket = 1; ibucket < sif_index.number_buckets(level); ibucket++)
+            {
+                u64 begin = sif_index.bucket_begin(level, ibucket);
+                if (std::binary_search(times.begin(), times.end(), begin))
+                    continue;
+                EXPECT_EQ(value_at(points_index, begin), value_at(points_file, begin)) << "level " << level << " bucket " << ibucket;
+            }
+        }
+
+        std::filesystem::remove(path);
+
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, saleae_compressed)
+    {
+        TEST_START
+
+        std::filesystem::path path_uint64     = std::filesystem::temp_directory_path() / "hal_saleae_uint64_test.bin";
+        std::filesystem::path path_compressed = std::filesystem::temp_directory_path() / "hal_saleae_compressed_test.bin";
+
+        // dense phases with equal transition times alternate with sparse phases, a few undefined values
+        std::vector<u64> times;
+        std::vector<int> values;
+        {
+            SaleaeOutputFile sof_uint64(path_uint64.string(), 0, SaleaeHeader::Uint64);
+            SaleaeOutputFile sof_compressed(path_compressed.string(), 0);
+            u64 t = 1000;
+            int v = 1;
+            for (u32 i = 0; i < 10000; i++)
+            {
+                if (i)
+                {
+                    t += (i % 3000 < 2500) ? (i * 7919) % 3 : (i * 7919) % 100000;
+                    v = (i % 211 == 0) ? -1 : (values.back() == 1 ? 0 : 1);
+                }
+                sof_uint64.writeTimeValue(t, v);
+                sof_compressed.writeTimeValue(t, v);
+                times.push_back(t);
+                values.push_back(v);
+            }
+            sof_uint64.close();
+            sof_compressed.close();
+        }
+        EXPECT_LT(std::filesystem::file_size(path_compressed) * 3, std::filesystem::file_size(path_uint64));
+
+        SaleaeInputFile sif_uint64(path_uint64.string());
+        SaleaeInputFile sif_compressed(path_compressed.string());
+        ASSERT_TRUE(sif_compressed.good());
+        EXPECT_EQ(sif_compressed.header()->storageFormat(), SaleaeHeader::Compressed);
+        EXPECT_EQ(sif_compressed.header()->numTransitions(), times.size() - 1);
+        EXPECT_TRUE(SaleaeIndexFile(path_compressed.string()).has_index());
+
+        // both formats must provide the same data
+        SaleaeDataBuffer* buf = sif_compressed.get_buffered_data(times.size() + 10);
+        ASSERT_EQ(buf->mCount, times.size());
+        for (u64 i = 0; i < times.size(); i++)
+        {
+            EXPECT_EQ(buf->mTimeArray[i], times.at(i));
+            EXPECT_EQ(buf->mValueArray[i], values.at(i));
+        }
+        delete buf;
+
+        // seek to last transition at or before t (and first at or after t) and continue reading from there
+        for (u64 t = times.front(); t <= times.back() + 10; t += (times.back() - times.front()) / 997)
+        {
+            for (bool successor : {false, true})
+            {
+                sif_uint64.clear();
+                sif_compressed.clear();
+                int64_t pos_uint64 = sif_uint64.get_file_position(t, successor);
+                int64_t pos_compressed = sif_compressed.get_file_position(t, successor);
+                if (pos_compressed < 0)
+                {
+                    EXPECT_LT(pos_uint64, 0);
+                    continue;
+                }
+                ASSERT_LT(pos_compressed, (int64_t)times.size());
+                ASSERT_GE(pos_uint64, 0);
+                EXPECT_EQ(times.at(pos_compressed), times.at(pos_uint64));
+                if (successor)
+                {
+                    EXPECT_GE(times.at(pos_compressed), t);
+                }
+                else
+                {
+                    EXPECT_LE(times.at(pos_compressed), t);
+                    EXPECT_TRUE(pos_compressed + 1 == (int64_t)times.size() || times.at(pos_compressed + 1) > t || times.at(pos_compressed + 1) == times.at(pos_compressed));
+                    SaleaeDataTuple sdt = sif_compressed.get_next_value();
+                    EXPECT_EQ(sdt.mTime, times.at(pos_compressed));
+                    EXPECT_EQ(sdt.mValue, values.at(pos_compressed));
+                }
+            }
+        }
+
+        std::filesystem::remove(path_uint64);
+        std::filesystem::remove(path_compressed);
+
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, saleae_parser_merge)
+    {
+        TEST_START
+
+        std::filesystem::path saleae_dir = std::filesystem::temp_directory_path() / "hal_saleae_parser_test";
+        std::filesystem::remove_all(saleae_dir);
+        std::filesystem::create_directories(saleae_dir);
+        std::string saleae_json = (saleae_dir / "saleae.json").string();
+
+        // waveforms exceed read batch size, transitions of different waveforms share timestamps
+        const u32 num_waves = 20;
+        const u64 num_transitions = 3 * SaleaeParser::sReadBatchSize + 17;
+        std::vector<std::vector<std::pair<u64, int>>> written(num_waves);
+        {
+            SaleaeWriter writer(saleae_json);
+            for (u32 w = 0; w < num_waves; w++)
+            {
+                SaleaeOutputFile* sof = writer.add_or_replace_waveform("wave" + std::to_string(w), w + 1);
+                ASSERT_NE(sof, nullptr);
+                u64 t = 0;
+                for (u64 i = 0; i <= num_transitions; i++)
+                {
+                    int v = (i % 2) ? 1 : 0;
+                    sof->writeTimeValue(t, v);
+                    written[w].push_back(std::make_pair(t, v));
+                    t += 1 + (i * (w + 3)) % 5;
+                }
+            }
+        }
+
+        std::vector<std::vector<std::pair<u64, int>>> received(num_waves);
+        u64 last_time = 0;
+        bool ordered  = true;
+        {
+            SaleaeParser parser(saleae_json);
+            for (u32 w = 0; w < num_waves; w++)
+            {
+                EXPECT_TRUE(parser.register_callback(
+                    "wave" + std::to_string(w),
+                    w + 1,
+                    [&](void* obj, u64 t, int v) {
+                        if (t < last_time)
+                            ordered = false;
+                        last_time = t;
+                        received[(uintptr_t)obj].push_back(std::make_pair(t, v));
+                    },
+                    (void*)(uintptr_t)w));
+            }
+            while (parser.next_event())
+                ;
+        }
+
+        EXPECT_TRUE(ordered);
+        for (u32 w = 0; w < num_waves; w++)
+        {
+            EXPECT_EQ(received[w], written[w]);
+        }
+
+        std::filesystem::remove_all(saleae_dir);
+
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, vcd_import_chunks)
+    {
+        TEST_START
+
+        std::filesystem::path work_dir = std::filesystem::temp_directory_path() / "hal_vcd_chunk_test";
+        std::filesystem::remove_all(work_dir);
+        std::filesystem::create_directories(work_dir);
+        std::filesystem::path path_vcd = work_dir / "chunks.vcd";
+
+        // single character identifier codes and one long code, data section spans several chunks
+        const u32 num_waves     = 40;
+        const u64 chunk_size    = VcdSerializer::sVcdChunkSize;
+        const u64 min_data_size = 3 * chunk_size + chunk_size / 2;
+        auto abbrev             = [](u32 w) { return w + 1 < num_waves ? std::string(1, (char)('!' + w)) : std::string("long_code"); };
+
+        std::vector<std::vector<std::pair<u64, int>>> written(num_waves);
+        std::vector<std::pair<u64, u64>> timestamp_lines;    // file offset and time of every timestamp line
+        u64 data_begin = 0;
+        {
+            std::ofstream ofs(path_vcd, std::ios::binary);
+            ofs << "$timescale 1ps $end\n$scope module chunk_tb $end\n";
+            for (u32 w = 0; w < num_waves; w++)
+            {
+                ofs << "$var wire 1 " << abbrev(w) << " w" << w << " $end\n";
+            }
+            ofs << "$upscope $end\n$enddefinitions $end\n";
+            data_begin = ofs.tellp();
+
+            ofs << "#0\n$dumpvars\n";
+            for (u32 w = 0; w < num_waves; w++)
+            {
+                ofs << "0" << abbrev(w) << "\n";
+                written[w].push_back(std::make_pair(0, 0));
+            }
+            ofs << "$end\n";
+
+            for (u64 i = 1; (u64)ofs.tellp() - data_begin < min_data_size; i++)
+            {
+                u64 t = i * 10;
+                timestamp_lines.push_back(std::make_pair((u64)ofs.tellp(), t));
+                ofs << "#" << t << "\n";
+                for (u32 w = 0; w < num_waves; w++)
+                {
+                    if ((i * 7 + w * 13) % 5)
+                        continue;
+                    int v = (written[w].back().second == 1) ? 0 : 1;
+                    if ((i + w) % 89 == 0)
+                        v = -1;
+                    ofs << (v < 0 ? 'x' : (char)('0' + v)) << abbrev(w) << "\n";
+                    written[w].push_back(std::make_pair(t, v));
+                }
+            }
+        }
+
+        // replicate split: chunk ends at first timestamp line behind chunk size
+        std::vector<u64> boundary_times;
+        {
+            u64 file_size = std::filesystem::file_size(path_vcd);
+            u64 pos       = data_begin;
+            auto it       = timestamp_lines.begin();
+            while (file_size - pos > chunk_size)
+            {
+                while (it != timestamp_lines.end() && it->first <= pos + chunk_size)
+                    ++it;
+                if (it == timestamp_lines.end())
+                    break;
+                pos = it->first;
+                boundary_times.push_back(it->second);
+            }
+        }
+        ASSERT_GE(boundary_times.size(), 3u);
+
+        VcdSerializer reader(QString::fromStdString(work_dir.string()));
+        ASSERT_TRUE(reader.importVcd(QString::fromStdString(path_vcd.string()), QString::fromStdString(work_dir.string())));
+        EXPECT_EQ(reader.maxTime(), timestamp_lines.back().second);
+
+        std::vector<std::vector<std::pair<u64, int>>> received(num_waves);
+        {
+            SaleaeParser parser(reader.get_saleae_directory_filename());
+            for (u32 w = 0; w < num_waves; w++)
+            {
+                EXPECT_TRUE(parser.register_callback(
+                    "w" + std::to_string(w), 0, [&](void* obj, u64 t, int v) { received[(uintptr_t)obj].push_back(std::make_pair(t, v)); }, (void*)(uintptr_t)w));
+            }
+            while (parser.next_event())
+                ;
+        }
+
+        auto value_at = [](const std::vector<std::pair<u64, int>>& events, u64 t) {
+            auto it = std::upper_bound(events.begin(), events.end(), t, [](u64 tt, const std::pair<u64, int>& evt) { return tt < evt.first; });
+            return it == events.begin() ? -2 : std::prev(it)->second;
+        };
+
+        // values right before and at the first timestamp of every chunk must match the written data
+        for (u64 t : boundary_times)
+        {
+            for (u32 w = 0; w < num_waves; w++)
+            {
+                EXPECT_EQ(value_at(received[w], t - 10), value_at(written[w], t - 10)) << "wave " << w << " before chunk at " << t;
+                EXPECT_EQ(value_at(received[w], t), value_at(written[w], t)) << "wave " << w << " at chunk begin " << t;
+            }
+        }
+        for (u32 w = 0; w < num_waves; w++)
+        {
+            EXPECT_EQ(received[w], written[w]) << "wave " << w;
+        }
+
+        std::filesystem::remove_all(work_dir);
+
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, vcd_export_compressed)
+    {
+        TEST_START
+
+        std::filesystem::path work_dir = std::filesystem::temp_directory_path() / "hal_vcd_export_test";
+        std::filesystem::remove_all(work_dir);
+        std::filesystem::create_directories(work_dir / "import");
+        std::filesystem::create_directories(work_dir / "reimport");
+        std::filesystem::path path_vcd    = work_dir / "input.vcd";
+        std::filesystem::path path_export = work_dir / "export.vcd";
+
+        // enough data to fill the export buffer several times
+        const u32 num_waves = 100;
+        u64 t_max           = 0;
+        {
+            std::ofstream ofs(path_vcd, std::ios::binary);
+            ofs << "$timescale 1ps $end\n$scope module export_tb $end\n";
+            for (u32 w = 0; w < num_waves; w++)
+            {
+                ofs << "$var wire 1 " << (char)('!' + w % 90) << (w < 90 ? "" : "_") << " w" << w << " $end\n";
+            }
+            ofs << "$upscope $end\n$enddefinitions $end\n";
+            for (u64 i = 0; i < 40000; i++)
+            {
+                t_max = i * 10;
+                ofs << "#" << t_max << "\n";
+                for (u32 w = 0; w < num_waves; w++)
+                {
+                    if (i && (i * 7 + w * 13) % 5)
+                        continue;
+                    char v = ((i + w) % 89 == 0) ? 'x' : (char)('0' + (i / 5 + w) % 2);
+                    ofs << v << (char)('!' + w % 90) << (w < 90 ? "" : "_") << "\n";
+                }
+            }
+        }
+
+        VcdSerializer importer(QString::fromStdString((work_dir / "import").string()));
+        ASSERT_TRUE(importer.importVcd(QString::fromStdString(path_vcd.string()), QString::fromStdString((work_dir / "import").string())));
+
+        std::vector<std::unique_ptr<WaveData>> waves;
+        QList<const WaveData*> export_list;
+        for (u32 w = 0; w < num_waves; w++)
+        {
+            waves.push_back(std::make_unique<WaveData>(0, QString("w%1").arg(w)));
+            export_list.append(waves.back().get());
+        }
+        EXPECT_TRUE(importer.exportVcd(QString::fromStdString(path_export.string()), export_list, 0, t_max));
+        EXPECT_TRUE(importer.exportVcd(QString::fromStdString(path_export.string() + ".gz"), export_list, 0, t_max));
+
+        // compressed export decompresses to the plain export
+        std::string plain_export;
+        {
+            std::ifstream ifs(path_export, std::ios::binary);
+            plain_export.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+        std::string decompressed_export;
+        if (gzFile gz = gzopen((path_export.string() + ".gz").c_str(), "rb"); gz != nullptr)
+        {
+            char gz_buffer[4096];
+            for (int n = gzread(gz, gz_buffer, sizeof(gz_buffer)); n > 0; n = gzread(gz, gz_buffer, sizeof(gz_buffer)))
+            {
+                decompressed_export.append(gz_buffer, n);
+            }
+            gzclose(gz);
+        }
+        EXPECT_GT(plain_export.size(), 2u << 20);
+        EXPECT_LT(std::filesystem::file_size(path_export.string() + ".gz") * 2, plain_export.size());
+        EXPECT_TRUE(decompressed_export == plain_export);
+
+        // exported file provides the same waveforms as the original file
+        VcdSerializer reimporter(QString::fromStdString((work_dir / "reimport").string()));
+        ASSERT_TRUE(reimporter.importVcd(QString::fromStdString(path_export.string()), QString::fromStdString((work_dir / "reimport").string())));
+        std::vector<std::vector<std::pair<u64, int>>> imported(num_waves);
+        std::vector<std::vector<std::pair<u64, int>>> reimported(num_waves);
+        for (auto [serializer, events] : {std::make_pair(&importer, &imported), std::make_pair(&reimporter, &reimported)})
+        {
+            SaleaeParser parser(serializer->get_saleae_directory_filename());
+            for (u32 w = 0; w < num_waves; w++)
+            {
+                EXPECT_TRUE(parser.register_callback(
+                    "w" + std::to_string(w), 0, [events = events](void* obj, u64 t, int v) { events->at((uintptr_t)obj).push_back(std::make_pair(t, v)); }, (void*)(uintptr_t)w));
+            }
+            while (parser.next_event())
+                ;
+        }
+        for (u32 w = 0; w < num_waves; w++)
+        {
+            EXPECT_FALSE(imported[w].empty());
+            EXPECT_EQ(reimported[w], imported[w]) << "wave " << w;
+        }
+
+        std::filesystem::remove_all(work_dir);
+
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, boolean_too_big_to_load)
+    {
+        TEST_START
+
+        std::filesystem::path saleae_dir = std::filesystem::temp_directory_path() / "hal_boolean_too_big_test";
+        std::filesystem::remove_all(saleae_dir);
+        std::filesystem::create_directories(saleae_dir);
+        std::string saleae_json = (saleae_dir / "saleae.json").string();
+
+        // A toggles every 10 time units, B is high in short windows only
+        std::map<u64, int> events_a;
+        std::map<u64, int> events_b;
+        {
+            SaleaeWriter writer(saleae_json);
+            SaleaeOutputFile* sof_a = writer.add_or_replace_waveform("A", 1);
+            SaleaeOutputFile* sof_b = writer.add_or_replace_waveform("B", 2);
+            ASSERT_NE(sof_a, nullptr);
+            ASSERT_NE(sof_b, nullptr);
+            for (u64 t = 0; t <= 50000; t += 10)
+            {
+                sof_a->writeTimeValue(t, (t / 10) % 2);
+                events_a[t] = (t / 10) % 2;
+            }
+            for (u64 t = 0; t < 50000; t += 5000)
+            {
+                for (auto [tt, v] : {std::make_pair(t, 0), std::make_pair(t + 1015, 1), std::make_pair(t + 1215, 0)})
+                {
+                    sof_b->writeTimeValue(tt, v);
+                    events_b[tt] = v;
+                }
+            }
+        }
+
+        auto value_at = [](const std::map<u64, int>& events, u64 t) { return std::prev(events.upper_bound(t))->second; };
+        auto data_events = [](const WaveData* wd) {
+            std::vector<std::pair<u64, int>> retval;
+            for (auto it = wd->data().constBegin(); it != wd->data().constEnd(); ++it)
+                retval.push_back(std::make_pair(it.key(), it.value()));
+            return retval;
+        };
+        std::vector<std::pair<u64, int>> expected_and;
+        std::vector<std::pair<u64, int>> expected_or;
+        std::vector<std::pair<u64, int>> expected_trigger;
+        {
+            std::set<u64> times;
+            for (const auto& evt : events_a)
+                times.insert(evt.first);
+            for (const auto& evt : events_b)
+                times.insert(evt.first);
+            for (u64 t : times)
+            {
+                int a = value_at(events_a, t);
+                int b = value_at(events_b, t);
+                if (expected_and.empty() || expected_and.back().second != (a & b))
+                    expected_and.push_back(std::make_pair(t, a & b));
+                if (expected_or.empty() || expected_or.back().second != (a | b))
+                    expected_or.push_back(std::make_pair(t, a | b));
+                if (t && events_b.count(t) && b == 1 && a == 1)
+                    expected_trigger.push_back(std::make_pair(t, 1));
+            }
+        }
+
+        // only B can be loaded, A as well as the result of A | B exceed the limit
+        int max_size_loadable = NetlistSimulatorControllerPlugin::sSimulationSettings->maxSizeLoadable();
+        NetlistSimulatorControllerPlugin::sSimulationSettings->setMaxSizeLoadable(1000);
+        {
+            WaveDataList wdl(QString::fromStdString(saleae_json));
+            wdl.updateFromSaleae();
+            WaveData* wd_a = wdl.waveDataByName("A");
+            WaveData* wd_b = wdl.waveDataByName("B");
+            ASSERT_NE(wd_a, nullptr);
+            ASSERT_NE(wd_b, nullptr);
+            EXPECT_TRUE(wd_a->loadPolicy() == WaveData::TooBigToLoad);
+            EXPECT_TRUE(wd_b->loadPolicy() == WaveData::LoadAllData);
+            ASSERT_LT(expected_and.size(), 1000u);
+            ASSERT_GT(expected_or.size(), 1000u);
+
+            std::unique_ptr<WaveDataBoolean> wd_and(new WaveDataBoolean(&wdl, "A & B"));
+            wd_and->recalcData();
+            EXPECT_TRUE(wd_and->loadPolicy() == WaveData::TooBigToLoad);
+            EXPECT_EQ(data_events(wd_and.get()), expected_and);
+            EXPECT_EQ(wd_and->get_events(), expected_and);
+
+            std::unique_ptr<WaveDataBoolean> wd_or(new WaveDataBoolean(&wdl, "A | B"));
+            wd_or->recalcData();
+            EXPECT_TRUE(wd_or->data().isEmpty());
+            EXPECT_EQ(wd_or->get_events(), expected_or);
+
+            std::unique_ptr<WaveDataTrigger> wd_trig(new WaveDataTrigger(&wdl, {wd_b}, {1}));
+            wd_trig->set_filter_wave(wd_a);
+            EXPECT_TRUE(wd_trig->loadPolicy() == WaveData::TooBigToLoad);
+            EXPECT_FALSE(expected_trigger.empty());
+            EXPECT_EQ(data_events(wd_trig.get()), expected_trigger);
+            EXPECT_EQ(wd_trig->get_events(), expected_trigger);
+        }
+        NetlistSimulatorControllerPlugin::sSimulationSettings->setMaxSizeLoadable(max_size_loadable);
+
+        std::filesystem::remove_all(saleae_dir);
+
+        TEST_END
+    }
+
     TEST_F(SimulatorTest, toycipher)
     {
         // return;
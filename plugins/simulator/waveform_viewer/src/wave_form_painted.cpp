@@ -317,6 +317,9 @@ namespace hal {
         *loop = true;
         WaveFormPrimitive* pendingTransition = nullptr;
 
+        // time covered by one pixel column, providers might summarize transitions at this resolution
+        wdp->setTimeResolution((u64) (sbar->tPosF(1) - sbar->tPosF(0)));
+
         quint64 tleft = sbar->tLeftI();
         bool refreshCursor = (mCursorTime >= tleft);
         int width = sbar->viewportWidth();
@@ -6,6 +6,7 @@
 #include <QDebug>
 #include <QDir>
 #include <QPaintEvent>
+#include <memory>
 #include "netlist_simulator_controller/saleae_file.h"
 #include "netlist_simulator_controller/plugin_netlist_simulator_controller.h"
 #include "netlist_simulator_controller/simulation_settings.h"
@@ -146,7 +147,8 @@ namespace hal {
                 break;
             break;
        default:
-            SaleaeInputFile sif(mWorkDir.absoluteFilePath(QString("digital_%1.bin").arg(mItem->wavedata()->fileIndex())).toStdString());
+            std::string dataFilename = mWorkDir.absoluteFilePath(QString("digital_%1.bin").arg(mItem->wavedata()->fileIndex())).toStdString();
+            SaleaeInputFile sif(dataFilename);
             if (sif.good())
             {
                 if (mItem->wavedata()->loadPolicy()==WaveData::LoadAllData)
@@ -169,8 +171,18 @@ namespace hal {
                 {
                     try {
                         WaveDataProviderFile wdpFile(sif, mTimeframe);
+                        WaveDataProvider* wdp = &wdpFile;
+
+                        // waveform too big to load, use index to summarize transitions if available
+                        std::unique_ptr<WaveDataProviderIndex> wdpIndex;
+                        if (mItem->wavedata()->loadPolicy()==WaveData::TooBigToLoad)
+                        {
+                            wdpIndex.reset(new WaveDataProviderIndex(dataFilename));
+                            if (wdpIndex->hasIndex()) wdp = wdpIndex.get();
+                        }
+
                         WaveFormPainted shadowPaint(mItem->mPainted);
-                        shadowPaint.generate(&wdpFile,mTransform,mScrollbar,&mItem->mLoop);
+                        shadowPaint.generate(wdp,mTransform,mScrollbar,&mItem->mLoop);
 
                         mItem->mMutex.lock();
                         mItem->mPainted = shadowPaint;
@@ -265,6 +277,16 @@ namespace hal {
                                 default:
                                 {
                                     QString dataFilename = mWorkDir.absoluteFilePath(QString("digital_%1.bin").arg(wree->wavedata()->fileIndex()));
+                                    if (wree->wavedata()->loadPolicy() == WaveData::TooBigToLoad)
+                                    {
+                                        WaveDataProviderIndex* wdpIndex = new WaveDataProviderIndex(dataFilename.toStdString());
+                                        if (wdpIndex->hasIndex())
+                                        {
+                                            wdp = wdpIndex;
+                                            break;
+                                        }
+                                        delete wdpIndex;
+                                    }
                                     SaleaeInputFile sif(dataFilename.toStdString());
                                     if (sif.good()) wdp = new WaveDataProviderFile(sif, mTimeframe);
                                     else
@@ -1,7 +1,9 @@
 #include "solve_fsm/plugin_solve_fsm.h"
 
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
 #include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/solver_session.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/decorators/subgraph_netlist_decorator.h"
 #include "hal_core/netlist/endpoint.h"
@@ -222,33 +224,52 @@ namespace hal
             const auto state_bf = sub_res.get().simplify();
             const auto inputs = utils::to_vector(state_bf.get_variable_names());
 
-            // brute force over all external inputs
-            for (u64 input_val = 0; input_val < (u64(1) << inputs.size()); input_val++)
+            // brute force over all external inputs, evaluating 64 input assignments per pass of the compiled next state function
+            const auto compiled_res = CompiledBooleanFunction::compile(state_bf, inputs);
+            if (compiled_res.is_error())
             {
-                // generate input map
-                std::unordered_map<std::string, std::vector<BooleanFunction::Value>> input_mapping;
+                return ERR_APPEND(compiled_res.get_error(), "failed to solve fsm: unable to compile next state function.");
+            }
+            const auto& compiled = compiled_res.get();
+
+            static const u64 lane_patterns[6] = {0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull, 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+            const u64 num_assignments = u64(1) << inputs.size();
+            std::vector<u64> input_values(inputs.size());
+            std::vector<u64> output_values, output_unknowns;
+            for (u64 base = 0; base < num_assignments; base += 64)
+            {
+                const u32 num_lanes = (u32)std::min<u64>(64, num_assignments - base);
+                const u64 lane_mask = (num_lanes == 64) ? ~u64(0) : ((u64(1) << num_lanes) - 1);
+
+                // generate input lanes: lane l holds the input assignment 'base + l'
                 for (u32 input_index = 0; input_index < inputs.size(); input_index++)
                 {
-                    std::string input_var      = inputs.at(input_index);
-                    BooleanFunction::Value val = ((input_val >> input_index) & 0x1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
-                    input_mapping.insert({input_var, {val}});
+                    input_values[input_index] = (input_index < 6) ? lane_patterns[input_index] : (((base >> input_index) & 0x1) ? ~u64(0) : 0);
                 }
 
-                const auto& eval_res = state_bf.evaluate(input_mapping);
-                if (sub_res.is_error())
+                if (const auto eval_res = compiled.evaluate(input_values, {}, output_values, output_unknowns); eval_res.is_error())
                 {
-                    return ERR_APPEND(sub_res.get_error(), "failed to solve fsm: unable to evaluate next state function.");
+                    return ERR_APPEND(eval_res.get_error(), "failed to solve fsm: unable to evaluate next state function.");
                 }
 
-                const auto eval = eval_res.get();
-
-                if (eval.front() == BooleanFunction::Value::X)
+                for (const auto unknowns : output_unknowns)
                 {
-                    return ERR("failed to solve fsm: evaluating state function resulted in X state.");
+                    if ((unknowns & lane_mask) != 0)
+                    {
+                        return ERR("failed to solve fsm: evaluating state function resulted in X state.");
+                    }
                 }
 
-                const u64 suc_state = BooleanFunction::to_u64(eval).get();
-                all_transitions[state].insert(suc_state);
+                for (u32 lane = 0; lane < num_lanes; lane++)
+                {
+                    u64 suc_state = 0;
+                    for (u32 bit = 0; bit < output_values.size(); bit++)
+                    {
+                        suc_state |= ((output_values.at(bit) >> lane) & 0x1) << bit;
+                    }
+                    all_transitions[state].insert(suc_state);
+                }
             }
         }
 
@@ -327,6 +348,20 @@ namespace hal
 
         q.push_back(initial_state_num);
 
+        // a single solver session is shared by all states, each state only opens its own scope
+        const auto config = SMT::QueryConfig().with_model_generation().with_timeout(timeout);
+
+        auto session_res = SMT::SolverSession::start(config);
+        if (session_res.is_error())
+        {
+            session_res = SMT::SolverSession::start_in_process(config);
+        }
+        if (session_res.is_error())
+        {
+            return ERR_APPEND(session_res.get_error(), "failed to solve fsm: could not start SMT solver session.");
+        }
+        const auto session = session_res.get();
+
         while (!q.empty())
         {
             std::vector<u64> successor_states;
@@ -341,12 +376,18 @@ namespace hal
             visited.insert(n);
 
             // generate new transitions and add them to the queue
-            SMT::Solver s;
-            s = s.with_constraint(SMT::Constraint{prev_state_vec.clone(), BooleanFunction::Const(n, state_size)});
+            if (auto res = session->push(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "failed to solve fsm: could not open solver scope for state " + std::to_string(n) + ".");
+            }
+            if (auto res = session->add_constraint(SMT::Constraint{prev_state_vec.clone(), BooleanFunction::Const(n, state_size)}); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "failed to solve fsm: could not add state constraint for state " + std::to_string(n) + ".");
+            }
 
             while(true)
             {
-                if (auto res = s.query(SMT::QueryConfig().with_model_generation().with_timeout(timeout)); res.is_error())
+                if (auto res = session->check(); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "failed to solve fsm: failed to querry SMT solver for state " + std::to_string(n) + ".");
                 }
@@ -370,7 +411,10 @@ namespace hal
                     if (suc.is_constant())
                     {
                         successor_states.push_back(suc.get_constant_value().get());
-                        s = s.with_constraint(SMT::Constraint(BooleanFunction::Not(BooleanFunction::Eq(next_state_vec.clone(), suc.clone(), 1).get(), 1).get()));
+                        if (auto c_res = session->add_constraint(SMT::Constraint(BooleanFunction::Not(BooleanFunction::Eq(next_state_vec.clone(), suc.clone(), 1).get(), 1).get())); c_res.is_error())
+                        {
+                            return ERR_APPEND(c_res.get_error(), "failed to solve fsm: could not exclude successor state of state " + std::to_string(n) + ".");
+                        }
                     }
                     else
                     {
@@ -388,12 +432,22 @@ namespace hal
                         {
                             const auto suc_num = BooleanFunction::to_u64(eval_res.get()).get();
                             successor_states.push_back(suc_num);
-                            s = s.with_constraint(SMT::Constraint(BooleanFunction::Not(BooleanFunction::Eq(next_state_vec.clone(), BooleanFunction::Const(suc_num, eval_res.get().size()), 1).get(), 1).get()));
+                            if (auto c_res = session->add_constraint(
+                                    SMT::Constraint(BooleanFunction::Not(BooleanFunction::Eq(next_state_vec.clone(), BooleanFunction::Const(suc_num, eval_res.get().size()), 1).get(), 1).get()));
+                                c_res.is_error())
+                            {
+                                return ERR_APPEND(c_res.get_error(), "failed to solve fsm: could not exclude successor state of state " + std::to_string(n) + ".");
+                            }
                         }
                     }
                 }
             }
 
+            if (auto res = session->pop(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "failed to solve fsm: could not close solver scope for state " + std::to_string(n) + ".");
+            }
+
             for (const auto& suc : successor_states)
             {
                 // generate n mapping
@@ -29,12 +29,16 @@
 #include "hal_core/netlist/gate_library/gate_type.h"
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist_builder.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/special_strings.h"
 #include "hal_core/utilities/token_stream.h"
 
+#include <deque>
 #include <optional>
 #include <sstream>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -120,6 +124,10 @@ namespace hal
             std::vector<VerilogDataEntry> m_parameters;
             std::vector<VerilogDataEntry> m_attributes;
             std::vector<std::pair<std::string, std::string>> m_expanded_port_assignments;
+
+            // gate instances only, pins are parallel to the expanded port assignments
+            GateType* m_gate_type = nullptr;
+            std::vector<GatePin*> m_expanded_port_pins;
         };
 
         struct VerilogModule
@@ -163,19 +171,21 @@ namespace hal
             std::map<std::string, VerilogInstance*> m_instances_by_name;
         };
 
-        std::stringstream m_fs;
+        MemoryMappedFile m_file;
         std::filesystem::path m_path;
 
         // temporary netlist
-        Netlist* m_netlist = nullptr;
+        Netlist* m_netlist                = nullptr;
+        NetlistBuilder* m_netlist_builder = nullptr;
 
         // all modules of the netlist
         std::vector<std::unique_ptr<VerilogModule>> m_modules;
         std::unordered_map<std::string, VerilogModule*> m_modules_by_name;
         std::string m_last_module;
 
-        // token stream of entire input file
-        TokenStream<std::string> m_token_stream;
+        // token stream of entire input file, tokens reference the mapped file or the token storage
+        TokenStream<std::string_view> m_token_stream;
+        std::deque<std::string> m_token_storage;
 
         // some caching
         std::unordered_map<std::string, GateType*> m_gate_types;
@@ -197,32 +207,35 @@ namespace hal
         // parse HDL into intermediate format
         void tokenize();
         Result<std::monostate> parse_tokens();
-        Result<std::monostate> parse_module(std::vector<VerilogDataEntry>& attributes);
-        void parse_port_list(VerilogModule* module);
-        Result<std::monostate> parse_port_declaration_list(VerilogModule* module);
-        Result<std::monostate> parse_port_definition(VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
-        Result<std::monostate> parse_signal_definition(VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
-        Result<std::monostate> parse_assignment(VerilogModule* module);
-        Result<std::monostate> parse_defparam(VerilogModule* module);
-        void parse_attribute(std::vector<VerilogDataEntry>& attributes);
-        Result<std::monostate> parse_instance(VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
-        Result<std::monostate> parse_port_assign(VerilogInstance* instance);
-        Result<std::vector<VerilogDataEntry>> parse_parameter_assign();
+        Result<std::unique_ptr<VerilogModule>> parse_module(TokenStream<std::string_view>& stream, std::vector<VerilogDataEntry>& attributes) const;
+        void parse_port_list(TokenStream<std::string_view>& stream, VerilogModule* module) const;
+        Result<std::monostate> parse_port_declaration_list(TokenStream<std::string_view>& stream, VerilogModule* module) const;
+        Result<std::monostate> parse_port_definition(TokenStream<std::string_view>& stream, VerilogModule* module, std::vector<VerilogDataEntry>& attributes) const;
+        Result<std::monostate> parse_signal_definition(TokenStream<std::string_view>& stream, VerilogModule* module, std::vector<VerilogDataEntry>& attributes) const;
+        Result<std::monostate> parse_assignment(TokenStream<std::string_view>& stream, VerilogModule* module) const;
+        Result<std::monostate> parse_defparam(TokenStream<std::string_view>& stream, VerilogModule* module) const;
+        void parse_attribute(TokenStream<std::string_view>& stream, std::vector<VerilogDataEntry>& attributes) const;
+        Result<std::monostate> parse_instance(TokenStream<std::string_view>& stream, VerilogModule* module, std::vector<VerilogDataEntry>& attributes) const;
+        Result<std::monostate> parse_port_assign(TokenStream<std::string_view>& stream, VerilogInstance* instance) const;
+        Result<std::vector<VerilogDataEntry>> parse_parameter_assign(TokenStream<std::string_view>& stream) const;
 
         // construct netlist from intermediate format
         Result<std::monostate> construct_netlist(VerilogModule* top_module);
+        void expand_gate_pin_assignments(VerilogModule* verilog_module) const;
         Result<Module*>
             instantiate_module(const std::string& instance_name, VerilogModule* verilog_module, Module* parent, const std::unordered_map<std::string, std::string>& parent_module_assignments);
 
         // helper functions
         std::string get_unique_alias(std::unordered_map<std::string, u32>& name_occurrences, const std::string& name) const;
-        std::vector<u32> parse_range(TokenStream<std::string>& stream) const;
+        std::vector<u32> parse_range(TokenStream<std::string_view>& stream) const;
         void expand_ranges_recursively(std::vector<std::string>& expanded_names, const std::string& current_name, const std::vector<std::vector<u32>>& ranges, u32 dimension) const;
         std::vector<std::string> expand_ranges(const std::string& name, const std::vector<std::vector<u32>>& ranges) const;
         Result<std::vector<BooleanFunction::Value>> get_binary_vector(std::string value) const;
-        Result<std::string> get_hex_from_literal(const Token<std::string>& value_token) const;
-        Result<std::pair<std::string, std::string>> parse_parameter_value(const Token<std::string>& value_token) const;
-        Result<std::vector<VerilogParser::assignment_t>> parse_assignment_expression(TokenStream<std::string>&& stream) const;
+        Result<std::string> get_hex_from_literal(const Token<std::string_view>& value_token) const;
+        Result<std::pair<std::string, std::string>> parse_parameter_value(const Token<std::string_view>& value_token) const;
+        Result<std::vector<VerilogParser::assignment_t>> parse_assignment_expression(TokenStream<std::string_view>&& stream) const;
         std::vector<std::string> expand_assignment_expression(VerilogModule* verilog_module, const std::vector<assignment_t>& vars) const;
+        Result<std::monostate> expand_module(VerilogModule* verilog_module) const;
+        Result<std::monostate> expand_module_port_assignments(VerilogModule* verilog_module) const;
     };
 }    // namespace hal
@@ -8,8 +8,12 @@
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/utils.h"
 
+#include <algorithm>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iomanip>
+#include <limits>
 #include <queue>
 
 namespace hal
@@ -25,15 +29,9 @@ namespace hal
         m_modules.clear();
         m_modules_by_name.clear();
 
+        if (auto res = m_file.open(file_path); res.is_error())
         {
-            std::ifstream ifs;
-            ifs.open(file_path.string(), std::ifstream::in);
-            if (!ifs.is_open())
-            {
-                return ERR("could not parse Verilog file '" + m_path.string() + "' : unable to open file");
-            }
-            m_fs << ifs.rdbuf();
-            ifs.close();
+            return ERR_APPEND(res.get_error(), "could not parse Verilog file '" + m_path.string() + "' : unable to open file");
         }
 
         // tokenize file
@@ -47,7 +45,7 @@ namespace hal
                 return ERR_APPEND(res.get_error(), "could not parse Verilog file '" + file_path.string() + "': unable to parse tokens");
             }
         }
-        catch (TokenStream<std::string>::TokenStreamException& e)
+        catch (TokenStream<std::string_view>::TokenStreamException& e)
         {
             if (e.line_number != (u32)-1)
             {
@@ -59,168 +57,220 @@ namespace hal
             }
         }
 
+        // release the tokens and the file, all parsed data has been copied into the intermediate format
+        m_token_stream = TokenStream<std::string_view>();
+        m_token_storage.clear();
+        m_file.close();
+
         if (m_modules.empty())
         {
             return ERR("could not parse Verilog file '" + m_path.string() + "': does not contain any modules");
         }
 
-        // expand module port identifiers, signals, and assignments
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        // expand module port identifiers, signals, and assignments, each module only touches its own data
+        std::vector<std::optional<Result<std::monostate>>> expansion_results(m_modules.size());
+#pragma omp parallel for schedule(dynamic)
+        for (i64 i = 0; i < (i64)m_modules.size(); i++)
+        {
+            // exceptions must not escape the parallel region
+            try
+            {
+                expansion_results[i] = expand_module(m_modules[i].get());
+            }
+            catch (const std::exception& e)
+            {
+                expansion_results[i] = ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand module '" + m_modules[i]->m_name + "': " + e.what());
+            }
+        }
+        for (auto& res : expansion_results)
         {
-            // expand port identifiers
-            for (const auto& port : verilog_module->m_ports)
+            if (res.value().is_error())
             {
-                if (port->m_expression == port->m_identifier)
+                return std::move(res.value());
+            }
+        }
+
+        // expand module port assignments, requires the expanded ports of all instantiated modules
+#pragma omp parallel for schedule(dynamic)
+        for (i64 i = 0; i < (i64)m_modules.size(); i++)
+        {
+            try
+            {
+                expansion_results[i] = expand_module_port_assignments(m_modules[i].get());
+            }
+            catch (const std::exception& e)
+            {
+                expansion_results[i] =
+                    ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand port assignments within module '" + m_modules[i]->m_name + "': " + e.what());
+            }
+        }
+        for (auto& res : expansion_results)
+        {
+            if (res.value().is_error())
+            {
+                return std::move(res.value());
+            }
+        }
+
+        return OK({});
+    }
+
+    Result<std::monostate> VerilogParser::expand_module(VerilogModule* verilog_module) const
+    {
+        // expand port identifiers
+        for (const auto& port : verilog_module->m_ports)
+        {
+            if (port->m_expression == port->m_identifier)
+            {
+                if (!port->m_ranges.empty())
                 {
-                    if (!port->m_ranges.empty())
-                    {
-                        port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
-                        verilog_module->m_expanded_port_expressions.insert(port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
-                    }
-                    else
-                    {
-                        port->m_expanded_identifiers = {port->m_identifier};
-                        verilog_module->m_expanded_port_expressions.insert(port->m_identifier);
-                    }
+                    port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
+                    verilog_module->m_expanded_port_expressions.insert(port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
                 }
                 else
                 {
-                    if (!port->m_ranges.empty())
-                    {
-                        port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
-                        auto expanded_expression     = expand_ranges(port->m_expression, port->m_ranges);
-                        verilog_module->m_expanded_port_expressions.insert(expanded_expression.begin(), expanded_expression.end());
-                    }
-                    else
-                    {
-                        port->m_expanded_identifiers = {port->m_identifier};
-                        verilog_module->m_expanded_port_expressions.insert(port->m_expression);
-                    }
+                    port->m_expanded_identifiers = {port->m_identifier};
+                    verilog_module->m_expanded_port_expressions.insert(port->m_identifier);
                 }
             }
-
-            // expand signals
-            for (auto& signal : verilog_module->m_signals)
+            else
             {
-                if (!signal->m_ranges.empty())
+                if (!port->m_ranges.empty())
                 {
-                    signal->m_expanded_names = expand_ranges(signal->m_name, signal->m_ranges);
+                    port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
+                    auto expanded_expression     = expand_ranges(port->m_expression, port->m_ranges);
+                    verilog_module->m_expanded_port_expressions.insert(expanded_expression.begin(), expanded_expression.end());
                 }
                 else
                 {
-                    signal->m_expanded_names = std::vector<std::string>({signal->m_name});
+                    port->m_expanded_identifiers = {port->m_identifier};
+                    verilog_module->m_expanded_port_expressions.insert(port->m_expression);
                 }
             }
+        }
 
-            // expand assignments
-            for (auto& assignment : verilog_module->m_assignments)
+        // expand signals
+        for (auto& signal : verilog_module->m_signals)
+        {
+            if (!signal->m_ranges.empty())
             {
-                const std::vector<std::string> left_signals  = expand_assignment_expression(verilog_module, assignment.m_variable);
-                const std::vector<std::string> right_signals = expand_assignment_expression(verilog_module, assignment.m_assignment);
-                if (left_signals.empty() || right_signals.empty())
-                {
-                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand assignments within module '" + verilog_module->m_name + "'");
-                }
+                signal->m_expanded_names = expand_ranges(signal->m_name, signal->m_ranges);
+            }
+            else
+            {
+                signal->m_expanded_names = std::vector<std::string>({signal->m_name});
+            }
+        }
 
-                u32 left_size  = left_signals.size();
-                u32 right_size = right_signals.size();
-                if (left_size <= right_size)
+        // expand assignments
+        for (auto& assignment : verilog_module->m_assignments)
+        {
+            const std::vector<std::string> left_signals  = expand_assignment_expression(verilog_module, assignment.m_variable);
+            const std::vector<std::string> right_signals = expand_assignment_expression(verilog_module, assignment.m_assignment);
+            if (left_signals.empty() || right_signals.empty())
+            {
+                return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand assignments within module '" + verilog_module->m_name + "'");
+            }
+
+            u32 left_size  = left_signals.size();
+            u32 right_size = right_signals.size();
+            if (left_size <= right_size)
+            {
+                // cut off redundant bits
+                for (u32 i = 0; i < left_size; i++)
                 {
-                    // cut off redundant bits
-                    for (u32 i = 0; i < left_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
-                    }
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
                 }
-                else
+            }
+            else
+            {
+                for (u32 i = 0; i < right_size; i++)
                 {
-                    for (u32 i = 0; i < right_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
-                    }
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
+                }
 
-                    // implicit "0"
-                    for (u32 i = 0; i < left_size - right_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i + right_size), "'0'"));
-                    }
+                // implicit "0"
+                for (u32 i = 0; i < left_size - right_size; i++)
+                {
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i + right_size), "'0'"));
                 }
             }
         }
 
-        // expand module port assignments
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        return OK({});
+    }
+
+    Result<std::monostate> VerilogParser::expand_module_port_assignments(VerilogModule* verilog_module) const
+    {
+        for (auto& instance : verilog_module->m_instances)
         {
-            for (auto& instance : verilog_module->m_instances)
+            if (auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
             {
-                if (auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
+                instance->m_is_module = true;
+                if (!instance->m_port_assignments.empty())
                 {
-                    instance->m_is_module = true;
-                    if (!instance->m_port_assignments.empty())
+                    // all port assignments by name
+                    if (instance->m_port_assignments.front().m_port_name.has_value())
                     {
-                        // all port assignments by name
-                        if (instance->m_port_assignments.front().m_port_name.has_value())
+                        for (const auto& port_assignment : instance->m_port_assignments)
                         {
-                            for (const auto& port_assignment : instance->m_port_assignments)
+                            const std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                            if (!right_port.empty())
                             {
-                                const std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
+                                VerilogPort* port;
+                                if (const auto port_it = module_it->second->m_ports_by_identifier.find(port_assignment.m_port_name.value());
+                                    port_it == module_it->second->m_ports_by_identifier.end())
+                                {
+                                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to assign signal to port '" + port_assignment.m_port_name.value()
+                                               + "' as it is not a port of module '" + module_it->first + "'");
+                                }
+                                else
+                                {
+                                    port = port_it->second;
+                                }
+                                const std::vector<std::string>& left_port = port->m_expanded_identifiers;
+                                if (left_port.empty())
+                                {
+                                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand port assignment");
+                                }
+
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+
+                                for (u32 i = 0; i < max_size; i++)
                                 {
-                                    VerilogPort* port;
-                                    if (const auto port_it = module_it->second->m_ports_by_identifier.find(port_assignment.m_port_name.value());
-                                        port_it == module_it->second->m_ports_by_identifier.end())
-                                    {
-                                        return ERR("could not parse Verilog file '" + m_path.string() + "': unable to assign signal to port '" + port_assignment.m_port_name.value()
-                                                   + "' as it is not a port of module '" + module_it->first + "'");
-                                    }
-                                    else
-                                    {
-                                        port = port_it->second;
-                                    }
-                                    const std::vector<std::string>& left_port = port->m_expanded_identifiers;
-                                    if (left_port.empty())
-                                    {
-                                        return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand port assignment");
-                                    }
-
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
                                 }
                             }
                         }
-                        // all port assignments by order
-                        else
+                    }
+                    // all port assignments by order
+                    else
+                    {
+                        std::vector<std::string> ports;
+                        for (const auto& port : m_modules_by_name.at(instance->m_type)->m_ports)
                         {
-                            std::vector<std::string> ports;
-                            for (const auto& port : m_modules_by_name.at(instance->m_type)->m_ports)
-                            {
-                                ports.insert(ports.end(), port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
-                            }
+                            ports.insert(ports.end(), port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
+                        }
 
-                            auto port_it = ports.begin();
+                        auto port_it = ports.begin();
 
-                            for (const auto& port_assignment : instance->m_port_assignments)
+                        for (const auto& port_assignment : instance->m_port_assignments)
+                        {
+                            std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                            if (!right_port.empty())
                             {
-                                std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
-                                {
-                                    std::vector<std::string> left_port;
+                                std::vector<std::string> left_port;
 
-                                    for (u32 i = 0; i < right_port.size() && port_it != ports.end(); i++)
-                                    {
-                                        left_port.push_back(*port_it++);
-                                    }
+                                for (u32 i = 0; i < right_port.size() && port_it != ports.end(); i++)
+                                {
+                                    left_port.push_back(*port_it++);
+                                }
 
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
 
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
                                 }
                             }
                         }
@@ -257,6 +307,8 @@ namespace hal
                 if (!instance->m_is_module)
                 {
                     instance->m_expanded_port_assignments.clear();
+                    instance->m_expanded_port_pins.clear();
+                    instance->m_gate_type = nullptr;
                 }
             }
         }
@@ -316,6 +368,41 @@ namespace hal
         // construct the netlist with the the top module
         VerilogModule* top_module = m_modules_by_name.at(top_module_candidates.front());
 
+        // pre-allocate netlist storage based on the size of the flattened module hierarchy
+        std::unordered_map<const VerilogModule*, std::tuple<u64, u64, u64>> flattened_sizes;
+        std::function<std::tuple<u64, u64, u64>(const VerilogModule*)> get_flattened_size = [this, &flattened_sizes, &get_flattened_size](const VerilogModule* verilog_module) {
+            if (const auto it = flattened_sizes.find(verilog_module); it != flattened_sizes.end())
+            {
+                return it->second;
+            }
+
+            // guard against cyclic instantiations, which are reported when constructing the netlist
+            flattened_sizes[verilog_module] = std::make_tuple(0, 0, 0);
+
+            u64 num_gates = 0, num_nets = 0, num_modules = 1;
+            for (const auto& signal : verilog_module->m_signals)
+            {
+                num_nets += signal->m_expanded_names.size();
+            }
+            for (const auto& instance : verilog_module->m_instances)
+            {
+                if (const auto it = m_modules_by_name.find(instance->m_type); it != m_modules_by_name.end())
+                {
+                    const auto [sub_gates, sub_nets, sub_modules] = get_flattened_size(it->second);
+                    num_gates += sub_gates;
+                    num_nets += sub_nets;
+                    num_modules += sub_modules;
+                }
+                else
+                {
+                    num_gates++;
+                }
+            }
+            return flattened_sizes[verilog_module] = std::make_tuple(num_gates, num_nets, num_modules);
+        };
+        const auto [num_gates, num_nets, num_modules] = get_flattened_size(top_module);
+        m_netlist->reserve(std::min<u64>(num_gates, std::numeric_limits<u32>::max()), std::min<u64>(num_nets, std::numeric_limits<u32>::max()), std::min<u64>(num_modules, std::numeric_limits<u32>::max()));
+
         if (const auto res = construct_netlist(top_module); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not instantiate Verilog netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': unable to construct netlist");
@@ -345,117 +432,186 @@ namespace hal
 
     void VerilogParser::tokenize()
     {
-        const std::string delimiters = "`,()[]{}\\#*: ;=./";
-        std::string current_token;
-        u32 line_number = 0;
+        m_token_storage.clear();
 
-        std::string line;
-        char prev_char  = 0;
-        bool in_string  = false;
-        bool escaped    = false;
-        bool in_comment = false;
+        const std::string_view data       = m_file.get_data();
+        const std::string_view delimiters = "`,()[]{}\\#*: ;=./";
+        u32 line_number                   = 1;
 
-        std::vector<Token<std::string>> parsed_tokens;
-        while (std::getline(m_fs, line))
-        {
-            line_number++;
-            // this->remove_comments(line, multi_line_comment);
+        // the current token usually is a contiguous range of the file, it is only copied if characters within the token are skipped (e.g., escape characters)
+        size_t token_begin = 0;
+        size_t token_end   = 0;
+        std::string token_copy;
+        bool is_copied = false;
 
-            for (char c : line)
-            {
-                // deal with comments
-                if (in_comment)
-                {
-                    if (c == '/' && prev_char == '*')
-                    {
-                        in_comment = false;
-                    }
+        char prev_char       = 0;
+        bool in_string       = false;
+        bool escaped         = false;
+        bool in_comment      = false;
+        bool in_line_comment = false;
 
-                    prev_char = c;
-                    continue;
-                }
+        std::vector<Token<std::string_view>> parsed_tokens;
 
-                // deal with escaping and strings
-                if (!in_string && c == '\\')
-                {
-                    escaped = true;
-                    continue;
-                }
-                else if (escaped && std::isspace(c))
+        const auto append_to_token = [&](size_t pos) {
+            if (token_begin == token_end && !is_copied)
+            {
+                token_begin = pos;
+                token_end   = pos + 1;
+            }
+            else if (!is_copied && token_end == pos)
+            {
+                token_end++;
+            }
+            else
+            {
+                if (!is_copied)
                 {
-                    escaped = false;
-                    continue;
+                    token_copy.assign(data.substr(token_begin, token_end - token_begin));
+                    is_copied = true;
                 }
-                else if (!escaped && c == '"')
+                token_copy += data[pos];
+            }
+        };
+
+        const auto take_token = [&]() {
+            std::string_view token;
+            if (is_copied)
+            {
+                token = m_token_storage.emplace_back(std::move(token_copy));
+                token_copy.clear();
+                is_copied = false;
+            }
+            else
+            {
+                token = data.substr(token_begin, token_end - token_begin);
+            }
+            token_begin = token_end = 0;
+            return token;
+        };
+
+        const auto has_token = [&]() { return is_copied || token_begin != token_end; };
+
+        for (size_t pos = 0; pos < data.size(); pos++)
+        {
+            const char c = data[pos];
+
+            if (c == '\n')
+            {
+                if (has_token())
                 {
-                    in_string = !in_string;
+                    parsed_tokens.emplace_back(line_number, take_token());
                 }
+                line_number++;
+                in_line_comment = false;
+                continue;
+            }
 
-                if (!in_comment && ((!std::isspace(c) && delimiters.find(c) == std::string::npos) || escaped || in_string))
+            if (in_line_comment)
+            {
+                continue;
+            }
+
+            // deal with comments
+            if (in_comment)
+            {
+                if (c == '/' && prev_char == '*')
                 {
-                    current_token += c;
+                    in_comment = false;
                 }
-                else
+
+                prev_char = c;
+                continue;
+            }
+
+            // deal with escaping and strings
+            if (!in_string && c == '\\')
+            {
+                escaped = true;
+                continue;
+            }
+            else if (escaped && std::isspace(c))
+            {
+                escaped = false;
+                continue;
+            }
+            else if (!escaped && c == '"')
+            {
+                in_string = !in_string;
+            }
+
+            if ((!std::isspace(c) && delimiters.find(c) == std::string_view::npos) || escaped || in_string)
+            {
+                append_to_token(pos);
+            }
+            else
+            {
+                // deal with floats
+                if (has_token())
                 {
-                    // deal with floats
-                    if (!current_token.empty())
+                    const std::string_view current_token = take_token();
+                    if (parsed_tokens.size() > 1 && utils::is_digits(parsed_tokens.at(parsed_tokens.size() - 2).string) && parsed_tokens.at(parsed_tokens.size() - 1) == "."
+                        && utils::is_digits(current_token))
                     {
-                        if (parsed_tokens.size() > 1 && utils::is_digits(parsed_tokens.at(parsed_tokens.size() - 2).string) && parsed_tokens.at(parsed_tokens.size() - 1) == "."
-                            && utils::is_digits(current_token))
+                        const std::string_view dot = parsed_tokens.back().string;
+                        parsed_tokens.pop_back();
+                        const std::string_view integer_part = parsed_tokens.back().string;
+                        if (integer_part.data() + integer_part.size() == dot.data() && dot.data() + dot.size() == current_token.data())
                         {
-                            parsed_tokens.pop_back();
-                            parsed_tokens.back() += "." + current_token;
+                            parsed_tokens.back() = std::string_view(integer_part.data(), integer_part.size() + dot.size() + current_token.size());
                         }
                         else
                         {
-                            parsed_tokens.emplace_back(line_number, current_token);
+                            parsed_tokens.back() = m_token_storage.emplace_back(std::string(integer_part) + "." + std::string(current_token));
                         }
-                        current_token.clear();
                     }
-
-                    if (!parsed_tokens.empty())
+                    else
                     {
-                        // deal with multi-character tokens
-                        if (c == '(' && parsed_tokens.back() == "#")
-                        {
-                            parsed_tokens.back() = "#(";
-                            continue;
-                        }
-                        else if (c == '*' && parsed_tokens.back() == "(")
-                        {
-                            parsed_tokens.back() = "(*";
-                            continue;
-                        }
-                        else if (c == ')' && parsed_tokens.back() == "*")
-                        {
-                            parsed_tokens.back() = "*)";
-                            continue;
-                        }
-                        // start a comment
-                        else if (c == '/' && parsed_tokens.back() == "/")
-                        {
-                            parsed_tokens.pop_back();
-                            break;
-                        }
-                        else if (c == '*' && parsed_tokens.back() == "/")
-                        {
-                            in_comment = true;
-                            parsed_tokens.pop_back();
-                            continue;
-                        }
+                        parsed_tokens.emplace_back(line_number, current_token);
                     }
+                }
 
-                    if (!std::isspace(c))
+                if (!parsed_tokens.empty())
+                {
+                    // deal with multi-character tokens
+                    if (c == '(' && parsed_tokens.back() == "#")
+                    {
+                        parsed_tokens.back() = "#(";
+                        continue;
+                    }
+                    else if (c == '*' && parsed_tokens.back() == "(")
                     {
-                        parsed_tokens.emplace_back(line_number, std::string(1, c));
+                        parsed_tokens.back() = "(*";
+                        continue;
+                    }
+                    else if (c == ')' && parsed_tokens.back() == "*")
+                    {
+                        parsed_tokens.back() = "*)";
+                        continue;
+                    }
+                    // start a comment
+                    else if (c == '/' && parsed_tokens.back() == "/")
+                    {
+                        parsed_tokens.pop_back();
+                        in_line_comment = true;
+                        continue;
+                    }
+                    else if (c == '*' && parsed_tokens.back() == "/")
+                    {
+                        in_comment = true;
+                        parsed_tokens.pop_back();
+                        continue;
                     }
                 }
+
+                if (!std::isspace(c))
+                {
+                    parsed_tokens.emplace_back(line_number, data.substr(pos, 1));
+                }
             }
-            if (!current_token.empty())
-            {
-                parsed_tokens.emplace_back(line_number, current_token);
-                current_token.clear();
-            }
+        }
+        if (has_token())
+        {
+            parsed_tokens.emplace_back(line_number, take_token());
         }
 
         m_token_stream = TokenStream(parsed_tokens, {"(", "["}, {")", "]"});
@@ -463,14 +619,22 @@ namespace hal
 
     Result<std::monostate> VerilogParser::parse_tokens()
     {
+        struct ModuleDefinition
+        {
+            u32 line_number;
+            std::vector<VerilogDataEntry> attributes;
+            TokenStream<std::string_view> tokens;
+        };
+
+        // (1) locate all module definitions, attributes preceding a module definition are parsed right away
+        std::vector<ModuleDefinition> definitions;
         std::vector<VerilogDataEntry> attributes;
-        u32 line_number;
 
         while (m_token_stream.remaining() > 0)
         {
             if (m_token_stream.peek() == "(*")
             {
-                parse_attribute(attributes);
+                parse_attribute(m_token_stream, attributes);
             }
             else if (m_token_stream.peek() == "`")
             {
@@ -479,32 +643,81 @@ namespace hal
             }
             else
             {
-                line_number = m_token_stream.peek().number;
-                if (auto res = parse_module(attributes); res.is_error())
+                const u32 line_number = m_token_stream.peek().number;
+                u32 end               = m_token_stream.find_next("endmodule", TokenStream<std::string_view>::END_OF_STREAM, false);
+                if (end != TokenStream<std::string_view>::END_OF_STREAM)
                 {
-                    return ERR_APPEND(res.get_error(), "could not parse tokens: unable to parse module (line " + std::to_string(line_number) + ")");
+                    end++;
                 }
+                definitions.push_back({line_number, std::move(attributes), m_token_stream.extract(end)});
+                attributes.clear();
+            }
+        }
+
+        // (2) parse module definitions in parallel, they do not depend on each other
+        std::vector<std::optional<Result<std::unique_ptr<VerilogModule>>>> results(definitions.size());
+        std::vector<std::optional<TokenStream<std::string_view>::TokenStreamException>> exceptions(definitions.size());
+
+#pragma omp parallel for schedule(dynamic)
+        for (i64 i = 0; i < (i64)definitions.size(); i++)
+        {
+            try
+            {
+                results[i] = parse_module(definitions[i].tokens, definitions[i].attributes);
+            }
+            catch (TokenStream<std::string_view>::TokenStreamException& e)
+            {
+                exceptions[i] = e;
+            }
+            catch (const std::exception& e)
+            {
+                // e.g., std::stoi on a malformed range, exceptions must not escape the parallel region
+                results[i] = ERR(e.what());
             }
         }
 
+        // (3) collect modules in the order of their definition
+        for (u32 i = 0; i < definitions.size(); i++)
+        {
+            const u32 line_number = definitions.at(i).line_number;
+
+            if (exceptions.at(i).has_value())
+            {
+                throw exceptions.at(i).value();
+            }
+
+            auto& res = results.at(i).value();
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not parse tokens: unable to parse module (line " + std::to_string(line_number) + ")");
+            }
+
+            std::unique_ptr<VerilogModule> verilog_module = res.get();
+            const std::string& module_name                = verilog_module->m_name;
+
+            // verify module name
+            if (const auto it = m_modules_by_name.find(module_name); it != m_modules_by_name.end())
+            {
+                return ERR("could not parse tokens: unable to parse module '" + module_name + "' (line " + std::to_string(line_number) + "): a module with the same name already exists (line "
+                           + std::to_string(it->second->m_line_number) + ")");
+            }
+
+            m_modules_by_name[module_name] = verilog_module.get();
+            m_last_module                  = module_name;
+            m_modules.push_back(std::move(verilog_module));
+        }
+
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_module(std::vector<VerilogDataEntry>& attributes)
+    Result<std::unique_ptr<VerilogParser::VerilogModule>> VerilogParser::parse_module(TokenStream<std::string_view>& stream, std::vector<VerilogDataEntry>& attributes) const
     {
         std::set<std::string> port_names;
         std::vector<VerilogDataEntry> internal_attributes;
 
-        m_token_stream.consume("module", true);
-        const u32 line_number         = m_token_stream.peek().number;
-        const std::string module_name = m_token_stream.consume();
-
-        // verify entity name
-        if (const auto it = m_modules_by_name.find(module_name); it != m_modules_by_name.end())
-        {
-            return ERR("could not parse module '" + module_name + "' (line " + std::to_string(line_number) + "): a module with the same name already exists (line "
-                       + std::to_string(it->second->m_line_number) + ")");
-        }
+        stream.consume("module", true);
+        const u32 line_number         = stream.peek().number;
+        const std::string module_name = std::string(stream.consume().string);
 
         auto verilog_module               = std::make_unique<VerilogModule>();
         VerilogModule* verilog_module_raw = verilog_module.get();
@@ -512,44 +725,44 @@ namespace hal
         verilog_module_raw->m_name        = module_name;
 
         // parse parameter list
-        if (m_token_stream.consume("#("))
+        if (stream.consume("#("))
         {
             // TODO add support for parameter parsing
-            m_token_stream.consume_until(")");
-            m_token_stream.consume(")", true);
+            stream.consume_until(")");
+            stream.consume(")", true);
             log_warning("verilog_parser", "could not parse parameter list provided for module '{}'.", module_name);
         }
 
         // parse port (declaration) list
-        m_token_stream.consume("(", true);
-        Token<std::string> next_token = m_token_stream.peek();
+        stream.consume("(", true);
+        Token<std::string_view> next_token = stream.peek();
         if (next_token == "input" || next_token == "output" || next_token == "inout")
         {
-            if (auto res = parse_port_declaration_list(verilog_module_raw); res.is_error())
+            if (auto res = parse_port_declaration_list(stream, verilog_module_raw); res.is_error())
             {
                 return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse port declaration list (line " + std::to_string(line_number) + ")");
             }
         }
         else
         {
-            parse_port_list(verilog_module_raw);
+            parse_port_list(stream, verilog_module_raw);
         }
 
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
 
-        next_token = m_token_stream.peek();
+        next_token = stream.peek();
         while (next_token != "endmodule")
         {
             if (next_token == "input" || next_token == "output" || next_token == "inout")
             {
-                if (auto res = parse_port_definition(verilog_module_raw, internal_attributes); res.is_error())
+                if (auto res = parse_port_definition(stream, verilog_module_raw, internal_attributes); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse port definition (line " + std::to_string(line_number) + ")");
                 }
             }
             else if (next_token == "wire" || next_token == "tri")
             {
-                if (auto res = parse_signal_definition(verilog_module_raw, internal_attributes); res.is_error())
+                if (auto res = parse_signal_definition(stream, verilog_module_raw, internal_attributes); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse signal definition (line " + std::to_string(line_number) + ")");
                 }
@@ -557,40 +770,40 @@ namespace hal
             else if (next_token == "parameter")
             {
                 // TODO add support for parameter parsing
-                m_token_stream.consume_until(";");
-                m_token_stream.consume(";", true);
+                stream.consume_until(";");
+                stream.consume(";", true);
                 log_warning("verilog_parser", "could not parse parameter provided for module '{}'.", module_name);
             }
             else if (next_token == "assign")
             {
-                if (auto res = parse_assignment(verilog_module_raw); res.is_error())
+                if (auto res = parse_assignment(stream, verilog_module_raw); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse assignment (line " + std::to_string(line_number) + ")");
                 }
             }
             else if (next_token == "defparam")
             {
-                if (auto res = parse_defparam(verilog_module_raw); res.is_error())
+                if (auto res = parse_defparam(stream, verilog_module_raw); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse defparam (line " + std::to_string(line_number) + ")");
                 }
             }
             else if (next_token == "(*")
             {
-                parse_attribute(internal_attributes);
+                parse_attribute(stream, internal_attributes);
             }
             else
             {
-                if (auto res = parse_instance(verilog_module_raw, internal_attributes); res.is_error())
+                if (auto res = parse_instance(stream, verilog_module_raw, internal_attributes); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse instance (line " + std::to_string(line_number) + ")");
                 }
             }
 
-            next_token = m_token_stream.peek();
+            next_token = stream.peek();
         }
 
-        m_token_stream.consume("endmodule", true);
+        stream.consume("endmodule", true);
 
         // assign attributes to entity
         if (!attributes.empty())
@@ -599,23 +812,18 @@ namespace hal
             attributes.clear();
         }
 
-        // add to collection of entities
-        m_modules.push_back(std::move(verilog_module));
-        m_modules_by_name[module_name] = verilog_module_raw;
-        m_last_module                  = module_name;
-
-        return OK({});
+        return OK(std::move(verilog_module));
     }
 
-    void VerilogParser::parse_port_list(VerilogModule* verilog_module)
+    void VerilogParser::parse_port_list(TokenStream<std::string_view>& stream, VerilogModule* verilog_module) const
     {
-        TokenStream<std::string> ports_stream = m_token_stream.extract_until(")");
-        m_token_stream.consume(")", true);
+        TokenStream<std::string_view> ports_stream = stream.extract_until(")");
+        stream.consume(")", true);
 
         while (ports_stream.remaining() > 0)
         {
-            Token<std::string> next_token = ports_stream.consume();
-            auto port                     = std::make_unique<VerilogPort>();
+            Token<std::string_view> next_token = ports_stream.consume();
+            auto port                          = std::make_unique<VerilogPort>();
 
             if (next_token == ".")
             {
@@ -638,19 +846,19 @@ namespace hal
         }
     }
 
-    Result<std::monostate> VerilogParser::parse_port_declaration_list(VerilogModule* verilog_module)
+    Result<std::monostate> VerilogParser::parse_port_declaration_list(TokenStream<std::string_view>& stream, VerilogModule* verilog_module) const
     {
-        TokenStream<std::string> ports_stream = m_token_stream.extract_until(")");
-        m_token_stream.consume(")", true);
+        TokenStream<std::string_view> ports_stream = stream.extract_until(")");
+        stream.consume(")", true);
 
         while (ports_stream.remaining() > 0)
         {
             // direction
-            const Token<std::string> direction_token = ports_stream.consume();
-            PinDirection direction                   = enum_from_string<PinDirection>(direction_token.string, PinDirection::none);
+            const Token<std::string_view> direction_token = ports_stream.consume();
+            PinDirection direction                        = enum_from_string<PinDirection>(std::string(direction_token.string), PinDirection::none);
             if (direction == PinDirection::none || direction == PinDirection::internal)
             {
-                return ERR("could not parse port declaration list: invalid direction '" + direction_token.string + "' (line " + std::to_string(direction_token.number) + ")");
+                return ERR("could not parse port declaration list: invalid direction '" + std::string(direction_token.string) + "' (line " + std::to_string(direction_token.number) + ")");
             }
 
             // ranges
@@ -666,7 +874,7 @@ namespace hal
             // port expressions
             do
             {
-                const Token<std::string> next_token = ports_stream.peek();
+                const Token<std::string_view> next_token = ports_stream.peek();
                 if (next_token == "input" || next_token == "output" || next_token == "inout")
                 {
                     break;
@@ -691,22 +899,22 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_port_definition(VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
+    Result<std::monostate> VerilogParser::parse_port_definition(TokenStream<std::string_view>& stream, VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes) const
     {
         // port direction
-        const Token<std::string> direction_token = m_token_stream.consume();
-        PinDirection direction                   = enum_from_string<PinDirection>(direction_token.string, PinDirection::none);
+        const Token<std::string_view> direction_token = stream.consume();
+        PinDirection direction                        = enum_from_string<PinDirection>(std::string(direction_token.string), PinDirection::none);
         if (direction == PinDirection::none || direction == PinDirection::internal)
         {
-            return ERR("could not parse port definition: invalid direction '" + direction_token.string + "' (line " + std::to_string(direction_token.number) + ")");
+            return ERR("could not parse port definition: invalid direction '" + std::string(direction_token.string) + "' (line " + std::to_string(direction_token.number) + ")");
         }
 
         // ranges
         std::vector<std::vector<u32>> ranges;
-        while (m_token_stream.consume("["))
+        while (stream.consume("["))
         {
-            const std::vector<u32> range = parse_range(m_token_stream);
-            m_token_stream.consume("]", true);
+            const std::vector<u32> range = parse_range(stream);
+            stream.consume("]", true);
 
             ranges.emplace_back(range);
         }
@@ -714,8 +922,8 @@ namespace hal
         // port expressions
         do
         {
-            Token<std::string> port_expression_token = m_token_stream.consume();
-            std::string port_expression              = port_expression_token.string;
+            Token<std::string_view> port_expression_token = stream.consume();
+            std::string port_expression                   = std::string(port_expression_token.string);
 
             VerilogPort* port;
             if (const auto it = verilog_module->m_ports_by_expression.find(port_expression); it == verilog_module->m_ports_by_expression.end())
@@ -734,21 +942,21 @@ namespace hal
                 port->m_ranges = ranges;
             }
             port->m_attributes.insert(port->m_attributes.end(), attributes.begin(), attributes.end());
-        } while (m_token_stream.consume(",", false));
+        } while (stream.consume(",", false));
 
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
         attributes.clear();
 
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_signal_definition(VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
+    Result<std::monostate> VerilogParser::parse_signal_definition(TokenStream<std::string_view>& stream, VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes) const
     {
         // consume "wire" or "tri"
-        u32 line_number = m_token_stream.consume().number;
+        u32 line_number = stream.consume().number;
 
-        TokenStream<std::string> signal_stream = m_token_stream.extract_until(";");
-        m_token_stream.consume(";", true);
+        TokenStream<std::string_view> signal_stream = stream.extract_until(";");
+        stream.consume(";", true);
 
         // extract bounds
         std::vector<std::vector<u32>> ranges;
@@ -763,11 +971,11 @@ namespace hal
         // extract names
         do
         {
-            Token<std::string> signal_name = signal_stream.consume();
+            Token<std::string_view> signal_name = signal_stream.consume();
             if (signal_stream.remaining() > 0 && signal_stream.peek() == "=")
             {
                 VerilogAssignment assignment;
-                assignment.m_variable.push_back(signal_name);
+                assignment.m_variable.push_back(std::string(signal_name.string));
                 signal_stream.consume("=", true);
                 if (auto res = parse_assignment_expression(signal_stream.extract_until(",")); res.is_error())
                 {
@@ -787,7 +995,7 @@ namespace hal
                 signal->m_ranges = ranges;
             }
             signal->m_attributes.insert(signal->m_attributes.end(), attributes.begin(), attributes.end());
-            verilog_module->m_signals_by_name[signal_name.string] = signal.get();
+            verilog_module->m_signals_by_name[signal->m_name] = signal.get();
             verilog_module->m_signals.push_back(std::move(signal));
 
         } while (signal_stream.consume(",", false));
@@ -797,13 +1005,13 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_assignment(VerilogModule* verilog_module)
+    Result<std::monostate> VerilogParser::parse_assignment(TokenStream<std::string_view>& stream, VerilogModule* verilog_module) const
     {
-        m_token_stream.consume("assign", true);
-        u32 line_number = m_token_stream.peek().number;
+        stream.consume("assign", true);
+        u32 line_number = stream.peek().number;
         VerilogAssignment assignment;
 
-        if (auto res = parse_assignment_expression(m_token_stream.extract_until("=")); res.is_error())
+        if (auto res = parse_assignment_expression(stream.extract_until("=")); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not parse assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
         }
@@ -811,9 +1019,9 @@ namespace hal
         {
             assignment.m_variable = res.get();
         }
-        m_token_stream.consume("=", true);
+        stream.consume("=", true);
 
-        if (auto res = parse_assignment_expression(m_token_stream.extract_until(";")); res.is_error())
+        if (auto res = parse_assignment_expression(stream.extract_until(";")); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not parse assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
         }
@@ -821,25 +1029,25 @@ namespace hal
         {
             assignment.m_assignment = res.get();
         }
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
 
         verilog_module->m_assignments.push_back(std::move(assignment));
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_defparam(VerilogModule* module)
+    Result<std::monostate> VerilogParser::parse_defparam(TokenStream<std::string_view>& stream, VerilogModule* module) const
     {
-        m_token_stream.consume("defparam", true);
-        std::string instance_name = m_token_stream.consume().string;
-        m_token_stream.consume(".", true);
+        stream.consume("defparam", true);
+        std::string instance_name = std::string(stream.consume().string);
+        stream.consume(".", true);
 
         if (const auto inst_it = module->m_instances_by_name.find(instance_name); inst_it != module->m_instances_by_name.end())
         {
             VerilogDataEntry param;
-            param.m_name = m_token_stream.consume().string;
-            m_token_stream.consume("=", true);
+            param.m_name = stream.consume().string;
+            stream.consume("=", true);
 
-            if (const auto res = parse_parameter_value(m_token_stream.consume()); res.is_ok())
+            if (const auto res = parse_parameter_value(stream.consume()); res.is_ok())
             {
                 const auto value = res.get();
                 param.m_type     = value.first;
@@ -853,28 +1061,28 @@ namespace hal
         }
         else
         {
-            m_token_stream.consume(";", true);
+            stream.consume(";", true);
             return ERR("could not parse defparam: no instance with name '" + instance_name + "' exists within module '" + module->m_name + "'");
         }
 
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
         return OK({});
     }
 
-    void VerilogParser::parse_attribute(std::vector<VerilogDataEntry>& attributes)
+    void VerilogParser::parse_attribute(TokenStream<std::string_view>& stream, std::vector<VerilogDataEntry>& attributes) const
     {
-        m_token_stream.consume("(*", true);
+        stream.consume("(*", true);
 
         // extract attributes
         do
         {
             VerilogDataEntry attribute;
-            attribute.m_name = m_token_stream.consume().string;
+            attribute.m_name = stream.consume().string;
 
             // attribute value specified?
-            if (m_token_stream.consume("="))
+            if (stream.consume("="))
             {
-                attribute.m_value = m_token_stream.consume();
+                attribute.m_value = stream.consume();
 
                 // remove "
                 if (attribute.m_value[0] == '\"' && attribute.m_value.back() == '\"')
@@ -885,21 +1093,21 @@ namespace hal
 
             attributes.push_back(std::move(attribute));
 
-        } while (m_token_stream.consume(",", false));
+        } while (stream.consume(",", false));
 
-        m_token_stream.consume("*)", true);
+        stream.consume("*)", true);
     }
 
-    Result<std::monostate> VerilogParser::parse_instance(VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
+    Result<std::monostate> VerilogParser::parse_instance(TokenStream<std::string_view>& stream, VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes) const
     {
         auto instance    = std::make_unique<VerilogInstance>();
-        u32 line_number  = m_token_stream.peek().number;
-        instance->m_type = m_token_stream.consume().string;
+        u32 line_number  = stream.peek().number;
+        instance->m_type = stream.consume().string;
 
         // parse generics map
-        if (m_token_stream.consume("#("))
+        if (stream.consume("#("))
         {
-            if (auto res = parse_parameter_assign(); res.is_error())
+            if (auto res = parse_parameter_assign(stream); res.is_error())
             {
                 return ERR_APPEND(res.get_error(), "could not parse instance of type '" + instance->m_type + "': unable to parse parameter assignment (line " + std::to_string(line_number) + ")");
             }
@@ -910,10 +1118,10 @@ namespace hal
         }
 
         // parse instance name
-        instance->m_name = m_token_stream.consume().string;
+        instance->m_name = stream.consume().string;
 
         // parse port map
-        if (auto res = parse_port_assign(instance.get()); res.is_error())
+        if (auto res = parse_port_assign(stream, instance.get()); res.is_error())
         {
             return ERR_APPEND(res.get_error(),
                               "could not parse instance '" + instance->m_name + "' of type '" + instance->m_type + "': unable to parse port assignment (line " + std::to_string(line_number) + ")");
@@ -929,20 +1137,20 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_port_assign(VerilogInstance* instance)
+    Result<std::monostate> VerilogParser::parse_port_assign(TokenStream<std::string_view>& stream, VerilogInstance* instance) const
     {
-        u32 line_number = m_token_stream.peek().number;
-        m_token_stream.consume("(", true);
-        u32 line_end = m_token_stream.find_next(";");
-        if (m_token_stream.peek() == ".")
+        u32 line_number = stream.peek().number;
+        stream.consume("(", true);
+        u32 line_end = stream.find_next(";");
+        if (stream.peek() == ".")
         {
             do
             {
-                m_token_stream.consume(".");
+                stream.consume(".");
                 VerilogPortAssignment port_assignment;
-                port_assignment.m_port_name = m_token_stream.consume().string;
-                m_token_stream.consume("(", true);
-                if (auto res = parse_assignment_expression(m_token_stream.extract_until(")")); res.is_error())
+                port_assignment.m_port_name = stream.consume().string;
+                stream.consume("(", true);
+                if (auto res = parse_assignment_expression(stream.extract_until(")")); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse port assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
                 }
@@ -950,20 +1158,20 @@ namespace hal
                 {
                     port_assignment.m_assignment = res.get();
                 }
-                m_token_stream.consume(")", true);
+                stream.consume(")", true);
                 if (port_assignment.m_assignment.empty())
                 {
                     continue;
                 }
                 instance->m_port_assignments.push_back(std::move(port_assignment));
-            } while (m_token_stream.consume(",", false));
+            } while (stream.consume(",", false));
         }
         else
         {
             do
             {
                 VerilogPortAssignment port_assignment;
-                if (auto res = parse_assignment_expression(m_token_stream.extract_until(",", line_end - 1)); res.is_error())
+                if (auto res = parse_assignment_expression(stream.extract_until(",", line_end - 1)); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse port assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
                 }
@@ -976,29 +1184,29 @@ namespace hal
                     continue;
                 }
                 instance->m_port_assignments.push_back(std::move(port_assignment));
-            } while (m_token_stream.consume(",", false));
+            } while (stream.consume(",", false));
         }
 
-        m_token_stream.consume(")", true);
-        m_token_stream.consume(";", true);
+        stream.consume(")", true);
+        stream.consume(";", true);
 
         return OK({});
     }
 
-    Result<std::vector<VerilogParser::VerilogDataEntry>> VerilogParser::parse_parameter_assign()
+    Result<std::vector<VerilogParser::VerilogDataEntry>> VerilogParser::parse_parameter_assign(TokenStream<std::string_view>& stream) const
     {
         std::vector<VerilogDataEntry> generics;
 
         do
         {
-            if (m_token_stream.consume(".", false))
+            if (stream.consume(".", false))
             {
-                const Token<std::string> lhs = m_token_stream.join_until("(", "");
-                m_token_stream.consume("(", true);
-                const Token<std::string> rhs = m_token_stream.join_until(")", "");
-                m_token_stream.consume(")", true);
+                const Token<std::string> lhs = stream.join_until("(", "");
+                stream.consume("(", true);
+                const Token<std::string> rhs = stream.join_until(")", "");
+                stream.consume(")", true);
 
-                if (const auto res = parse_parameter_value(rhs); res.is_ok())
+                if (const auto res = parse_parameter_value({rhs.number, rhs.string}); res.is_ok())
                 {
                     const auto value = res.get();
                     generics.push_back(VerilogDataEntry({lhs.string, value.first, value.second}));
@@ -1008,9 +1216,9 @@ namespace hal
                     log_warning("verilog_parser", "{}", res.get_error().get());
                 }
             }
-        } while (m_token_stream.consume(",", false));
+        } while (stream.consume(",", false));
 
-        m_token_stream.consume(")", true);
+        stream.consume(")", true);
 
         return OK(generics);
     }
@@ -1024,11 +1232,54 @@ namespace hal
         m_netlist->set_design_name(top_module->m_name);
         m_netlist->enable_automatic_net_checks(false);
 
-        std::unordered_map<std::string, u32> instantiation_count;
+        NetlistBuilder builder(m_netlist);
+        m_netlist_builder = &builder;
+
+        // determine the module hierarchy below the top module in topological order, i.e., every module precedes the modules it instantiates
+        std::vector<VerilogModule*> topological_order;
+        std::unordered_map<const VerilogModule*, u8> visit_state;
+        std::function<bool(VerilogModule*)> visit = [this, &topological_order, &visit_state, &visit](VerilogModule* module) {
+            if (const auto it = visit_state.find(module); it != visit_state.end())
+            {
+                // a module that is still being visited is part of a cycle
+                return it->second == 2;
+            }
+
+            visit_state[module] = 1;
+            for (const auto& instance : module->m_instances)
+            {
+                if (const auto it = m_modules_by_name.find(instance->m_type); it != m_modules_by_name.end() && !visit(it->second))
+                {
+                    return false;
+                }
+            }
+            visit_state[module] = 2;
+            topological_order.push_back(module);
+            return true;
+        };
+
+        if (!visit(top_module))
+        {
+            return ERR("could not construct netlist: module hierarchy of top module '" + top_module->m_name + "' contains a cyclic instantiation");
+        }
+        std::reverse(topological_order.begin(), topological_order.end());
+
+        // count how often each module is instantiated, a module is instantiated once for every instantiation of the modules containing it
+        std::unordered_map<const VerilogModule*, u64> instantiation_count;
+        instantiation_count[top_module] = 1;
+        for (const auto* module : topological_order)
+        {
+            const u64 count = instantiation_count.at(module);
+            for (const auto& instance : module->m_instances)
+            {
+                if (const auto it = m_modules_by_name.find(instance->m_type); it != m_modules_by_name.end())
+                {
+                    instantiation_count[it->second] += count;
+                }
+            }
+        }
 
         // preparations for alias: count the occurences of all names
-        std::queue<VerilogModule*> q;
-        q.push(top_module);
 
         // top entity instance will be named after its entity, so take into account for aliases
         m_instance_name_occurrences["top_module"]++;
@@ -1042,117 +1293,53 @@ namespace hal
             }
         }
 
-        while (!q.empty())
+        for (const auto* module : topological_order)
         {
-            VerilogModule* module = q.front();
-            q.pop();
-
-            instantiation_count[module->m_name]++;
+            const u32 count = (u32)std::min<u64>(instantiation_count.at(module), std::numeric_limits<u32>::max());
 
             for (const auto& signal : module->m_signals)
             {
                 for (const auto& expanded_name : signal->m_expanded_names)
                 {
-                    m_signal_name_occurrences[expanded_name]++;
+                    m_signal_name_occurrences[expanded_name] += count;
                 }
             }
 
             for (const auto& instance : module->m_instances)
             {
-                m_instance_name_occurrences[instance->m_name]++;
-
-                if (const auto it = m_modules_by_name.find(instance->m_type); it != m_modules_by_name.end())
-                {
-                    q.push(it->second);
-                }
+                m_instance_name_occurrences[instance->m_name] += count;
             }
         }
 
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        // detect unused modules
+        for (const auto& [module_name, verilog_module] : m_modules_by_name)
         {
-            // detect unused modules
-            if (instantiation_count[module_name] == 0)
+            if (instantiation_count.find(verilog_module) == instantiation_count.end())
             {
                 log_warning("verilog_parser", "module '{}' has been defined in the netlist but is not instantiated.", module_name);
-                continue;
             }
+        }
 
-            // expand gate pin assignments
-            for (const auto& instance : verilog_module->m_instances)
+        // expand gate pin assignments once per module, all instances of a module share the result
+        std::vector<std::optional<std::string>> expansion_errors(topological_order.size());
+#pragma omp parallel for schedule(dynamic)
+        for (i64 i = 0; i < (i64)topological_order.size(); i++)
+        {
+            // exceptions must not escape the parallel region
+            try
             {
-                if (const auto gate_type_it = m_gate_types.find(instance->m_type); gate_type_it != m_gate_types.end())
-                {
-                    if (!instance->m_port_assignments.empty())
-                    {
-                        // all port assignments by name
-                        if (instance->m_port_assignments.front().m_port_name.has_value())
-                        {
-                            // cache pin groups
-                            std::unordered_map<std::string, std::vector<std::string>> pin_groups;
-                            for (const auto pin_group : gate_type_it->second->get_pin_groups())
-                            {
-                                for (const auto pin : pin_group->get_pins())
-                                {
-                                    pin_groups[pin_group->get_name()].push_back(pin->get_name());
-                                }
-                            }
-
-                            for (const auto& port_assignment : instance->m_port_assignments)
-                            {
-                                std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
-                                {
-                                    std::vector<std::string> left_port;
-
-                                    const auto& port_name = port_assignment.m_port_name.value();
-                                    if (const auto group_it = pin_groups.find(port_name); group_it != pin_groups.end())
-                                    {
-                                        left_port = group_it->second;
-                                    }
-                                    else
-                                    {
-                                        left_port.push_back(port_name);
-                                    }
-
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
-                                }
-                            }
-                        }
-                        // all port assignments by order
-                        else
-                        {
-                            // cache pins
-                            std::vector<std::string> pins = gate_type_it->second->get_pin_names();
-                            auto pin_it                   = pins.begin();
-
-                            for (const auto& port_assignment : instance->m_port_assignments)
-                            {
-                                std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
-                                {
-                                    std::vector<std::string> left_port;
-
-                                    for (u32 i = 0; i < right_port.size() && pin_it != pins.end(); i++)
-                                    {
-                                        left_port.push_back(*pin_it++);
-                                    }
-
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+                expand_gate_pin_assignments(topological_order[i]);
+            }
+            catch (const std::exception& e)
+            {
+                expansion_errors[i] = e.what();
+            }
+        }
+        for (u32 i = 0; i < topological_order.size(); i++)
+        {
+            if (expansion_errors.at(i).has_value())
+            {
+                return ERR("could not construct netlist: unable to expand gate pin assignments within module '" + topological_order.at(i)->m_name + "': " + expansion_errors.at(i).value());
             }
         }
 
@@ -1162,7 +1349,7 @@ namespace hal
         {
             for (const auto& expanded_port_identifier : port->m_expanded_identifiers)
             {
-                Net* global_port_net = m_netlist->create_net(expanded_port_identifier);
+                Net* global_port_net = m_netlist_builder->create_net(expanded_port_identifier);
                 if (global_port_net == nullptr)
                 {
                     return ERR("could not construct netlist: failed to create global I/O net '" + expanded_port_identifier + "'");
@@ -1244,7 +1431,7 @@ namespace hal
 
                         if (!master_net->is_a_source(src_gate, src_pin))
                         {
-                            if (!master_net->add_source(src_gate, src_pin))
+                            if (!m_netlist_builder->add_source(master_net, src_gate, src_pin))
                             {
                                 return ERR("could not construct netlist: failed to add source to net '" + master_net->get_name() + "' with ID " + std::to_string(master_net->get_id()));
                             }
@@ -1269,7 +1456,7 @@ namespace hal
 
                         if (!master_net->is_a_destination(dst_gate, dst_pin))
                         {
-                            if (!master_net->add_destination(dst_gate, dst_pin))
+                            if (!m_netlist_builder->add_destination(master_net, dst_gate, dst_pin))
                             {
                                 return ERR("could not construct netlist: failed to add destination to net '" + master_net->get_name() + "' with ID " + std::to_string(master_net->get_id()));
                             }
@@ -1323,14 +1510,14 @@ namespace hal
             {
                 GateType* gnd_type  = m_gnd_gate_types.begin()->second;
                 GatePin* output_pin = gnd_type->get_output_pins().front();
-                Gate* gnd           = m_netlist->create_gate(m_netlist->get_unique_gate_id(), gnd_type, "global_gnd");
+                Gate* gnd           = m_netlist_builder->create_gate(gnd_type, "global_gnd");
 
                 if (!m_netlist->mark_gnd_gate(gnd))
                 {
                     return ERR("failed to mark GND gate");
                 }
 
-                if (m_zero_net->add_source(gnd, output_pin) == nullptr)
+                if (m_netlist_builder->add_source(m_zero_net, gnd, output_pin) == nullptr)
                 {
                     return ERR("failed to add source to GND gate");
                 }
@@ -1348,14 +1535,14 @@ namespace hal
             {
                 GateType* vcc_type  = m_vcc_gate_types.begin()->second;
                 GatePin* output_pin = vcc_type->get_output_pins().front();
-                Gate* vcc           = m_netlist->create_gate(m_netlist->get_unique_gate_id(), vcc_type, "global_vcc");
+                Gate* vcc           = m_netlist_builder->create_gate(vcc_type, "global_vcc");
 
                 if (!m_netlist->mark_vcc_gate(vcc))
                 {
                     return ERR("failed to mark VCC gate");
                 }
 
-                if (m_one_net->add_source(vcc, output_pin) == nullptr)
+                if (m_netlist_builder->add_source(m_one_net, vcc, output_pin) == nullptr)
                 {
                     return ERR("failed to add source to VCC gate");
                 }
@@ -1366,10 +1553,10 @@ namespace hal
             }
         }
 
-        // update module nets, internal nets, input nets, and output nets
-        for (Module* module : m_netlist->get_modules())
+        // classify module nets, internal nets, input nets, and output nets
+        if (auto res = m_netlist_builder->commit(); res.is_error())
         {
-            module->update_nets();
+            return ERR_APPEND(res.get_error(), "could not construct netlist: failed to commit netlist builder");
         }
 
         // assign module pins
@@ -1423,6 +1610,113 @@ namespace hal
         return OK({});
     }
 
+    void VerilogParser::expand_gate_pin_assignments(VerilogModule* verilog_module) const
+    {
+        // cache pins and pin groups per gate type
+        std::unordered_map<const GateType*, std::unordered_map<std::string, GatePin*>> pins_by_name;
+        std::unordered_map<const GateType*, std::unordered_map<std::string, std::vector<GatePin*>>> pin_groups_by_name;
+
+        for (const auto& instance : verilog_module->m_instances)
+        {
+            const auto gate_type_it = m_gate_types.find(instance->m_type);
+            if (gate_type_it == m_gate_types.end())
+            {
+                continue;
+            }
+
+            GateType* gate_type   = gate_type_it->second;
+            instance->m_gate_type = gate_type;
+
+            if (instance->m_port_assignments.empty())
+            {
+                continue;
+            }
+
+            if (pins_by_name.find(gate_type) == pins_by_name.end())
+            {
+                auto& pins       = pins_by_name[gate_type];
+                auto& pin_groups = pin_groups_by_name[gate_type];
+                for (auto* pin : gate_type->get_pins())
+                {
+                    pins[pin->get_name()] = pin;
+                }
+                for (const auto* pin_group : gate_type->get_pin_groups())
+                {
+                    pin_groups[pin_group->get_name()] = pin_group->get_pins();
+                }
+            }
+            const auto& pins       = pins_by_name.at(gate_type);
+            const auto& pin_groups = pin_groups_by_name.at(gate_type);
+
+            // all port assignments by name
+            if (instance->m_port_assignments.front().m_port_name.has_value())
+            {
+                for (const auto& port_assignment : instance->m_port_assignments)
+                {
+                    std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                    if (!right_port.empty())
+                    {
+                        std::vector<std::pair<std::string, GatePin*>> left_port;
+
+                        const auto& port_name = port_assignment.m_port_name.value();
+                        if (const auto group_it = pin_groups.find(port_name); group_it != pin_groups.end())
+                        {
+                            for (auto* pin : group_it->second)
+                            {
+                                left_port.push_back(std::make_pair(pin->get_name(), pin));
+                            }
+                        }
+                        else if (const auto pin_it = pins.find(port_name); pin_it != pins.end())
+                        {
+                            left_port.push_back(std::make_pair(port_name, pin_it->second));
+                        }
+                        else
+                        {
+                            // invalid pins are reported during instantiation
+                            left_port.push_back(std::make_pair(port_name, nullptr));
+                        }
+
+                        u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+
+                        for (u32 i = 0; i < max_size; i++)
+                        {
+                            instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i).first, right_port.at(i)));
+                            instance->m_expanded_port_pins.push_back(left_port.at(i).second);
+                        }
+                    }
+                }
+            }
+            // all port assignments by order
+            else
+            {
+                std::vector<GatePin*> ordered_pins = gate_type->get_pins();
+                auto pin_it                        = ordered_pins.begin();
+
+                for (const auto& port_assignment : instance->m_port_assignments)
+                {
+                    std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                    if (!right_port.empty())
+                    {
+                        std::vector<GatePin*> left_port;
+
+                        for (u32 i = 0; i < right_port.size() && pin_it != ordered_pins.end(); i++)
+                        {
+                            left_port.push_back(*pin_it++);
+                        }
+
+                        u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+
+                        for (u32 i = 0; i < max_size; i++)
+                        {
+                            instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i)->get_name(), right_port.at(i)));
+                            instance->m_expanded_port_pins.push_back(left_port.at(i));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     Result<Module*> VerilogParser::instantiate_module(const std::string& instance_identifier,
                                                       VerilogModule* verilog_module,
                                                       Module* parent,
@@ -1444,7 +1738,7 @@ namespace hal
         }
         else
         {
-            module = m_netlist->create_module(instance_alias.at(instance_identifier), parent);
+            module = m_netlist_builder->create_module(instance_alias.at(instance_identifier), parent);
         }
 
         std::string instance_type = verilog_module->m_name;
@@ -1507,7 +1801,7 @@ namespace hal
                 signal_alias[expanded_name] = get_unique_alias(m_signal_name_occurrences, expanded_name);
 
                 // create new net for the signal
-                Net* signal_net = m_netlist->create_net(signal_alias.at(expanded_name));
+                Net* signal_net = m_netlist_builder->create_net(signal_alias.at(expanded_name));
                 if (signal_net == nullptr)
                 {
                     return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to create net '" + expanded_name + "'");
@@ -1627,12 +1921,12 @@ namespace hal
                 }
             }
             // otherwise it has to be an element from the gate library
-            else if (const auto gate_type_it = m_gate_types.find(instance->m_type); gate_type_it != m_gate_types.end())
+            else if (GateType* gate_type = instance->m_gate_type; gate_type != nullptr)
             {
                 // create the new gate
                 instance_alias[instance->m_name] = get_unique_alias(m_instance_name_occurrences, instance->m_name);
 
-                Gate* new_gate = m_netlist->create_gate(gate_type_it->second, instance_alias.at(instance->m_name));
+                Gate* new_gate = m_netlist_builder->create_gate(gate_type, instance_alias.at(instance->m_name));
                 if (new_gate == nullptr)
                 {
                     return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to create gate '" + instance->m_name + "'");
@@ -1640,7 +1934,7 @@ namespace hal
 
                 if (!module->is_top_module())
                 {
-                    module->assign_gate(new_gate);
+                    m_netlist_builder->assign_gates(module, {new_gate});
                 }
 
                 container = new_gate;
@@ -1657,16 +1951,11 @@ namespace hal
                                + "' as VCC gate");
                 }
 
-                // cache pin names
-                std::unordered_map<std::string, GatePin*> pin_names_map;
-                for (auto* pin : gate_type_it->second->get_pins())
-                {
-                    pin_names_map[pin->get_name()] = pin;
-                }
-
-                // expand pin assignments
-                for (const auto& [pin, assignment] : instance->m_expanded_port_assignments)
+                // expand pin assignments, the pins have been looked up once per module
+                for (u32 i = 0; i < instance->m_expanded_port_assignments.size(); i++)
                 {
+                    const auto& [pin, assignment] = instance->m_expanded_port_assignments.at(i);
+                    GatePin* gate_pin             = instance->m_expanded_port_pins.at(i);
                     std::string signal;
 
                     if (const auto parent_it = parent_module_assignments.find(assignment); parent_it != parent_module_assignments.end())
@@ -1709,9 +1998,9 @@ namespace hal
                         bool is_input  = false;
                         bool is_output = false;
 
-                        if (const auto it = pin_names_map.find(pin); it != pin_names_map.end())
+                        if (gate_pin != nullptr)
                         {
-                            PinDirection direction = it->second->get_direction();
+                            PinDirection direction = gate_pin->get_direction();
                             if (direction == PinDirection::input || direction == PinDirection::inout)
                             {
                                 is_input = true;
@@ -1729,13 +2018,13 @@ namespace hal
                                        + "' as it is not a pin of gate '" + new_gate->get_name() + "' of type '" + new_gate->get_type()->get_name() + "'");
                         }
 
-                        if (is_output && !current_net->add_source(new_gate, pin))
+                        if (is_output && !m_netlist_builder->add_source(current_net, new_gate, gate_pin))
                         {
                             return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + signal + "' as a source to gate '"
                                        + new_gate->get_name() + "' via pin '" + pin + "'");
                         }
 
-                        if (is_input && !current_net->add_destination(new_gate, pin))
+                        if (is_input && !m_netlist_builder->add_destination(current_net, new_gate, gate_pin))
                         {
                             return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + signal + "' as a destination to gate '"
                                        + new_gate->get_name() + "' via pin '" + pin + "'");
@@ -1844,17 +2133,17 @@ namespace hal
         return name + "__[" + std::to_string(name_occurrences[name]) + "]__";
     }
 
-    std::vector<u32> VerilogParser::parse_range(TokenStream<std::string>& stream) const
+    std::vector<u32> VerilogParser::parse_range(TokenStream<std::string_view>& stream) const
     {
         if (stream.remaining() == 1)
         {
-            return {(u32)std::stoi(stream.consume().string)};
+            return {(u32)std::stoi(std::string(stream.consume().string))};
         }
 
         // MSB to LSB
-        const int end = std::stoi(stream.consume().string);
+        const int end = std::stoi(std::string(stream.consume().string));
         stream.consume(":", true);
-        const int start = std::stoi(stream.consume().string);
+        const int start = std::stoi(std::string(stream.consume().string));
 
         const int direction = (start <= end) ? 1 : -1;
 
@@ -2022,10 +2311,10 @@ namespace hal
         return OK(result);
     }
 
-    Result<std::string> VerilogParser::get_hex_from_literal(const Token<std::string>& value_token) const
+    Result<std::string> VerilogParser::get_hex_from_literal(const Token<std::string_view>& value_token) const
     {
         const u32 line_number   = value_token.number;
-        const std::string value = utils::to_upper(utils::replace(value_token.string, std::string("_"), std::string("")));
+        const std::string value = utils::to_upper(utils::replace(std::string(value_token.string), std::string("_"), std::string("")));
 
         i32 len = -1;
         std::string prefix;
@@ -2117,16 +2406,16 @@ namespace hal
         return OK(ss.str());
     }
 
-    Result<std::pair<std::string, std::string>> VerilogParser::parse_parameter_value(const Token<std::string>& value_token) const
+    Result<std::pair<std::string, std::string>> VerilogParser::parse_parameter_value(const Token<std::string_view>& value_token) const
     {
         std::pair<std::string, std::string> value;
 
-        if (utils::is_integer(value_token.string))
+        if (utils::is_integer(std::string(value_token.string)))
         {
             value.first  = "integer";
             value.second = value_token.string;
         }
-        else if (utils::is_floating_point(value_token.string))
+        else if (utils::is_floating_point(std::string(value_token.string)))
         {
             value.first  = "floating_point";
             value.second = value_token.string;
@@ -2141,7 +2430,7 @@ namespace hal
             if (const auto res = get_hex_from_literal(value_token); res.is_error())
             {
                 return ERR_APPEND(res.get_error(),
-                                  "could not parse parameter value: failed to convert '" + value_token.string + "' to hexadecimal value (line " + std::to_string(value_token.number) + ")");
+                                  "could not parse parameter value: failed to convert '" + std::string(value_token.string) + "' to hexadecimal value (line " + std::to_string(value_token.number) + ")");
             }
             else
             {
@@ -2159,15 +2448,15 @@ namespace hal
         }
         else
         {
-            return ERR("could not parse parameter value: failed to identify data type of parameter '" + value_token.string + "' (line " + std::to_string(value_token.number) + ")");
+            return ERR("could not parse parameter value: failed to identify data type of parameter '" + std::string(value_token.string) + "' (line " + std::to_string(value_token.number) + ")");
         }
 
         return OK(value);
     }
 
-    Result<std::vector<VerilogParser::assignment_t>> VerilogParser::parse_assignment_expression(TokenStream<std::string>&& stream) const
+    Result<std::vector<VerilogParser::assignment_t>> VerilogParser::parse_assignment_expression(TokenStream<std::string_view>&& stream) const
     {
-        std::vector<TokenStream<std::string>> parts;
+        std::vector<TokenStream<std::string_view>> parts;
 
         if (stream.size() == 0)
         {
@@ -2178,7 +2467,7 @@ namespace hal
         {
             stream.consume("{", true);
 
-            TokenStream<std::string> assignment_list_str = stream.extract_until("}");
+            TokenStream<std::string_view> assignment_list_str = stream.extract_until("}");
             stream.consume("}", true);
 
             do
@@ -2196,15 +2485,15 @@ namespace hal
 
         for (auto it = parts.rbegin(); it != parts.rend(); it++)
         {
-            TokenStream<std::string>& part_stream = *it;
+            TokenStream<std::string_view>& part_stream = *it;
 
-            const Token<std::string> signal_name_token = part_stream.consume();
-            std::string signal_name                    = signal_name_token.string;
+            const Token<std::string_view> signal_name_token = part_stream.consume();
+            std::string signal_name                         = std::string(signal_name_token.string);
 
             // (3) NUMBER
             if (isdigit(signal_name[0]) || signal_name[0] == '\'')
             {
-                if (auto res = get_binary_vector(signal_name_token); res.is_error())
+                if (auto res = get_binary_vector(signal_name); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse assignment expression: unable to convert token to binary vector");
                 }
@@ -2224,7 +2513,7 @@ namespace hal
                     std::vector<std::vector<u32>> ranges;
                     do
                     {
-                        TokenStream<std::string> range_str = part_stream.extract_until("]");
+                        TokenStream<std::string_view> range_str = part_stream.extract_until("]");
                         ranges.emplace_back(parse_range(range_str));
                         part_stream.consume("]", true);
                     } while (part_stream.consume("[", false));
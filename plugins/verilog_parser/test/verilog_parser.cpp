@@ -2238,6 +2238,59 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing tokens that do not appear verbatim in the file, i.e., escaped identifiers containing escape characters, floating point numbers,
+     * and multi-character tokens split by whitespace, as well as files with Windows line endings.
+     *
+     * Functions: parse
+     */
+    TEST_F(VerilogParserTest, check_non_verbatim_tokens) {
+
+        TEST_START
+            {
+                std::string netlist_input("module top (\r\n"
+                                        "  global_in,\r\n"
+                                        "  \\global\\_out \r\n"
+                                        " ) ;\r\n"
+                                        "  input global_in ;\r\n"
+                                        "  output \\global\\_out ;\r\n"
+                                        "  wire \\net\\\\_0 ;\r\n"
+                                        "BUF # (\r\n"
+                                        "  .key_floating_point(1.25),\r\n"
+                                        "  .key_spaced_floating_point(3 . 75)\r\n"
+                                        ") \\gate\\_0 (\r\n"
+                                        "  .I (global_in ),\r\n"
+                                        "  .O (\\net\\\\_0 )\r\n"
+                                        " ) ;\r\n"
+                                        "BUF gate_1 (\r\n"
+                                        "  .I (\\net\\\\_0 ),\r\n"
+                                        "  .O (\\global\\_out )\r\n"
+                                        " ) ;\r\n"
+                                        "endmodule\r\n");
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+                VerilogParser verilog_parser;
+                auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                ASSERT_TRUE(nl_res.is_ok());
+                std::unique_ptr<Netlist> nl = nl_res.get();
+                ASSERT_NE(nl, nullptr);
+
+                ASSERT_EQ(nl->get_gates(test_utils::gate_filter("BUF", "gate_0")).size(), 1);
+                Gate* gate_0 = *nl->get_gates(test_utils::gate_filter("BUF", "gate_0")).begin();
+                EXPECT_EQ(gate_0->get_data("generic", "key_floating_point"), std::make_tuple("floating_point", "1.25"));
+                EXPECT_EQ(gate_0->get_data("generic", "key_spaced_floating_point"), std::make_tuple("floating_point", "3.75"));
+
+                ASSERT_NE(gate_0->get_fan_out_net("O"), nullptr);
+                EXPECT_EQ(gate_0->get_fan_out_net("O")->get_name(), "net_0");
+                ASSERT_EQ(nl->get_gates(test_utils::gate_filter("BUF", "gate_1")).size(), 1);
+                Gate* gate_1 = *nl->get_gates(test_utils::gate_filter("BUF", "gate_1")).begin();
+                ASSERT_NE(gate_1->get_fan_out_net("O"), nullptr);
+                EXPECT_EQ(gate_1->get_fan_out_net("O")->get_name(), "global_out");
+                EXPECT_TRUE(gate_1->get_fan_out_net("O")->is_global_output_net());
+            }
+        TEST_END
+    }
+
     /**
      * Testing the usage of attributes for gates nets and modules
      *
@@ -2568,6 +2621,29 @@ namespace hal {
                 auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
                 ASSERT_TRUE(nl_res.is_error());
             }
+            {
+                // The modules below the top module instantiate each other
+                NO_COUT_TEST_BLOCK;
+                std::string netlist_input("module mod_a ( a_in ) ;"
+                                        "  input a_in ;"
+                                        "mod_b inst_b ( .b_in (a_in ) ) ;"
+                                        "endmodule"
+                                        "\n"
+                                        "module mod_b ( b_in ) ;"
+                                        "  input b_in ;"
+                                        "mod_a inst_a ( .a_in (b_in ) ) ;"
+                                        "endmodule"
+                                        "\n"
+                                        "module top ( global_in ) ;"
+                                        "  input global_in ;"
+                                        "mod_a inst_top ( .a_in (global_in ) ) ;"
+                                        "endmodule");
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+                VerilogParser verilog_parser;
+                auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                ASSERT_TRUE(nl_res.is_error());
+            }
         /* non-used entity test commented out (entity erroneously considered as top module)
             {
                 // Create a non-used entity (should not create any problems...)
@@ -2633,11 +2709,10 @@ namespace hal {
                 auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
                 ASSERT_TRUE(nl_res.is_error());
             }
-            if(test_utils::known_issue_tests_active())
             {
-                    // Use non-numeric ranges (invalid) ISSUE: stoi Failure
-                    NO_COUT_TEST_BLOCK;
-                    std::string netlist_input("module top ("
+                // Use non-numeric ranges (invalid)
+                NO_COUT_TEST_BLOCK;
+                std::string netlist_input("module top ("
                              "  global_in,"
                              "  global_out"
                              " ) ;"
@@ -29,11 +29,14 @@
 #include "hal_core/netlist/gate_library/gate_type.h"
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist_builder.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/result.h"
 #include "hal_core/utilities/special_strings.h"
 #include "hal_core/utilities/token_stream.h"
 
+#include <deque>
 #include <optional>
 #include <sstream>
 #include <unordered_map>
@@ -69,6 +72,7 @@ namespace hal
 
     private:
         using ci_string           = core_strings::CaseInsensitiveString;
+        using ci_string_view      = core_strings::CaseInsensitiveStringView;
         using identifier_t        = ci_string;
         using ranged_identifier_t = std::pair<ci_string, std::vector<std::vector<u32>>>;
         using numeral_t           = std::vector<BooleanFunction::Value>;
@@ -172,11 +176,12 @@ namespace hal
 
         using attribute_buffer_t = std::map<AttributeTarget, std::map<ci_string, VhdlDataEntry>>;
 
-        std::stringstream m_fs;
+        MemoryMappedFile m_file;
         std::filesystem::path m_path;
 
         // temporary netlist
-        Netlist* m_netlist = nullptr;
+        Netlist* m_netlist                = nullptr;
+        NetlistBuilder* m_netlist_builder = nullptr;
 
         // all entities of the netlist
         std::vector<std::unique_ptr<VhdlEntity>> m_entities;
@@ -186,8 +191,9 @@ namespace hal
         // std::unordered_map<ci_string, VhdlEntity> m_entities;
         // ci_string m_last_entity;
 
-        // token stream of entire input file
-        TokenStream<ci_string> m_token_stream;
+        // token stream of entire input file, tokens reference the mapped file or the token storage
+        TokenStream<ci_string_view> m_token_stream;
+        std::deque<ci_string> m_token_storage;
 
         // some caching
         std::unordered_map<ci_string, GateType*> m_gate_types;
@@ -234,13 +240,13 @@ namespace hal
 
         // helper functions
         ci_string get_unique_alias(std::unordered_map<ci_string, u32>& name_occurrences, const ci_string& name) const;
-        std::vector<u32> parse_range(TokenStream<ci_string>& range_stream) const;
-        Result<std::vector<std::vector<u32>>> parse_signal_ranges(TokenStream<ci_string>& signal_stream) const;
+        std::vector<u32> parse_range(TokenStream<ci_string_view>& range_stream) const;
+        Result<std::vector<std::vector<u32>>> parse_signal_ranges(TokenStream<ci_string_view>& signal_stream) const;
         void expand_ranges_recursively(std::vector<ci_string>& expanded_names, const ci_string& current_name, const std::vector<std::vector<u32>>& ranges, u32 dimension) const;
         std::vector<ci_string> expand_ranges(const ci_string& name, const std::vector<std::vector<u32>>& ranges) const;
         Result<std::vector<BooleanFunction::Value>> get_binary_vector(std::string value) const;
-        Result<std::string> get_hex_from_literal(const Token<ci_string>& value_token) const;
-        Result<std::vector<assignment_t>> parse_assignment_expression(TokenStream<ci_string>&& stream) const;
+        Result<std::string> get_hex_from_literal(const Token<ci_string_view>& value_token) const;
+        Result<std::vector<assignment_t>> parse_assignment_expression(TokenStream<ci_string_view>&& stream) const;
         Result<std::vector<ci_string>> expand_assignment_expression(VhdlEntity* vhdl_entity, const std::vector<assignment_t>& vars) const;
     };
 }    // namespace hal
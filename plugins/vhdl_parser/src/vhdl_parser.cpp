@@ -9,7 +9,9 @@
 #include "hal_core/utilities/utils.h"
 
 #include <fstream>
+#include <functional>
 #include <iomanip>
+#include <limits>
 #include <queue>
 
 namespace hal
@@ -26,15 +28,9 @@ namespace hal
         m_attribute_buffer.clear();
         m_attribute_types.clear();
 
+        if (auto res = m_file.open(file_path); res.is_error())
         {
-            std::ifstream ifs;
-            ifs.open(file_path.string(), std::ifstream::in);
-            if (!ifs.is_open())
-            {
-                return ERR("unable to open VHDL file '" + file_path.string() + "'");
-            }
-            m_fs << ifs.rdbuf();
-            ifs.close();
+            return ERR_APPEND(res.get_error(), "unable to open VHDL file '" + file_path.string() + "'");
         }
 
         // tokenize file
@@ -48,7 +44,7 @@ namespace hal
                 return ERR_APPEND(res.get_error(), "could not parse VHDL file '" + m_path.string() + "'");
             }
         }
-        catch (TokenStream<ci_string>::TokenStreamException& e)
+        catch (TokenStream<ci_string_view>::TokenStreamException& e)
         {
             if (e.line_number != (u32)-1)
             {
@@ -60,6 +56,11 @@ namespace hal
             }
         }
 
+        // release the tokens and the file, all parsed data has been copied into the intermediate format
+        m_token_stream = TokenStream<ci_string_view>();
+        m_token_storage.clear();
+        m_file.close();
+
         if (m_entities.empty())
         {
             return ERR("could not parse VHDL file '" + m_path.string() + "': it does not contain any entities");
@@ -331,6 +332,38 @@ namespace hal
         // construct the netlist with the the top module
         VhdlEntity* top_entity = m_entities_by_name.at(top_module_candidates.front());
 
+        // pre-allocate netlist storage based on the size of the flattened entity hierarchy
+        std::unordered_map<const VhdlEntity*, std::tuple<u64, u64, u64>> flattened_sizes;
+        std::function<std::tuple<u64, u64, u64>(const VhdlEntity*)> get_flattened_size = [this, &flattened_sizes, &get_flattened_size](const VhdlEntity* vhdl_entity) {
+            if (const auto it = flattened_sizes.find(vhdl_entity); it != flattened_sizes.end())
+            {
+                return it->second;
+            }
+
+            u64 num_gates = 0, num_nets = 0, num_modules = 1;
+            for (const auto& signal : vhdl_entity->m_signals)
+            {
+                num_nets += signal->m_expanded_names.size();
+            }
+            for (const auto& instance : vhdl_entity->m_instances)
+            {
+                if (const auto it = m_entities_by_name.find(instance->m_type); it != m_entities_by_name.end())
+                {
+                    const auto [sub_gates, sub_nets, sub_modules] = get_flattened_size(it->second);
+                    num_gates += sub_gates;
+                    num_nets += sub_nets;
+                    num_modules += sub_modules;
+                }
+                else
+                {
+                    num_gates++;
+                }
+            }
+            return flattened_sizes[vhdl_entity] = std::make_tuple(num_gates, num_nets, num_modules);
+        };
+        const auto [num_gates, num_nets, num_modules] = get_flattened_size(top_entity);
+        m_netlist->reserve(std::min<u64>(num_gates, std::numeric_limits<u32>::max()), std::min<u64>(num_nets, std::numeric_limits<u32>::max()), std::min<u64>(num_modules, std::numeric_limits<u32>::max()));
+
         if (const auto res = construct_netlist(top_entity); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not instantiate VHDL netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "'");
@@ -410,90 +443,165 @@ namespace hal
 
     void VHDLParser::tokenize()
     {
-        std::vector<Token<core_strings::CaseInsensitiveString>> parsed_tokens;
-        const std::string delimiters = ",(): ;=><&";
-        core_strings::CaseInsensitiveString current_token;
-        u32 line_number = 0;
+        m_token_storage.clear();
+
+        const std::string_view data       = m_file.get_data();
+        const std::string_view delimiters = ",(): ;=><&";
+        u32 line_number                   = 0;
+
+        // the current token usually is a contiguous range of the file, it is only copied if characters within the token are skipped (e.g., escape characters)
+        size_t token_begin = 0;
+        size_t token_end   = 0;
+        ci_string token_copy;
+        bool is_copied = false;
 
-        std::string line;
         bool in_string = false;
         bool escaped   = false;
 
-        while (std::getline(m_fs, line))
-        {
-            line_number++;
-            if (line.find("--") != std::string::npos)
+        std::vector<Token<ci_string_view>> parsed_tokens;
+
+        const auto append_to_token = [&](size_t pos) {
+            if (token_begin == token_end && !is_copied)
             {
-                line = line.substr(0, line.find("--"));
+                token_begin = pos;
+                token_end   = pos + 1;
             }
-            for (char c : utils::trim(line))
+            else if (!is_copied && token_end == pos)
             {
-                if (in_string == false && c == '\\')
-                {
-                    escaped = !escaped;
-                    continue;
-                }
-                else if (escaped && std::isspace(c))
-                {
-                    escaped = false;
-                    continue;
-                }
-                else if (!escaped && c == '"')
+                token_end++;
+            }
+            else
+            {
+                if (!is_copied)
                 {
-                    in_string = !in_string;
+                    token_copy.assign(data.data() + token_begin, token_end - token_begin);
+                    is_copied = true;
                 }
+                token_copy += data[pos];
+            }
+        };
 
-                if (delimiters.find(c) == std::string::npos || escaped || in_string)
-                {
-                    current_token += c;
-                }
-                else
+        const auto take_token = [&]() {
+            ci_string_view token;
+            if (is_copied)
+            {
+                token = m_token_storage.emplace_back(std::move(token_copy));
+                token_copy.clear();
+                is_copied = false;
+            }
+            else
+            {
+                token = ci_string_view(data.data() + token_begin, token_end - token_begin);
+            }
+            token_begin = token_end = 0;
+            return token;
+        };
+
+        const auto has_token = [&]() { return is_copied || token_begin != token_end; };
+
+        size_t line_begin = 0;
+        while (line_begin < data.size())
+        {
+            size_t line_end = data.find('\n', line_begin);
+            if (line_end == std::string_view::npos)
+            {
+                line_end = data.size();
+            }
+            const size_t next_line_begin = line_end + 1;
+
+            line_number++;
+            if (const size_t comment = data.substr(line_begin, line_end - line_begin).find("--"); comment != std::string_view::npos)
+            {
+                line_end = line_begin + comment;
+            }
+
+            // trim the line
+            const std::string_view line = data.substr(line_begin, line_end - line_begin);
+            const size_t first          = line.find_first_not_of(" \t\r\n");
+            const size_t last           = line.find_last_not_of(" \t\r\n");
+            if (first != std::string_view::npos)
+            {
+                for (size_t pos = line_begin + first; pos <= line_begin + last; pos++)
                 {
-                    if (!current_token.empty())
+                    const char c = data[pos];
+
+                    if (in_string == false && c == '\\')
                     {
-                        if (parsed_tokens.size() > 1 && utils::is_digits(parsed_tokens.at(parsed_tokens.size() - 2).string) && parsed_tokens.at(parsed_tokens.size() - 1) == "."
-                            && utils::is_digits(current_token))
-                        {
-                            parsed_tokens.pop_back();
-                            parsed_tokens.back() += "." + current_token;
-                        }
-                        else
-                        {
-                            parsed_tokens.emplace_back(line_number, current_token);
-                        }
-                        current_token.clear();
+                        escaped = !escaped;
+                        continue;
+                    }
+                    else if (escaped && std::isspace(c))
+                    {
+                        escaped = false;
+                        continue;
+                    }
+                    else if (!escaped && c == '"')
+                    {
+                        in_string = !in_string;
                     }
 
-                    if (!parsed_tokens.empty())
+                    if (delimiters.find(c) == std::string_view::npos || escaped || in_string)
+                    {
+                        append_to_token(pos);
+                    }
+                    else
                     {
-                        if (c == '=' && parsed_tokens.back() == "<")
+                        if (has_token())
                         {
-                            parsed_tokens.back() = "<=";
-                            continue;
+                            const ci_string_view current_token = take_token();
+                            if (parsed_tokens.size() > 1 && utils::is_digits(parsed_tokens.at(parsed_tokens.size() - 2).string) && parsed_tokens.at(parsed_tokens.size() - 1) == "."
+                                && utils::is_digits(current_token))
+                            {
+                                const ci_string_view dot = parsed_tokens.back().string;
+                                parsed_tokens.pop_back();
+                                const ci_string_view integer_part = parsed_tokens.back().string;
+                                if (integer_part.data() + integer_part.size() == dot.data() && dot.data() + dot.size() == current_token.data())
+                                {
+                                    parsed_tokens.back() = ci_string_view(integer_part.data(), integer_part.size() + dot.size() + current_token.size());
+                                }
+                                else
+                                {
+                                    parsed_tokens.back() = m_token_storage.emplace_back(ci_string(integer_part) + "." + ci_string(current_token));
+                                }
+                            }
+                            else
+                            {
+                                parsed_tokens.emplace_back(line_number, current_token);
+                            }
                         }
-                        else if (c == '=' && parsed_tokens.back() == ":")
+
+                        if (!parsed_tokens.empty())
                         {
-                            parsed_tokens.back() = ":=";
-                            continue;
+                            if (c == '=' && parsed_tokens.back() == "<")
+                            {
+                                parsed_tokens.back() = "<=";
+                                continue;
+                            }
+                            else if (c == '=' && parsed_tokens.back() == ":")
+                            {
+                                parsed_tokens.back() = ":=";
+                                continue;
+                            }
+                            else if (c == '>' && parsed_tokens.back() == "=")
+                            {
+                                parsed_tokens.back() = "=>";
+                                continue;
+                            }
                         }
-                        else if (c == '>' && parsed_tokens.back() == "=")
+
+                        if (!std::isspace(c))
                         {
-                            parsed_tokens.back() = "=>";
-                            continue;
+                            parsed_tokens.emplace_back(line_number, ci_string_view(data.data() + pos, 1));
                         }
                     }
-
-                    if (!std::isspace(c))
-                    {
-                        parsed_tokens.emplace_back(line_number, core_strings::CaseInsensitiveString(1, c));
-                    }
                 }
             }
-            if (!current_token.empty())
+            if (has_token())
             {
-                parsed_tokens.emplace_back(line_number, current_token);
-                current_token.clear();
+                parsed_tokens.emplace_back(line_number, take_token());
             }
+
+            line_begin = next_line_begin;
         }
         m_token_stream = TokenStream(parsed_tokens, {"("}, {")"});
     }
@@ -540,7 +648,7 @@ namespace hal
 
             // remove specific import like ".all" but keep the "."
             lib = utils::trim(lib.substr(0, lib.rfind(".") + 1));
-            m_libraries.insert(lib);
+            m_libraries.insert(ci_string(lib));
         }
         else
         {
@@ -553,7 +661,7 @@ namespace hal
     {
         m_token_stream.consume("entity", true);
         const u32 line_number       = m_token_stream.peek().number;
-        const ci_string entity_name = m_token_stream.consume().string;
+        const ci_string entity_name = ci_string(m_token_stream.consume().string);
 
         // verify entity name
         if (const auto it = m_entities_by_name.find(entity_name); it != m_entities_by_name.end())
@@ -570,7 +678,7 @@ namespace hal
 
         m_attribute_buffer.clear();
 
-        Token<ci_string> next_token = m_token_stream.peek();
+        Token<ci_string_view> next_token = m_token_stream.peek();
         while (next_token != "end")
         {
             if (next_token == "generic")
@@ -632,14 +740,14 @@ namespace hal
             // extract names
             do
             {
-                port_names.push_back(port_def_stream.consume().string);
+                port_names.push_back(ci_string(port_def_stream.consume().string));
             } while (port_def_stream.consume(",", false));
 
             port_def_stream.consume(":", true);
 
             // extract direction
             PinDirection direction;
-            const ci_string direction_str = port_def_stream.consume().string;
+            const ci_string direction_str = ci_string(port_def_stream.consume().string);
             if (direction_str == "in")
             {
                 direction = PinDirection::input;
@@ -659,7 +767,7 @@ namespace hal
             }
 
             // extract ranges
-            TokenStream<ci_string> port_stream = port_def_stream.extract_until(";");
+            TokenStream<ci_string_view> port_stream = port_def_stream.extract_until(";");
             std::vector<std::vector<u32>> ranges;
             if (auto res = parse_signal_ranges(port_stream); res.is_error())
             {
@@ -694,7 +802,7 @@ namespace hal
         const u32 line_number = m_token_stream.peek().number;
 
         m_token_stream.consume("attribute", true);
-        const ci_string attribute_name = m_token_stream.consume().string;
+        const ci_string attribute_name = ci_string(m_token_stream.consume().string);
 
         if (m_token_stream.peek() == ":")
         {
@@ -706,9 +814,9 @@ namespace hal
         {
             AttributeTarget target_class;
             m_token_stream.consume("of", true);
-            const ci_string attribute_target = m_token_stream.consume().string;
+            const ci_string attribute_target = ci_string(m_token_stream.consume().string);
             m_token_stream.consume(":", true);
-            const ci_string attribute_class = m_token_stream.consume().string;
+            const ci_string attribute_class = ci_string(m_token_stream.consume().string);
             m_token_stream.consume("is", true);
             ci_string attribute_value = m_token_stream.join_until(";", " ").string;
             m_token_stream.consume(";", true);
@@ -770,7 +878,7 @@ namespace hal
         u32 line_number              = m_token_stream.peek().number;
         const auto entity_name_token = m_token_stream.consume();
 
-        if (const auto it = m_entities_by_name.find(entity_name_token.string); it == m_entities_by_name.end())
+        if (const auto it = m_entities_by_name.find(ci_string(entity_name_token.string)); it == m_entities_by_name.end())
         {
             return ERR("could not parse architecture: architecture refers to non-existent entity '" + core_strings::to<std::string>(entity_name_token.string) + "' (line "
                        + std::to_string(entity_name_token.number) + ")");
@@ -814,7 +922,7 @@ namespace hal
             {
                 // components are ignored
                 m_token_stream.consume("component", true);
-                const ci_string component_name = m_token_stream.consume().string;
+                const ci_string component_name = ci_string(m_token_stream.consume().string);
                 m_token_stream.consume_until("end");
                 m_token_stream.consume("end", true);
                 m_token_stream.consume("component", true);
@@ -851,13 +959,13 @@ namespace hal
         std::vector<ci_string> signal_names;
         do
         {
-            signal_names.push_back(m_token_stream.consume().string);
+            signal_names.push_back(ci_string(m_token_stream.consume().string));
         } while (m_token_stream.consume(",", false));
 
         m_token_stream.consume(":", true);
 
         // extract bounds
-        TokenStream<ci_string> signal_stream = m_token_stream.extract_until(";");
+        TokenStream<ci_string_view> signal_stream = m_token_stream.extract_until(";");
         std::vector<std::vector<u32>> ranges;
         if (auto res = parse_signal_ranges(signal_stream); res.is_error())
         {
@@ -1036,16 +1144,16 @@ namespace hal
         m_token_stream.consume("port", true);
         m_token_stream.consume("map", true);
         m_token_stream.consume("(", true);
-        TokenStream<ci_string> port_stream = m_token_stream.extract_until(")");
+        TokenStream<ci_string_view> port_stream = m_token_stream.extract_until(")");
         m_token_stream.consume(")", true);
 
-        if (port_stream.find_next("=>") != TokenStream<ci_string>::END_OF_STREAM)
+        if (port_stream.find_next("=>") != TokenStream<ci_string_view>::END_OF_STREAM)
         {
             while (port_stream.remaining() > 0)
             {
-                TokenStream<ci_string> left_stream = port_stream.extract_until("=>");
+                TokenStream<ci_string_view> left_stream = port_stream.extract_until("=>");
                 port_stream.consume("=>", true);
-                TokenStream<ci_string> right_stream = port_stream.extract_until(",");
+                TokenStream<ci_string_view> right_stream = port_stream.extract_until(",");
                 port_stream.consume(",", port_stream.remaining() > 0);    // last entry has no comma
 
                 if (!right_stream.consume("open"))
@@ -1079,7 +1187,7 @@ namespace hal
         {
             while (port_stream.remaining() > 0)
             {
-                TokenStream<ci_string> right_stream = port_stream.extract_until(",");
+                TokenStream<ci_string_view> right_stream = port_stream.extract_until(",");
                 port_stream.consume(",", port_stream.remaining() > 0);    // last entry has no comma
 
                 if (!right_stream.consume("open"))
@@ -1113,7 +1221,7 @@ namespace hal
     {
         m_token_stream.consume("map", true);
         m_token_stream.consume("(", true);
-        TokenStream<ci_string> generic_stream = m_token_stream.extract_until(")");
+        TokenStream<ci_string_view> generic_stream = m_token_stream.extract_until(")");
         m_token_stream.consume(")", true);
 
         while (generic_stream.remaining() > 0)
@@ -1160,7 +1268,7 @@ namespace hal
             }
             else if (rhs.string.at(1) == '\"' && rhs.string.back() == '\"')
             {
-                if (auto res = get_hex_from_literal(rhs); res.is_error())
+                if (auto res = get_hex_from_literal({rhs.number, rhs.string}); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse generic assignment: unable to translate token to hexadecimal string");
                 }
@@ -1252,6 +1360,9 @@ namespace hal
         m_netlist->set_design_name(core_strings::to<std::string>(top_entity->m_name));
         m_netlist->enable_automatic_net_checks(false);
 
+        NetlistBuilder builder(m_netlist);
+        m_netlist_builder = &builder;
+
         std::unordered_map<ci_string, u32> instantiation_count;
 
         // preparations for alias: count the occurences of all names
@@ -1420,7 +1531,7 @@ namespace hal
         {
             for (const auto& expanded_port_identifier : port->m_expanded_identifiers)
             {
-                Net* global_port_net = m_netlist->create_net(core_strings::to<std::string>(expanded_port_identifier));
+                Net* global_port_net = m_netlist_builder->create_net(core_strings::to<std::string>(expanded_port_identifier));
                 if (global_port_net == nullptr)
                 {
                     return ERR("could not construct netlist: failed to create global I/O net '" + core_strings::to<std::string>(expanded_port_identifier) + "'");
@@ -1502,7 +1613,7 @@ namespace hal
 
                         if (!master_net->is_a_source(src_gate, src_pin))
                         {
-                            if (!master_net->add_source(src_gate, src_pin))
+                            if (!m_netlist_builder->add_source(master_net, src_gate, src_pin))
                             {
                                 return ERR("could not construct netlist: unable to add source to net '" + master_net->get_name() + "' with ID " + std::to_string(master_net->get_id()));
                             }
@@ -1527,7 +1638,7 @@ namespace hal
 
                         if (!master_net->is_a_destination(dst_gate, dst_pin))
                         {
-                            if (!master_net->add_destination(dst_gate, dst_pin))
+                            if (!m_netlist_builder->add_destination(master_net, dst_gate, dst_pin))
                             {
                                 return ERR("could not construct netlist: unable to add destination to net '" + master_net->get_name() + "' with ID " + std::to_string(master_net->get_id()));
                             }
@@ -1575,10 +1686,10 @@ namespace hal
             }
         }
 
-        // update module nets, internal nets, input nets, and output nets
-        for (Module* module : m_netlist->get_modules())
+        // classify module nets, internal nets, input nets, and output nets
+        if (auto res = m_netlist_builder->commit(); res.is_error())
         {
-            module->update_nets();
+            return ERR_APPEND(res.get_error(), "could not construct netlist: failed to commit netlist builder");
         }
 
         // assign module pins
@@ -1651,7 +1762,7 @@ namespace hal
         }
         else
         {
-            module = m_netlist->create_module(core_strings::to<std::string>(instance_alias.at(instance_identifier)), parent);
+            module = m_netlist_builder->create_module(core_strings::to<std::string>(instance_alias.at(instance_identifier)), parent);
         }
 
         ci_string instance_type = vhdl_entity->m_name;
@@ -1715,7 +1826,7 @@ namespace hal
                 signal_alias[expanded_name] = get_unique_alias(m_signal_name_occurrences, expanded_name);
 
                 // create new net for the signal
-                Net* signal_net = m_netlist->create_net(core_strings::to<std::string>(signal_alias.at(expanded_name)));
+                Net* signal_net = m_netlist_builder->create_net(core_strings::to<std::string>(signal_alias.at(expanded_name)));
                 if (signal_net == nullptr)
                 {
                     return ERR("could not create instance '" + core_strings::to<std::string>(instance_identifier) + "' of type '" + core_strings::to<std::string>(instance_type)
@@ -1842,7 +1953,7 @@ namespace hal
                 // create the new gate
                 instance_alias[instance->m_name] = get_unique_alias(m_instance_name_occurrences, instance->m_name);
 
-                Gate* new_gate = m_netlist->create_gate(gate_type_it->second, core_strings::to<std::string>(instance_alias.at(instance->m_name)));
+                Gate* new_gate = m_netlist_builder->create_gate(gate_type_it->second, core_strings::to<std::string>(instance_alias.at(instance->m_name)));
                 if (new_gate == nullptr)
                 {
                     return ERR("could not create instance '" + core_strings::to<std::string>(instance_identifier) + "' of type '" + core_strings::to<std::string>(instance_type)
@@ -1851,7 +1962,7 @@ namespace hal
 
                 if (!module->is_top_module())
                 {
-                    module->assign_gate(new_gate);
+                    m_netlist_builder->assign_gates(module, {new_gate});
                 }
 
                 container = new_gate;
@@ -1943,14 +2054,14 @@ namespace hal
                                        + new_gate->get_name() + "' of type '" + new_gate->get_type()->get_name() + "'");
                         }
 
-                        if (is_output && !current_net->add_source(new_gate, core_strings::to<std::string>(pin)))
+                        if (is_output && !m_netlist_builder->add_source(current_net, new_gate, core_strings::to<std::string>(pin)))
                         {
                             return ERR("could not create instance '" + core_strings::to<std::string>(instance_identifier) + "' of type '" + core_strings::to<std::string>(instance_type)
                                        + "': failed to add net '" + core_strings::to<std::string>(signal) + "' as a source to gate '" + new_gate->get_name() + "' via pin '"
                                        + core_strings::to<std::string>(pin) + "'");
                         }
 
-                        if (is_input && !current_net->add_destination(new_gate, core_strings::to<std::string>(pin)))
+                        if (is_input && !m_netlist_builder->add_destination(current_net, new_gate, core_strings::to<std::string>(pin)))
                         {
                             return ERR("could not create instance '" + core_strings::to<std::string>(instance_identifier) + "' of type '" + core_strings::to<std::string>(instance_type)
                                        + "': failed to add net '" + core_strings::to<std::string>(signal) + "' as a destination to gate '" + new_gate->get_name() + "' via pin '"
@@ -2062,7 +2173,7 @@ namespace hal
         return name + "__[" + core_strings::to<ci_string>(std::to_string(name_occurrences[name])) + "]__";
     }
 
-    std::vector<u32> VHDLParser::parse_range(TokenStream<ci_string>& range_stream) const
+    std::vector<u32> VHDLParser::parse_range(TokenStream<ci_string_view>& range_stream) const
     {
         if (range_stream.remaining() == 1)
         {
@@ -2092,32 +2203,32 @@ namespace hal
         return res;
     }
 
-    Result<std::vector<std::vector<u32>>> VHDLParser::parse_signal_ranges(TokenStream<ci_string>& signal_stream) const
+    Result<std::vector<std::vector<u32>>> VHDLParser::parse_signal_ranges(TokenStream<ci_string_view>& signal_stream) const
     {
         std::vector<std::vector<u32>> ranges;
         const u32 line_number = signal_stream.peek().number;
 
-        const Token<ci_string> type_name = signal_stream.consume();
+        const Token<ci_string_view> type_name = signal_stream.consume();
         if (type_name == "std_logic")
         {
             return OK(ranges);
         }
 
         signal_stream.consume("(", true);
-        TokenStream<ci_string> signal_bounds_stream = signal_stream.extract_until(")");
+        TokenStream<ci_string_view> signal_bounds_stream = signal_stream.extract_until(")");
 
         // process ranges
         do
         {
-            TokenStream<ci_string> bound_stream = signal_bounds_stream.extract_until(",");
+            TokenStream<ci_string_view> bound_stream = signal_bounds_stream.extract_until(",");
             ranges.emplace_back(parse_range(bound_stream));
         } while (signal_bounds_stream.consume(","));
 
         signal_stream.consume(")", true);
 
-        if (id_to_dim.find(type_name) != id_to_dim.end())
+        if (id_to_dim.find(ci_string(type_name.string)) != id_to_dim.end())
         {
-            const size_t dimension = id_to_dim.at(type_name);
+            const size_t dimension = id_to_dim.at(ci_string(type_name.string));
 
             if (ranges.size() != dimension)
             {
@@ -2261,10 +2372,10 @@ namespace hal
         return OK(result);
     }
 
-    Result<std::string> VHDLParser::get_hex_from_literal(const Token<ci_string>& value_token) const
+    Result<std::string> VHDLParser::get_hex_from_literal(const Token<ci_string_view>& value_token) const
     {
         const u32 line_number = value_token.number;
-        const ci_string value = utils::to_upper(utils::replace(value_token.string, ci_string("_"), ci_string("")));
+        const ci_string value = utils::to_upper(utils::replace(ci_string(value_token.string), ci_string("_"), ci_string("")));
 
         ci_string prefix;
         ci_string number;
@@ -2348,7 +2459,7 @@ namespace hal
         return OK(ss.str());
     }
 
-    Result<std::vector<VHDLParser::assignment_t>> VHDLParser::parse_assignment_expression(TokenStream<ci_string>&& stream) const
+    Result<std::vector<VHDLParser::assignment_t>> VHDLParser::parse_assignment_expression(TokenStream<ci_string_view>&& stream) const
     {
         // PARSE ASSIGNMENT
         //   assignment can currently be one of the following:
@@ -2358,7 +2469,7 @@ namespace hal
         //   (4) NAME(BEGIN_INDEX1 to/downto END_INDEX1, BEGIN_INDEX2 to/downto END_INDEX2, ...)
         //   (5) ((1 - 4), (1 - 4), ...)
 
-        std::vector<TokenStream<ci_string>> parts;
+        std::vector<TokenStream<ci_string_view>> parts;
 
         if (stream.size() == 0)
         {
@@ -2385,10 +2496,10 @@ namespace hal
 
         for (auto it = parts.rbegin(); it != parts.rend(); it++)
         {
-            TokenStream<ci_string>& part_stream = *it;
+            TokenStream<ci_string_view>& part_stream = *it;
 
-            const Token<ci_string> signal_name_token = part_stream.consume();
-            ci_string signal_name                    = signal_name_token.string;
+            const Token<ci_string_view> signal_name_token = part_stream.consume();
+            ci_string signal_name                         = ci_string(signal_name_token.string);
 
             // (2) NUMBER
             if (utils::starts_with(signal_name, core_strings::CaseInsensitiveString("\"")) || utils::starts_with(signal_name, core_strings::CaseInsensitiveString("b\""))
@@ -2429,7 +2540,7 @@ namespace hal
                     u32 closing_pos = part_stream.find_next(")");
                     do
                     {
-                        TokenStream<ci_string> range_stream = part_stream.extract_until(",", closing_pos);
+                        TokenStream<ci_string_view> range_stream = part_stream.extract_until(",", closing_pos);
                         ranges.emplace_back(parse_range(range_stream));
 
                     } while (part_stream.consume(",", false));
@@ -1,5 +1,6 @@
 #include "hal_core/netlist/boolean_function.h"
 
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
 #include "hal_core/netlist/boolean_function/parser.h"
 #include "hal_core/netlist/boolean_function/simplification.h"
 #include "hal_core/netlist/boolean_function/symbolic_execution.h"
@@ -1110,14 +1111,43 @@ namespace hal
             }
         }
 
-        // (2) initialize the symbolic state using the input variables
+        // (2) use the compiled bitsliced evaluation in case all variables are assigned
+        {
+            std::vector<std::string> variables;
+            std::vector<BooleanFunction::Value> flat_inputs;
+            bool all_assigned = true;
+            for (const auto& name : this->get_variable_names())
+            {
+                const auto it = inputs.find(name);
+                if (it == inputs.end())
+                {
+                    all_assigned = false;
+                    break;
+                }
+                variables.push_back(name);
+                flat_inputs.insert(flat_inputs.end(), it->second.begin(), it->second.end());
+            }
+
+            if (all_assigned)
+            {
+                if (auto compiled = CompiledBooleanFunction::compile(*this, variables); compiled.is_ok())
+                {
+                    if (auto value = compiled.get().evaluate(flat_inputs); value.is_ok())
+                    {
+                        return value;
+                    }
+                }
+            }
+        }
+
+        // (3) initialize the symbolic state using the input variables
         auto symbolic_execution = SMT::SymbolicExecution();
         for (const auto& [name, value] : inputs)
         {
             symbolic_execution.state.set(BooleanFunction::Var(name, value.size()), BooleanFunction::Const(value));
         }
 
-        // (3) analyze the evaluation result and check whether the result is a
+        // (4) analyze the evaluation result and check whether the result is a
         //     constant boolean function
         auto result = symbolic_execution.evaluate(*this);
         if (result.is_ok())
@@ -1173,9 +1203,19 @@ namespace hal
             return ERR("could not compute truth table for Boolean function '" + this->to_string() + "': unable to generate truth-table with more than 10 variables");
         }
 
+        // (5) evaluate all rows at once using the compiled bitsliced evaluation
+        //     if the function can be compiled over the given variables
+        if (auto compiled = CompiledBooleanFunction::compile(*this, variables); compiled.is_ok())
+        {
+            if (auto truth_table = compiled.get().compute_truth_table(); truth_table.is_ok())
+            {
+                return truth_table;
+            }
+        }
+
         std::vector<std::vector<Value>> truth_table(this->size(), std::vector<Value>(1 << variables.size(), Value::ZERO));
 
-        // (5) iterate the truth-table rows and set each column accordingly
+        // (6) otherwise, iterate the truth-table rows and set each column accordingly
         for (auto value = 0u; value < ((u32)1 << variables.size()); value++)
         {
             std::unordered_map<std::string, std::vector<Value>> input;
@@ -1332,12 +1372,43 @@ namespace hal
                     return {true, ~p[0]};
                 case BooleanFunction::NodeType::Xor:
                     return {true, p[0] ^ p[1]};
+
+                case BooleanFunction::NodeType::Add:
+                    return {true, p[0] + p[1]};
+                case BooleanFunction::NodeType::Sub:
+                    return {true, p[0] - p[1]};
+                case BooleanFunction::NodeType::Mul:
+                    return {true, p[0] * p[1]};
+                case BooleanFunction::NodeType::Sdiv:
+                    return {true, p[0] / p[1]};
+                case BooleanFunction::NodeType::Udiv:
+                    return {true, z3::udiv(p[0], p[1])};
+                case BooleanFunction::NodeType::Srem:
+                    return {true, z3::srem(p[0], p[1])};
+                case BooleanFunction::NodeType::Urem:
+                    return {true, z3::urem(p[0], p[1])};
+
                 case BooleanFunction::NodeType::Slice:
                     return {true, p[0].extract(p[2].get_numeral_uint(), p[1].get_numeral_uint())};
                 case BooleanFunction::NodeType::Concat:
                     return {true, z3::concat(p[0], p[1])};
+                case BooleanFunction::NodeType::Zext:
+                    return {true, z3::zext(p[0], node.size - p[0].get_sort().bv_size())};
                 case BooleanFunction::NodeType::Sext:
-                    return {true, z3::sext(p[0], p[1].get_numeral_uint())};
+                    return {true, z3::sext(p[0], node.size - p[0].get_sort().bv_size())};
+
+                case BooleanFunction::NodeType::Eq:
+                    return {true, z3::ite(p[0] == p[1], context.bv_val(1, node.size), context.bv_val(0, node.size))};
+                case BooleanFunction::NodeType::Sle:
+                    return {true, z3::ite(z3::sle(p[0], p[1]), context.bv_val(1, node.size), context.bv_val(0, node.size))};
+                case BooleanFunction::NodeType::Slt:
+                    return {true, z3::ite(z3::slt(p[0], p[1]), context.bv_val(1, node.size), context.bv_val(0, node.size))};
+                case BooleanFunction::NodeType::Ule:
+                    return {true, z3::ite(z3::ule(p[0], p[1]), context.bv_val(1, node.size), context.bv_val(0, node.size))};
+                case BooleanFunction::NodeType::Ult:
+                    return {true, z3::ite(z3::ult(p[0], p[1]), context.bv_val(1, node.size), context.bv_val(0, node.size))};
+                case BooleanFunction::NodeType::Ite:
+                    return {true, z3::ite(p[0] == context.bv_val(1, 1), p[1], p[2])};
 
                 default:
                     log_error("netlist", "Not implemented reached for nodetype {} in z3 conversion", node.type);
@@ -0,0 +1,315 @@
+#include "hal_core/netlist/boolean_function/and_inverter_graph.h"
+
+#include <optional>
+
+namespace hal
+{
+    AndInverterGraph::AndInverterGraph()
+    {
+        // node 0 represents the constant zero
+        m_nodes.emplace_back();
+    }
+
+    AndInverterGraph::Literal AndInverterGraph::negate(Literal literal)
+    {
+        return literal ^ 1;
+    }
+
+    bool AndInverterGraph::is_complemented(Literal literal)
+    {
+        return (literal & 1) != 0;
+    }
+
+    u32 AndInverterGraph::get_node_index(Literal literal)
+    {
+        return literal >> 1;
+    }
+
+    u32 AndInverterGraph::get_num_nodes() const
+    {
+        return m_nodes.size();
+    }
+
+    u32 AndInverterGraph::get_num_and_nodes() const
+    {
+        return m_num_and_nodes;
+    }
+
+    bool AndInverterGraph::is_input_node(u32 node_index) const
+    {
+        return m_input_positions.find(node_index) != m_input_positions.end();
+    }
+
+    bool AndInverterGraph::is_and_node(u32 node_index) const
+    {
+        return (node_index < m_nodes.size()) && (m_nodes[node_index].fan_in_0 != INVALID_LITERAL);
+    }
+
+    Result<std::pair<AndInverterGraph::Literal, AndInverterGraph::Literal>> AndInverterGraph::get_fan_in(u32 node_index) const
+    {
+        if (!is_and_node(node_index))
+        {
+            return ERR("could not get fan-in of node " + std::to_string(node_index) + ": node is not an AND node");
+        }
+        return OK({m_nodes[node_index].fan_in_0, m_nodes[node_index].fan_in_1});
+    }
+
+    AndInverterGraph::Literal AndInverterGraph::add_input(const std::string& name)
+    {
+        if (const auto it = m_inputs.find(name); it != m_inputs.end())
+        {
+            return it->second << 1;
+        }
+
+        const u32 node_index = m_nodes.size();
+        m_nodes.emplace_back();
+        m_inputs[name]                = node_index;
+        m_input_positions[node_index] = m_input_names.size();
+        m_input_names.push_back(name);
+
+        return node_index << 1;
+    }
+
+    Result<AndInverterGraph::Literal> AndInverterGraph::get_input(const std::string& name) const
+    {
+        if (const auto it = m_inputs.find(name); it != m_inputs.end())
+        {
+            return OK(it->second << 1);
+        }
+        return ERR("could not get input '" + name + "': no such input exists");
+    }
+
+    const std::vector<std::string>& AndInverterGraph::get_input_names() const
+    {
+        return m_input_names;
+    }
+
+    Result<std::string> AndInverterGraph::get_input_name(u32 node_index) const
+    {
+        if (const auto it = m_input_positions.find(node_index); it != m_input_positions.end())
+        {
+            return OK(m_input_names[it->second]);
+        }
+        return ERR("could not get input name of node " + std::to_string(node_index) + ": node is not an input node");
+    }
+
+    AndInverterGraph::Literal AndInverterGraph::add_and(Literal a, Literal b)
+    {
+        if (a > b)
+        {
+            std::swap(a, b);
+        }
+
+        // trivial cases
+        if (a == CONSTANT_ZERO)
+        {
+            return CONSTANT_ZERO;
+        }
+        if (a == CONSTANT_ONE || a == b)
+        {
+            return b;
+        }
+        if (a == negate(b))
+        {
+            return CONSTANT_ZERO;
+        }
+
+        const u64 key = (static_cast<u64>(a) << 32) | b;
+        if (const auto it = m_structural_hash.find(key); it != m_structural_hash.end())
+        {
+            return it->second << 1;
+        }
+
+        const u32 node_index = m_nodes.size();
+        m_nodes.push_back({a, b});
+        m_structural_hash[key] = node_index;
+        m_num_and_nodes++;
+
+        return node_index << 1;
+    }
+
+    AndInverterGraph::Literal AndInverterGraph::add_or(Literal a, Literal b)
+    {
+        return negate(add_and(negate(a), negate(b)));
+    }
+
+    AndInverterGraph::Literal AndInverterGraph::add_xor(Literal a, Literal b)
+    {
+        return add_or(add_and(a, negate(b)), add_and(negate(a), b));
+    }
+
+    AndInverterGraph::Literal AndInverterGraph::add_ite(Literal condition, Literal true_case, Literal false_case)
+    {
+        return add_or(add_and(condition, true_case), add_and(negate(condition), false_case));
+    }
+
+    Result<AndInverterGraph::Literal> AndInverterGraph::add_function(const BooleanFunction& function, const std::unordered_map<std::string, Literal>& variables)
+    {
+        if (function.is_empty())
+        {
+            return ERR("could not add Boolean function to and-inverter graph: function is empty");
+        }
+        if (function.size() != 1)
+        {
+            return ERR("could not add Boolean function '" + function.to_string() + "' to and-inverter graph: function has a size of " + std::to_string(function.size()) + " bits instead of 1 bit");
+        }
+
+        std::vector<Literal> stack;
+        for (const auto& node : function.get_nodes())
+        {
+            const auto arity = node.get_arity();
+            if (stack.size() < arity)
+            {
+                return ERR("could not add Boolean function '" + function.to_string() + "' to and-inverter graph: invalid number of operands");
+            }
+
+            const Literal* p = stack.data() + (stack.size() - arity);
+            Literal result   = CONSTANT_ZERO;
+
+            switch (node.type)
+            {
+                case BooleanFunction::NodeType::Constant:
+                    if (node.size != 1 || (node.constant.front() != BooleanFunction::Value::ZERO && node.constant.front() != BooleanFunction::Value::ONE))
+                    {
+                        return ERR("could not add Boolean function '" + function.to_string() + "' to and-inverter graph: only single-bit constants 0 and 1 are supported");
+                    }
+                    result = (node.constant.front() == BooleanFunction::Value::ONE) ? CONSTANT_ONE : CONSTANT_ZERO;
+                    break;
+                case BooleanFunction::NodeType::Variable:
+                    if (node.size != 1)
+                    {
+                        return ERR("could not add Boolean function '" + function.to_string() + "' to and-inverter graph: variable '" + node.variable + "' is not a single-bit variable");
+                    }
+                    if (const auto it = variables.find(node.variable); it != variables.end())
+                    {
+                        result = it->second;
+                    }
+                    else
+                    {
+                        result = add_input(node.variable);
+                    }
+                    break;
+                case BooleanFunction::NodeType::And:
+                    result = add_and(p[0], p[1]);
+                    break;
+                case BooleanFunction::NodeType::Or:
+                    result = add_or(p[0], p[1]);
+                    break;
+                case BooleanFunction::NodeType::Not:
+                    result = negate(p[0]);
+                    break;
+                case BooleanFunction::NodeType::Xor:
+                    result = add_xor(p[0], p[1]);
+                    break;
+                case BooleanFunction::NodeType::Eq:
+                    result = negate(add_xor(p[0], p[1]));
+                    break;
+                case BooleanFunction::NodeType::Ite:
+                    result = add_ite(p[0], p[1], p[2]);
+                    break;
+                default:
+                    return ERR("could not add Boolean function '" + function.to_string() + "' to and-inverter graph: node type " + std::to_string(node.type) + " is not supported");
+            }
+
+            stack.resize(stack.size() - arity);
+            stack.push_back(result);
+        }
+
+        if (stack.size() != 1)
+        {
+            return ERR("could not add Boolean function '" + function.to_string() + "' to and-inverter graph: number of elements remaining on the stack is not 1");
+        }
+
+        return OK(stack.back());
+    }
+
+    Result<std::monostate> AndInverterGraph::add_output(const std::string& name, Literal literal)
+    {
+        if (get_node_index(literal) >= m_nodes.size())
+        {
+            return ERR("could not add output '" + name + "': literal " + std::to_string(literal) + " does not belong to the graph");
+        }
+        if (m_output_positions.find(name) != m_output_positions.end())
+        {
+            return ERR("could not add output '" + name + "': an output with the same name already exists");
+        }
+
+        m_output_positions[name] = m_outputs.size();
+        m_outputs.emplace_back(name, literal);
+        return OK({});
+    }
+
+    Result<AndInverterGraph::Literal> AndInverterGraph::get_output(const std::string& name) const
+    {
+        if (const auto it = m_output_positions.find(name); it != m_output_positions.end())
+        {
+            return OK(m_outputs[it->second].second);
+        }
+        return ERR("could not get output '" + name + "': no such output exists");
+    }
+
+    const std::vector<std::pair<std::string, AndInverterGraph::Literal>>& AndInverterGraph::get_outputs() const
+    {
+        return m_outputs;
+    }
+
+    Result<BooleanFunction> AndInverterGraph::to_boolean_function(Literal literal) const
+    {
+        const u32 root = get_node_index(literal);
+        if (root >= m_nodes.size())
+        {
+            return ERR("could not convert literal " + std::to_string(literal) + " to Boolean function: literal does not belong to the graph");
+        }
+
+        // (1) mark the transitive fan-in of the root, the fan-in of a node always has a smaller index
+        std::vector<bool> required(root + 1, false);
+        required[root] = true;
+        for (u32 i = root; i > 0; i--)
+        {
+            if (required[i] && is_and_node(i))
+            {
+                required[get_node_index(m_nodes[i].fan_in_0)] = true;
+                required[get_node_index(m_nodes[i].fan_in_1)] = true;
+            }
+        }
+
+        // (2) convert the marked nodes in topological order
+        std::vector<std::optional<BooleanFunction>> functions(root + 1);
+        const auto get_literal_function = [&functions](Literal l) {
+            const auto& f = *functions[get_node_index(l)];
+            return is_complemented(l) ? ~f : f;
+        };
+
+        functions[0] = BooleanFunction::Const(0, 1);
+        for (u32 i = 1; i <= root; i++)
+        {
+            if (!required[i])
+            {
+                continue;
+            }
+
+            if (is_and_node(i))
+            {
+                functions[i] = get_literal_function(m_nodes[i].fan_in_0) & get_literal_function(m_nodes[i].fan_in_1);
+            }
+            else
+            {
+                functions[i] = BooleanFunction::Var(m_input_names[m_input_positions.at(i)], 1);
+            }
+        }
+
+        return OK(get_literal_function(literal));
+    }
+
+    Result<BooleanFunction> AndInverterGraph::to_boolean_function(const std::string& name) const
+    {
+        if (auto res = get_output(name); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not convert output '" + name + "' to Boolean function");
+        }
+        else
+        {
+            return to_boolean_function(res.get());
+        }
+    }
+}    // namespace hal
@@ -0,0 +1,571 @@
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
+
+#include <unordered_map>
+
+namespace hal
+{
+    namespace
+    {
+        /// Lane patterns of the six least significant input bits when enumerating a truth table.
+        constexpr u64 truth_table_patterns[6] = {
+            0xAAAAAAAAAAAAAAAAull,
+            0xCCCCCCCCCCCCCCCCull,
+            0xF0F0F0F0F0F0F0F0ull,
+            0xFF00FF00FF00FF00ull,
+            0xFFFF0000FFFF0000ull,
+            0xFFFFFFFF00000000ull,
+        };
+
+        /// An operand on the compile-time stack, i.e., the slots holding its bits (LSB first) or, for index nodes, the index value.
+        struct Operand
+        {
+            std::vector<u32> bits;
+            u16 index = 0;
+        };
+
+        BooleanFunction::Value to_value(bool value, bool unknown)
+        {
+            if (unknown)
+            {
+                return value ? BooleanFunction::Value::Z : BooleanFunction::Value::X;
+            }
+            return value ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
+        }
+    }    // namespace
+
+    Result<CompiledBooleanFunction> CompiledBooleanFunction::compile(const BooleanFunction& function, const std::vector<std::string>& variables)
+    {
+        if (function.is_empty())
+        {
+            return ERR("could not compile Boolean function: function is empty");
+        }
+
+        CompiledBooleanFunction compiled;
+
+        // (1) collect the sizes of the variables within the function
+        std::unordered_map<std::string, u16> variable_sizes;
+        for (const auto& node : function.get_nodes())
+        {
+            if (node.is_variable())
+            {
+                variable_sizes[node.variable] = node.size;
+            }
+        }
+
+        if (variables.empty())
+        {
+            const auto names = function.get_variable_names();
+            compiled.m_variables = std::vector<std::string>(names.begin(), names.end());
+        }
+        else
+        {
+            compiled.m_variables = variables;
+        }
+
+        // (2) assign input slots to the variables
+        std::unordered_map<std::string, u32> variable_slots;
+        u32 next_slot = slot_inputs;
+        for (const auto& variable : compiled.m_variables)
+        {
+            if (variable_slots.find(variable) != variable_slots.end())
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': variable '" + variable + "' is contained more than once in the list of input variables");
+            }
+
+            u16 size = 1;
+            if (const auto it = variable_sizes.find(variable); it != variable_sizes.end())
+            {
+                size = it->second;
+            }
+
+            variable_slots[variable] = next_slot;
+            compiled.m_variable_sizes.push_back(size);
+            next_slot += size;
+        }
+
+        for (const auto& [variable, size] : variable_sizes)
+        {
+            if (variable_slots.find(variable) == variable_slots.end())
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': variable '" + variable + "' is not contained in the list of input variables");
+            }
+        }
+
+        compiled.m_num_inputs = next_slot - slot_inputs;
+        compiled.m_num_slots  = next_slot;
+
+        // (3) translate the reverse polish notation of the function into bit-level instructions
+        std::vector<Operand> stack;
+        for (const auto& node : function.get_nodes())
+        {
+            const auto arity = node.get_arity();
+            if (stack.size() < arity)
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': stack is imbalanced");
+            }
+
+            std::vector<Operand> p(std::make_move_iterator(stack.end() - arity), std::make_move_iterator(stack.end()));
+            stack.erase(stack.end() - arity, stack.end());
+
+            Operand result;
+            switch (node.type)
+            {
+                case BooleanFunction::NodeType::Constant: {
+                    for (const auto value : node.constant)
+                    {
+                        switch (value)
+                        {
+                            case BooleanFunction::Value::ZERO:
+                                result.bits.push_back(slot_zero);
+                                break;
+                            case BooleanFunction::Value::ONE:
+                                result.bits.push_back(slot_one);
+                                break;
+                            case BooleanFunction::Value::Z:
+                                result.bits.push_back(slot_z);
+                                break;
+                            default:
+                                result.bits.push_back(slot_x);
+                                break;
+                        }
+                    }
+                    break;
+                }
+                case BooleanFunction::NodeType::Index: {
+                    result.index = node.index;
+                    break;
+                }
+                case BooleanFunction::NodeType::Variable: {
+                    const u32 first = variable_slots.at(node.variable);
+                    for (u32 i = 0; i < node.size; i++)
+                    {
+                        result.bits.push_back(first + i);
+                    }
+                    break;
+                }
+                case BooleanFunction::NodeType::Not: {
+                    for (const auto bit : p[0].bits)
+                    {
+                        result.bits.push_back(compiled.emit(OpCode::Not, bit));
+                    }
+                    break;
+                }
+                case BooleanFunction::NodeType::And:
+                case BooleanFunction::NodeType::Or:
+                case BooleanFunction::NodeType::Xor: {
+                    const OpCode op = (node.type == BooleanFunction::NodeType::And) ? OpCode::And : ((node.type == BooleanFunction::NodeType::Or) ? OpCode::Or : OpCode::Xor);
+                    for (u32 i = 0; i < p[0].bits.size(); i++)
+                    {
+                        result.bits.push_back(compiled.emit(op, p[0].bits[i], p[1].bits[i]));
+                    }
+                    break;
+                }
+                case BooleanFunction::NodeType::Add: {
+                    const u32 unknown = compiled.emit(OpCode::Or, compiled.emit_any_unknown(p[0].bits), compiled.emit_any_unknown(p[1].bits));
+                    result.bits       = compiled.emit_force_x(compiled.emit_add(p[0].bits, p[1].bits, slot_zero), unknown);
+                    break;
+                }
+                case BooleanFunction::NodeType::Sub: {
+                    const u32 unknown = compiled.emit(OpCode::Or, compiled.emit_any_unknown(p[0].bits), compiled.emit_any_unknown(p[1].bits));
+                    std::vector<u32> inverted;
+                    for (const auto bit : p[1].bits)
+                    {
+                        inverted.push_back(compiled.emit(OpCode::Not, bit));
+                    }
+                    result.bits = compiled.emit_force_x(compiled.emit_add(p[0].bits, inverted, slot_one), unknown);
+                    break;
+                }
+                case BooleanFunction::NodeType::Mul: {
+                    const u32 unknown = compiled.emit(OpCode::Or, compiled.emit_any_unknown(p[0].bits), compiled.emit_any_unknown(p[1].bits));
+                    const u32 size    = p[0].bits.size();
+                    std::vector<u32> product(size, slot_zero);
+                    for (u32 i = 0; i < size; i++)
+                    {
+                        u32 carry = slot_zero;
+                        for (u32 j = 0; j < size - i; j++)
+                        {
+                            const u32 partial = compiled.emit(OpCode::And, p[0].bits[i], p[1].bits[j]);
+                            const u32 half    = compiled.emit(OpCode::Xor, product[i + j], partial);
+                            const u32 sum     = compiled.emit(OpCode::Xor, half, carry);
+                            carry             = compiled.emit(OpCode::Or, compiled.emit(OpCode::And, product[i + j], partial), compiled.emit(OpCode::And, half, carry));
+                            product[i + j]    = sum;
+                        }
+                    }
+                    result.bits = compiled.emit_force_x(product, unknown);
+                    break;
+                }
+                case BooleanFunction::NodeType::Concat: {
+                    result.bits = p[1].bits;
+                    result.bits.insert(result.bits.end(), p[0].bits.begin(), p[0].bits.end());
+                    break;
+                }
+                case BooleanFunction::NodeType::Slice: {
+                    const u16 start = p[1].index;
+                    const u16 end   = p[2].index;
+                    if (start > end || end >= p[0].bits.size())
+                    {
+                        return ERR("could not compile Boolean function '" + function.to_string() + "': invalid slice indices");
+                    }
+                    result.bits = std::vector<u32>(p[0].bits.begin() + start, p[0].bits.begin() + end + 1);
+                    break;
+                }
+                case BooleanFunction::NodeType::Zext: {
+                    result.bits = p[0].bits;
+                    result.bits.resize(node.size, slot_zero);
+                    break;
+                }
+                case BooleanFunction::NodeType::Sext: {
+                    result.bits = p[0].bits;
+                    result.bits.resize(node.size, p[0].bits.back());
+                    break;
+                }
+                case BooleanFunction::NodeType::Eq: {
+                    u32 equal = slot_one;
+                    for (u32 i = 0; i < p[0].bits.size(); i++)
+                    {
+                        equal = compiled.emit(OpCode::And, equal, compiled.emit(OpCode::Same, p[0].bits[i], p[1].bits[i]));
+                    }
+                    result.bits.push_back(equal);
+                    break;
+                }
+                case BooleanFunction::NodeType::Ule:
+                case BooleanFunction::NodeType::Ult:
+                case BooleanFunction::NodeType::Sle:
+                case BooleanFunction::NodeType::Slt: {
+                    const u32 unknown = compiled.emit(OpCode::Or, compiled.emit_any_unknown(p[0].bits), compiled.emit_any_unknown(p[1].bits));
+
+                    // signed comparisons are reduced to unsigned ones by flipping the sign bits
+                    auto lhs = p[0].bits;
+                    auto rhs = p[1].bits;
+                    if (node.type == BooleanFunction::NodeType::Sle || node.type == BooleanFunction::NodeType::Slt)
+                    {
+                        lhs.back() = compiled.emit(OpCode::Not, lhs.back());
+                        rhs.back() = compiled.emit(OpCode::Not, rhs.back());
+                    }
+
+                    u32 comparison;
+                    if (node.type == BooleanFunction::NodeType::Ule || node.type == BooleanFunction::NodeType::Sle)
+                    {
+                        // p0 <= p1  <=>  p1 >= p0
+                        comparison = compiled.emit_unsigned_greater_equal(rhs, lhs);
+                    }
+                    else
+                    {
+                        // p0 < p1  <=>  !(p0 >= p1)
+                        comparison = compiled.emit(OpCode::Not, compiled.emit_unsigned_greater_equal(lhs, rhs));
+                    }
+                    result.bits = compiled.emit_force_x({comparison}, unknown);
+                    break;
+                }
+                case BooleanFunction::NodeType::Ite: {
+                    const u32 condition = p[0].bits.front();
+                    for (u32 i = 0; i < p[1].bits.size(); i++)
+                    {
+                        result.bits.push_back(compiled.emit(OpCode::Mux, condition, p[1].bits[i], p[2].bits[i]));
+                    }
+                    break;
+                }
+                default:
+                    return ERR("could not compile Boolean function '" + function.to_string() + "': node type '" + node.to_string() + "' is not supported");
+            }
+
+            stack.push_back(std::move(result));
+        }
+
+        if (stack.size() != 1)
+        {
+            return ERR("could not compile Boolean function '" + function.to_string() + "': stack is imbalanced");
+        }
+
+        compiled.m_outputs = std::move(stack.back().bits);
+        return OK(compiled);
+    }
+
+    const std::vector<std::string>& CompiledBooleanFunction::get_variables() const
+    {
+        return m_variables;
+    }
+
+    const std::vector<u16>& CompiledBooleanFunction::get_variable_sizes() const
+    {
+        return m_variable_sizes;
+    }
+
+    u32 CompiledBooleanFunction::get_num_inputs() const
+    {
+        return m_num_inputs;
+    }
+
+    u16 CompiledBooleanFunction::size() const
+    {
+        return m_outputs.size();
+    }
+
+    u32 CompiledBooleanFunction::get_num_instructions() const
+    {
+        return m_instructions.size();
+    }
+
+    Result<std::monostate> CompiledBooleanFunction::evaluate(const std::vector<u64>& values,
+                                                             const std::vector<u64>& unknowns,
+                                                             std::vector<u64>& output_values,
+                                                             std::vector<u64>& output_unknowns,
+                                                             u32 num_words) const
+    {
+        if (num_words == 0)
+        {
+            return ERR("could not evaluate compiled Boolean function: number of lane words must be at least 1");
+        }
+        if (values.size() != (size_t)m_num_inputs * num_words || (!unknowns.empty() && unknowns.size() != values.size()))
+        {
+            return ERR("could not evaluate compiled Boolean function: expected " + std::to_string(m_num_inputs * num_words) + " lane words per plane but got " + std::to_string(values.size()));
+        }
+
+        // registers are laid out as [slot][plane][word] and reused across calls of the same thread
+        thread_local std::vector<u64> registers;
+        registers.resize((size_t)m_num_slots * 2 * num_words);
+
+        const auto load = [num_words](u32 slot, u64 value, u64 unknown) {
+            std::fill_n(registers.begin() + (size_t)slot * 2 * num_words, num_words, value);
+            std::fill_n(registers.begin() + ((size_t)slot * 2 + 1) * num_words, num_words, unknown);
+        };
+        load(slot_zero, 0, 0);
+        load(slot_one, ~0ull, 0);
+        load(slot_x, 0, ~0ull);
+        load(slot_z, ~0ull, ~0ull);
+
+        for (u32 i = 0; i < m_num_inputs; i++)
+        {
+            u64* dst = registers.data() + (size_t)(slot_inputs + i) * 2 * num_words;
+            std::copy_n(values.begin() + (size_t)i * num_words, num_words, dst);
+            if (unknowns.empty())
+            {
+                std::fill_n(dst + num_words, num_words, 0);
+            }
+            else
+            {
+                std::copy_n(unknowns.begin() + (size_t)i * num_words, num_words, dst + num_words);
+            }
+        }
+
+        execute(registers, num_words);
+
+        output_values.resize(m_outputs.size() * num_words);
+        output_unknowns.resize(m_outputs.size() * num_words);
+        for (u32 o = 0; o < m_outputs.size(); o++)
+        {
+            const u64* src = registers.data() + (size_t)m_outputs[o] * 2 * num_words;
+            std::copy_n(src, num_words, output_values.begin() + (size_t)o * num_words);
+            std::copy_n(src + num_words, num_words, output_unknowns.begin() + (size_t)o * num_words);
+        }
+
+        return OK({});
+    }
+
+    Result<std::vector<BooleanFunction::Value>> CompiledBooleanFunction::evaluate(const std::vector<BooleanFunction::Value>& inputs) const
+    {
+        if (inputs.size() != m_num_inputs)
+        {
+            return ERR("could not evaluate compiled Boolean function: expected " + std::to_string(m_num_inputs) + " input bits but got " + std::to_string(inputs.size()));
+        }
+
+        std::vector<u64> values(m_num_inputs);
+        std::vector<u64> unknowns(m_num_inputs);
+        for (u32 i = 0; i < m_num_inputs; i++)
+        {
+            values[i]   = (inputs[i] == BooleanFunction::Value::ONE || inputs[i] == BooleanFunction::Value::Z) ? 1 : 0;
+            unknowns[i] = (inputs[i] == BooleanFunction::Value::X || inputs[i] == BooleanFunction::Value::Z) ? 1 : 0;
+        }
+
+        std::vector<u64> output_values;
+        std::vector<u64> output_unknowns;
+        if (auto res = evaluate(values, unknowns, output_values, output_unknowns, 1); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+
+        std::vector<BooleanFunction::Value> result;
+        result.reserve(m_outputs.size());
+        for (u32 o = 0; o < m_outputs.size(); o++)
+        {
+            result.push_back(to_value(output_values[o] & 1, output_unknowns[o] & 1));
+        }
+        return OK(result);
+    }
+
+    Result<std::vector<std::vector<BooleanFunction::Value>>> CompiledBooleanFunction::compute_truth_table() const
+    {
+        if (m_num_inputs > 31)
+        {
+            return ERR("could not compute truth table of compiled Boolean function: too many input bits (" + std::to_string(m_num_inputs) + ")");
+        }
+
+        const u64 num_rows  = (u64)1 << m_num_inputs;
+        const u32 num_words = (num_rows + 63) / 64;
+
+        std::vector<u64> values((size_t)m_num_inputs * num_words);
+        for (u32 i = 0; i < m_num_inputs; i++)
+        {
+            for (u32 w = 0; w < num_words; w++)
+            {
+                values[(size_t)i * num_words + w] = (i < 6) ? truth_table_patterns[i] : ((((u64)w >> (i - 6)) & 1) ? ~0ull : 0);
+            }
+        }
+
+        std::vector<u64> output_values;
+        std::vector<u64> output_unknowns;
+        if (auto res = evaluate(values, {}, output_values, output_unknowns, num_words); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+
+        std::vector<std::vector<BooleanFunction::Value>> truth_table(m_outputs.size(), std::vector<BooleanFunction::Value>(num_rows));
+        for (u32 o = 0; o < m_outputs.size(); o++)
+        {
+            for (u64 row = 0; row < num_rows; row++)
+            {
+                const size_t word   = (size_t)o * num_words + (row >> 6);
+                truth_table[o][row] = to_value((output_values[word] >> (row & 63)) & 1, (output_unknowns[word] >> (row & 63)) & 1);
+            }
+        }
+        return OK(truth_table);
+    }
+
+    u32 CompiledBooleanFunction::emit(OpCode op, u32 a, u32 b, u32 c)
+    {
+        const u32 dst = m_num_slots++;
+        m_instructions.push_back({op, dst, a, b, c});
+        return dst;
+    }
+
+    u32 CompiledBooleanFunction::emit_any_unknown(const std::vector<u32>& bits)
+    {
+        u32 unknown = slot_zero;
+        for (const auto bit : bits)
+        {
+            unknown = emit(OpCode::Or, unknown, emit(OpCode::Unknown, bit));
+        }
+        return unknown;
+    }
+
+    std::vector<u32> CompiledBooleanFunction::emit_force_x(const std::vector<u32>& bits, u32 mask)
+    {
+        std::vector<u32> result;
+        result.reserve(bits.size());
+        for (const auto bit : bits)
+        {
+            result.push_back(emit(OpCode::ForceX, bit, mask));
+        }
+        return result;
+    }
+
+    std::vector<u32> CompiledBooleanFunction::emit_add(const std::vector<u32>& p0, const std::vector<u32>& p1, u32 carry)
+    {
+        std::vector<u32> sum;
+        sum.reserve(p0.size());
+        for (u32 i = 0; i < p0.size(); i++)
+        {
+            const u32 half = emit(OpCode::Xor, p0[i], p1[i]);
+            sum.push_back(emit(OpCode::Xor, half, carry));
+            carry = emit(OpCode::Or, emit(OpCode::And, p0[i], p1[i]), emit(OpCode::And, half, carry));
+        }
+        return sum;
+    }
+
+    u32 CompiledBooleanFunction::emit_unsigned_greater_equal(const std::vector<u32>& p0, const std::vector<u32>& p1)
+    {
+        // p0 >= p1 iff computing p0 + ~p1 + 1 produces a carry
+        u32 carry = slot_one;
+        for (u32 i = 0; i < p0.size(); i++)
+        {
+            const u32 inverted = emit(OpCode::Not, p1[i]);
+            const u32 half     = emit(OpCode::Xor, p0[i], inverted);
+            carry              = emit(OpCode::Or, emit(OpCode::And, p0[i], inverted), emit(OpCode::And, half, carry));
+        }
+        return carry;
+    }
+
+    void CompiledBooleanFunction::execute(std::vector<u64>& registers, u32 num_words) const
+    {
+        u64* r = registers.data();
+        for (const auto& ins : m_instructions)
+        {
+            u64* dv       = r + (size_t)ins.dst * 2 * num_words;
+            u64* du       = dv + num_words;
+            const u64* av = r + (size_t)ins.a * 2 * num_words;
+            const u64* au = av + num_words;
+            const u64* bv = r + (size_t)ins.b * 2 * num_words;
+            const u64* bu = bv + num_words;
+            const u64* cv = r + (size_t)ins.c * 2 * num_words;
+            const u64* cu = cv + num_words;
+
+            switch (ins.op)
+            {
+                case OpCode::Not:
+                    // X and Z are preserved
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        dv[w] = av[w] ^ ~au[w];
+                        du[w] = au[w];
+                    }
+                    break;
+                case OpCode::And:
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        const u64 zero = (~av[w] & ~au[w]) | (~bv[w] & ~bu[w]);
+                        const u64 one  = (av[w] & ~au[w]) & (bv[w] & ~bu[w]);
+                        dv[w]          = one;
+                        du[w]          = ~(zero | one);
+                    }
+                    break;
+                case OpCode::Or:
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        const u64 zero = (~av[w] & ~au[w]) & (~bv[w] & ~bu[w]);
+                        const u64 one  = (av[w] & ~au[w]) | (bv[w] & ~bu[w]);
+                        dv[w]          = one;
+                        du[w]          = ~(zero | one);
+                    }
+                    break;
+                case OpCode::Xor:
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        const u64 unknown = au[w] | bu[w];
+                        dv[w]             = (av[w] ^ bv[w]) & ~unknown;
+                        du[w]             = unknown;
+                    }
+                    break;
+                case OpCode::Mux:
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        const u64 one  = av[w] & ~au[w];
+                        const u64 zero = ~av[w] & ~au[w];
+                        dv[w]          = (one & bv[w]) | (zero & cv[w]);
+                        du[w]          = (one & bu[w]) | (zero & cu[w]) | au[w];
+                    }
+                    break;
+                case OpCode::Same:
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        dv[w] = ~((av[w] ^ bv[w]) | (au[w] ^ bu[w]));
+                        du[w] = 0;
+                    }
+                    break;
+                case OpCode::Unknown:
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        dv[w] = au[w];
+                        du[w] = 0;
+                    }
+                    break;
+                case OpCode::ForceX:
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        dv[w] = av[w] & ~bv[w];
+                        du[w] = au[w] | bv[w];
+                    }
+                    break;
+            }
+        }
+    }
+}    // namespace hal
@@ -3,8 +3,10 @@
 #include <boost/fusion/include/at_c.hpp>
 #include <boost/fusion/sequence/intrinsic/at_c.hpp>
 #include <boost/spirit/home/x3.hpp>
+#include <functional>
 #include <mutex>
 #include <string.h>
+#include <unordered_set>
 
 extern "C" {
 ////////////////////////////////////////////////////////////////////////////
@@ -435,7 +437,7 @@ namespace hal
         ///
         /// # Developer Note
         /// `ContextABC` behaves as a singleton as this variable is (and should be)
-        /// just initialized once statically within the abc_simplfication function.
+        /// just initialized once statically within the abc_context function.
         /// Note that we opted for this solution, rather than a real singleton be-
         /// havior as we cannot easily cleanup the singleton within HAL.
         class ContextABC final
@@ -454,12 +456,29 @@ namespace hal
             }
         };
 
+        /// Serializes all accesses to the global ABC frame, as simplifications may be executed in parallel.
+        std::mutex abc_mutex;
+
+        /// Returns the global ABC context shared by all simplification entry points, initializing it on first use.
+        /// Must only be called while holding `abc_mutex`.
+        static ContextABC& abc_context()
+        {
+            static ContextABC context;
+            return context;
+        }
+
         /// Copied from "src/base/abc/abc.h", see above for link to ABC's repository
         Abc_Obj_t* Abc_ObjFanin(Abc_Obj_t* pObj, int i)
         {
             return (Abc_Obj_t*)pObj->pNtk->vObjs->pArray[pObj->vFanins.pArray[i]];
         }
 
+        /// Copied from "src/base/abc/abc.h", see above for link to ABC's repository
+        Abc_Obj_t* Abc_ObjNotCond(Abc_Obj_t* p, int c)
+        {
+            return (Abc_Obj_t*)((uintptr_t)(p) ^ (uintptr_t)(c != 0));
+        }
+
         /// Copied from "src/base/io/ioWriteVerilog.c", see above for link to ABC's repository
         char* Io_WriteVerilogGetName(char* pName)
         {
@@ -687,6 +706,70 @@ namespace hal
             return OK(network);
         }
 
+        /**
+         * Translates an `AndInverterGraph` to the ABC network representation.
+         * Since both representations are structurally hashed and-inverter graphs, every node is translated exactly once.
+         * The inputs and outputs are named 'input_<i>' and 'output_<i>' according to their position within the graph.
+         * 
+         * @param[in] graph - And-inverter graph to translate.
+         * @returns Ok() and ABC network on success, Err() otherwise.
+         */
+        Result<Abc_Ntk_t*> translate_to_abc(const AndInverterGraph& graph)
+        {
+            // (1) initialze a new ABC network with structured hashing
+            auto network = Abc_NtkAlloc(ABC_NTK_STRASH, ABC_FUNC_AIG, 1);
+
+            // (2) translate all nodes in topological order, node 0 is the constant zero
+            std::vector<Abc_Obj_t*> nodes(graph.get_num_nodes(), nullptr);
+            nodes[0] = Abc_ObjNotCond(Abc_AigConst1(network), 1);
+
+            const auto translate_literal = [&nodes](AndInverterGraph::Literal literal) {
+                return Abc_ObjNotCond(nodes[AndInverterGraph::get_node_index(literal)], AndInverterGraph::is_complemented(literal));
+            };
+
+            const auto& inputs = graph.get_input_names();
+            for (u32 i = 0; i < inputs.size(); i++)
+            {
+                const auto literal = graph.get_input(inputs[i]).get();
+                auto object        = Abc_NtkCreateObj(network, ABC_OBJ_PI);
+                auto name          = "input_" + std::to_string(i);
+                Abc_ObjAssignName(object, name.data(), NULL);
+
+                nodes[AndInverterGraph::get_node_index(literal)] = object;
+            }
+
+            for (u32 i = 1; i < graph.get_num_nodes(); i++)
+            {
+                if (graph.is_and_node(i))
+                {
+                    const auto [fan_in_0, fan_in_1] = graph.get_fan_in(i).get();
+                    nodes[i]                        = Abc_AigAnd((Abc_Aig_t*)network->pManFunc, translate_literal(fan_in_0), translate_literal(fan_in_1));
+                }
+            }
+
+            // (3) define the outputs of the network
+            const auto& outputs = graph.get_outputs();
+            for (u32 i = 0; i < outputs.size(); i++)
+            {
+                auto output = Abc_NtkCreateObj(network, ABC_OBJ_PO);
+                auto name   = "output_" + std::to_string(i);
+                Abc_ObjAssignName(output, name.data(), NULL);
+                Abc_ObjAddFanin(output, translate_literal(outputs[i].second));
+            }
+
+            // (4) internal ABC cleanup to remove any dangling object
+            Abc_AigCleanup((Abc_Aig_t*)network->pManFunc);
+
+            // (5) check whether the network construction is successful
+            if (!Abc_NtkCheck(network))
+            {
+                Abc_NtkDelete(network);
+                return ERR("could not translate and-inverter graph to ABC notation: AbcNtkCheck() failed");
+            }
+
+            return OK(network);
+        }
+
         /**
          * Performs the Boolean function simplification using ABC.
          * 
@@ -801,6 +884,66 @@ namespace hal
             return OK(ss.str());
         }
 
+        /**
+         * Translates an Verilog statement such as "assign new_n8_ = ~I1 & ~I3;"
+         * into the respective left-hand and right-hand side Boolean functions.
+         * 
+         * @param[in] assignment - Verilog assignment statement.
+         * @returns Left-hand and right-hand Boolean functions on success, error otherwise.
+         */
+        Result<std::tuple<BooleanFunction, BooleanFunction>> parse_assignment(const std::string& assignment)
+        {
+            Result<BooleanFunction> lhs = ERR(""), rhs = ERR("");
+
+            namespace x3 = boost::spirit::x3;
+
+            ////////////////////////////////////////////////////////////////////////
+            // Actions
+            ////////////////////////////////////////////////////////////////////////
+
+            const auto LHSAction = [&lhs](auto& ctx) { lhs = BooleanFunction::from_string(_attr(ctx)); };
+            const auto RHSAction = [&rhs](auto& ctx) { rhs = BooleanFunction::from_string(_attr(ctx)); };
+
+            ////////////////////////////////////////////////////////////////////////
+            // Rules
+            ////////////////////////////////////////////////////////////////////////
+
+            const auto EndOfLineRule = x3::lit(";") >> *x3::space;
+            const auto RHSRule       = x3::lexeme[*x3::char_("a-zA-Z0-9_+*~|&!'()[]\\ ")][RHSAction];
+            const auto EqualSignRule = *x3::space >> x3::lit("=") >> *x3::space;
+            const auto LHSRule       = x3::lexeme[*x3::char_("a-zA-Z0-9_")][LHSAction];
+            const auto AssignRule    = *x3::space >> x3::lit("assign") >> *x3::space;
+
+            // (1) parse the assignment to left-hand and right-hand side
+            auto iter     = assignment.begin();
+            const auto ok = x3::phrase_parse(iter,
+                                             assignment.end(),
+                                             ////////////////////////////////////////////////////////////////////
+                                             // Parsing Expression Grammar
+                                             ////////////////////////////////////////////////////////////////////
+                                             AssignRule >> LHSRule >> EqualSignRule >> RHSRule >> EndOfLineRule,
+                                             // we use an invalid a.k.a. non-printable ASCII character in order
+                                             // to prevent the skipping of space characters as they are defined
+                                             // as skipper within a Boolean function and operation
+                                             x3::char_(0x00));
+
+            if (!ok || (iter != assignment.end()))
+            {
+                return ERR("could not parse assignment from Verilog notation: '" + assignment + "' (remaining '" + std::string(iter, assignment.end()) + "')");
+            }
+
+            if (lhs.is_error())
+            {
+                return ERR_APPEND(lhs.get_error(), "cannot parse assignment from Verilog notation: unable to translate left side of assignment '" + assignment + "' into a Boolean function");
+            }
+            if (rhs.is_error())
+            {
+                return ERR_APPEND(rhs.get_error(), "cannot parse assignment from Verilog notation: unable to translate right side of assignment '" + assignment + "' into a Boolean function");
+            }
+
+            return OK({lhs.get(), rhs.get()});
+        }
+
         /** 
          * Translates a structured Verilog file to a Boolean function.
          * 
@@ -810,65 +953,6 @@ namespace hal
          */
         Result<BooleanFunction> translate_from_verilog(const std::string& verilog, const BooleanFunction& function)
         {
-            /**
-             * Translates an Verilog statement such as "assign new_n8_ = ~I1 & ~I3;"
-             * into the respective left-hand and right-hand side Boolean functions.
-             * 
-             * @param[in] assignment - Verilog assignment statement.
-             * @returns Left-hand and right-hand Boolean functions on success, error otherwise.
-             */
-            auto parse_assignment = [](const auto& assignment) -> Result<std::tuple<BooleanFunction, BooleanFunction>> {
-                Result<BooleanFunction> lhs = ERR(""), rhs = ERR("");
-
-                namespace x3 = boost::spirit::x3;
-
-                ////////////////////////////////////////////////////////////////////////
-                // Actions
-                ////////////////////////////////////////////////////////////////////////
-
-                const auto LHSAction = [&lhs](auto& ctx) { lhs = BooleanFunction::from_string(_attr(ctx)); };
-                const auto RHSAction = [&rhs](auto& ctx) { rhs = BooleanFunction::from_string(_attr(ctx)); };
-
-                ////////////////////////////////////////////////////////////////////////
-                // Rules
-                ////////////////////////////////////////////////////////////////////////
-
-                const auto EndOfLineRule = x3::lit(";") >> *x3::space;
-                const auto RHSRule       = x3::lexeme[*x3::char_("a-zA-Z0-9_+*~|&!'()[]\\ ")][RHSAction];
-                const auto EqualSignRule = *x3::space >> x3::lit("=") >> *x3::space;
-                const auto LHSRule       = x3::lexeme[*x3::char_("a-zA-Z0-9_")][LHSAction];
-                const auto AssignRule    = *x3::space >> x3::lit("assign") >> *x3::space;
-
-                // (1) parse the assignment to left-hand and right-hand side
-                auto iter     = assignment.begin();
-                const auto ok = x3::phrase_parse(iter,
-                                                 assignment.end(),
-                                                 ////////////////////////////////////////////////////////////////////
-                                                 // Parsing Expression Grammar
-                                                 ////////////////////////////////////////////////////////////////////
-                                                 AssignRule >> LHSRule >> EqualSignRule >> RHSRule >> EndOfLineRule,
-                                                 // we use an invalid a.k.a. non-printable ASCII character in order
-                                                 // to prevent the skipping of space characters as they are defined
-                                                 // as skipper within a Boolean function and operation
-                                                 x3::char_(0x00));
-
-                if (!ok || (iter != assignment.end()))
-                {
-                    return ERR("could not parse assignment from Verilog notation: '" + assignment + "' (remaining '" + std::string(iter, assignment.end()) + "')");
-                }
-
-                if (lhs.is_error())
-                {
-                    return ERR_APPEND(lhs.get_error(), "cannot parse assignment from Verilog notation: unable to translate left side of assignment '" + assignment + "' into a Boolean function");
-                }
-                if (rhs.is_error())
-                {
-                    return ERR_APPEND(rhs.get_error(), "cannot parse assignment from Verilog notation: unable to translate right side of assignment '" + assignment + "' into a Boolean function");
-                }
-
-                return OK({lhs.get(), rhs.get()});
-            };
-
             std::map<BooleanFunction, BooleanFunction> assignments;
 
             // (1) translate each Verilog assignment of the form "assign ... = ...;"
@@ -952,6 +1036,102 @@ namespace hal
             }
             return OK(state);
         }
+
+        /** 
+         * Translates a structured Verilog file to an and-inverter graph.
+         * Intermediate variables are resolved into shared nodes of the graph and are hence never expanded.
+         * 
+         * @param[in] verilog - Verilog data that represents a list of assignments
+         * @param[in] graph - Input and-inverter graph (not simplified).
+         * @returns Simplified and-inverter graph on success, error otherwise.
+         */
+        Result<AndInverterGraph> translate_from_verilog(const std::string& verilog, const AndInverterGraph& graph)
+        {
+            std::unordered_map<std::string, BooleanFunction> assignments;
+
+            // (1) translate each Verilog assignment of the form "assign ... = ...;"
+            std::istringstream data(verilog);
+            std::string line;
+            while (std::getline(data, line))
+            {
+                if (auto assignment = parse_assignment(line); assignment.is_ok())
+                {
+                    auto [lhs, rhs] = assignment.get();
+                    if (lhs.is_variable())
+                    {
+                        assignments[*lhs.get_variable_names().begin()] = rhs;
+                    }
+                }
+            }
+
+            // (2) add the original inputs in their original order
+            AndInverterGraph simplified;
+            std::unordered_map<std::string, AndInverterGraph::Literal> literals;
+
+            const auto& inputs = graph.get_input_names();
+            for (u32 i = 0; i < inputs.size(); i++)
+            {
+                literals["input_" + std::to_string(i)] = simplified.add_input(inputs[i]);
+            }
+
+            // (3) resolve each assignment into the graph exactly once
+            std::unordered_set<std::string> on_stack;
+            std::function<Result<AndInverterGraph::Literal>(const std::string&)> resolve = [&](const std::string& name) -> Result<AndInverterGraph::Literal> {
+                if (const auto it = literals.find(name); it != literals.end())
+                {
+                    return OK(it->second);
+                }
+
+                const auto it = assignments.find(name);
+                if (it == assignments.end())
+                {
+                    return ERR("could not parse assignment from Verilog notation: variable '" + name + "' is not defined in Verilog");
+                }
+                if (!on_stack.insert(name).second)
+                {
+                    return ERR("could not parse assignment from Verilog notation: variable '" + name + "' depends on itself");
+                }
+
+                std::unordered_map<std::string, AndInverterGraph::Literal> variables;
+                for (const auto& variable : it->second.get_variable_names())
+                {
+                    if (auto res = resolve(variable); res.is_error())
+                    {
+                        return res;
+                    }
+                    else
+                    {
+                        variables[variable] = res.get();
+                    }
+                }
+
+                auto res = simplified.add_function(it->second, variables);
+                if (res.is_ok())
+                {
+                    literals[name] = res.get();
+                }
+
+                on_stack.erase(name);
+                return res;
+            };
+
+            // (4) define the outputs using their original names
+            const auto& outputs = graph.get_outputs();
+            for (u32 i = 0; i < outputs.size(); i++)
+            {
+                auto res = resolve("output_" + std::to_string(i));
+                if (res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                if (auto output_res = simplified.add_output(outputs[i].first, res.get()); output_res.is_error())
+                {
+                    return ERR(output_res.get_error());
+                }
+            }
+
+            return OK(simplified);
+        }
     }    // namespace
 
     Result<BooleanFunction> Simplification::abc_simplification(const BooleanFunction& function)
@@ -967,7 +1147,6 @@ namespace hal
         // back the graph back into our Boolean function representation.
         //
         // [1] https://people.eecs.berkeley.edu/~alanmi/abc/
-        static ContextABC context;
 
         // (1) check whether the Boolean function can be simplified using ABC
         using NodeType = BooleanFunction::NodeType;
@@ -989,8 +1168,8 @@ namespace hal
         // (2) since the simplification and translations require access to the
         //     ABC global frame, we have to ensure an exclusive access in case
         //     Boolean function simplifications are executed in parallel
-        static std::mutex mutex;
-        mutex.lock();
+        std::unique_lock<std::mutex> lock(abc_mutex);
+        abc_context();
 
         auto status = translate_to_abc(function).map<std::monostate>([](const auto& network) { return simplify(network); });
 
@@ -1002,7 +1181,7 @@ namespace hal
         // (3) translate the ABC graph back into a Boolean function
         auto translated_function = translate_from_abc().map<BooleanFunction>([&function](const auto& verilog) { return translate_from_verilog(verilog, function); });
 
-        mutex.unlock();
+        lock.unlock();
 
         if (translated_function.is_ok())
         {
@@ -1013,4 +1192,31 @@ namespace hal
             return OK(function.clone());
         }
     }
+
+    Result<AndInverterGraph> Simplification::abc_simplification(const AndInverterGraph& graph)
+    {
+        // (1) graphs without inputs or outputs cannot be simplified any further
+        if (graph.get_input_names().empty() || graph.get_outputs().empty())
+        {
+            return OK(graph);
+        }
+
+        // (2) the translations require exclusive access to the ABC global frame
+        std::lock_guard<std::mutex> lock(abc_mutex);
+        abc_context();
+
+        auto status = translate_to_abc(graph).map<std::monostate>([](const auto& network) { return simplify(network); });
+        if (status.is_error())
+        {
+            return ERR_APPEND(status.get_error(), "could not simplify and-inverter graph using ABC: unable to translate & simplify and-inverter graph");
+        }
+
+        // (3) translate the ABC graph back into an and-inverter graph, keep the original graph if ABC produced output we cannot read back
+        if (auto translated_graph = translate_from_abc().map<AndInverterGraph>([&graph](const auto& verilog) { return translate_from_verilog(verilog, graph); }); translated_graph.is_ok())
+        {
+            return translated_graph;
+        }
+
+        return OK(graph);
+    }
 }    // namespace hal
@@ -0,0 +1,931 @@
+#include "hal_core/netlist/boolean_function/solver_session.h"
+
+#include "hal_core/netlist/boolean_function/translator.h"
+#include "hal_core/utilities/process.h"
+
+#include <cctype>
+#include <set>
+#include <thread>
+
+#ifndef _WIN32
+#include <csignal>
+#include <pthread.h>
+#endif
+
+namespace hal
+{
+    namespace SMT
+    {
+        namespace Z3
+        {
+            /// Checks whether a Z3 binary is available on the system (see solver.cpp).
+            Result<std::string> query_binary_path();
+        }    // namespace Z3
+
+        namespace Boolector
+        {
+            /// Checks whether a Boolector binary is available on the system (see solver.cpp).
+            Result<std::string> query_binary_path();
+        }    // namespace Boolector
+
+        namespace
+        {
+            /// prefix of the Boolean literals that guard assumptions
+            const std::string assumption_prefix = "hal_assumption_";
+
+            /**
+             * Collects all variables and their bit-sizes of a constraint.
+             *
+             * @param[in] constraint - The constraint.
+             * @param[inout] variables - The set of variable names and sizes to add to.
+             */
+            void collect_variables(const Constraint& constraint, std::set<std::pair<std::string, u16>>& variables)
+            {
+                const auto collect = [&variables](const BooleanFunction& function) {
+                    for (const auto& node : function.get_nodes())
+                    {
+                        if (node.is_variable())
+                        {
+                            variables.insert({node.variable, node.size});
+                        }
+                    }
+                };
+
+                if (constraint.is_assignment())
+                {
+                    collect(constraint.get_assignment().get()->first);
+                    collect(constraint.get_assignment().get()->second);
+                }
+                else
+                {
+                    collect(*constraint.get_function().get());
+                }
+            }
+
+            /**
+             * Removes the definitions of assumption literals from an SMT-LIB model, as they are no bit-vectors.
+             *
+             * @param[in] model_str - The SMT-LIB model.
+             * @returns The model without assumption literals.
+             */
+            std::string strip_assumption_literals(std::string model_str)
+            {
+                const std::string definition = "(define-fun " + assumption_prefix;
+                for (auto start = model_str.find(definition); start != std::string::npos; start = model_str.find(definition, start))
+                {
+                    i32 depth = 0;
+                    auto end  = start;
+                    for (; end < model_str.size(); end++)
+                    {
+                        if (model_str[end] == '(')
+                        {
+                            depth++;
+                        }
+                        else if (model_str[end] == ')' && --depth == 0)
+                        {
+                            break;
+                        }
+                    }
+                    model_str.erase(start, end - start + 1);
+                }
+                return model_str;
+            }
+        }    // namespace
+
+        /**
+         * Interface of the solver backends of a session.
+         */
+        class SolverSession::Backend
+        {
+        public:
+            virtual ~Backend() = default;
+
+            virtual bool is_usable() const                                                                         = 0;
+            virtual Result<std::monostate> push()                                                                  = 0;
+            virtual Result<std::monostate> pop(u32 num_scopes)                                                     = 0;
+            virtual Result<std::monostate> add_constraints(const std::vector<Constraint>& constraints)            = 0;
+            virtual Result<SolverResult> check(const std::vector<BooleanFunction>& assumptions)                   = 0;
+            virtual Result<std::vector<SolverResult>> check_batch(const std::vector<std::vector<Constraint>>& queries) = 0;
+        };
+
+        /**
+         * Backend communicating with a solver process via SMT-LIB v2 in interactive mode.
+         * Every command is acknowledged by the solver (`:print-success`), which keeps requests and responses in sync.
+         * Once a request fails after commands have been sent, responses might be left unread, hence the process is terminated and the backend becomes unusable.
+         */
+        class SolverSession::ProcessBackend final : public SolverSession::Backend
+        {
+        public:
+            ProcessBackend(const QueryConfig& config, std::unique_ptr<subprocess::Popen> process) : m_config(config), m_process(std::move(process))
+            {
+                m_declarations.emplace_back();
+            }
+
+            ~ProcessBackend() override
+            {
+                if (m_process)
+                {
+                    (void)send("(exit)\n");
+                    m_process->close_input();
+                    m_process->wait();
+                }
+            }
+
+            bool is_usable() const override
+            {
+                return m_process != nullptr;
+            }
+
+            Result<std::monostate> initialize()
+            {
+                std::string commands = "(set-option :print-success true)\n";
+                u32 num_commands     = 1;
+                if (m_config.generate_model)
+                {
+                    commands += "(set-option :produce-models true)\n";
+                    num_commands++;
+                }
+                commands += "(set-logic QF_ABV)\n";
+                num_commands++;
+
+                if (auto res = exchange(commands, num_commands); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not initialize solver process");
+                }
+                return OK({});
+            }
+
+            Result<std::monostate> push() override
+            {
+                if (auto res = check_usable(); res.is_error())
+                {
+                    return res;
+                }
+                m_declarations.emplace_back();
+                return exchange("(push 1)\n", 1);
+            }
+
+            Result<std::monostate> pop(u32 num_scopes) override
+            {
+                if (auto res = check_usable(); res.is_error())
+                {
+                    return res;
+                }
+                m_declarations.resize(m_declarations.size() - num_scopes);
+                return exchange("(pop " + std::to_string(num_scopes) + ")\n", 1);
+            }
+
+            Result<std::monostate> add_constraints(const std::vector<Constraint>& constraints) override
+            {
+                if (auto res = check_usable(); res.is_error())
+                {
+                    return res;
+                }
+                std::string commands;
+                u32 num_commands = 0;
+                if (auto res = translate(constraints, commands, num_commands); res.is_error())
+                {
+                    return res;
+                }
+                return exchange(commands, num_commands);
+            }
+
+            Result<SolverResult> check(const std::vector<BooleanFunction>& assumptions) override
+            {
+                if (auto res = check_usable(); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                std::string commands;
+                u32 num_commands = 0;
+
+                // assumptions are guarded by fresh Boolean literals, as check-sat-assuming only accepts literals
+                std::vector<Constraint> guards;
+                std::string literals;
+                for (const auto& assumption : assumptions)
+                {
+                    auto term = Translator::translate_to_smt2(assumption);
+                    if (term.is_error())
+                    {
+                        return ERR_APPEND(term.get_error(), "could not check satisfiability: unable to translate assumption '" + assumption.to_string() + "'");
+                    }
+                    guards.emplace_back(assumption.clone());
+
+                    const std::string literal = assumption_prefix + std::to_string(m_num_assumptions++);
+                    commands += "(declare-fun " + literal + " () Bool)\n";
+                    commands += "(assert (=> " + literal + " (= #b1 " + term.get() + ")))\n";
+                    num_commands += 2;
+                    literals += " " + literal;
+                }
+
+                // declare the variables of the assumptions first
+                std::string declarations;
+                if (auto res = declare(guards, declarations, num_commands); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                commands = declarations + commands;
+
+                commands += assumptions.empty() ? "(check-sat)\n" : "(check-sat-assuming (" + literals.substr(1) + "))\n";
+                if (auto res = exchange(commands, num_commands); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                auto result = read_result();
+                if (result.is_ok() && result.get().is_sat() && m_config.generate_model)
+                {
+                    if (auto res = send("(get-model)\n"); res.is_error())
+                    {
+                        result = ERR(res.get_error());
+                    }
+                    else
+                    {
+                        result = read_model();
+                    }
+                }
+                if (result.is_error())
+                {
+                    terminate();
+                }
+                return result;
+            }
+
+            Result<std::vector<SolverResult>> check_batch(const std::vector<std::vector<Constraint>>& queries) override
+            {
+                if (auto res = check_usable(); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+
+                // Boolector terminates on requesting a model for an unsatisfiable query, hence queries are not pipelined
+                const bool pipeline_models = m_config.generate_model && m_config.solver == SolverType::Z3;
+                if (m_config.generate_model && !pipeline_models)
+                {
+                    std::vector<SolverResult> results;
+                    for (const auto& query : queries)
+                    {
+                        if (auto res = push(); res.is_error())
+                        {
+                            return ERR(res.get_error());
+                        }
+                        if (auto res = add_constraints(query); res.is_error())
+                        {
+                            return ERR(res.get_error());
+                        }
+                        auto result = check({});
+                        if (result.is_error())
+                        {
+                            return ERR(result.get_error());
+                        }
+                        if (auto res = pop(1); res.is_error())
+                        {
+                            return ERR(res.get_error());
+                        }
+                        results.push_back(result.get());
+                    }
+                    return OK(results);
+                }
+
+                // share the declarations of all queries in the current scope
+                std::string commands;
+                u32 num_declarations = 0;
+                std::vector<Constraint> all_constraints;
+                for (const auto& query : queries)
+                {
+                    all_constraints.insert(all_constraints.end(), query.begin(), query.end());
+                }
+                if (auto res = declare(all_constraints, commands, num_declarations); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+
+                std::vector<u32> num_asserts;
+                for (const auto& query : queries)
+                {
+                    u32 num_commands = 0;
+                    commands += "(push 1)\n";
+                    if (auto res = translate(query, commands, num_commands); res.is_error())
+                    {
+                        return ERR(res.get_error());
+                    }
+                    commands += pipeline_models ? "(check-sat)\n(get-model)\n(pop 1)\n" : "(check-sat)\n(pop 1)\n";
+                    num_asserts.push_back(num_commands);
+                }
+
+                // write from a separate thread to prevent both processes from blocking on full pipes
+                bool sent = true;
+                std::thread writer([this, &commands, &sent]() {
+#ifndef _WIN32
+                    // writing to a terminated solver process has to fail instead of raising SIGPIPE for the whole process
+                    sigset_t signals;
+                    sigemptyset(&signals);
+                    sigaddset(&signals, SIGPIPE);
+                    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+#endif
+                    sent = send(commands).is_ok();
+                });
+
+                std::vector<SolverResult> results;
+                Result<std::monostate> status = expect_success(num_declarations);
+                for (u32 i = 0; i < queries.size() && status.is_ok(); i++)
+                {
+                    // (push 1) and all assertions
+                    if (status = expect_success(1 + num_asserts.at(i)); status.is_error())
+                    {
+                        break;
+                    }
+
+                    auto result = read_result();
+                    if (result.is_error())
+                    {
+                        status = ERR(result.get_error());
+                        break;
+                    }
+                    if (pipeline_models)
+                    {
+                        // the model request fails for unsatisfiable queries, the error response is skipped
+                        if (result.get().is_sat())
+                        {
+                            result = read_model();
+                        }
+                        else if (auto response = read_response(); response.is_error())
+                        {
+                            result = ERR(response.get_error());
+                        }
+
+                        if (result.is_error())
+                        {
+                            status = ERR(result.get_error());
+                            break;
+                        }
+                    }
+                    results.push_back(result.get());
+
+                    // (pop 1)
+                    status = expect_success(1);
+                }
+
+                // after a failure the responses to the remaining commands are not read, the solver process is killed
+                // to unblock the writer and terminated, as the pending responses would corrupt all later requests
+                if (status.is_error())
+                {
+                    m_process->kill();
+                }
+                writer.join();
+                if (!sent && status.is_ok())
+                {
+                    status = ERR("could not send commands to solver process");
+                }
+                if (status.is_error())
+                {
+                    terminate();
+                    return ERR_APPEND(status.get_error(), "could not check batch of " + std::to_string(queries.size()) + " queries");
+                }
+                return OK(results);
+            }
+
+        private:
+            QueryConfig m_config;
+            /// the solver process, reset once the process has been terminated after a failed request
+            std::unique_ptr<subprocess::Popen> m_process;
+            /// variables declared within each scope, index 0 is the base scope
+            std::vector<std::set<std::string>> m_declarations;
+            /// counter for unique assumption literals
+            u64 m_num_assumptions = 0;
+
+            Result<std::monostate> check_usable() const
+            {
+                if (!m_process)
+                {
+                    return ERR("solver process has been terminated after a failed request, the session has to be restarted");
+                }
+                return OK({});
+            }
+
+            /**
+             * Kills and reaps the solver process.
+             */
+            void terminate()
+            {
+                if (!m_process)
+                {
+                    return;
+                }
+                m_process->kill();
+                m_process->close_input();
+                m_process->close_output();
+                try
+                {
+                    m_process->wait();
+                }
+                catch (const std::exception&)
+                {
+                }
+                m_process.reset();
+            }
+
+            /**
+             * Sends commands that are each acknowledged by `success` and reads the acknowledgements.
+             * The solver process is terminated if the exchange fails.
+             */
+            Result<std::monostate> exchange(const std::string& commands, u32 num_commands)
+            {
+                auto res = send(commands);
+                if (res.is_ok())
+                {
+                    res = expect_success(num_commands);
+                }
+                if (res.is_error())
+                {
+                    terminate();
+                }
+                return res;
+            }
+
+            Result<std::monostate> send(const std::string& commands)
+            {
+                FILE* in = m_process->input();
+                if (in == nullptr || fwrite(commands.data(), 1, commands.size(), in) != commands.size() || fflush(in) != 0)
+                {
+                    return ERR("could not send commands to solver process");
+                }
+                return OK({});
+            }
+
+            /**
+             * Reads a single response, i.e., an atom terminated by a line break or a balanced s-expression.
+             */
+            Result<std::string> read_response()
+            {
+                FILE* out = m_process->output();
+                if (out == nullptr)
+                {
+                    return ERR("could not read response of solver process: no output channel");
+                }
+
+                std::string response;
+                i32 depth      = 0;
+                bool in_string = false;
+                for (int c = fgetc(out); c != EOF; c = fgetc(out))
+                {
+                    if (response.empty() && std::isspace(c))
+                    {
+                        continue;
+                    }
+                    if (depth == 0 && !in_string && c == '\n')
+                    {
+                        return OK(response);
+                    }
+
+                    response.push_back((char)c);
+                    if (in_string)
+                    {
+                        in_string = (c != '"');
+                    }
+                    else if (c == '"')
+                    {
+                        in_string = true;
+                    }
+                    else if (c == '(')
+                    {
+                        depth++;
+                    }
+                    else if (c == ')' && --depth == 0)
+                    {
+                        return OK(response);
+                    }
+                }
+                return ERR("could not read response of solver process: process terminated unexpectedly");
+            }
+
+            Result<std::monostate> expect_success(u32 num_responses)
+            {
+                for (u32 i = 0; i < num_responses; i++)
+                {
+                    auto response = read_response();
+                    if (response.is_error())
+                    {
+                        return ERR(response.get_error());
+                    }
+                    if (response.get() != "success")
+                    {
+                        return ERR("solver process responded with '" + response.get() + "'");
+                    }
+                }
+                return OK({});
+            }
+
+            Result<SolverResult> read_result()
+            {
+                auto response = read_response();
+                if (response.is_error())
+                {
+                    return ERR(response.get_error());
+                }
+
+                if (response.get() == "unsat")
+                {
+                    return OK(SolverResult::UnSat());
+                }
+                if (response.get() == "unknown")
+                {
+                    return OK(SolverResult::Unknown());
+                }
+                if (response.get() != "sat")
+                {
+                    return ERR("could not check satisfiability: solver process responded with '" + response.get() + "'");
+                }
+                return OK(SolverResult::Sat());
+            }
+
+            Result<SolverResult> read_model()
+            {
+                auto model_str = read_response();
+                if (model_str.is_error())
+                {
+                    return ERR(model_str.get_error());
+                }
+                if (auto model = Model::parse(strip_assumption_literals(model_str.get()), m_config.solver); model.is_error())
+                {
+                    return ERR_APPEND(model.get_error(), "could not check satisfiability: unable to parse model");
+                }
+                else
+                {
+                    return OK(SolverResult::Sat(model.get()));
+                }
+            }
+
+            /**
+             * Appends declarations for all variables of the constraints that are not yet declared in any open scope.
+             */
+            Result<std::monostate> declare(const std::vector<Constraint>& constraints, std::string& commands, u32& num_commands)
+            {
+                std::set<std::pair<std::string, u16>> variables;
+                for (const auto& constraint : constraints)
+                {
+                    collect_variables(constraint, variables);
+                }
+
+                for (const auto& [name, size] : variables)
+                {
+                    bool declared = false;
+                    for (const auto& scope : m_declarations)
+                    {
+                        declared |= scope.find(name) != scope.end();
+                    }
+                    if (!declared)
+                    {
+                        m_declarations.back().insert(name);
+                        commands += "(declare-fun " + name + " () (_ BitVec " + std::to_string(size) + "))\n";
+                        num_commands++;
+                    }
+                }
+                return OK({});
+            }
+
+            /**
+             * Appends declarations and assertions for the constraints.
+             */
+            Result<std::monostate> translate(const std::vector<Constraint>& constraints, std::string& commands, u32& num_commands)
+            {
+                if (auto res = declare(constraints, commands, num_commands); res.is_error())
+                {
+                    return res;
+                }
+
+                for (const auto& constraint : constraints)
+                {
+                    if (constraint.is_assignment())
+                    {
+                        const auto assignment = constraint.get_assignment().get();
+                        auto lhs              = Translator::translate_to_smt2(assignment->first);
+                        auto rhs              = Translator::translate_to_smt2(assignment->second);
+                        if (lhs.is_error())
+                        {
+                            return ERR_APPEND(lhs.get_error(), "could not translate constraint to SMT-LIB v2: '" + constraint.to_string() + "'");
+                        }
+                        if (rhs.is_error())
+                        {
+                            return ERR_APPEND(rhs.get_error(), "could not translate constraint to SMT-LIB v2: '" + constraint.to_string() + "'");
+                        }
+                        commands += "(assert (= " + lhs.get() + " " + rhs.get() + "))\n";
+                    }
+                    else
+                    {
+                        auto function = Translator::translate_to_smt2(*constraint.get_function().get());
+                        if (function.is_error())
+                        {
+                            return ERR_APPEND(function.get_error(), "could not translate constraint to SMT-LIB v2: '" + constraint.to_string() + "'");
+                        }
+                        commands += "(assert (= #b1 " + function.get() + "))\n";
+                    }
+                    num_commands++;
+                }
+                return OK({});
+            }
+        };
+
+        /**
+         * Backend using the Z3 library linked into HAL.
+         */
+        class SolverSession::Z3Backend final : public SolverSession::Backend
+        {
+        public:
+            Z3Backend(const QueryConfig& config) : m_config(config), m_solver(m_context)
+            {
+                z3::params parameters(m_context);
+                parameters.set("timeout", (unsigned)(config.timeout_in_seconds * 1000));
+                m_solver.set(parameters);
+            }
+
+            bool is_usable() const override
+            {
+                return true;
+            }
+
+            Result<std::monostate> push() override
+            {
+                m_solver.push();
+                return OK({});
+            }
+
+            Result<std::monostate> pop(u32 num_scopes) override
+            {
+                m_solver.pop(num_scopes);
+                return OK({});
+            }
+
+            Result<std::monostate> add_constraints(const std::vector<Constraint>& constraints) override
+            {
+                try
+                {
+                    for (const auto& constraint : constraints)
+                    {
+                        m_solver.add(to_z3(constraint));
+                    }
+                }
+                catch (const z3::exception& e)
+                {
+                    return ERR("could not add constraints to Z3 solver: " + std::string(e.msg()));
+                }
+                return OK({});
+            }
+
+            Result<SolverResult> check(const std::vector<BooleanFunction>& assumptions) override
+            {
+                try
+                {
+                    z3::expr_vector literals(m_context);
+                    for (const auto& assumption : assumptions)
+                    {
+                        const auto literal = m_context.bool_const((assumption_prefix + std::to_string(m_num_assumptions++)).c_str());
+                        m_solver.add(z3::implies(literal, assumption.to_z3(m_context) == m_context.bv_val(1, 1)));
+                        literals.push_back(literal);
+                    }
+
+                    return OK(to_result(m_solver.check(literals)));
+                }
+                catch (const z3::exception& e)
+                {
+                    return ERR("could not check satisfiability with Z3 solver: " + std::string(e.msg()));
+                }
+            }
+
+            Result<std::vector<SolverResult>> check_batch(const std::vector<std::vector<Constraint>>& queries) override
+            {
+                std::vector<SolverResult> results;
+                try
+                {
+                    for (const auto& query : queries)
+                    {
+                        m_solver.push();
+                        for (const auto& constraint : query)
+                        {
+                            m_solver.add(to_z3(constraint));
+                        }
+                        results.push_back(to_result(m_solver.check()));
+                        m_solver.pop();
+                    }
+                }
+                catch (const z3::exception& e)
+                {
+                    return ERR("could not check batch of " + std::to_string(queries.size()) + " queries with Z3 solver: " + std::string(e.msg()));
+                }
+                return OK(results);
+            }
+
+        private:
+            QueryConfig m_config;
+            z3::context m_context;
+            z3::solver m_solver;
+            /// counter for unique assumption literals
+            u64 m_num_assumptions = 0;
+
+            z3::expr to_z3(const Constraint& constraint)
+            {
+                if (constraint.is_assignment())
+                {
+                    const auto assignment = constraint.get_assignment().get();
+                    return assignment->first.to_z3(m_context) == assignment->second.to_z3(m_context);
+                }
+                return constraint.get_function().get()->to_z3(m_context) == m_context.bv_val(1, 1);
+            }
+
+            SolverResult to_result(z3::check_result result)
+            {
+                if (result == z3::unsat)
+                {
+                    return SolverResult::UnSat();
+                }
+                if (result == z3::unknown)
+                {
+                    return SolverResult::Unknown();
+                }
+                if (!m_config.generate_model)
+                {
+                    return SolverResult::Sat();
+                }
+
+                std::map<std::string, std::tuple<u64, u16>> model;
+                const z3::model z3_model = m_solver.get_model();
+                for (u32 i = 0; i < z3_model.num_consts(); i++)
+                {
+                    const z3::func_decl declaration = z3_model.get_const_decl(i);
+                    if (!declaration.range().is_bv())
+                    {
+                        continue;
+                    }
+                    const z3::expr value = z3_model.get_const_interp(declaration);
+                    model[declaration.name().str()] = {value.get_numeral_uint64(), declaration.range().bv_size()};
+                }
+                return SolverResult::Sat(Model(model));
+            }
+        };
+
+        SolverSession::SolverSession(const QueryConfig& config, std::unique_ptr<Backend> backend) : m_config(config), m_backend(std::move(backend))
+        {
+        }
+
+        SolverSession::~SolverSession() = default;
+
+        Result<std::unique_ptr<SolverSession>> SolverSession::start(const QueryConfig& config)
+        {
+            std::vector<std::string> arguments;
+            switch (config.solver)
+            {
+                case SolverType::Z3: {
+                    auto binary_path = Z3::query_binary_path();
+                    if (binary_path.is_error())
+                    {
+                        return ERR_APPEND(binary_path.get_error(), "could not start solver session: unable to locate Z3 binary");
+                    }
+                    // read commands from stdin, soft timeout per check in milliseconds
+                    arguments = {binary_path.get(), "-in", "-smt2", "-t:" + std::to_string(config.timeout_in_seconds * 1000)};
+                    break;
+                }
+                case SolverType::Boolector: {
+                    auto binary_path = Boolector::query_binary_path();
+                    if (binary_path.is_error())
+                    {
+                        return ERR_APPEND(binary_path.get_error(), "could not start solver session: unable to locate Boolector binary");
+                    }
+                    // Boolector only supports a time limit for the whole process, hence no timeout is applied
+                    arguments = {binary_path.get(), "--smt2", "--incremental", "--output-format=smt2", std::string("--model-gen=") + ((config.generate_model) ? "1" : "0")};
+                    break;
+                }
+                default:
+                    return ERR("could not start solver session: unsupported solver type");
+            }
+
+            std::unique_ptr<subprocess::Popen> process;
+            try
+            {
+                process = std::make_unique<subprocess::Popen>(arguments, subprocess::output{subprocess::PIPE}, subprocess::input{subprocess::PIPE});
+            }
+            catch (const std::exception& e)
+            {
+                return ERR("could not start solver session: " + std::string(e.what()));
+            }
+
+            auto backend = std::make_unique<ProcessBackend>(config, std::move(process));
+            if (auto res = backend->initialize(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not start solver session");
+            }
+            return OK(std::unique_ptr<SolverSession>(new SolverSession(config, std::move(backend))));
+        }
+
+        Result<std::unique_ptr<SolverSession>> SolverSession::start_in_process(const QueryConfig& config)
+        {
+            return OK(std::unique_ptr<SolverSession>(new SolverSession(config, std::make_unique<Z3Backend>(config))));
+        }
+
+        const QueryConfig& SolverSession::get_config() const
+        {
+            return m_config;
+        }
+
+        bool SolverSession::is_in_process() const
+        {
+            return dynamic_cast<const Z3Backend*>(m_backend.get()) != nullptr;
+        }
+
+        bool SolverSession::is_usable() const
+        {
+            return m_backend->is_usable();
+        }
+
+        Result<std::monostate> SolverSession::restart()
+        {
+            auto res = is_in_process() ? start_in_process(m_config) : start(m_config);
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not restart solver session");
+            }
+            auto session = res.get();
+            m_backend    = std::move(session->m_backend);
+            m_num_scopes = 0;
+            return OK({});
+        }
+
+        u32 SolverSession::get_num_scopes() const
+        {
+            return m_num_scopes;
+        }
+
+        Result<std::monostate> SolverSession::push()
+        {
+            if (auto res = m_backend->push(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not open new scope in solver session");
+            }
+            m_num_scopes++;
+            return OK({});
+        }
+
+        Result<std::monostate> SolverSession::pop(u32 num_scopes)
+        {
+            if (num_scopes > m_num_scopes)
+            {
+                return ERR("could not close " + std::to_string(num_scopes) + " scopes in solver session: only " + std::to_string(m_num_scopes) + " scopes are open");
+            }
+            if (num_scopes == 0)
+            {
+                return OK({});
+            }
+
+            if (auto res = m_backend->pop(num_scopes); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not close " + std::to_string(num_scopes) + " scopes in solver session");
+            }
+            m_num_scopes -= num_scopes;
+            return OK({});
+        }
+
+        Result<std::monostate> SolverSession::add_constraint(const Constraint& constraint)
+        {
+            return add_constraints({constraint});
+        }
+
+        Result<std::monostate> SolverSession::add_constraints(const std::vector<Constraint>& constraints)
+        {
+            if (auto res = m_backend->add_constraints(constraints); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not add constraints to solver session");
+            }
+            return OK({});
+        }
+
+        Result<SolverResult> SolverSession::check(const std::vector<BooleanFunction>& assumptions)
+        {
+            for (const auto& assumption : assumptions)
+            {
+                if (assumption.size() != 1)
+                {
+                    return ERR("could not check satisfiability in solver session: assumption '" + assumption.to_string() + "' is not of size 1");
+                }
+            }
+
+            if (auto res = m_backend->check(assumptions); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not check satisfiability in solver session");
+            }
+            else
+            {
+                return res;
+            }
+        }
+
+        Result<std::vector<SolverResult>> SolverSession::check_batch(const std::vector<std::vector<Constraint>>& queries)
+        {
+            if (auto res = m_backend->check_batch(queries); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not check batch in solver session");
+            }
+            else
+            {
+                return res;
+            }
+        }
+    }    // namespace SMT
+}    // namespace hal
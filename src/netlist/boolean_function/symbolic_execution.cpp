@@ -363,7 +363,7 @@ namespace hal
                 }
                 else
                 {
-                    return BooleanFunction::Const(std::vector<BooleanFunction::Value>(p0.size(), BooleanFunction::Value::X));
+                    return BooleanFunction::Const(std::vector<BooleanFunction::Value>(p1.size(), BooleanFunction::Value::X));
                 }
             }
 
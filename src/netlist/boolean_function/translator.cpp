@@ -151,6 +151,68 @@ namespace hal
                         return ERR("could not translate Boolean function to SMT-Lib v2 string: stack is imbalanced");
                 }
             }
+
+            Result<std::string> translate_to_smt2(const AndInverterGraph& graph)
+            {
+                const auto node_name = [&graph](u32 node_index) -> std::string {
+                    if (node_index == 0)
+                    {
+                        return "(_ bv0 1)";
+                    }
+                    if (graph.is_input_node(node_index))
+                    {
+                        return graph.get_input_name(node_index).get();
+                    }
+                    return "aig_node_" + std::to_string(node_index);
+                };
+                const auto literal_to_smt2 = [&node_name](AndInverterGraph::Literal literal) -> std::string {
+                    const auto name = node_name(AndInverterGraph::get_node_index(literal));
+                    return AndInverterGraph::is_complemented(literal) ? "(bvnot " + name + ")" : name;
+                };
+
+                // (1) only translate AND nodes that are part of the transitive fan-in of an output
+                std::vector<bool> required(graph.get_num_nodes(), false);
+                for (const auto& [name, literal] : graph.get_outputs())
+                {
+                    required[AndInverterGraph::get_node_index(literal)] = true;
+                }
+                for (u32 i = graph.get_num_nodes(); i-- > 1;)
+                {
+                    if (required[i] && graph.is_and_node(i))
+                    {
+                        const auto [fan_in_0, fan_in_1]                  = graph.get_fan_in(i).get();
+                        required[AndInverterGraph::get_node_index(fan_in_0)] = true;
+                        required[AndInverterGraph::get_node_index(fan_in_1)] = true;
+                    }
+                }
+
+                // (2) declare all inputs and define every shared AND node exactly once in topological order
+                std::stringstream ss;
+                for (const auto& input : graph.get_input_names())
+                {
+                    ss << "(declare-fun " << input << " () (_ BitVec 1))\n";
+                }
+                for (u32 i = 1; i < graph.get_num_nodes(); i++)
+                {
+                    if (required[i] && graph.is_and_node(i))
+                    {
+                        const auto [fan_in_0, fan_in_1] = graph.get_fan_in(i).get();
+                        ss << "(define-fun " << node_name(i) << " () (_ BitVec 1) (bvand " << literal_to_smt2(fan_in_0) << " " << literal_to_smt2(fan_in_1) << "))\n";
+                    }
+                }
+
+                // (3) define the outputs, except for outputs that are plain inputs of the same name
+                for (const auto& [name, literal] : graph.get_outputs())
+                {
+                    if (const auto input = graph.get_input(name); input.is_ok() && input.get() == literal)
+                    {
+                        continue;
+                    }
+                    ss << "(define-fun " << name << " () (_ BitVec 1) " << literal_to_smt2(literal) << ")\n";
+                }
+
+                return OK(ss.str());
+            }
         }    // namespace Translator
     }        // namespace SMT
 }    // namespace hal
@@ -2,11 +2,46 @@
 
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+
 namespace hal
 {
+    namespace
+    {
+        SymbolTable* get_default_symbol_table()
+        {
+            static SymbolTable symbol_table;
+            return &symbol_table;
+        }
+    }    // namespace
+
+    DataContainer::DataContainer(SymbolTable* symbol_table) : m_symbol_table((symbol_table != nullptr) ? symbol_table : get_default_symbol_table())
+    {
+    }
+
     bool DataContainer::operator==(const DataContainer& other) const
     {
-        return m_data == other.get_data_map();
+        if (m_data.size() != other.m_data.size())
+        {
+            return false;
+        }
+
+        if (m_symbol_table != other.m_symbol_table)
+        {
+            return get_data_map() == other.get_data_map();
+        }
+
+        for (const Entry& entry : m_data)
+        {
+            if (std::find_if(other.m_data.begin(), other.m_data.end(), [&entry](const Entry& e) {
+                    return e.category == entry.category && e.key == entry.key && e.type == entry.type && e.value == entry.value;
+                })
+                == other.m_data.end())
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     bool DataContainer::operator!=(const DataContainer& other) const
@@ -22,9 +57,20 @@ namespace hal
             return false;
         }
 
-        m_data[std::make_tuple(category, key)] = std::make_tuple(value_data_type, value);
-
-        //notify_updated();
+        const Entry entry = {m_symbol_table->intern(category), m_symbol_table->intern(key), m_symbol_table->intern(value_data_type), m_symbol_table->intern(value)};
+        if (auto it = std::find_if(m_data.begin(), m_data.end(), [&entry](const Entry& e) { return e.category == entry.category && e.key == entry.key; }); it != m_data.end())
+        {
+            if (it->type != entry.type || it->value != entry.value)
+            {
+                *it = entry;
+                notify_data_changed();
+            }
+        }
+        else
+        {
+            m_data.push_back(entry);
+            notify_data_changed();
+        }
 
         if (log_with_info_level)
         {
@@ -46,17 +92,17 @@ namespace hal
             return false;
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
+        auto it = find_entry(category, key);
         if (it == m_data.end())
         {
             log_debug("netlist", "no key ('{}', '{}') found.", category, key);
             return true;
         }
 
-        auto deleted_value = std::get<1>(it->second);
+        std::string_view deleted_value = m_symbol_table->get(it->value);
         m_data.erase(it);
 
-        //notify_updated();
+        notify_data_changed();
 
         if (log_with_info_level)
         {
@@ -69,29 +115,75 @@ namespace hal
         return true;
     }
 
-    const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& DataContainer::get_data_map() const
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> DataContainer::get_data_map() const
     {
-        return m_data;
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> map;
+        for (const Entry& entry : m_data)
+        {
+            map.emplace(std::make_tuple(std::string(m_symbol_table->get(entry.category)), std::string(m_symbol_table->get(entry.key))),
+                        std::make_tuple(std::string(m_symbol_table->get(entry.type)), std::string(m_symbol_table->get(entry.value))));
+        }
+        return map;
     }
 
     void DataContainer::set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map)
     {
-        m_data = map;
+        m_data.clear();
+        m_data.reserve(map.size());
+        for (const auto& [category_key, type_value] : map)
+        {
+            m_data.push_back({m_symbol_table->intern(std::get<0>(category_key)),
+                              m_symbol_table->intern(std::get<1>(category_key)),
+                              m_symbol_table->intern(std::get<0>(type_value)),
+                              m_symbol_table->intern(std::get<1>(type_value))});
+        }
+
+        notify_data_changed();
     }
 
-    bool DataContainer::has_data(const std::string& category, const std::string& key) const
+    void DataContainer::notify_data_changed()
     {
-        if (category.empty() || key.empty())
+    }
+
+    void DataContainer::copy_data(const DataContainer& other)
+    {
+        if (m_symbol_table == other.m_symbol_table)
         {
-            return false;
+            m_data = other.m_data;
+            return;
+        }
+
+        m_data.clear();
+        m_data.reserve(other.m_data.size());
+        for (const Entry& entry : other.m_data)
+        {
+            m_data.push_back({m_symbol_table->intern(other.m_symbol_table->get(entry.category)),
+                              m_symbol_table->intern(other.m_symbol_table->get(entry.key)),
+                              m_symbol_table->intern(other.m_symbol_table->get(entry.type)),
+                              m_symbol_table->intern(other.m_symbol_table->get(entry.value))});
+        }
+    }
+
+    std::vector<DataContainer::Entry>::const_iterator DataContainer::find_entry(const std::string& category, const std::string& key) const
+    {
+        // strings that have never been interned cannot be part of any entry
+        const SymbolTable::Symbol category_symbol = m_symbol_table->find(category);
+        const SymbolTable::Symbol key_symbol      = m_symbol_table->find(key);
+        if (category_symbol == SymbolTable::INVALID_SYMBOL || key_symbol == SymbolTable::INVALID_SYMBOL)
+        {
+            return m_data.end();
         }
+        return std::find_if(m_data.begin(), m_data.end(), [category_symbol, key_symbol](const Entry& e) { return e.category == category_symbol && e.key == key_symbol; });
+    }
 
-        if (auto it = m_data.find(std::make_tuple(category, key)); it == m_data.end())
+    bool DataContainer::has_data(const std::string& category, const std::string& key) const
+    {
+        if (category.empty() || key.empty())
         {
             return false;
         }
 
-        return true;
+        return find_entry(category, key) != m_data.end();
     }
 
     std::tuple<std::string, std::string> DataContainer::get_data(const std::string& category, const std::string& key) const
@@ -102,13 +194,13 @@ namespace hal
             return std::make_tuple("", "");
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
+        auto it = find_entry(category, key);
         if (it == m_data.end())
         {
             log_debug("netlist", "no value stored for key ('{}', '{}').", category, key);
             return std::make_tuple("", "");
         }
-        return it->second;
+        return std::make_tuple(std::string(m_symbol_table->get(it->type)), std::string(m_symbol_table->get(it->value)));
     }
 
 }    // namespace hal
@@ -366,6 +366,86 @@ namespace hal
             return res;
         }
 
+        Result<AndInverterGraph::Literal> subgraph_graph_recursive(const Net* n,
+                                                                   const std::unordered_set<const Gate*>& subgraph_gates,
+                                                                   AndInverterGraph& graph,
+                                                                   std::unordered_map<const Net*, AndInverterGraph::Literal>& net_cache,
+                                                                   std::unordered_set<const Net*>& on_stack)
+        {
+            if (const auto it = net_cache.find(n); it != net_cache.end())
+            {
+                return OK(it->second);
+            }
+
+            if (on_stack.find(n) != on_stack.end())
+            {
+                return ERR("could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": subgraph contains a cycle!");
+            }
+
+            const std::vector<Endpoint*> sources = n->get_sources();
+
+            // net is multi driven
+            if (sources.size() > 1)
+            {
+                return ERR("could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": cannot handle multi driven nets! Encountered at net " + std::to_string(n->get_id()) + ".");
+            }
+
+            // net has no source or its source is not in subgraph gates
+            if (sources.empty() || subgraph_gates.find(sources.front()->get_gate()) == subgraph_gates.end())
+            {
+                const auto literal = graph.add_input(BooleanFunctionNetDecorator(*n).get_boolean_variable_name());
+                net_cache.insert({n, literal});
+                return OK(literal);
+            }
+
+            const Endpoint* src_ep = sources.front();
+            const Gate* src_gate   = src_ep->get_gate();
+
+            const auto bf_res = src_gate->get_resolved_boolean_function(src_ep->get_pin());
+            if (bf_res.is_error())
+            {
+                return ERR_APPEND(bf_res.get_error(), "could not get subgraph function of net " + n->get_name() + " with ID " + std::to_string(n->get_id()) + ": failed to get function of gate.");
+            }
+            const BooleanFunction& gate_func = bf_res.get();
+
+            on_stack.insert(n);
+
+            std::unordered_map<std::string, AndInverterGraph::Literal> input_to_literal;
+            for (const std::string& in_net_str : gate_func.get_variable_names())
+            {
+                u32 in_net_id = std::stoi(in_net_str.substr(4));
+                Net* in_net   = src_gate->get_netlist()->get_net_by_id(in_net_id);
+
+                if (in_net == nullptr)
+                {
+                    return ERR("could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": cannot find in_net " + in_net_str + " at gate "
+                               + std::to_string(src_gate->get_id()) + "!");
+                }
+
+                auto input_res = subgraph_graph_recursive(in_net, subgraph_gates, graph, net_cache, on_stack);
+                if (input_res.is_error())
+                {
+                    // NOTE since this can lead to a deep recursion we dont append the error and instead just forward this.
+                    return input_res;
+                }
+
+                input_to_literal.insert({in_net_str, input_res.get()});
+            }
+
+            auto res = graph.add_function(gate_func, input_to_literal);
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(),
+                                  "could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": failed to add gate function " + gate_func.to_string()
+                                      + " to and-inverter graph.");
+            }
+
+            on_stack.erase(n);
+            net_cache.insert({n, res.get()});
+
+            return res;
+        }
+
         /*
         Result<std::monostate> subgraph_function_bfs(Net* n,
                                                      BooleanFunction& current,
@@ -539,4 +619,83 @@ namespace hal
             return res;
         }
     }
-}    // namespace hal
\ No newline at end of file
+
+    Result<AndInverterGraph> SubgraphNetlistDecorator::get_subgraph_function(const std::vector<const Gate*>& subgraph_gates, const std::vector<const Net*>& subgraph_outputs) const
+    {
+        // check validity of subgraph_gates
+        if (subgraph_gates.empty())
+        {
+            return ERR("could not get subgraph function: subgraph contains no gates");
+        }
+        else if (std::any_of(subgraph_gates.begin(), subgraph_gates.end(), [](const Gate* g) { return g == nullptr; }))
+        {
+            return ERR("could not get subgraph function: subgraph contains a gate that is a 'nullptr'");
+        }
+
+        const std::unordered_set<const Gate*> subgraph_gates_set(subgraph_gates.begin(), subgraph_gates.end());
+
+        AndInverterGraph graph;
+        std::unordered_map<const Net*, AndInverterGraph::Literal> net_cache;
+        std::unordered_set<const Net*> on_stack;
+
+        for (const Net* subgraph_output : subgraph_outputs)
+        {
+            if (subgraph_output == nullptr)
+            {
+                return ERR("could not get subgraph function: net is a 'nullptr'");
+            }
+            else if (subgraph_output->get_num_of_sources() > 1)
+            {
+                return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": net has more than one source");
+            }
+            else if (!subgraph_output->is_global_input_net() && subgraph_output->get_num_of_sources() == 0)
+            {
+                return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": net has no sources");
+            }
+
+            const auto output_name = BooleanFunctionNetDecorator(*subgraph_output).get_boolean_variable_name();
+            if (graph.get_output(output_name).is_ok())
+            {
+                continue;
+            }
+
+            auto res = subgraph_graph_recursive(subgraph_output, subgraph_gates_set, graph, net_cache, on_stack);
+            if (res.is_error())
+            {
+                return ERR(res.get_error());
+            }
+
+            if (auto output_res = graph.add_output(output_name, res.get()); output_res.is_error())
+            {
+                return ERR(output_res.get_error());
+            }
+        }
+
+        return OK(graph);
+    }
+
+    Result<AndInverterGraph> SubgraphNetlistDecorator::get_subgraph_function(const std::vector<Gate*>& subgraph_gates, const std::vector<const Net*>& subgraph_outputs) const
+    {
+        const auto subgraph_gates_const = std::vector<const Gate*>(subgraph_gates.begin(), subgraph_gates.end());
+        if (auto res = get_subgraph_function(subgraph_gates_const, subgraph_outputs); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        else
+        {
+            return res;
+        }
+    }
+
+    Result<AndInverterGraph> SubgraphNetlistDecorator::get_subgraph_function(const Module* subgraph_module, const std::vector<const Net*>& subgraph_outputs) const
+    {
+        if (auto res = get_subgraph_function(subgraph_module->get_gates(), subgraph_outputs); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        else
+        {
+            return res;
+        }
+    }
+}    // namespace hal
@@ -27,7 +27,8 @@ namespace hal
                                                                                    {GateEvent::event::removed, "removed"},
                                                                                    {GateEvent::event::name_changed, "name_changed"},
                                                                                    {GateEvent::event::location_changed, "location_changed"},
-                                                                                   {GateEvent::event::boolean_function_changed, "boolean_function_changed"}};
+                                                                                   {GateEvent::event::boolean_function_changed, "boolean_function_changed"},
+                                                                                   {GateEvent::event::data_changed, "data_changed"}};
 
     template<>
     std::map<NetEvent::event, std::string> EnumStrings<NetEvent::event>::data = {{NetEvent::event::created, "created"},
@@ -36,7 +37,8 @@ namespace hal
                                                                                  {NetEvent::event::src_added, "src_added"},
                                                                                  {NetEvent::event::src_removed, "src_removed"},
                                                                                  {NetEvent::event::dst_added, "dst_added"},
-                                                                                 {NetEvent::event::dst_removed, "dst_removed"}};
+                                                                                 {NetEvent::event::dst_removed, "dst_removed"},
+                                                                                 {NetEvent::event::data_changed, "data_changed"}};
 
     template<>
     std::map<ModuleEvent::event, std::string> EnumStrings<ModuleEvent::event>::data = {{ModuleEvent::event::created, "created"},
@@ -52,7 +54,8 @@ namespace hal
                                                                                        {ModuleEvent::event::gates_remove_begin, "gates_remove_begin"},
                                                                                        {ModuleEvent::event::gates_remove_end, "gates_remove_end"},
                                                                                        {ModuleEvent::event::gate_removed, "gate_removed"},
-                                                                                       {ModuleEvent::event::pin_changed, "pin_changed"}};
+                                                                                       {ModuleEvent::event::pin_changed, "pin_changed"},
+                                                                                       {ModuleEvent::event::data_changed, "data_changed"}};
 
     template<>
     std::map<GroupingEvent::event, std::string> EnumStrings<GroupingEvent::event>::data = {{GroupingEvent::event::created, "created"},
@@ -65,7 +68,7 @@ namespace hal
                                                                                            {GroupingEvent::event::module_assigned, "module_assigned"},
                                                                                            {GroupingEvent::event::module_removed, "module_removed"}};
 
-    EventHandler::EventHandler() : netlist_event_enabled(true), module_event_enabled(true), gate_event_enabled(true), net_event_enabled(true), grouping_event_enabled(true)
+    EventHandler::EventHandler() : netlist_event_enabled(true), module_event_enabled(true), gate_event_enabled(true), net_event_enabled(true), grouping_event_enabled(true), m_connectivity_stamp(0)
     {
     }
 
@@ -89,6 +92,11 @@ namespace hal
 
     void EventHandler::notify(GateEvent::event c, Gate* gate, u32 associated_data)
     {
+        if (c == GateEvent::event::created || c == GateEvent::event::removed)
+        {
+            m_connectivity_stamp++;
+        }
+
         if (gate_event_enabled)
         {
             m_gate_callback(c, gate, associated_data);
@@ -98,6 +106,11 @@ namespace hal
 
     void EventHandler::notify(NetEvent::event c, Net* net, u32 associated_data)
     {
+        if (c != NetEvent::event::name_changed && c != NetEvent::event::data_changed)
+        {
+            m_connectivity_stamp++;
+        }
+
         if (net_event_enabled)
         {
             m_net_callback(c, net, associated_data);
@@ -157,4 +170,9 @@ namespace hal
         m_net_callback.remove_callback(name);
         m_grouping_callback.remove_callback(name);
     }
+
+    u64 EventHandler::get_connectivity_stamp() const
+    {
+        return m_connectivity_stamp;
+    }
 }    // namespace hal
@@ -0,0 +1,201 @@
+#include "hal_core/netlist/frozen_netlist_view.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+namespace hal
+{
+    FrozenNetlistView::FrozenNetlistView(const Netlist& netlist) : m_netlist(netlist), m_stamp(netlist.get_event_handler()->get_connectivity_stamp())
+    {
+        m_gates = netlist.get_gates();
+        m_nets  = netlist.get_nets();
+
+        m_gate_id_to_index.reserve(m_gates.size());
+        for (u32 i = 0; i < m_gates.size(); i++)
+        {
+            m_gate_id_to_index[m_gates[i]->get_id()] = i;
+        }
+
+        m_net_id_to_index.reserve(m_nets.size());
+        for (u32 i = 0; i < m_nets.size(); i++)
+        {
+            m_net_id_to_index[m_nets[i]->get_id()] = i;
+        }
+
+        // gate -> net adjacency
+        m_fan_in_offsets.reserve(m_gates.size() + 1);
+        m_fan_out_offsets.reserve(m_gates.size() + 1);
+        m_fan_in_offsets.push_back(0);
+        m_fan_out_offsets.push_back(0);
+        for (const Gate* gate : m_gates)
+        {
+            for (const Endpoint* ep : gate->get_fan_in_endpoints())
+            {
+                m_fan_in_nets.push_back(m_net_id_to_index.at(ep->get_net()->get_id()));
+                m_fan_in_pins.push_back(ep->get_pin());
+            }
+            m_fan_in_offsets.push_back(m_fan_in_nets.size());
+
+            for (const Endpoint* ep : gate->get_fan_out_endpoints())
+            {
+                m_fan_out_nets.push_back(m_net_id_to_index.at(ep->get_net()->get_id()));
+                m_fan_out_pins.push_back(ep->get_pin());
+            }
+            m_fan_out_offsets.push_back(m_fan_out_nets.size());
+        }
+
+        // net -> gate adjacency
+        m_source_offsets.reserve(m_nets.size() + 1);
+        m_destination_offsets.reserve(m_nets.size() + 1);
+        m_source_offsets.push_back(0);
+        m_destination_offsets.push_back(0);
+        m_source_gates.reserve(m_fan_out_nets.size());
+        m_source_pins.reserve(m_fan_out_nets.size());
+        m_destination_gates.reserve(m_fan_in_nets.size());
+        m_destination_pins.reserve(m_fan_in_nets.size());
+        for (const Net* net : m_nets)
+        {
+            for (const Endpoint* ep : net->get_sources())
+            {
+                m_source_gates.push_back(m_gate_id_to_index.at(ep->get_gate()->get_id()));
+                m_source_pins.push_back(ep->get_pin());
+            }
+            m_source_offsets.push_back(m_source_gates.size());
+
+            for (const Endpoint* ep : net->get_destinations())
+            {
+                m_destination_gates.push_back(m_gate_id_to_index.at(ep->get_gate()->get_id()));
+                m_destination_pins.push_back(ep->get_pin());
+            }
+            m_destination_offsets.push_back(m_destination_gates.size());
+        }
+    }
+
+    const Netlist& FrozenNetlistView::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    u64 FrozenNetlistView::get_stamp() const
+    {
+        return m_stamp;
+    }
+
+    bool FrozenNetlistView::is_valid() const
+    {
+        return m_netlist.get_event_handler()->get_connectivity_stamp() == m_stamp;
+    }
+
+    u32 FrozenNetlistView::get_num_gates() const
+    {
+        return m_gates.size();
+    }
+
+    u32 FrozenNetlistView::get_num_nets() const
+    {
+        return m_nets.size();
+    }
+
+    Gate* FrozenNetlistView::get_gate(u32 gate_index) const
+    {
+        if (gate_index >= m_gates.size())
+        {
+            return nullptr;
+        }
+
+        return m_gates[gate_index];
+    }
+
+    Net* FrozenNetlistView::get_net(u32 net_index) const
+    {
+        if (net_index >= m_nets.size())
+        {
+            return nullptr;
+        }
+
+        return m_nets[net_index];
+    }
+
+    u32 FrozenNetlistView::get_gate_index(const Gate* gate) const
+    {
+        if (gate == nullptr || gate->get_netlist() != &m_netlist)
+        {
+            return invalid_index;
+        }
+
+        return get_gate_index_by_id(gate->get_id());
+    }
+
+    u32 FrozenNetlistView::get_gate_index_by_id(u32 gate_id) const
+    {
+        if (const auto it = m_gate_id_to_index.find(gate_id); it != m_gate_id_to_index.end())
+        {
+            return it->second;
+        }
+
+        return invalid_index;
+    }
+
+    u32 FrozenNetlistView::get_net_index(const Net* net) const
+    {
+        if (net == nullptr || net->get_netlist() != &m_netlist)
+        {
+            return invalid_index;
+        }
+
+        return get_net_index_by_id(net->get_id());
+    }
+
+    u32 FrozenNetlistView::get_net_index_by_id(u32 net_id) const
+    {
+        if (const auto it = m_net_id_to_index.find(net_id); it != m_net_id_to_index.end())
+        {
+            return it->second;
+        }
+
+        return invalid_index;
+    }
+
+    FrozenNetlistView::Range<u32> FrozenNetlistView::get_fan_in_nets(u32 gate_index) const
+    {
+        return Range<u32>(m_fan_in_nets.data() + m_fan_in_offsets[gate_index], m_fan_in_nets.data() + m_fan_in_offsets[gate_index + 1]);
+    }
+
+    FrozenNetlistView::Range<const GatePin*> FrozenNetlistView::get_fan_in_pins(u32 gate_index) const
+    {
+        return Range<const GatePin*>(m_fan_in_pins.data() + m_fan_in_offsets[gate_index], m_fan_in_pins.data() + m_fan_in_offsets[gate_index + 1]);
+    }
+
+    FrozenNetlistView::Range<u32> FrozenNetlistView::get_fan_out_nets(u32 gate_index) const
+    {
+        return Range<u32>(m_fan_out_nets.data() + m_fan_out_offsets[gate_index], m_fan_out_nets.data() + m_fan_out_offsets[gate_index + 1]);
+    }
+
+    FrozenNetlistView::Range<const GatePin*> FrozenNetlistView::get_fan_out_pins(u32 gate_index) const
+    {
+        return Range<const GatePin*>(m_fan_out_pins.data() + m_fan_out_offsets[gate_index], m_fan_out_pins.data() + m_fan_out_offsets[gate_index + 1]);
+    }
+
+    FrozenNetlistView::Range<u32> FrozenNetlistView::get_sources(u32 net_index) const
+    {
+        return Range<u32>(m_source_gates.data() + m_source_offsets[net_index], m_source_gates.data() + m_source_offsets[net_index + 1]);
+    }
+
+    FrozenNetlistView::Range<const GatePin*> FrozenNetlistView::get_source_pins(u32 net_index) const
+    {
+        return Range<const GatePin*>(m_source_pins.data() + m_source_offsets[net_index], m_source_pins.data() + m_source_offsets[net_index + 1]);
+    }
+
+    FrozenNetlistView::Range<u32> FrozenNetlistView::get_destinations(u32 net_index) const
+    {
+        return Range<u32>(m_destination_gates.data() + m_destination_offsets[net_index], m_destination_gates.data() + m_destination_offsets[net_index + 1]);
+    }
+
+    FrozenNetlistView::Range<const GatePin*> FrozenNetlistView::get_destination_pins(u32 net_index) const
+    {
+        return Range<const GatePin*>(m_destination_pins.data() + m_destination_offsets[net_index], m_destination_pins.data() + m_destination_offsets[net_index + 1]);
+    }
+}    // namespace hal
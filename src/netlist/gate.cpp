@@ -42,7 +42,7 @@ static u64 bitreverse(u64 n)
 namespace hal
 {
     Gate::Gate(NetlistInternalManager* mgr, EventHandler* event_handler, const u32 id, GateType* gt, const std::string& name, i32 x, i32 y)
-        : m_internal_manager(mgr), m_id(id), m_name(name), m_type(gt), m_x(x), m_y(y), m_event_handler(event_handler)
+        : DataContainer(&mgr->m_symbol_table), m_internal_manager(mgr), m_id(id), m_name(name), m_type(gt), m_x(x), m_y(y), m_event_handler(event_handler)
     {
         ;
     }
@@ -173,6 +173,11 @@ namespace hal
         set_location_y(location.second);
     }
 
+    void Gate::notify_data_changed()
+    {
+        m_event_handler->notify(GateEvent::event::data_changed, this);
+    }
+
     Module* Gate::get_module() const
     {
         return m_module;
@@ -455,6 +460,26 @@ namespace hal
         return f;
     }
 
+    Endpoint* Gate::get_pin_endpoint(const GatePin* pin, bool is_destination) const
+    {
+        const u32 slot = 2 * pin->get_index() + (is_destination ? 0 : 1);
+        if (slot >= m_pin_endpoints.size())
+        {
+            return nullptr;
+        }
+        return m_pin_endpoints[slot];
+    }
+
+    void Gate::set_pin_endpoint(const GatePin* pin, bool is_destination, Endpoint* ep)
+    {
+        const u32 slot = 2 * pin->get_index() + (is_destination ? 0 : 1);
+        if (slot >= m_pin_endpoints.size())
+        {
+            m_pin_endpoints.resize(std::max(slot + 1, 2 * m_type->get_pin_count()), nullptr);
+        }
+        m_pin_endpoints[slot] = ep;
+    }
+
     bool Gate::add_boolean_function(const std::string& name, const BooleanFunction& func)
     {
         LUTComponent* lut_component = m_type->get_component_as<LUTComponent>([](const GateTypeComponent* component) { return component->get_type() == GateTypeComponent::ComponentType::lut; });
@@ -589,14 +614,24 @@ namespace hal
             log_warning("gate", "could not get fan-in endpoint of pin '{}' at gate '{}' with ID {}: pin is not an input pin", pin->get_name(), m_name, std::to_string(m_id));
             return nullptr;
         }
-        auto it = std::find_if(m_in_endpoints.begin(), m_in_endpoints.end(), [&pin](auto& ep) { return *ep->get_pin() == *pin; });
-        if (it == m_in_endpoints.end())
+        Endpoint* ep = nullptr;
+        if (pin->get_index() < m_type->get_pin_count() && m_type->get_pin_by_index(pin->get_index()) == pin)
+        {
+            ep = get_pin_endpoint(pin, true);
+        }
+        else if (auto it = std::find_if(m_in_endpoints.begin(), m_in_endpoints.end(), [&pin](auto& e) { return *e->get_pin() == *pin; }); it != m_in_endpoints.end())
+        {
+            // pins of other gate types can only be matched by value
+            ep = *it;
+        }
+
+        if (ep == nullptr)
         {
             log_debug("gate", "could not get fan-in endpoint of pin '{}' at gate '{}' with ID {}: no net is connected to pin", pin->get_name(), m_name, std::to_string(m_id));
             return nullptr;
         }
 
-        return *it;
+        return ep;
     }
 
     Endpoint* Gate::get_fan_in_endpoint(const std::string& pin_name) const
@@ -657,14 +692,24 @@ namespace hal
             log_warning("gate", "could not get fan-out endpoint of pin '{}' at gate '{}' with ID {}: pin is not an output pin", pin->get_name(), m_name, std::to_string(m_id));
             return nullptr;
         }
-        auto it = std::find_if(m_out_endpoints.begin(), m_out_endpoints.end(), [&pin](auto& ep) { return *ep->get_pin() == *pin; });
-        if (it == m_out_endpoints.end())
+        Endpoint* ep = nullptr;
+        if (pin->get_index() < m_type->get_pin_count() && m_type->get_pin_by_index(pin->get_index()) == pin)
+        {
+            ep = get_pin_endpoint(pin, false);
+        }
+        else if (auto it = std::find_if(m_out_endpoints.begin(), m_out_endpoints.end(), [&pin](auto& e) { return *e->get_pin() == *pin; }); it != m_out_endpoints.end())
+        {
+            // pins of other gate types can only be matched by value
+            ep = *it;
+        }
+
+        if (ep == nullptr)
         {
             log_debug("gate", "could not get fan-out endpoint of pin '{}' at gate '{}' with ID {}: no net is connected to pin", pin->get_name(), m_name, std::to_string(m_id));
             return nullptr;
         }
 
-        return *it;
+        return ep;
     }
 
     Endpoint* Gate::get_fan_out_endpoint(const std::string& pin_name) const
@@ -0,0 +1,689 @@
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
+
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/lut_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_port_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+#include "hal_core/utilities/utils.h"
+#include "hal_version.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace hal
+{
+    namespace gate_library_cache
+    {
+        namespace
+        {
+            const u32 CACHE_FORMAT_VERSION = 2;
+
+            const char MAGIC[8]       = {'H', 'A', 'L', 'G', 'L', 'C', '\r', '\n'};
+            const u32 BYTE_ORDER_MARK = 0x01020304;
+
+            enum TypeFlags : u8
+            {
+                GND_TYPE = 1 << 0,
+                VCC_TYPE = 1 << 1
+            };
+
+            /*
+             * The cache file is a plain sequence of fixed-width integers and length-prefixed strings.
+             * It starts with the magic number, the format version, the byte order mark, the HAL version and git hash of the writing build, and the key of the gate library file, i.e., its size, last modification time, and path.
+             * The HAL version is part of the header since the cache stores the output of the gate library parsers, which may change between builds without a change of the format version.
+             * The key is followed by the library name, the gate location data specification, the includes, and all gate types in the order of their IDs.
+             * Enum values are stored by name so that a cache file stays readable if an enum is extended.
+             */
+            class CacheWriter
+            {
+            public:
+                template<typename T>
+                void write(T value)
+                {
+                    m_data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+                }
+
+                void write_string(const std::string& str)
+                {
+                    write<u32>(str.size());
+                    m_data.append(str);
+                }
+
+                void write_function(const BooleanFunction& function)
+                {
+                    const auto& nodes = function.get_nodes();
+                    write<u32>(nodes.size());
+                    for (const auto& node : nodes)
+                    {
+                        write<u16>(node.type);
+                        write<u16>(node.size);
+                        if (node.type == BooleanFunction::NodeType::Constant)
+                        {
+                            write<u32>(node.constant.size());
+                            for (const auto value : node.constant)
+                            {
+                                write<i8>(value);
+                            }
+                        }
+                        else if (node.type == BooleanFunction::NodeType::Index)
+                        {
+                            write<u16>(node.index);
+                        }
+                        else if (node.type == BooleanFunction::NodeType::Variable)
+                        {
+                            write_string(node.variable);
+                        }
+                    }
+                }
+
+                const std::string& get_data() const
+                {
+                    return m_data;
+                }
+
+            private:
+                std::string m_data;
+            };
+
+            class CacheReader
+            {
+            public:
+                explicit CacheReader(std::string_view data) : m_data(data)
+                {
+                }
+
+                template<typename T>
+                T read()
+                {
+                    T value;
+                    std::memcpy(&value, advance(sizeof(T)), sizeof(T));
+                    return value;
+                }
+
+                std::string read_string()
+                {
+                    const u32 size = read<u32>();
+                    return std::string(advance(size), size);
+                }
+
+                BooleanFunction read_function()
+                {
+                    const u32 num_nodes = read<u32>();
+                    if (num_nodes == 0)
+                    {
+                        return BooleanFunction();
+                    }
+
+                    std::vector<BooleanFunction::Node> nodes;
+                    nodes.reserve(num_nodes);
+                    for (u32 i = 0; i < num_nodes; i++)
+                    {
+                        const u16 type = read<u16>();
+                        const u16 size = read<u16>();
+                        if (type == BooleanFunction::NodeType::Constant)
+                        {
+                            const u32 num_values = read<u32>();
+                            std::vector<BooleanFunction::Value> value;
+                            value.reserve(num_values);
+                            for (u32 j = 0; j < num_values; j++)
+                            {
+                                value.push_back((BooleanFunction::Value)read<i8>());
+                            }
+                            nodes.push_back(BooleanFunction::Node::Constant(value));
+                        }
+                        else if (type == BooleanFunction::NodeType::Index)
+                        {
+                            nodes.push_back(BooleanFunction::Node::Index(read<u16>(), size));
+                        }
+                        else if (type == BooleanFunction::NodeType::Variable)
+                        {
+                            nodes.push_back(BooleanFunction::Node::Variable(read_string(), size));
+                        }
+                        else
+                        {
+                            nodes.push_back(BooleanFunction::Node::Operation(type, size));
+                        }
+                    }
+
+                    auto function = BooleanFunction::build(std::move(nodes));
+                    if (function.is_error())
+                    {
+                        throw std::runtime_error("invalid Boolean function: " + function.get_error().get());
+                    }
+                    return function.get();
+                }
+
+            private:
+                const char* advance(u64 size)
+                {
+                    if (m_data.size() - m_position < size)
+                    {
+                        throw std::runtime_error("unexpected end of file");
+                    }
+                    const char* res = m_data.data() + m_position;
+                    m_position += size;
+                    return res;
+                }
+
+                std::string_view m_data;
+                u64 m_position = 0;
+            };
+
+            struct FileKey
+            {
+                u64 size;
+                i64 modification_time;
+            };
+
+            Result<FileKey> get_file_key(const std::filesystem::path& file_path)
+            {
+                std::error_code ec;
+                const u64 size = std::filesystem::file_size(file_path, ec);
+                if (ec)
+                {
+                    return ERR("could not determine size of gate library file '" + file_path.string() + "': " + ec.message());
+                }
+                const auto modification_time = std::filesystem::last_write_time(file_path, ec);
+                if (ec)
+                {
+                    return ERR("could not determine modification time of gate library file '" + file_path.string() + "': " + ec.message());
+                }
+                return OK(FileKey{size, (i64)modification_time.time_since_epoch().count()});
+            }
+
+            void write_component(CacheWriter& writer, const GateTypeComponent* component)
+            {
+                writer.write<u8>((u8)component->get_type());
+                switch (component->get_type())
+                {
+                    case GateTypeComponent::ComponentType::lut: {
+                        writer.write<u8>(component->convert_to<LUTComponent>()->is_init_ascending() ? 1 : 0);
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::ff: {
+                        const FFComponent* ff_component = component->convert_to<FFComponent>();
+                        writer.write_function(ff_component->get_next_state_function());
+                        writer.write_function(ff_component->get_clock_function());
+                        writer.write_function(ff_component->get_async_reset_function());
+                        writer.write_function(ff_component->get_async_set_function());
+                        writer.write_string(enum_to_string(ff_component->get_async_set_reset_behavior().first));
+                        writer.write_string(enum_to_string(ff_component->get_async_set_reset_behavior().second));
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::latch: {
+                        const LatchComponent* latch_component = component->convert_to<LatchComponent>();
+                        writer.write_function(latch_component->get_data_in_function());
+                        writer.write_function(latch_component->get_enable_function());
+                        writer.write_function(latch_component->get_async_reset_function());
+                        writer.write_function(latch_component->get_async_set_function());
+                        writer.write_string(enum_to_string(latch_component->get_async_set_reset_behavior().first));
+                        writer.write_string(enum_to_string(latch_component->get_async_set_reset_behavior().second));
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::ram: {
+                        writer.write<u32>(component->convert_to<RAMComponent>()->get_bit_size());
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::mac: {
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::init: {
+                        const InitComponent* init_component = component->convert_to<InitComponent>();
+                        writer.write_string(init_component->get_init_category());
+                        writer.write<u32>(init_component->get_init_identifiers().size());
+                        for (const auto& identifier : init_component->get_init_identifiers())
+                        {
+                            writer.write_string(identifier);
+                        }
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::state: {
+                        const StateComponent* state_component = component->convert_to<StateComponent>();
+                        writer.write_string(state_component->get_state_identifier());
+                        writer.write_string(state_component->get_neg_state_identifier());
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::ram_port: {
+                        const RAMPortComponent* port_component = component->convert_to<RAMPortComponent>();
+                        writer.write_string(port_component->get_data_group());
+                        writer.write_string(port_component->get_address_group());
+                        writer.write_function(port_component->get_clock_function());
+                        writer.write_function(port_component->get_enable_function());
+                        writer.write<u8>(port_component->is_write_port() ? 1 : 0);
+                        break;
+                    }
+                }
+            }
+
+            std::unique_ptr<GateTypeComponent> read_component(CacheReader& reader, std::unique_ptr<GateTypeComponent> child)
+            {
+                const auto type = (GateTypeComponent::ComponentType)reader.read<u8>();
+                switch (type)
+                {
+                    case GateTypeComponent::ComponentType::lut: {
+                        const bool init_ascending = reader.read<u8>() != 0;
+                        return GateTypeComponent::create_lut_component(std::move(child), init_ascending);
+                    }
+                    case GateTypeComponent::ComponentType::ff: {
+                        BooleanFunction next_state_bf = reader.read_function();
+                        BooleanFunction clock_bf      = reader.read_function();
+                        auto component                = GateTypeComponent::create_ff_component(std::move(child), next_state_bf, clock_bf);
+                        FFComponent* ff_component     = component->convert_to<FFComponent>();
+                        ff_component->set_async_reset_function(reader.read_function());
+                        ff_component->set_async_set_function(reader.read_function());
+                        const auto behav_state     = enum_from_string<AsyncSetResetBehavior>(reader.read_string());
+                        const auto behav_neg_state = enum_from_string<AsyncSetResetBehavior>(reader.read_string());
+                        ff_component->set_async_set_reset_behavior(behav_state, behav_neg_state);
+                        return component;
+                    }
+                    case GateTypeComponent::ComponentType::latch: {
+                        auto component                  = GateTypeComponent::create_latch_component(std::move(child));
+                        LatchComponent* latch_component = component->convert_to<LatchComponent>();
+                        latch_component->set_data_in_function(reader.read_function());
+                        latch_component->set_enable_function(reader.read_function());
+                        latch_component->set_async_reset_function(reader.read_function());
+                        latch_component->set_async_set_function(reader.read_function());
+                        const auto behav_state     = enum_from_string<AsyncSetResetBehavior>(reader.read_string());
+                        const auto behav_neg_state = enum_from_string<AsyncSetResetBehavior>(reader.read_string());
+                        latch_component->set_async_set_reset_behavior(behav_state, behav_neg_state);
+                        return component;
+                    }
+                    case GateTypeComponent::ComponentType::ram: {
+                        const u32 bit_size = reader.read<u32>();
+                        return GateTypeComponent::create_ram_component(std::move(child), bit_size);
+                    }
+                    case GateTypeComponent::ComponentType::mac: {
+                        return GateTypeComponent::create_mac_component();
+                    }
+                    case GateTypeComponent::ComponentType::init: {
+                        std::string init_category = reader.read_string();
+                        std::vector<std::string> init_identifiers(reader.read<u32>());
+                        for (auto& identifier : init_identifiers)
+                        {
+                            identifier = reader.read_string();
+                        }
+                        return GateTypeComponent::create_init_component(init_category, init_identifiers);
+                    }
+                    case GateTypeComponent::ComponentType::state: {
+                        std::string state_identifier     = reader.read_string();
+                        std::string neg_state_identifier = reader.read_string();
+                        return GateTypeComponent::create_state_component(std::move(child), state_identifier, neg_state_identifier);
+                    }
+                    case GateTypeComponent::ComponentType::ram_port: {
+                        std::string data_group    = reader.read_string();
+                        std::string addr_group    = reader.read_string();
+                        BooleanFunction clock_bf  = reader.read_function();
+                        BooleanFunction enable_bf = reader.read_function();
+                        const bool is_write       = reader.read<u8>() != 0;
+                        return GateTypeComponent::create_ram_port_component(std::move(child), data_group, addr_group, clock_bf, enable_bf, is_write);
+                    }
+                }
+
+                throw std::runtime_error("unknown component type " + std::to_string((u32)type));
+            }
+
+            void write_gate_type(CacheWriter& writer, const GateLibrary* gate_lib, const GateType* gt)
+            {
+                writer.write<u32>(gt->get_id());
+                writer.write_string(gt->get_name());
+
+                const auto gnd_types = gate_lib->get_gnd_gate_types();
+                const auto vcc_types = gate_lib->get_vcc_gate_types();
+                writer.write<u8>((gnd_types.find(gt->get_name()) != gnd_types.end() ? GND_TYPE : 0) | (vcc_types.find(gt->get_name()) != vcc_types.end() ? VCC_TYPE : 0));
+
+                const auto properties = gt->get_properties();
+                writer.write<u32>(properties.size());
+                for (const auto property : properties)
+                {
+                    writer.write_string(enum_to_string(property));
+                }
+
+                // components form a chain that is stored from the innermost to the outermost component
+                const std::vector<GateTypeComponent*> components = gt->get_components();
+                writer.write<u32>(components.size());
+                for (const GateTypeComponent* component : components)
+                {
+                    write_component(writer, component);
+                }
+
+                const auto pins = gt->get_pins();
+                writer.write<u32>(pins.size());
+                for (const GatePin* pin : pins)
+                {
+                    writer.write<u32>(pin->get_id());
+                    writer.write_string(pin->get_name());
+                    writer.write_string(enum_to_string(pin->get_direction()));
+                    writer.write_string(enum_to_string(pin->get_type()));
+                }
+
+                const auto pin_groups = gt->get_pin_groups();
+                writer.write<u32>(pin_groups.size());
+                for (const PinGroup<GatePin>* pin_group : pin_groups)
+                {
+                    writer.write<u32>(pin_group->get_id());
+                    writer.write_string(pin_group->get_name());
+                    writer.write_string(enum_to_string(pin_group->get_direction()));
+                    writer.write_string(enum_to_string(pin_group->get_type()));
+                    writer.write<u8>(pin_group->is_ascending() ? 1 : 0);
+                    writer.write<u32>(pin_group->get_start_index());
+
+                    const auto group_pins = pin_group->get_pins();
+                    writer.write<u32>(group_pins.size());
+                    for (const GatePin* pin : group_pins)
+                    {
+                        writer.write<u32>(pin->get_id());
+                    }
+                }
+
+                // sort functions by name to obtain deterministic files
+                const auto& functions = gt->get_boolean_functions();
+                std::map<std::string, const BooleanFunction*> sorted_functions;
+                for (const auto& [name, function] : functions)
+                {
+                    sorted_functions[name] = &function;
+                }
+                writer.write<u32>(sorted_functions.size());
+                for (const auto& [name, function] : sorted_functions)
+                {
+                    writer.write_string(name);
+                    writer.write_function(*function);
+                }
+            }
+
+            Result<std::monostate> read_gate_type(CacheReader& reader, GateLibrary* gate_lib)
+            {
+                const u32 id     = reader.read<u32>();
+                std::string name = reader.read_string();
+                const u8 flags   = reader.read<u8>();
+
+                std::set<GateTypeProperty> properties;
+                const u32 num_properties = reader.read<u32>();
+                for (u32 i = 0; i < num_properties; i++)
+                {
+                    properties.insert(enum_from_string<GateTypeProperty>(reader.read_string()));
+                }
+
+                std::unique_ptr<GateTypeComponent> component = nullptr;
+                const u32 num_components                     = reader.read<u32>();
+                for (u32 i = 0; i < num_components; i++)
+                {
+                    component = read_component(reader, std::move(component));
+                }
+
+                GateType* gt = gate_lib->create_gate_type(name, properties, std::move(component));
+                if (gt == nullptr || gt->get_id() != id)
+                {
+                    return ERR("could not read gate type '" + name + "' with ID " + std::to_string(id) + ": failed to create gate type");
+                }
+
+                const u32 num_pins = reader.read<u32>();
+                for (u32 i = 0; i < num_pins; i++)
+                {
+                    const u32 pin_id         = reader.read<u32>();
+                    std::string pin_name     = reader.read_string();
+                    const auto pin_direction = enum_from_string<PinDirection>(reader.read_string());
+                    const auto pin_type      = enum_from_string<PinType>(reader.read_string());
+                    if (auto res = gt->create_pin(pin_id, pin_name, pin_direction, pin_type, false); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not read gate type '" + name + "' with ID " + std::to_string(id) + ": failed to create pin '" + pin_name + "'");
+                    }
+                }
+
+                const u32 num_pin_groups = reader.read<u32>();
+                for (u32 i = 0; i < num_pin_groups; i++)
+                {
+                    const u32 group_id         = reader.read<u32>();
+                    std::string group_name     = reader.read_string();
+                    const auto group_direction = enum_from_string<PinDirection>(reader.read_string());
+                    const auto group_type      = enum_from_string<PinType>(reader.read_string());
+                    const bool ascending       = reader.read<u8>() != 0;
+                    const u32 start_index      = reader.read<u32>();
+
+                    std::vector<GatePin*> pins(reader.read<u32>());
+                    for (auto& pin : pins)
+                    {
+                        pin = gt->get_pin_by_id(reader.read<u32>());
+                    }
+
+                    if (auto res = gt->create_pin_group(group_id, group_name, pins, group_direction, group_type, ascending, start_index); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not read gate type '" + name + "' with ID " + std::to_string(id) + ": failed to create pin group '" + group_name + "'");
+                    }
+                }
+
+                const u32 num_functions = reader.read<u32>();
+                for (u32 i = 0; i < num_functions; i++)
+                {
+                    std::string function_name = reader.read_string();
+                    gt->add_boolean_function(function_name, reader.read_function());
+                }
+
+                // marking requires the pins and Boolean functions of the gate type
+                if ((flags & GND_TYPE) != 0 && !gate_lib->mark_gnd_gate_type(gt))
+                {
+                    return ERR("could not read gate type '" + name + "' with ID " + std::to_string(id) + ": failed to mark gate type as GND gate type");
+                }
+                if ((flags & VCC_TYPE) != 0 && !gate_lib->mark_vcc_gate_type(gt))
+                {
+                    return ERR("could not read gate type '" + name + "' with ID " + std::to_string(id) + ": failed to mark gate type as VCC gate type");
+                }
+
+                return OK({});
+            }
+
+            Result<std::string> read_header(CacheReader& reader, const std::filesystem::path& file_path)
+            {
+                char magic[sizeof(MAGIC)];
+                for (auto& c : magic)
+                {
+                    c = reader.read<char>();
+                }
+                if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+                {
+                    return ERR("file is not a gate library cache file");
+                }
+                if (const u32 version = reader.read<u32>(); version != CACHE_FORMAT_VERSION)
+                {
+                    return ERR("cache file has format version " + std::to_string(version) + " but version " + std::to_string(CACHE_FORMAT_VERSION) + " is required");
+                }
+                if (reader.read<u32>() != BYTE_ORDER_MARK)
+                {
+                    return ERR("cache file has been written on a machine with a different byte order");
+                }
+                const std::string written_version  = reader.read_string();
+                const std::string written_git_hash = reader.read_string();
+                if (written_version != hal_version::version || written_git_hash != hal_version::git_hash)
+                {
+                    return ERR("cache file has been written by HAL version '" + written_version + "' (" + written_git_hash + ") but version '" + hal_version::version + "' (" + hal_version::git_hash + ") is running");
+                }
+
+                auto key = get_file_key(file_path);
+                if (key.is_error())
+                {
+                    return ERR_APPEND(key.get_error(), "could not validate cache file");
+                }
+                const u64 size              = reader.read<u64>();
+                const i64 modification_time = reader.read<i64>();
+                if (reader.read_string() != file_path.string() || size != key.get().size || modification_time != key.get().modification_time)
+                {
+                    return ERR("gate library file has changed since the cache file was written");
+                }
+
+                return OK(reader.read_string());
+            }
+        }    // namespace
+
+        std::filesystem::path get_cache_file(const std::filesystem::path& file_path)
+        {
+            std::stringstream ss;
+            ss << file_path.stem().string() << "_" << std::hex << std::hash<std::string>{}(file_path.string()) << ".glcache";
+            return utils::get_user_share_directory() / "gate_library_cache" / ss.str();
+        }
+
+        Result<std::monostate> write(const GateLibrary* gate_lib)
+        {
+            if (gate_lib == nullptr)
+            {
+                return ERR("could not write gate library cache: gate library is a 'nullptr'");
+            }
+
+            const std::filesystem::path file_path = gate_lib->get_path();
+            auto key                              = get_file_key(file_path);
+            if (key.is_error())
+            {
+                return ERR_APPEND(key.get_error(), "could not write gate library cache for '" + gate_lib->get_name() + "'");
+            }
+
+            CacheWriter writer;
+            for (const char c : MAGIC)
+            {
+                writer.write<char>(c);
+            }
+            writer.write<u32>(CACHE_FORMAT_VERSION);
+            writer.write<u32>(BYTE_ORDER_MARK);
+            writer.write_string(hal_version::version);
+            writer.write_string(hal_version::git_hash);
+            writer.write<u64>(key.get().size);
+            writer.write<i64>(key.get().modification_time);
+            writer.write_string(file_path.string());
+
+            writer.write_string(gate_lib->get_name());
+            writer.write_string(gate_lib->get_gate_location_data_category());
+            writer.write_string(gate_lib->get_gate_location_data_identifiers().first);
+            writer.write_string(gate_lib->get_gate_location_data_identifiers().second);
+
+            const auto includes = gate_lib->get_includes();
+            writer.write<u32>(includes.size());
+            for (const auto& inc : includes)
+            {
+                writer.write_string(inc);
+            }
+
+            // gate types are stored in the order of their IDs so that the IDs are reproduced when reading the cache
+            std::vector<GateType*> gate_types;
+            for (const auto& [name, gt] : gate_lib->get_gate_types())
+            {
+                gate_types.push_back(gt);
+            }
+            std::sort(gate_types.begin(), gate_types.end(), [](GateType* lhs, GateType* rhs) { return lhs->get_id() < rhs->get_id(); });
+
+            writer.write<u32>(gate_types.size());
+            for (const GateType* gt : gate_types)
+            {
+                write_gate_type(writer, gate_lib, gt);
+            }
+
+            // write to a temporary file first so that concurrent readers never observe a partially written cache file
+            const std::filesystem::path cache_file = get_cache_file(file_path);
+            std::filesystem::path tmp_file         = cache_file;
+            tmp_file += ".tmp";
+
+            std::error_code ec;
+            std::filesystem::create_directories(cache_file.parent_path(), ec);
+            {
+                std::ofstream ofs(tmp_file, std::ios::binary | std::ios::trunc);
+                if (!ofs.is_open())
+                {
+                    return ERR("could not write gate library cache for '" + gate_lib->get_name() + "': unable to open file '" + tmp_file.string() + "'");
+                }
+                ofs.write(writer.get_data().data(), writer.get_data().size());
+                if (!ofs.good())
+                {
+                    return ERR("could not write gate library cache for '" + gate_lib->get_name() + "': unable to write file '" + tmp_file.string() + "'");
+                }
+            }
+
+            std::filesystem::rename(tmp_file, cache_file, ec);
+            if (ec)
+            {
+                std::filesystem::remove(tmp_file, ec);
+                return ERR("could not write gate library cache for '" + gate_lib->get_name() + "': unable to move file to '" + cache_file.string() + "'");
+            }
+
+            return OK({});
+        }
+
+        Result<std::unique_ptr<GateLibrary>> read(const std::filesystem::path& file_path)
+        {
+            MemoryMappedFile file;
+            if (auto res = file.open(get_cache_file(file_path)); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not read gate library cache for '" + file_path.string() + "': unable to open cache file");
+            }
+
+            try
+            {
+                CacheReader reader(file.get_data());
+                auto name = read_header(reader, file_path);
+                if (name.is_error())
+                {
+                    return ERR_APPEND(name.get_error(), "could not read gate library cache for '" + file_path.string() + "'");
+                }
+
+                auto gate_lib = std::make_unique<GateLibrary>(file_path, name.get());
+
+                std::string category     = reader.read_string();
+                std::string x_identifier = reader.read_string();
+                std::string y_identifier = reader.read_string();
+                gate_lib->set_gate_location_data_category(category);
+                gate_lib->set_gate_location_data_identifiers(x_identifier, y_identifier);
+
+                const u32 num_includes = reader.read<u32>();
+                for (u32 i = 0; i < num_includes; i++)
+                {
+                    gate_lib->add_include(reader.read_string());
+                }
+
+                const u32 num_gate_types = reader.read<u32>();
+                for (u32 i = 0; i < num_gate_types; i++)
+                {
+                    if (auto res = read_gate_type(reader, gate_lib.get()); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not read gate library cache for '" + file_path.string() + "'");
+                    }
+                }
+
+                return OK(std::move(gate_lib));
+            }
+            catch (const std::runtime_error& e)
+            {
+                return ERR("could not read gate library cache for '" + file_path.string() + "': cache file is corrupted (" + e.what() + ")");
+            }
+        }
+
+        Result<std::string> read_name(const std::filesystem::path& file_path)
+        {
+            MemoryMappedFile file;
+            if (auto res = file.open(get_cache_file(file_path)); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not read gate library cache for '" + file_path.string() + "': unable to open cache file");
+            }
+
+            try
+            {
+                CacheReader reader(file.get_data());
+                if (auto name = read_header(reader, file_path); name.is_error())
+                {
+                    return ERR_APPEND(name.get_error(), "could not read gate library cache for '" + file_path.string() + "'");
+                }
+                else
+                {
+                    return name;
+                }
+            }
+            catch (const std::runtime_error& e)
+            {
+                return ERR("could not read gate library cache for '" + file_path.string() + "': cache file is corrupted (" + e.what() + ")");
+            }
+        }
+    }    // namespace gate_library_cache
+}    // namespace hal
@@ -1,6 +1,7 @@
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
 
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
 #include "hal_core/netlist/gate_library/gate_library_parser/gate_library_parser_manager.h"
 #include "hal_core/netlist/gate_library/gate_library_writer/gate_library_writer_manager.h"
 #include "hal_core/utilities/log.h"
@@ -16,6 +17,9 @@ namespace hal
         {
             std::map<std::filesystem::path, std::unique_ptr<GateLibrary>> m_gate_libraries;
 
+            // gate library files found by load_all that have not been loaded yet
+            std::set<std::filesystem::path> m_registered_libraries;
+
             Result<std::monostate> prepare_library(const std::unique_ptr<GateLibrary>& lib)
             {
                 auto gate_types = lib->get_gate_types();
@@ -70,6 +74,16 @@ namespace hal
 
                 return OK({});
             }
+
+            void load_registered_libraries()
+            {
+                // load() removes the files from the set of registered libraries
+                const std::vector<std::filesystem::path> registered(m_registered_libraries.begin(), m_registered_libraries.end());
+                for (const auto& file_path : registered)
+                {
+                    load(file_path);
+                }
+            }
         }    // namespace
 
         GateLibrary* load(std::filesystem::path file_path, bool reload)
@@ -94,10 +108,31 @@ namespace hal
                 }
             }
 
-            std::unique_ptr<GateLibrary> gate_lib = gate_library_parser_manager::parse(file_path);
+            m_registered_libraries.erase(file_path);
+
+            // a reload always parses the gate library file to also refresh the cache
+            std::unique_ptr<GateLibrary> gate_lib = nullptr;
+            bool from_cache                       = false;
+            if (!reload)
+            {
+                if (auto res = gate_library_cache::read(file_path); res.is_ok())
+                {
+                    gate_lib   = res.get();
+                    from_cache = true;
+                }
+                else
+                {
+                    log_debug("gate_library_manager", "could not load gate library file '{}' from cache:\n{}", file_path.string(), res.get_error().get());
+                }
+            }
+
             if (gate_lib == nullptr)
             {
-                return nullptr;
+                gate_lib = gate_library_parser_manager::parse(file_path);
+                if (gate_lib == nullptr)
+                {
+                    return nullptr;
+                }
             }
 
             if (auto res = prepare_library(gate_lib); res.is_error())
@@ -106,6 +141,14 @@ namespace hal
                 return nullptr;
             }
 
+            if (!from_cache)
+            {
+                if (auto res = gate_library_cache::write(gate_lib.get()); res.is_error())
+                {
+                    log_warning("gate_library_manager", "could not cache gate library file '{}':\n{}", file_path.string(), res.get_error().get());
+                }
+            }
+
             GateLibrary* res                     = gate_lib.get();
             m_gate_libraries[file_path.string()] = std::move(gate_lib);
             return res;
@@ -122,11 +165,26 @@ namespace hal
                     continue;
                 }
 
-                log_info("gate_library_manager", "loading all gate library files from {}.", lib_dir.string());
+                if (reload)
+                {
+                    log_info("gate_library_manager", "loading all gate library files from {}.", lib_dir.string());
+                }
+                else
+                {
+                    log_info("gate_library_manager", "registering all gate library files from {}.", lib_dir.string());
+                }
 
                 for (const auto& lib_path : utils::RecursiveDirectoryRange(lib_dir))
                 {
-                    load(lib_path.path(), reload);
+                    if (reload)
+                    {
+                        load(lib_path.path(), true);
+                    }
+                    else if (const std::filesystem::path file_path = std::filesystem::absolute(lib_path.path()); m_gate_libraries.find(file_path) == m_gate_libraries.end())
+                    {
+                        // loading is deferred until the library is requested
+                        m_registered_libraries.insert(file_path);
+                    }
                 }
             }
         }
@@ -169,6 +227,7 @@ namespace hal
         void remove(std::filesystem::path file_path)
         {
             m_gate_libraries.erase(file_path);
+            m_registered_libraries.erase(file_path);
         }
 
         GateLibrary* get_gate_library(const std::string& file_path)
@@ -214,11 +273,40 @@ namespace hal
                     return it.second.get();
                 }
             }
+
+            // registered libraries with a valid cache file are identified by the name stored in the cache, all others have to be loaded to learn their name
+            std::vector<std::filesystem::path> uncached;
+            const std::vector<std::filesystem::path> registered(m_registered_libraries.begin(), m_registered_libraries.end());
+            for (const auto& file_path : registered)
+            {
+                if (auto res = gate_library_cache::read_name(file_path); res.is_error())
+                {
+                    uncached.push_back(file_path);
+                }
+                else if (res.get() == lib_name)
+                {
+                    if (GateLibrary* gate_lib = load(file_path); gate_lib != nullptr)
+                    {
+                        return gate_lib;
+                    }
+                }
+            }
+
+            for (const auto& file_path : uncached)
+            {
+                if (GateLibrary* gate_lib = load(file_path); gate_lib != nullptr && gate_lib->get_name() == lib_name)
+                {
+                    return gate_lib;
+                }
+            }
+
             return nullptr;
         }
 
         std::vector<GateLibrary*> get_gate_libraries()
         {
+            load_registered_libraries();
+
             std::vector<GateLibrary*> res;
             res.reserve(m_gate_libraries.size());
             for (const auto& it : m_gate_libraries)
@@ -5,8 +5,12 @@
 namespace hal
 {
     GateType::GateType(GateLibrary* gate_library, u32 id, const std::string& name, std::set<GateTypeProperty> properties, std::unique_ptr<GateTypeComponent> component)
-        : m_gate_library(gate_library), m_id(id), m_name(name), m_properties(properties), m_component(std::move(component))
+        : m_gate_library(gate_library), m_id(id), m_name(name), m_component(std::move(component))
     {
+        for (const GateTypeProperty property : properties)
+        {
+            m_properties.set(static_cast<u32>(property));
+        }
         m_next_pin_id       = 1;
         m_next_pin_group_id = 1;
     }
@@ -63,17 +67,25 @@ namespace hal
 
     void GateType::assign_property(const GateTypeProperty property)
     {
-        m_properties.insert(property);
+        m_properties.set(static_cast<u32>(property));
     }
 
     std::set<GateTypeProperty> GateType::get_properties() const
     {
-        return m_properties;
+        std::set<GateTypeProperty> res;
+        for (u32 i = 0; i < NUM_GATE_TYPE_PROPERTIES; i++)
+        {
+            if (m_properties.test(i))
+            {
+                res.insert(static_cast<GateTypeProperty>(i));
+            }
+        }
+        return res;
     }
 
     bool GateType::has_property(GateTypeProperty property) const
     {
-        return m_properties.find(property) != m_properties.end();
+        return m_properties.test(static_cast<u32>(property));
     }
 
     GateLibrary* GateType::get_gate_library() const
@@ -150,9 +162,10 @@ namespace hal
             return ERR("could not create pin '" + name + "' for gate type '" + m_name + "' with " + std::to_string(m_id) + ": direction '" + enum_to_string(direction) + "' is invalid");
         }
 
-        // create pin
+        // create pin, pins are never removed from a gate type so their position is a dense index
         std::unique_ptr<GatePin> pin_owner(new GatePin(id, name, direction, type));
         GatePin* pin = pin_owner.get();
+        pin->m_index = m_pins.size();
         m_pins.push_back(std::move(pin_owner));
         m_pins_map[id]        = pin;
         m_pin_names_map[name] = pin;
@@ -288,6 +301,22 @@ namespace hal
         return nullptr;
     }
 
+    u32 GateType::get_pin_count() const
+    {
+        return m_pins.size();
+    }
+
+    GatePin* GateType::get_pin_by_index(const u32 index) const
+    {
+        if (index >= m_pins.size())
+        {
+            log_warning("gate_library", "could not get pin by index for gate type '{}' with ID {}: index {} is out of range", m_name, std::to_string(m_id), index);
+            return nullptr;
+        }
+
+        return m_pins[index].get();
+    }
+
     GatePin* GateType::get_pin_by_name(const std::string& name) const
     {
         if (name.empty())
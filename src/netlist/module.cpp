@@ -11,15 +11,13 @@
 namespace hal
 {
     Module::Module(NetlistInternalManager* internal_manager, EventHandler* event_handler, u32 id, Module* parent, const std::string& name)
+        : DataContainer(&internal_manager->m_symbol_table)
     {
         m_internal_manager = internal_manager;
         m_id               = id;
         m_parent           = parent;
         m_name             = name;
 
-        m_next_pin_id       = 1;
-        m_next_pin_group_id = 1;
-
         m_event_handler = event_handler;
     }
 
@@ -119,6 +117,11 @@ namespace hal
         }
     }
 
+    void Module::notify_data_changed()
+    {
+        m_event_handler->notify(ModuleEvent::event::data_changed, this);
+    }
+
     Grouping* Module::get_grouping() const
     {
         return m_grouping;
@@ -199,6 +202,14 @@ namespace hal
             new_parent->set_parent_module(m_parent);
         }
 
+        // move the endpoint counts of the entire subtree from the old to the new ancestors
+        const Module* common_ancestor = m_parent->get_common_ancestor(new_parent);
+        for (const auto& [net, counts] : m_net_endpoint_counts)
+        {
+            m_parent->update_net_endpoint_counts(net, -static_cast<i32>(counts.first), -static_cast<i32>(counts.second), common_ancestor);
+            new_parent->update_net_endpoint_counts(net, counts.first, counts.second, common_ancestor);
+        }
+
         m_parent->m_submodules_map.erase(m_id);
         m_parent->m_submodules.erase(std::find(m_parent->m_submodules.begin(), m_parent->m_submodules.end(), this));
 
@@ -355,18 +366,18 @@ namespace hal
         {
             return false;
         }
-        bool success = std::find(m_gates.begin(), m_gates.end(), gate) != m_gates.end();
-        if (!success && recursive)
+        if (!recursive)
         {
-            for (auto sm : m_submodules)
+            return gate->m_module == this;
+        }
+        for (const Module* m = gate->m_module; m != nullptr; m = m->m_parent)
+        {
+            if (m == this)
             {
-                if (sm->contains_gate(gate, true))
-                {
-                    return true;
-                }
+                return true;
             }
         }
-        return success;
+        return false;
     }
 
     Gate* Module::get_gate_by_id(const u32 gate_id, bool recursive) const
@@ -435,20 +446,7 @@ namespace hal
         m_output_nets.clear();
         m_internal_nets.clear();
 
-        std::unordered_set<Net*> net_cache;
-        for (const Gate* gate : get_gates(nullptr, true))
-        {
-            for (Net* net : gate->get_fan_in_nets())
-            {
-                net_cache.insert(net);
-            }
-            for (Net* net : gate->get_fan_out_nets())
-            {
-                net_cache.insert(net);
-            }
-        }
-
-        for (Net* net : net_cache)
+        for (const auto& [net, _] : m_net_endpoint_counts)
         {
             NetConnectivity con = check_net_endpoints(net);
             if (con.has_internal_source || con.has_internal_destination)
@@ -574,52 +572,71 @@ namespace hal
         return m_internal_nets.find(net) != m_internal_nets.end();
     }
 
-    Module::NetConnectivity Module::check_net_endpoints(const Net* net) const
+    Module::NetConnectivity Module::check_net_endpoints(Net* net) const
     {
-        std::vector<Endpoint*> sources      = net->get_sources();
-        std::vector<Endpoint*> destinations = net->get_destinations();
+        u32 num_internal_sources      = 0;
+        u32 num_internal_destinations = 0;
+        if (const auto it = m_net_endpoint_counts.find(net); it != m_net_endpoint_counts.end())
+        {
+            std::tie(num_internal_sources, num_internal_destinations) = it->second;
+        }
 
         NetConnectivity res;
-        res.has_external_source      = net->is_global_input_net();
-        res.has_internal_source      = false;
-        res.has_external_destination = net->is_global_output_net();
-        res.has_internal_destination = false;
+        res.has_internal_source      = num_internal_sources > 0;
+        res.has_internal_destination = num_internal_destinations > 0;
+        res.has_external_source      = num_internal_sources < net->get_num_of_sources() || net->is_global_input_net();
+        res.has_external_destination = num_internal_destinations < net->get_num_of_destinations() || net->is_global_output_net();
 
-        for (Endpoint* ep : sources)
-        {
-            if (Module* mod = ep->get_gate()->get_module(); this != mod && !is_parent_module_of(mod, true))
-            {
-                res.has_external_source = true;
-            }
-            else
-            {
-                res.has_internal_source = true;
-            }
+        return res;
+    }
 
-            if (res.has_external_source && res.has_internal_source)
-            {
-                break;
-            }
-        }
+    void Module::insert_gate_internal(Gate* gate)
+    {
+        m_gates_map[gate->get_id()] = gate;
+        gate->m_module_index        = m_gates.size();
+        m_gates.push_back(gate);
+    }
+
+    void Module::erase_gate_internal(Gate* gate)
+    {
+        m_gates_map.erase(gate->get_id());
+
+        // swap with the last gate to remove in constant time
+        Gate* last                    = m_gates.back();
+        m_gates[gate->m_module_index] = last;
+        last->m_module_index          = gate->m_module_index;
+        m_gates.pop_back();
+    }
 
-        for (Endpoint* ep : destinations)
+    void Module::update_net_endpoint_counts(Net* net, i32 num_sources, i32 num_destinations, const Module* stop)
+    {
+        for (Module* m = this; m != stop; m = m->m_parent)
         {
-            if (Module* mod = ep->get_gate()->get_module(); this != mod && !is_parent_module_of(mod, true))
-            {
-                res.has_external_destination = true;
-            }
-            else
+            auto& [sources, destinations] = m->m_net_endpoint_counts[net];
+            sources += num_sources;
+            destinations += num_destinations;
+            if (sources == 0 && destinations == 0)
             {
-                res.has_internal_destination = true;
+                m->m_net_endpoint_counts.erase(net);
             }
+        }
+    }
 
-            if (res.has_external_destination && res.has_internal_destination)
+    const Module* Module::get_common_ancestor(const Module* other) const
+    {
+        std::unordered_set<const Module*> ancestors;
+        for (const Module* m = this; m != nullptr; m = m->m_parent)
+        {
+            ancestors.insert(m);
+        }
+        for (const Module* m = other; m != nullptr; m = m->m_parent)
+        {
+            if (ancestors.find(m) != ancestors.end())
             {
-                break;
+                return m;
             }
         }
-
-        return res;
+        return nullptr;
     }
 
     Result<std::monostate> Module::check_net(Net* net, bool recursive)
@@ -752,28 +769,12 @@ namespace hal
 
     u32 Module::get_unique_pin_id()
     {
-        if (!m_free_pin_ids.empty())
-        {
-            return *(m_free_pin_ids.begin());
-        }
-        while (m_used_pin_ids.find(m_next_pin_id) != m_used_pin_ids.end())
-        {
-            m_next_pin_id++;
-        }
-        return m_next_pin_id;
+        return m_pin_ids.get_unique_id();
     }
 
     u32 Module::get_unique_pin_group_id()
     {
-        if (!m_free_pin_group_ids.empty())
-        {
-            return *(m_free_pin_group_ids.begin());
-        }
-        while (m_used_pin_group_ids.find(m_next_pin_group_id) != m_used_pin_group_ids.end())
-        {
-            m_next_pin_group_id++;
-        }
-        return m_next_pin_group_id;
+        return m_pin_group_ids.get_unique_id();
     }
 
     Result<ModulePin*> Module::create_pin(const u32 id, const std::string& name, Net* net, PinType type, bool create_group)
@@ -1535,7 +1536,7 @@ namespace hal
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_ids.find(id) != m_used_pin_ids.end())
+        if (m_pin_ids.is_used(id))
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1560,11 +1561,7 @@ namespace hal
         m_pin_names_map[name] = pin;
 
         // mark pin ID as used
-        if (auto free_id_it = m_free_pin_ids.find(id); free_id_it != m_free_pin_ids.end())
-        {
-            m_free_pin_ids.erase(free_id_it);
-        }
-        m_used_pin_ids.insert(id);
+        m_pin_ids.acquire(id);
 
         return OK(pin);
     }
@@ -1590,8 +1587,7 @@ namespace hal
         m_pins.erase(std::find_if(m_pins.begin(), m_pins.end(), [pin](const auto& p) { return p.get() == pin; }));
 
         // free pin ID
-        m_free_pin_ids.insert(del_id);
-        m_used_pin_ids.erase(del_id);
+        m_pin_ids.release(del_id);
 
         return OK({});
     }
@@ -1603,7 +1599,7 @@ namespace hal
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_group_ids.find(id) != m_used_pin_group_ids.end())
+        if (m_pin_group_ids.is_used(id))
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1621,11 +1617,7 @@ namespace hal
         m_pin_group_names_map[name] = pin_group;
 
         // mark pin group ID as used
-        if (auto free_id_it = m_free_pin_group_ids.find(id); free_id_it != m_free_pin_group_ids.end())
-        {
-            m_free_pin_group_ids.erase(free_id_it);
-        }
-        m_used_pin_group_ids.insert(id);
+        m_pin_group_ids.acquire(id);
 
         return OK(pin_group);
     }
@@ -1652,8 +1644,7 @@ namespace hal
         m_pin_groups.erase(std::find_if(m_pin_groups.begin(), m_pin_groups.end(), [pin_group](const auto& pg) { return pg.get() == pin_group; }));
 
         // free pin group ID
-        m_free_pin_group_ids.insert(del_id);
-        m_used_pin_group_ids.erase(del_id);
+        m_pin_group_ids.release(del_id);
 
         return OK({});
     }
@@ -13,7 +13,7 @@
 
 namespace hal
 {
-    Net::Net(NetlistInternalManager* internal_manager, EventHandler* event_handler, const u32 id, const std::string& name)
+    Net::Net(NetlistInternalManager* internal_manager, EventHandler* event_handler, const u32 id, const std::string& name) : DataContainer(&internal_manager->m_symbol_table)
     {
         assert(internal_manager != nullptr);
         m_internal_manager = internal_manager;
@@ -37,7 +37,7 @@ namespace hal
             return false;
         }
 
-        if (m_sources.size() != other.get_num_of_sources() || m_destinations.size() != other.get_num_of_destinations())
+        if (m_sources_raw.size() != other.get_num_of_sources() || m_destinations_raw.size() != other.get_num_of_destinations())
         {
             log_info("net", "the nets with IDs {} and {} are not equal due to an unequal number of sources or destinations.", m_id, other.get_id());
             return false;
@@ -117,6 +117,11 @@ namespace hal
         }
     }
 
+    void Net::notify_data_changed()
+    {
+        m_event_handler->notify(NetEvent::event::data_changed, this);
+    }
+
     Grouping* Net::get_grouping() const
     {
         return m_grouping;
@@ -383,17 +388,17 @@ namespace hal
 
     bool Net::is_unrouted() const
     {
-        return ((m_sources.size() == 0) || (m_destinations.size() == 0));
+        return ((m_sources_raw.size() == 0) || (m_destinations_raw.size() == 0));
     }
 
     bool Net::is_gnd_net() const
     {
-        return m_sources.size() == 1 && m_sources.front()->get_gate()->is_gnd_gate();
+        return m_sources_raw.size() == 1 && m_sources_raw.front()->get_gate()->is_gnd_gate();
     }
 
     bool Net::is_vcc_net() const
     {
-        return m_sources.size() == 1 && m_sources.front()->get_gate()->is_vcc_gate();
+        return m_sources_raw.size() == 1 && m_sources_raw.front()->get_gate()->is_vcc_gate();
     }
 
     bool Net::mark_global_input_net()
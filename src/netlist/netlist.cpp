@@ -12,15 +12,11 @@ namespace hal
 {
     Netlist::Netlist(const GateLibrary* library) : m_gate_library(library)
     {
-        m_event_handler    = std::make_unique<EventHandler>();
-        m_manager          = new NetlistInternalManager(this, m_event_handler.get());
-        m_netlist_id       = 1;
-        m_next_gate_id     = 1;
-        m_next_net_id      = 1;
-        m_next_module_id   = 1;
-        m_next_grouping_id = 1;
-        m_top_module       = nullptr;    // this triggers the internal manager to allow creation of a module without parent
-        m_top_module       = create_module("top_module", nullptr);
+        m_event_handler = std::make_unique<EventHandler>();
+        m_manager       = new NetlistInternalManager(this, m_event_handler.get());
+        m_netlist_id    = 1;
+        m_top_module    = nullptr;    // this triggers the internal manager to allow creation of a module without parent
+        m_top_module    = create_module("top_module", nullptr);
     }
 
     Netlist::~Netlist()
@@ -50,7 +46,7 @@ namespace hal
 
         for (const Net* net : other.get_nets())
         {
-            if (const auto it = m_nets_map.find(net->get_id()); it == m_nets_map.end() || *it->second != *net)
+            if (const Net* own_net = m_nets_map.get(net->get_id()); own_net == nullptr || *own_net != *net)
             {
                 log_info("netlist", "the netlists with IDs {} and {} are not equal due to unequal nets.", m_netlist_id, other.get_id());
                 return false;
@@ -151,6 +147,11 @@ namespace hal
         }
     }
 
+    void Netlist::reserve(u32 num_gates, u32 num_nets, u32 num_modules)
+    {
+        m_manager->reserve(num_gates, num_nets, num_modules);
+    }
+
     /*
      * ################################################################
      *      gate functions
@@ -159,15 +160,7 @@ namespace hal
 
     u32 Netlist::get_unique_gate_id()
     {
-        if (!m_free_gate_ids.empty())
-        {
-            return *(m_free_gate_ids.begin());
-        }
-        while (m_used_gate_ids.find(m_next_gate_id) != m_used_gate_ids.end())
-        {
-            m_next_gate_id++;
-        }
-        return m_next_gate_id;
+        return m_gate_ids.get_unique_id();
     }
 
     Gate* Netlist::create_gate(const u32 id, GateType* gt, const std::string& name, i32 x, i32 y)
@@ -192,9 +185,9 @@ namespace hal
 
     Gate* Netlist::get_gate_by_id(const u32 gate_id) const
     {
-        if (auto it = m_gates_map.find(gate_id); it != m_gates_map.end())
+        if (Gate* gate = m_gates_map.get(gate_id); gate != nullptr)
         {
-            return it->second.get();
+            return gate;
         }
 
         log_error("netlist", "there is no gate with ID {} in the netlist with ID {}.", gate_id, m_netlist_id);
@@ -319,15 +312,7 @@ namespace hal
 
     u32 Netlist::get_unique_net_id()
     {
-        if (!m_free_net_ids.empty())
-        {
-            return *(m_free_net_ids.begin());
-        }
-        while (m_used_net_ids.find(m_next_net_id) != m_used_net_ids.end())
-        {
-            m_next_net_id++;
-        }
-        return m_next_net_id;
+        return m_net_ids.get_unique_id();
     }
 
     Net* Netlist::create_net(const u32 id, const std::string& name)
@@ -352,13 +337,13 @@ namespace hal
 
     Net* Netlist::get_net_by_id(u32 net_id) const
     {
-        auto it = m_nets_map.find(net_id);
-        if (it == m_nets_map.end())
+        Net* net = m_nets_map.get(net_id);
+        if (net == nullptr)
         {
             log_error("netlist", "there is no net with ID {} in the netlist with ID {}.", net_id, m_netlist_id);
             return nullptr;
         }
-        return it->second.get();
+        return net;
     }
 
     const std::vector<Net*>& Netlist::get_nets() const
@@ -539,15 +524,7 @@ namespace hal
 
     u32 Netlist::get_unique_module_id()
     {
-        if (!m_free_module_ids.empty())
-        {
-            return *(m_free_module_ids.begin());
-        }
-        while (m_used_module_ids.find(m_next_module_id) != m_used_module_ids.end())
-        {
-            m_next_module_id++;
-        }
-        return m_next_module_id;
+        return m_module_ids.get_unique_id();
     }
 
     Module* Netlist::create_module(const u32 id, const std::string& name, Module* parent, const std::vector<Gate*>& gates)
@@ -578,13 +555,13 @@ namespace hal
 
     Module* Netlist::get_module_by_id(u32 id) const
     {
-        auto it = m_modules_map.find(id);
-        if (it == m_modules_map.end())
+        Module* module = m_modules_map.get(id);
+        if (module == nullptr)
         {
             log_error("netlist", "there is no module with ID {} in the netlist with ID {}.", id, m_netlist_id);
             return nullptr;
         }
-        return it->second.get();
+        return module;
     }
 
     const std::vector<Module*>& Netlist::get_modules() const
@@ -623,15 +600,7 @@ namespace hal
 
     u32 Netlist::get_unique_grouping_id()
     {
-        if (!m_free_grouping_ids.empty())
-        {
-            return *(m_free_grouping_ids.begin());
-        }
-        while (m_used_grouping_ids.find(m_next_grouping_id) != m_used_grouping_ids.end())
-        {
-            m_next_grouping_id++;
-        }
-        return m_next_grouping_id;
+        return m_grouping_ids.get_unique_id();
     }
 
     Grouping* Netlist::create_grouping(const u32 id, const std::string& name)
@@ -656,13 +625,13 @@ namespace hal
 
     Grouping* Netlist::get_grouping_by_id(u32 grouping_id) const
     {
-        auto it = m_groupings_map.find(grouping_id);
-        if (it == m_groupings_map.end())
+        Grouping* grouping = m_groupings_map.get(grouping_id).get();
+        if (grouping == nullptr)
         {
             log_error("netlist", "there is no grouping with ID {} in the netlist with ID {}.", grouping_id, m_netlist_id);
             return nullptr;
         }
-        return it->second.get();
+        return grouping;
     }
 
     std::vector<Grouping*> Netlist::get_groupings(const std::function<bool(Grouping*)>& filter) const
@@ -691,122 +660,122 @@ namespace hal
 
     u32 Netlist::get_next_gate_id() const
     {
-        return m_next_gate_id;
+        return m_gate_ids.get_next_id();
     }
 
     void Netlist::set_next_gate_id(const u32 id)
     {
-        m_next_gate_id = id;
+        m_gate_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_gate_ids() const
     {
-        return m_used_gate_ids;
+        return m_gate_ids.get_used_ids();
     }
 
     void Netlist::set_used_gate_ids(const std::set<u32> ids)
     {
-        m_used_gate_ids = ids;
+        m_gate_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_gate_ids() const
     {
-        return m_free_gate_ids;
+        return m_gate_ids.get_free_ids();
     }
 
     void Netlist::set_free_gate_ids(const std::set<u32> ids)
     {
-        m_free_gate_ids = ids;
+        m_gate_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_net_id() const
     {
-        return m_next_net_id;
+        return m_net_ids.get_next_id();
     }
 
     void Netlist::set_next_net_id(const u32 id)
     {
-        m_next_net_id = id;
+        m_net_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_net_ids() const
     {
-        return m_used_net_ids;
+        return m_net_ids.get_used_ids();
     }
 
     void Netlist::set_used_net_ids(const std::set<u32> ids)
     {
-        m_used_net_ids = ids;
+        m_net_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_net_ids() const
     {
-        return m_free_net_ids;
+        return m_net_ids.get_free_ids();
     }
 
     void Netlist::set_free_net_ids(const std::set<u32> ids)
     {
-        m_free_net_ids = ids;
+        m_net_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_module_id() const
     {
-        return m_next_module_id;
+        return m_module_ids.get_next_id();
     }
 
     void Netlist::set_next_module_id(const u32 id)
     {
-        m_next_module_id = id;
+        m_module_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_module_ids() const
     {
-        return m_used_module_ids;
+        return m_module_ids.get_used_ids();
     }
 
     void Netlist::set_used_module_ids(const std::set<u32> ids)
     {
-        m_used_module_ids = ids;
+        m_module_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_module_ids() const
     {
-        return m_free_module_ids;
+        return m_module_ids.get_free_ids();
     }
 
     void Netlist::set_free_module_ids(const std::set<u32> ids)
     {
-        m_free_module_ids = ids;
+        m_module_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_grouping_id() const
     {
-        return m_next_grouping_id;
+        return m_grouping_ids.get_next_id();
     }
 
     void Netlist::set_next_grouping_id(const u32 id)
     {
-        m_next_grouping_id = id;
+        m_grouping_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_grouping_ids() const
     {
-        return m_used_grouping_ids;
+        return m_grouping_ids.get_used_ids();
     }
 
     void Netlist::set_used_grouping_ids(const std::set<u32> ids)
     {
-        m_used_grouping_ids = ids;
+        m_grouping_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_grouping_ids() const
     {
-        return m_free_grouping_ids;
+        return m_grouping_ids.get_free_ids();
     }
 
     void Netlist::set_free_grouping_ids(const std::set<u32> ids)
     {
-        m_free_grouping_ids = ids;
+        m_grouping_ids.set_free_ids(ids);
     }
 
     /*
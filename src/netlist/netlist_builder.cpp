@@ -0,0 +1,535 @@
+#include "hal_core/netlist/netlist_builder.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_internal_manager.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <unordered_map>
+
+namespace hal
+{
+    NetlistBuilder::NetlistBuilder(Netlist* netlist) : m_netlist(netlist)
+    {
+        assert(netlist != nullptr);
+
+        m_net_checks_enabled                       = m_netlist->m_manager->m_net_checks_enabled;
+        m_netlist->m_manager->m_net_checks_enabled = false;
+    }
+
+    NetlistBuilder::~NetlistBuilder()
+    {
+        if (m_open)
+        {
+            if (auto res = commit(); res.is_error())
+            {
+                log_error("netlist", "{}", res.get_error().get());
+            }
+        }
+    }
+
+    Netlist* NetlistBuilder::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    bool NetlistBuilder::is_open() const
+    {
+        return m_open;
+    }
+
+    Gate* NetlistBuilder::create_gate(const u32 gate_id, GateType* gate_type, const std::string& name, i32 x, i32 y)
+    {
+        if (!m_open)
+        {
+            log_error("gate", "could not create gate '{}': transaction has already been committed.", name);
+            return nullptr;
+        }
+        if (gate_id == 0)
+        {
+            log_error("gate", "ID 0 represents an invalid gate ID.");
+            return nullptr;
+        }
+        if (m_netlist->m_gate_ids.is_used(gate_id))
+        {
+            log_error("gate", "gate ID {} is already taken in netlist with ID {}.", gate_id, m_netlist->m_netlist_id);
+            return nullptr;
+        }
+        if (gate_type == nullptr)
+        {
+            log_error("gate", "nullptr given for gate type.");
+            return nullptr;
+        }
+        if (m_netlist->m_manager->is_gate_type_invalid(gate_type))
+        {
+            log_error("gate", "gate type '{}' with ID {} is invalid.", gate_type->get_name(), gate_type->get_id());
+            return nullptr;
+        }
+        if (utils::trim(name).empty())
+        {
+            log_error("gate", "gate name cannot be empty.");
+            return nullptr;
+        }
+
+        NetlistInternalManager* manager = m_netlist->m_manager;
+        Gate* gate                      = new (manager->m_gate_pool.allocate()) Gate(manager, manager->m_event_handler, gate_id, gate_type, name, x, y);
+
+        m_netlist->m_gate_ids.acquire(gate_id);
+
+        m_netlist->m_gates_map.insert(gate_id, gate);
+        m_netlist->m_gates_set.insert(gate);
+        m_netlist->m_gates.push_back(gate);
+
+        // add gate to top module
+        Module* top_module               = m_netlist->m_top_module;
+        gate->m_module = top_module;
+        top_module->insert_gate_internal(gate);
+
+        m_created_gates.push_back(gate);
+        m_created_gates_set.insert(gate);
+
+        return gate;
+    }
+
+    Gate* NetlistBuilder::create_gate(GateType* gate_type, const std::string& name, i32 x, i32 y)
+    {
+        return create_gate(m_netlist->get_unique_gate_id(), gate_type, name, x, y);
+    }
+
+    Net* NetlistBuilder::create_net(const u32 net_id, const std::string& name)
+    {
+        if (!m_open)
+        {
+            log_error("net", "could not create net '{}': transaction has already been committed.", name);
+            return nullptr;
+        }
+        if (net_id == 0)
+        {
+            log_error("net", "ID 0 represents an invalid net ID.");
+            return nullptr;
+        }
+        if (m_netlist->m_net_ids.is_used(net_id))
+        {
+            log_error("net", "net ID {} is already taken in netlist with ID {}.", net_id, m_netlist->m_netlist_id);
+            return nullptr;
+        }
+        if (utils::trim(name).empty())
+        {
+            log_error("net", "net name cannot be empty.");
+            return nullptr;
+        }
+
+        NetlistInternalManager* manager = m_netlist->m_manager;
+        Net* net                        = new (manager->m_net_pool.allocate()) Net(manager, manager->m_event_handler, net_id, name);
+
+        m_netlist->m_net_ids.acquire(net_id);
+
+        m_netlist->m_nets_map.insert(net_id, net);
+        m_netlist->m_nets_set.insert(net);
+        m_netlist->m_nets.push_back(net);
+
+        m_created_nets.push_back(net);
+        m_created_nets_set.insert(net);
+
+        return net;
+    }
+
+    Net* NetlistBuilder::create_net(const std::string& name)
+    {
+        return create_net(m_netlist->get_unique_net_id(), name);
+    }
+
+    Endpoint* NetlistBuilder::add_endpoint(Net* net, Gate* gate, GatePin* pin, bool is_destination)
+    {
+        const char* endpoint_kind = is_destination ? "destination" : "source";
+
+        if (!m_open)
+        {
+            log_error("net", "could not add {} to net: transaction has already been committed.", endpoint_kind);
+            return nullptr;
+        }
+        if (!m_netlist->is_net_in_netlist(net) || !m_netlist->is_gate_in_netlist(gate) || pin == nullptr)
+        {
+            log_error("net", "could not add {} to net: net, gate, or pin is invalid.", endpoint_kind);
+            return nullptr;
+        }
+
+        // check whether the pin is a valid pin of the gate
+        const GateType* gate_type    = gate->get_type();
+        const PinDirection direction = pin->get_direction();
+        const bool valid_direction   = is_destination ? (direction == PinDirection::input || direction == PinDirection::inout) : (direction == PinDirection::output || direction == PinDirection::inout);
+        if (!valid_direction || pin->get_index() >= gate_type->get_pin_count() || gate_type->get_pin_by_index(pin->get_index()) != pin)
+        {
+            log_error("net",
+                      "gate '{}' with ID {} has no {} pin called '{}' in netlist with ID {}.",
+                      gate->get_name(),
+                      gate->get_id(),
+                      is_destination ? "input" : "output",
+                      pin->get_name(),
+                      m_netlist->m_netlist_id);
+            return nullptr;
+        }
+
+        // check whether the pin is already connected, this also covers adding the same endpoint twice
+        if (const Endpoint* connected_ep = gate->get_pin_endpoint(pin, is_destination); connected_ep != nullptr)
+        {
+            log_error("net",
+                      "gate '{}' with ID {} is already connected to net '{}' with ID {} at pin '{}', cannot assign new net '{}' with ID {} in netlist with ID {}.",
+                      gate->get_name(),
+                      gate->get_id(),
+                      connected_ep->get_net()->get_name(),
+                      connected_ep->get_net()->get_id(),
+                      pin->get_name(),
+                      net->get_name(),
+                      net->get_id(),
+                      m_netlist->m_netlist_id);
+            return nullptr;
+        }
+
+        Endpoint* ep = new (m_netlist->m_manager->m_endpoint_pool.allocate()) Endpoint(gate, pin, net, is_destination);
+        gate->set_pin_endpoint(pin, is_destination, ep);
+        if (is_destination)
+        {
+            net->m_destinations_raw.push_back(ep);
+            gate->m_in_endpoints.push_back(ep);
+            gate->m_in_nets.push_back(net);
+        }
+        else
+        {
+            net->m_sources_raw.push_back(ep);
+            gate->m_out_endpoints.push_back(ep);
+            gate->m_out_nets.push_back(net);
+        }
+        gate->m_module->update_net_endpoint_counts(net, is_destination ? 0 : 1, is_destination ? 1 : 0);
+
+        m_touched_nets.insert(net);
+        if (m_created_nets_set.find(net) == m_created_nets_set.end())
+        {
+            m_added_endpoints.emplace_back(net, gate->get_id(), is_destination);
+        }
+
+        return ep;
+    }
+
+    Endpoint* NetlistBuilder::add_source(Net* net, Gate* gate, GatePin* pin)
+    {
+        return add_endpoint(net, gate, pin, false);
+    }
+
+    Endpoint* NetlistBuilder::add_source(Net* net, Gate* gate, const std::string& pin_name)
+    {
+        if (gate == nullptr)
+        {
+            log_warning("net", "could not add source to gate: nullptr given for gate");
+            return nullptr;
+        }
+        GatePin* pin = gate->get_type()->get_pin_by_name(pin_name);
+        if (pin == nullptr)
+        {
+            log_warning("net", "could not add source to gate '{}' with ID {}: no pin with name '{}' exists", gate->get_name(), gate->get_id(), pin_name);
+            return nullptr;
+        }
+        return add_endpoint(net, gate, pin, false);
+    }
+
+    Endpoint* NetlistBuilder::add_destination(Net* net, Gate* gate, GatePin* pin)
+    {
+        return add_endpoint(net, gate, pin, true);
+    }
+
+    Endpoint* NetlistBuilder::add_destination(Net* net, Gate* gate, const std::string& pin_name)
+    {
+        if (gate == nullptr)
+        {
+            log_warning("net", "could not add destination to gate: nullptr given for gate");
+            return nullptr;
+        }
+        GatePin* pin = gate->get_type()->get_pin_by_name(pin_name);
+        if (pin == nullptr)
+        {
+            log_warning("net", "could not add destination to gate '{}' with ID {}: no pin with name '{}' exists", gate->get_name(), gate->get_id(), pin_name);
+            return nullptr;
+        }
+        return add_endpoint(net, gate, pin, true);
+    }
+
+    Module* NetlistBuilder::create_module(const u32 module_id, const std::string& name, Module* parent, const std::vector<Gate*>& gates)
+    {
+        if (!m_open)
+        {
+            log_error("module", "could not create module '{}': transaction has already been committed.", name);
+            return nullptr;
+        }
+        if (module_id == 0)
+        {
+            log_error("module", "ID 0 represents an invalid module ID.");
+            return nullptr;
+        }
+        if (m_netlist->m_module_ids.is_used(module_id))
+        {
+            log_error("module", "module ID {} is already taken in netlist with ID {}.", module_id, m_netlist->m_netlist_id);
+            return nullptr;
+        }
+        if (utils::trim(name).empty())
+        {
+            log_error("module", "module name cannot be empty.");
+            return nullptr;
+        }
+        if (!m_netlist->is_module_in_netlist(parent))
+        {
+            log_error("module", "parent module must belong to netlist with ID {}.", m_netlist->m_netlist_id);
+            return nullptr;
+        }
+
+        NetlistInternalManager* manager = m_netlist->m_manager;
+        Module* module                  = new (manager->m_module_pool.allocate()) Module(manager, manager->m_event_handler, module_id, parent, name);
+
+        m_netlist->m_module_ids.acquire(module_id);
+
+        m_netlist->m_modules_map.insert(module_id, module);
+        m_netlist->m_modules_set.insert(module);
+        m_netlist->m_modules.push_back(module);
+
+        parent->m_submodules_map[module_id] = module;
+        parent->m_submodules.push_back(module);
+
+        m_created_modules.push_back(module);
+        m_created_modules_set.insert(module);
+
+        assign_gates(module, gates);
+
+        return module;
+    }
+
+    Module* NetlistBuilder::create_module(const std::string& name, Module* parent, const std::vector<Gate*>& gates)
+    {
+        return create_module(m_netlist->get_unique_module_id(), name, parent, gates);
+    }
+
+    bool NetlistBuilder::assign_gates(Module* module, const std::vector<Gate*>& gates)
+    {
+        if (!m_open)
+        {
+            log_error("module", "could not assign gates: transaction has already been committed.");
+            return false;
+        }
+        if (!m_netlist->is_module_in_netlist(module))
+        {
+            log_error("module", "module must belong to netlist with ID {}.", m_netlist->m_netlist_id);
+            return false;
+        }
+
+        for (Gate* gate : gates)
+        {
+            if (!m_netlist->is_gate_in_netlist(gate))
+            {
+                log_error("module", "gate must belong to netlist with ID {}.", m_netlist->m_netlist_id);
+                return false;
+            }
+
+            Module* previous_module = gate->m_module;
+            if (previous_module == module)
+            {
+                continue;
+            }
+
+            previous_module->erase_gate_internal(gate);
+            module->insert_gate_internal(gate);
+            gate->m_module = module;
+
+            if (m_created_gates_set.find(gate) == m_created_gates_set.end())
+            {
+                m_moved_gates.emplace_back(gate, previous_module, module);
+            }
+
+            // only modules below the common ancestor of the previous and the new module see a change of the endpoints
+            const Module* common_ancestor = previous_module->get_common_ancestor(module);
+            for (Net* net : gate->m_in_nets)
+            {
+                previous_module->update_net_endpoint_counts(net, 0, -1, common_ancestor);
+                module->update_net_endpoint_counts(net, 0, 1, common_ancestor);
+            }
+            for (Net* net : gate->m_out_nets)
+            {
+                previous_module->update_net_endpoint_counts(net, -1, 0, common_ancestor);
+                module->update_net_endpoint_counts(net, 1, 0, common_ancestor);
+            }
+
+            // the nets of the gate are reclassified on commit, drop them from modules that may have lost them
+            for (const std::vector<Net*>* nets : {&gate->m_in_nets, &gate->m_out_nets})
+            {
+                for (Net* net : *nets)
+                {
+                    m_touched_nets.insert(net);
+                    for (Module* m = previous_module; m != common_ancestor; m = m->m_parent)
+                    {
+                        if (m->m_nets.erase(net) != 0)
+                        {
+                            m->m_input_nets.erase(net);
+                            m->m_output_nets.erase(net);
+                            m->m_internal_nets.erase(net);
+                            if (m_net_checks_enabled && !m->m_pins.empty())
+                            {
+                                m_pin_candidates.emplace_back(m, net);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    Result<std::monostate> NetlistBuilder::commit()
+    {
+        if (!m_open)
+        {
+            return ERR("could not commit netlist builder transaction for netlist with ID " + std::to_string(m_netlist->get_id()) + ": transaction has already been committed");
+        }
+        m_open                                     = false;
+        m_netlist->m_manager->m_net_checks_enabled = m_net_checks_enabled;
+
+        // (1) classify all touched nets for every module containing one of their endpoints in a single pass
+        const std::unordered_set<const Net*> global_inputs(m_netlist->m_global_input_nets.begin(), m_netlist->m_global_input_nets.end());
+        const std::unordered_set<const Net*> global_outputs(m_netlist->m_global_output_nets.begin(), m_netlist->m_global_output_nets.end());
+
+        std::unordered_set<Module*> affected_modules;
+        for (Net* net : m_touched_nets)
+        {
+            if (!m_netlist->is_net_in_netlist(net))
+            {
+                continue;
+            }
+
+            // once a module has been visited, so have all of its ancestors
+            affected_modules.clear();
+            for (const std::vector<Endpoint*>* endpoints : {&net->m_sources_raw, &net->m_destinations_raw})
+            {
+                for (const Endpoint* ep : *endpoints)
+                {
+                    Module* m = ep->get_gate()->m_module;
+                    while (m != nullptr && affected_modules.insert(m).second)
+                    {
+                        m = m->m_parent;
+                    }
+                }
+            }
+
+            const bool is_global_input  = global_inputs.find(net) != global_inputs.end();
+            const bool is_global_output = global_outputs.find(net) != global_outputs.end();
+            for (Module* module : affected_modules)
+            {
+                const auto& counts                  = module->m_net_endpoint_counts.at(net);
+                const bool has_internal_source      = counts.first > 0;
+                const bool has_internal_destination = counts.second > 0;
+                const bool has_external_source      = is_global_input || counts.first < net->m_sources_raw.size();
+                const bool has_external_destination = is_global_output || counts.second < net->m_destinations_raw.size();
+
+                module->m_nets.insert(net);
+                module->m_input_nets.erase(net);
+                module->m_output_nets.erase(net);
+                module->m_internal_nets.erase(net);
+
+                if (has_internal_source && has_internal_destination)
+                {
+                    module->m_internal_nets.insert(net);
+                }
+
+                if (has_internal_source && has_internal_destination && has_external_source && has_external_destination)
+                {
+                    module->m_input_nets.insert(net);
+                    module->m_output_nets.insert(net);
+                }
+                else if (has_external_source && has_internal_destination)
+                {
+                    module->m_input_nets.insert(net);
+                }
+                else if (has_internal_source && has_external_destination)
+                {
+                    module->m_output_nets.insert(net);
+                }
+
+                // (2) update module pins as the automatic net checks would have done
+                if (m_net_checks_enabled)
+                {
+                    const bool is_port = module->m_input_nets.find(net) != module->m_input_nets.end() || module->m_output_nets.find(net) != module->m_output_nets.end();
+                    if (is_port || (!module->m_pins.empty() && module->get_pin_by_net(net) != nullptr))
+                    {
+                        if (auto res = module->check_net(net, false); res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(), "could not commit netlist builder transaction for netlist with ID " + std::to_string(m_netlist->get_id()) + ": failed to update module pins");
+                        }
+                    }
+                }
+            }
+        }
+
+        for (const auto& [module, net] : m_pin_candidates)
+        {
+            if (!m_netlist->is_module_in_netlist(module) || !m_netlist->is_net_in_netlist(net) || module->m_nets.find(net) != module->m_nets.end())
+            {
+                continue;
+            }
+
+            if (module->get_pin_by_net(net) != nullptr)
+            {
+                if (auto res = module->check_net(net, false); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not commit netlist builder transaction for netlist with ID " + std::to_string(m_netlist->get_id()) + ": failed to remove module pins");
+                }
+            }
+        }
+
+        // (3) emit the events of the transaction
+        EventHandler* event_handler = m_netlist->m_event_handler.get();
+        for (Module* module : m_created_modules)
+        {
+            if (m_netlist->is_module_in_netlist(module))
+            {
+                event_handler->notify(ModuleEvent::event::created, module);
+                event_handler->notify(ModuleEvent::event::submodule_added, module->m_parent, module->get_id());
+            }
+        }
+        for (Net* net : m_created_nets)
+        {
+            if (m_netlist->is_net_in_netlist(net))
+            {
+                event_handler->notify(NetEvent::event::created, net);
+            }
+        }
+        for (Gate* gate : m_created_gates)
+        {
+            if (m_netlist->is_gate_in_netlist(gate))
+            {
+                event_handler->notify(ModuleEvent::event::gate_assigned, gate->m_module, gate->get_id());
+                event_handler->notify(GateEvent::event::created, gate);
+            }
+        }
+        for (const auto& [net, gate_id, is_destination] : m_added_endpoints)
+        {
+            if (m_netlist->is_net_in_netlist(net))
+            {
+                event_handler->notify(is_destination ? NetEvent::event::dst_added : NetEvent::event::src_added, net, gate_id);
+            }
+        }
+        for (const auto& [gate, previous_module, module] : m_moved_gates)
+        {
+            if (m_netlist->is_gate_in_netlist(gate) && m_netlist->is_module_in_netlist(previous_module) && m_netlist->is_module_in_netlist(module))
+            {
+                event_handler->notify(ModuleEvent::event::gate_removed, previous_module, gate->get_id());
+                event_handler->notify(ModuleEvent::event::gate_assigned, module, gate->get_id());
+            }
+        }
+
+        return OK({});
+    }
+}    // namespace hal
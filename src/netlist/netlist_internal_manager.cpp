@@ -21,10 +21,33 @@ namespace hal
         assert(eh != nullptr);
     }
 
+    NetlistInternalManager::~NetlistInternalManager()
+    {
+        // endpoints, gates, nets, and modules are destroyed together with their pools
+    }
+
     //######################################################################
     //###                      netlist                                   ###
     //######################################################################
 
+    void NetlistInternalManager::reserve(u32 num_gates, u32 num_nets, u32 num_modules)
+    {
+        m_gate_pool.reserve(num_gates);
+        m_net_pool.reserve(num_nets);
+        m_module_pool.reserve(num_modules);
+
+        // every gate pin is connected to at most one endpoint, assume two inputs and one output per gate on average
+        m_endpoint_pool.reserve(3 * static_cast<size_t>(num_gates));
+
+        // IDs are dense if the objects are created without explicit IDs
+        m_netlist->m_gate_ids.reserve(num_gates);
+        m_netlist->m_gates_map.reserve(num_gates);
+        m_netlist->m_net_ids.reserve(num_nets);
+        m_netlist->m_nets_map.reserve(num_nets);
+        m_netlist->m_module_ids.reserve(num_modules);
+        m_netlist->m_modules_map.reserve(num_modules);
+    }
+
     Result<std::unique_ptr<Netlist>> NetlistInternalManager::copy_netlist(const Netlist* nl) const
     {
         std::unique_ptr<Netlist> c_netlist = netlist_factory::create_netlist(nl->m_gate_library);
@@ -35,6 +58,14 @@ namespace hal
 
         c_netlist->enable_automatic_net_checks(false);
 
+        size_t num_endpoints = 0;
+        for (const Net* net : nl->m_nets)
+        {
+            num_endpoints += net->m_sources_raw.size() + net->m_destinations_raw.size();
+        }
+        c_netlist->m_manager->reserve(nl->m_gates.size(), nl->m_nets.size(), nl->m_modules.size());
+        c_netlist->m_manager->m_endpoint_pool.reserve(num_endpoints);
+
         // manager, netlist_id, and top_module are set in the constructor
 
         // copy design name, device name, input filename
@@ -50,7 +81,7 @@ namespace hal
             {
                 return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied net '" + net->m_name + "' with ID " + std::to_string(net->m_id));
             }
-            c_net->m_data = net->m_data;
+            c_net->copy_data(*net);
         }
 
         // copy gates
@@ -99,7 +130,7 @@ namespace hal
                 }
             }
 
-            c_gate->m_data = gate->m_data;
+            c_gate->copy_data(*gate);
         }
 
         // copy modules
@@ -108,7 +139,7 @@ namespace hal
             // ignore top module, since this is already created by the constructor
             if (module->m_id == 1)
             {
-                c_netlist->m_top_module->m_data = module->get_data_map();
+                c_netlist->m_top_module->copy_data(*module);
                 c_netlist->m_top_module->m_type = module->m_type;
                 continue;
             }
@@ -132,7 +163,7 @@ namespace hal
                 return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied module '" + module->m_name + "' with ID " + std::to_string(module->m_id));
             }
 
-            c_module->m_data = module->m_data;
+            c_module->copy_data(*module);
             c_module->m_type = module->m_type;
         }
 
@@ -214,21 +245,13 @@ namespace hal
         c_netlist->m_file_name   = nl->m_file_name;
 
         // update ids last, after all the creation
-        c_netlist->m_next_gate_id  = nl->m_next_gate_id;
-        c_netlist->m_used_gate_ids = nl->m_used_gate_ids;
-        c_netlist->m_free_gate_ids = nl->m_free_gate_ids;
+        c_netlist->m_gate_ids = nl->m_gate_ids;
 
-        c_netlist->m_next_net_id  = nl->m_next_net_id;
-        c_netlist->m_used_net_ids = nl->m_used_net_ids;
-        c_netlist->m_free_net_ids = nl->m_free_net_ids;
+        c_netlist->m_net_ids = nl->m_net_ids;
 
-        c_netlist->m_next_module_id  = nl->m_next_module_id;
-        c_netlist->m_used_module_ids = nl->m_used_module_ids;
-        c_netlist->m_free_module_ids = nl->m_free_module_ids;
+        c_netlist->m_module_ids = nl->m_module_ids;
 
-        c_netlist->m_next_grouping_id  = nl->m_next_grouping_id;
-        c_netlist->m_used_grouping_ids = nl->m_used_grouping_ids;
-        c_netlist->m_free_grouping_ids = nl->m_free_grouping_ids;
+        c_netlist->m_grouping_ids = nl->m_grouping_ids;
 
         // copy module port names
         for (Module* module : nl->m_modules)
@@ -283,7 +306,7 @@ namespace hal
             log_error("gate", "ID 0 represents an invalid gate ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_gate_ids.find(id) != m_netlist->m_used_gate_ids.end())
+        if (m_netlist->m_gate_ids.is_used(id))
         {
             log_error("gate", "gate ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -304,27 +327,20 @@ namespace hal
             return nullptr;
         }
 
-        auto new_gate = std::unique_ptr<Gate>(new Gate(this, m_event_handler, id, gt, name, x, y));
-
-        auto free_id_it = m_netlist->m_free_gate_ids.find(id);
-        if (free_id_it != m_netlist->m_free_gate_ids.end())
-        {
-            m_netlist->m_free_gate_ids.erase(free_id_it);
-        }
+        auto new_gate = new (m_gate_pool.allocate()) Gate(this, m_event_handler, id, gt, name, x, y);
 
-        m_netlist->m_used_gate_ids.insert(id);
+        m_netlist->m_gate_ids.acquire(id);
 
         // add gate to top module
         new_gate->m_module = m_netlist->m_top_module;
 
-        auto raw = new_gate.get();
+        auto raw = new_gate;
 
-        m_netlist->m_gates_map[id] = std::move(new_gate);
+        m_netlist->m_gates_map.insert(id, raw);
         m_netlist->m_gates_set.insert(raw);
         m_netlist->m_gates.push_back(raw);
 
-        m_netlist->m_top_module->m_gates_map[id] = raw;
-        m_netlist->m_top_module->m_gates.push_back(raw);
+        m_netlist->m_top_module->insert_gate_internal(raw);
 
         // notify
         m_event_handler->notify(ModuleEvent::event::gate_assigned, m_netlist->m_top_module, id);
@@ -367,22 +383,20 @@ namespace hal
         m_netlist->unmark_vcc_gate(gate);
 
         // remove gate from modules
-        gate->m_module->m_gates_map.erase(gate->m_module->m_gates_map.find(gate->get_id()));
-        utils::unordered_vector_erase(gate->m_module->m_gates, gate);
+        gate->m_module->erase_gate_internal(gate);
 
-        auto it  = m_netlist->m_gates_map.find(gate->get_id());
-        auto ptr = std::move(it->second);
-        m_netlist->m_gates_map.erase(it);
+        m_netlist->m_gates_map.erase(gate->get_id());
         m_netlist->m_gates_set.erase(gate);
         utils::unordered_vector_erase(m_netlist->m_gates, gate);
 
         // free ids
-        m_netlist->m_free_gate_ids.insert(gate->get_id());
-        m_netlist->m_used_gate_ids.erase(gate->get_id());
+        m_netlist->m_gate_ids.release(gate->get_id());
 
         m_event_handler->notify(ModuleEvent::event::gate_removed, gate->m_module, gate->get_id());
         m_event_handler->notify(GateEvent::event::removed, gate);
 
+        m_gate_pool.destroy(gate);
+
         return true;
     }
 
@@ -402,7 +416,7 @@ namespace hal
             log_error("net", "ID 0 represents an invalid net ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_net_ids.find(id) != m_netlist->m_used_net_ids.end())
+        if (m_netlist->m_net_ids.is_used(id))
         {
             log_error("net", "net ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -413,19 +427,13 @@ namespace hal
             return nullptr;
         }
 
-        auto new_net = std::unique_ptr<Net>(new Net(this, m_event_handler, id, name));
-
-        auto free_id_it = m_netlist->m_free_net_ids.find(id);
-        if (free_id_it != m_netlist->m_free_net_ids.end())
-        {
-            m_netlist->m_free_net_ids.erase(free_id_it);
-        }
+        auto new_net = new (m_net_pool.allocate()) Net(this, m_event_handler, id, name);
 
-        m_netlist->m_used_net_ids.insert(id);
+        m_netlist->m_net_ids.acquire(id);
 
         // add net to netlist
-        auto raw                  = new_net.get();
-        m_netlist->m_nets_map[id] = std::move(new_net);
+        auto raw                  = new_net;
+        m_netlist->m_nets_map.insert(id, raw);
         m_netlist->m_nets_set.insert(raw);
         m_netlist->m_nets.push_back(raw);
 
@@ -471,17 +479,16 @@ namespace hal
         m_netlist->unmark_global_output_net(net);
 
         // remove net from netlist
-        auto it  = m_netlist->m_nets_map.find(net->get_id());
-        auto ptr = std::move(it->second);
-        m_netlist->m_nets_map.erase(it);
+        m_netlist->m_nets_map.erase(net->get_id());
         m_netlist->m_nets_set.erase(net);
         utils::unordered_vector_erase(m_netlist->m_nets, net);
 
-        m_netlist->m_free_net_ids.insert(net->get_id());
-        m_netlist->m_used_net_ids.erase(net->get_id());
+        m_netlist->m_net_ids.release(net->get_id());
 
         m_event_handler->notify(NetEvent::event::removed, net);
 
+        m_net_pool.destroy(net);
+
         return true;
     }
 
@@ -506,9 +513,9 @@ namespace hal
         }
 
         // check whether pin is valid for this gate
-        auto output_pins = gate->get_type()->get_output_pins();
-
-        if ((std::find(output_pins.begin(), output_pins.end(), pin) == output_pins.end()))
+        const GateType* gate_type    = gate->get_type();
+        const PinDirection direction = pin->get_direction();
+        if ((direction != PinDirection::output && direction != PinDirection::inout) || pin->get_index() >= gate_type->get_pin_count() || gate_type->get_pin_by_index(pin->get_index()) != pin)
         {
             log_error("net", "gate '{}' with ID {} has no output pin called '{}' in netlist with ID {}.", gate->get_name(), gate->get_id(), pin->get_name(), m_netlist->m_netlist_id);
             return nullptr;
@@ -530,12 +537,12 @@ namespace hal
             return nullptr;
         }
 
-        auto new_endpoint     = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, false));
-        auto new_endpoint_raw = new_endpoint.get();
-        net->m_sources.push_back(std::move(new_endpoint));
+        auto new_endpoint_raw = new (m_endpoint_pool.allocate()) Endpoint(gate, pin, net, false);
         net->m_sources_raw.push_back(new_endpoint_raw);
         gate->m_out_endpoints.push_back(new_endpoint_raw);
+        gate->set_pin_endpoint(pin, false, new_endpoint_raw);
         gate->m_out_nets.push_back(net);
+        gate->m_module->update_net_endpoint_counts(net, 1, 0);
 
         // update internal nets and port nets
         if (m_net_checks_enabled)
@@ -571,16 +578,17 @@ namespace hal
         }
 
         bool removed = false;
-        for (u32 i = 0; i < net->m_sources.size(); ++i)
+        for (u32 i = 0; i < net->m_sources_raw.size(); ++i)
         {
             if (net->m_sources_raw[i] == ep)
             {
                 utils::unordered_vector_erase(gate->m_out_endpoints, ep);
+                gate->set_pin_endpoint(ep->get_pin(), false, nullptr);
                 utils::unordered_vector_erase(gate->m_out_nets, net);
-                net->m_sources[i] = std::move(net->m_sources.back());
-                net->m_sources.pop_back();
+                gate->m_module->update_net_endpoint_counts(net, -1, 0);
                 net->m_sources_raw[i] = net->m_sources_raw.back();
                 net->m_sources_raw.pop_back();
+                m_endpoint_pool.destroy(ep);
                 m_event_handler->notify(NetEvent::event::src_removed, net, gate->get_id());
                 removed = true;
                 break;
@@ -644,9 +652,9 @@ namespace hal
         }
 
         // check whether pin is valid for this gate
-        auto input_pins = gate->get_type()->get_input_pins();
-
-        if ((std::find(input_pins.begin(), input_pins.end(), pin) == input_pins.end()))
+        const GateType* gate_type    = gate->get_type();
+        const PinDirection direction = pin->get_direction();
+        if ((direction != PinDirection::input && direction != PinDirection::inout) || pin->get_index() >= gate_type->get_pin_count() || gate_type->get_pin_by_index(pin->get_index()) != pin)
         {
             log_error("net", "gate '{}' with ID {} has no input pin called '{}' in netlist with ID {}.", gate->get_name(), gate->get_id(), pin->get_name(), m_netlist->m_netlist_id);
             return nullptr;
@@ -668,12 +676,12 @@ namespace hal
             return nullptr;
         }
 
-        std::unique_ptr<Endpoint> new_endpoint = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, true));
-        Endpoint* new_endpoint_raw             = new_endpoint.get();
-        net->m_destinations.push_back(std::move(new_endpoint));
+        Endpoint* new_endpoint_raw = new (m_endpoint_pool.allocate()) Endpoint(gate, pin, net, true);
         net->m_destinations_raw.push_back(new_endpoint_raw);
         gate->m_in_endpoints.push_back(new_endpoint_raw);
+        gate->set_pin_endpoint(pin, true, new_endpoint_raw);
         gate->m_in_nets.push_back(net);
+        gate->m_module->update_net_endpoint_counts(net, 0, 1);
 
         // update internal nets and port nets
         if (m_net_checks_enabled)
@@ -708,16 +716,17 @@ namespace hal
         }
 
         bool removed = false;
-        for (u32 i = 0; i < net->m_destinations.size(); ++i)
+        for (u32 i = 0; i < net->m_destinations_raw.size(); ++i)
         {
             if (net->m_destinations_raw[i] == ep)
             {
                 utils::unordered_vector_erase(gate->m_in_endpoints, ep);
+                gate->set_pin_endpoint(ep->get_pin(), true, nullptr);
                 utils::unordered_vector_erase(gate->m_in_nets, net);
-                net->m_destinations[i] = std::move(net->m_destinations.back());
-                net->m_destinations.pop_back();
+                gate->m_module->update_net_endpoint_counts(net, 0, -1);
                 net->m_destinations_raw[i] = net->m_destinations_raw.back();
                 net->m_destinations_raw.pop_back();
+                m_endpoint_pool.destroy(ep);
                 m_event_handler->notify(NetEvent::event::dst_removed, net, gate->get_id());
                 removed = true;
                 break;
@@ -770,7 +779,7 @@ namespace hal
             log_error("module", "ID 0 represents an invalid module ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_module_ids.find(id) != m_netlist->m_used_module_ids.end())
+        if (m_netlist->m_module_ids.is_used(id))
         {
             log_error("module", "module ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -791,18 +800,12 @@ namespace hal
             return nullptr;
         }
 
-        auto m = std::unique_ptr<Module>(new Module(this, m_event_handler, id, parent, name));
-
-        auto free_id_it = m_netlist->m_free_module_ids.find(id);
-        if (free_id_it != m_netlist->m_free_module_ids.end())
-        {
-            m_netlist->m_free_module_ids.erase(free_id_it);
-        }
+        auto m = new (m_module_pool.allocate()) Module(this, m_event_handler, id, parent, name);
 
-        m_netlist->m_used_module_ids.insert(id);
+        m_netlist->m_module_ids.acquire(id);
 
-        auto raw                     = m.get();
-        m_netlist->m_modules_map[id] = std::move(m);
+        auto raw                     = m;
+        m_netlist->m_modules_map.insert(id, raw);
         m_netlist->m_modules_set.insert(raw);
         m_netlist->m_modules.push_back(raw);
 
@@ -865,16 +868,16 @@ namespace hal
         utils::unordered_vector_erase(to_remove->m_parent->m_submodules, to_remove);
         m_event_handler->notify(ModuleEvent::event::submodule_removed, to_remove->m_parent, to_remove->get_id());
 
-        auto it  = m_netlist->m_modules_map.find(to_remove->get_id());
-        auto ptr = std::move(it->second);
-        m_netlist->m_modules_map.erase(it);
+        m_netlist->m_modules_map.erase(to_remove->get_id());
         m_netlist->m_modules_set.erase(to_remove);
         utils::unordered_vector_erase(m_netlist->m_modules, to_remove);
 
-        m_netlist->m_free_module_ids.insert(to_remove->get_id());
-        m_netlist->m_used_module_ids.erase(to_remove->get_id());
+        m_netlist->m_module_ids.release(to_remove->get_id());
 
         m_event_handler->notify(ModuleEvent::event::removed, to_remove);
+
+        m_module_pool.destroy(to_remove);
+
         return true;
     }
 
@@ -934,30 +937,57 @@ namespace hal
         prev_modules.clear();
 
         // re-assign gates
+        std::unordered_map<const Module*, const Module*> common_ancestors;
         std::unordered_map<Module*, std::unordered_set<Net*>> nets_to_check;
         for (Gate* g : gates)
         {
             // remove gate from old module
             Module* prev_mod = g->m_module;
-            const auto it    = prev_mod->m_gates_map.find(g->get_id());
-            assert(it != prev_mod->m_gates_map.end());
-            prev_mod->m_gates_map.erase(it);
-
-            utils::unordered_vector_erase(prev_mod->m_gates, g);
+            assert(prev_mod->m_gates_map.find(g->get_id()) != prev_mod->m_gates_map.end());
+            prev_mod->erase_gate_internal(g);
 
             // move gate to new module
-            module->m_gates_map[g->get_id()] = g;
-            module->m_gates.push_back(g);
+            module->insert_gate_internal(g);
             g->m_module = module;
 
+            // only modules below the common ancestor of the old and the new module see a change of the endpoints
+            const Module* common_ancestor;
+            if (const auto it = common_ancestors.find(prev_mod); it != common_ancestors.end())
+            {
+                common_ancestor = it->second;
+            }
+            else
+            {
+                common_ancestor            = prev_mod->get_common_ancestor(module);
+                common_ancestors[prev_mod] = common_ancestor;
+            }
+
+            for (Net* net : g->m_in_nets)
+            {
+                prev_mod->update_net_endpoint_counts(net, 0, -1, common_ancestor);
+                module->update_net_endpoint_counts(net, 0, 1, common_ancestor);
+            }
+            for (Net* net : g->m_out_nets)
+            {
+                prev_mod->update_net_endpoint_counts(net, -1, 0, common_ancestor);
+                module->update_net_endpoint_counts(net, 1, 0, common_ancestor);
+            }
+
             // collect affected nets
-            std::vector<Net*> fan_in = g->get_fan_in_nets();
-            nets_to_check[prev_mod].insert(fan_in.begin(), fan_in.end());
-            nets_to_check[module].insert(fan_in.begin(), fan_in.end());
+            if (m_net_checks_enabled)
+            {
+                for (Module* m = prev_mod; m != common_ancestor; m = m->m_parent)
+                {
+                    nets_to_check[m].insert(g->m_in_nets.begin(), g->m_in_nets.end());
+                    nets_to_check[m].insert(g->m_out_nets.begin(), g->m_out_nets.end());
+                }
+                for (Module* m = module; m != common_ancestor; m = m->m_parent)
+                {
+                    nets_to_check[m].insert(g->m_in_nets.begin(), g->m_in_nets.end());
+                    nets_to_check[m].insert(g->m_out_nets.begin(), g->m_out_nets.end());
+                }
+            }
 
-            std::vector<Net*> fan_out = g->get_fan_out_nets();
-            nets_to_check[prev_mod].insert(fan_out.begin(), fan_out.end());
-            nets_to_check[module].insert(fan_out.begin(), fan_out.end());
             m_event_handler->notify(ModuleEvent::event::gate_removed, prev_mod, g->get_id());
             m_event_handler->notify(ModuleEvent::event::gate_assigned, module, g->get_id());
 
@@ -977,7 +1007,7 @@ namespace hal
             {
                 for (Net* net : nets)
                 {
-                    if (const auto res = affected_module->check_net(net, true); res.is_error())
+                    if (const auto res = affected_module->check_net(net, false); res.is_error())
                     {
                         log_error("module", "{}", res.get_error().get());
                         return false;
@@ -1015,7 +1045,7 @@ namespace hal
             log_error("grouping", "ID 0 represents an invalid grouping ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_grouping_ids.find(id) != m_netlist->m_used_grouping_ids.end())
+        if (m_netlist->m_grouping_ids.is_used(id))
         {
             log_error("grouping", "grouping ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -1028,17 +1058,11 @@ namespace hal
 
         auto new_grouping = std::unique_ptr<Grouping>(new Grouping(this, m_event_handler, id, name));
 
-        auto free_id_it = m_netlist->m_free_grouping_ids.find(id);
-        if (free_id_it != m_netlist->m_free_grouping_ids.end())
-        {
-            m_netlist->m_free_grouping_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_grouping_ids.insert(id);
+        m_netlist->m_grouping_ids.acquire(id);
 
         auto raw = new_grouping.get();
 
-        m_netlist->m_groupings_map[id] = std::move(new_grouping);
+        m_netlist->m_groupings_map.insert(id, std::move(new_grouping));
         m_netlist->m_groupings_set.insert(raw);
         m_netlist->m_groupings.push_back(raw);
 
@@ -1070,15 +1094,12 @@ namespace hal
             module->m_grouping = nullptr;
         }
 
-        auto it  = m_netlist->m_groupings_map.find(grouping->get_id());
-        auto ptr = std::move(it->second);
-        m_netlist->m_groupings_map.erase(it);
+        auto ptr = m_netlist->m_groupings_map.erase(grouping->get_id());
         m_netlist->m_groupings_set.erase(grouping);
         utils::unordered_vector_erase(m_netlist->m_groupings, grouping);
 
         // free ids
-        m_netlist->m_free_grouping_ids.insert(grouping->get_id());
-        m_netlist->m_used_grouping_ids.erase(grouping->get_id());
+        m_netlist->m_grouping_ids.release(grouping->get_id());
 
         // notify
         m_event_handler->notify(GroupingEvent::event::removed, grouping);
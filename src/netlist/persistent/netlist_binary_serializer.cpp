@@ -0,0 +1,1083 @@
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_builder.h"
+#include "hal_core/netlist/project_manager.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <queue>
+
+#ifndef DURATION
+#define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
+#endif
+
+namespace hal
+{
+    namespace netlist_binary_serializer
+    {
+        namespace
+        {
+            const u32 BINARY_FORMAT_VERSION = 1;
+
+            const char MAGIC[8]       = {'H', 'A', 'L', 'B', 'I', 'N', '\r', '\n'};
+            const u32 BYTE_ORDER_MARK = 0x01020304;
+            const u64 ALIGNMENT       = 8;
+
+            /*
+             * The file consists of the header, followed by one descriptor per column and the columns themselves.
+             * Every column is a plain array of fixed-width elements starting at an 8-byte aligned offset.
+             * Strings are stored once in the string table and referenced by their index, index 0 is the empty string.
+             * Columns are only ever appended in newer versions, so that readers may ignore unknown columns and treat missing ones as empty.
+             */
+            enum Column : u32
+            {
+                STRING_OFFSETS = 0,    // u64, number of strings + 1 offsets into the string data
+                STRING_DATA,           // char
+                NETLIST_INFO,          // u32, netlist ID followed by the strings for gate library, input file, design name, and device name
+
+                GATE_ID,       // u32
+                GATE_NAME,     // u32 string
+                GATE_TYPE,     // u32 string
+                GATE_FLAGS,    // u8, GND and VCC markers
+
+                NET_ID,       // u32
+                NET_NAME,     // u32 string
+                NET_FLAGS,    // u8, global input and output markers
+
+                ENDPOINT_NET,      // u32 net ID
+                ENDPOINT_GATE,     // u32 gate ID
+                ENDPOINT_PIN,      // u32 pin ID
+                ENDPOINT_FLAGS,    // u8, source marker
+
+                MODULE_ID,              // u32, modules are stored top-down to preserve the hierarchy
+                MODULE_NAME,            // u32 string
+                MODULE_TYPE,            // u32 string
+                MODULE_PARENT,          // u32 module ID, 0 for the top module
+                MODULE_GATE_OFFSETS,    // u64, number of modules + 1 offsets into the module gates
+                MODULE_GATES,           // u32 gate ID
+
+                PIN_GROUP_MODULE,         // u32 module ID
+                PIN_GROUP_ID,             // u32
+                PIN_GROUP_NAME,           // u32 string
+                PIN_GROUP_DIRECTION,      // u32 string
+                PIN_GROUP_TYPE,           // u32 string
+                PIN_GROUP_ASCENDING,      // u8
+                PIN_GROUP_START_INDEX,    // u32
+                PIN_GROUP_PIN_OFFSETS,    // u64, number of pin groups + 1 offsets into the module pins
+
+                MODULE_PIN_ID,      // u32
+                MODULE_PIN_NAME,    // u32 string
+                MODULE_PIN_TYPE,    // u32 string
+                MODULE_PIN_NET,     // u32 net ID
+
+                DATA_OWNER_KIND,    // u8, see DataOwner
+                DATA_OWNER_ID,      // u32
+                DATA_CATEGORY,      // u32 string
+                DATA_KEY,           // u32 string
+                DATA_TYPE,          // u32 string
+                DATA_VALUE,         // u32 string
+
+                FUNCTION_GATE,            // u32 gate ID
+                FUNCTION_NAME,            // u32 string
+                FUNCTION_NODE_OFFSETS,    // u64, number of functions + 1 offsets into the nodes
+
+                NODE_TYPE,                // u16
+                NODE_SIZE,                // u16
+                NODE_INDEX,               // u16
+                NODE_VARIABLE,            // u32 string
+                NODE_CONSTANT_OFFSETS,    // u64, number of nodes + 1 offsets into the constant values
+                CONSTANT_VALUES,          // i8 BooleanFunction::Value
+
+                NUM_COLUMNS
+            };
+
+            enum DataOwner : u8
+            {
+                GATE_DATA   = 0,
+                NET_DATA    = 1,
+                MODULE_DATA = 2
+            };
+
+            enum Flags : u8
+            {
+                GND_GATE          = 1 << 0,
+                VCC_GATE          = 1 << 1,
+                GLOBAL_INPUT_NET  = 1 << 0,
+                GLOBAL_OUTPUT_NET = 1 << 1,
+                SOURCE_ENDPOINT   = 1 << 0
+            };
+
+            struct FileHeader
+            {
+                char magic[8];
+                u32 version;
+                u32 byte_order;
+                u32 num_columns;
+                u32 reserved;
+            };
+
+            struct ColumnDescriptor
+            {
+                u64 offset;
+                u64 count;
+                u32 element_size;
+                u32 reserved;
+            };
+
+            // serializing functions
+
+            class StringTable
+            {
+            public:
+                StringTable()
+                {
+                    add(std::string());
+                }
+
+                u32 add(const std::string& str)
+                {
+                    if (const auto it = m_indices.find(str); it != m_indices.end())
+                    {
+                        return it->second;
+                    }
+
+                    const u32 index = m_offsets.size() - 1;
+                    m_indices.emplace(str, index);
+                    m_data.insert(m_data.end(), str.begin(), str.end());
+                    m_offsets.push_back(m_data.size());
+                    return index;
+                }
+
+                const std::vector<u64>& get_offsets() const
+                {
+                    return m_offsets;
+                }
+
+                const std::vector<char>& get_data() const
+                {
+                    return m_data;
+                }
+
+            private:
+                std::unordered_map<std::string, u32> m_indices;
+                std::vector<u64> m_offsets = {0};
+                std::vector<char> m_data;
+            };
+
+            class ColumnWriter
+            {
+            public:
+                template<typename T>
+                void set(Column column, const std::vector<T>& values)
+                {
+                    auto& [data, count, element_size] = m_columns[column];
+                    data.resize(values.size() * sizeof(T));
+                    if (!values.empty())
+                    {
+                        std::memcpy(data.data(), values.data(), data.size());
+                    }
+                    count        = values.size();
+                    element_size = sizeof(T);
+                }
+
+                bool write(std::ofstream& stream) const
+                {
+                    FileHeader header;
+                    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+                    header.version     = BINARY_FORMAT_VERSION;
+                    header.byte_order  = BYTE_ORDER_MARK;
+                    header.num_columns = NUM_COLUMNS;
+                    header.reserved    = 0;
+
+                    std::vector<ColumnDescriptor> descriptors(NUM_COLUMNS);
+                    u64 offset = align(sizeof(FileHeader) + NUM_COLUMNS * sizeof(ColumnDescriptor));
+                    for (u32 i = 0; i < NUM_COLUMNS; i++)
+                    {
+                        const auto& [data, count, element_size] = m_columns[i];
+                        descriptors[i]                          = {offset, count, element_size, 0};
+                        offset                                  = align(offset + data.size());
+                    }
+
+                    stream.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+                    stream.write(reinterpret_cast<const char*>(descriptors.data()), descriptors.size() * sizeof(ColumnDescriptor));
+
+                    u64 position = sizeof(FileHeader) + NUM_COLUMNS * sizeof(ColumnDescriptor);
+                    for (u32 i = 0; i < NUM_COLUMNS; i++)
+                    {
+                        const std::vector<char> padding(descriptors[i].offset - position, 0);
+                        stream.write(padding.data(), padding.size());
+                        stream.write(m_columns[i].data.data(), m_columns[i].data.size());
+                        position = descriptors[i].offset + m_columns[i].data.size();
+                    }
+
+                    return stream.good();
+                }
+
+            private:
+                struct ColumnData
+                {
+                    std::vector<char> data;
+                    u64 count        = 0;
+                    u32 element_size = 0;
+                };
+
+                static u64 align(u64 offset)
+                {
+                    return (offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+                }
+
+                ColumnData m_columns[NUM_COLUMNS];
+            };
+
+            void serialize_data(const DataContainer* container, DataOwner owner_kind, u32 owner_id, StringTable& strings, std::vector<std::vector<u32>>& data_columns, std::vector<u8>& data_owner_kinds)
+            {
+                for (const auto& [category_key, type_value] : container->get_data_map())
+                {
+                    data_owner_kinds.push_back(owner_kind);
+                    data_columns[0].push_back(owner_id);
+                    data_columns[1].push_back(strings.add(std::get<0>(category_key)));
+                    data_columns[2].push_back(strings.add(std::get<1>(category_key)));
+                    data_columns[3].push_back(strings.add(std::get<0>(type_value)));
+                    data_columns[4].push_back(strings.add(std::get<1>(type_value)));
+                }
+            }
+
+            bool serialize(const Netlist* nl, std::ofstream& stream)
+            {
+                StringTable strings;
+                ColumnWriter writer;
+
+                // owner ID, category, key, type, and value of all data entries
+                std::vector<std::vector<u32>> data_columns(5);
+                std::vector<u8> data_owner_kinds;
+
+                writer.set<u32>(NETLIST_INFO,
+                                {nl->get_id(),
+                                 strings.add(nl->get_gate_library()->get_path().string()),
+                                 strings.add(nl->get_input_filename().string()),
+                                 strings.add(nl->get_design_name()),
+                                 strings.add(nl->get_device_name())});
+
+                // gates and their custom Boolean functions
+                {
+                    std::vector<Gate*> sorted = nl->get_gates();
+                    std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+
+                    std::vector<u32> ids, names, types;
+                    std::vector<u8> flags;
+                    std::vector<u32> function_gates, function_names;
+                    std::vector<u64> function_node_offsets = {0};
+                    std::vector<u16> node_types, node_sizes, node_indices;
+                    std::vector<u32> node_variables;
+                    std::vector<u64> node_constant_offsets = {0};
+                    std::vector<i8> constant_values;
+
+                    ids.reserve(sorted.size());
+                    names.reserve(sorted.size());
+                    types.reserve(sorted.size());
+                    flags.reserve(sorted.size());
+
+                    for (const Gate* gate : sorted)
+                    {
+                        ids.push_back(gate->get_id());
+                        names.push_back(strings.add(gate->get_name()));
+                        types.push_back(strings.add(gate->get_type()->get_name()));
+                        flags.push_back((nl->is_gnd_gate(gate) ? GND_GATE : 0) | (nl->is_vcc_gate(gate) ? VCC_GATE : 0));
+
+                        serialize_data(gate, GATE_DATA, gate->get_id(), strings, data_columns, data_owner_kinds);
+
+                        // sort functions by name to obtain deterministic files
+                        const auto functions = gate->get_boolean_functions(true);
+                        std::map<std::string, const BooleanFunction*> sorted_functions;
+                        for (const auto& [name, function] : functions)
+                        {
+                            sorted_functions[name] = &function;
+                        }
+
+                        for (const auto& [name, function] : sorted_functions)
+                        {
+                            function_gates.push_back(gate->get_id());
+                            function_names.push_back(strings.add(name));
+                            for (const auto& node : function->get_nodes())
+                            {
+                                node_types.push_back(node.type);
+                                node_sizes.push_back(node.size);
+                                node_indices.push_back(node.index);
+                                node_variables.push_back(strings.add(node.variable));
+                                for (const auto value : node.constant)
+                                {
+                                    constant_values.push_back((i8)value);
+                                }
+                                node_constant_offsets.push_back(constant_values.size());
+                            }
+                            function_node_offsets.push_back(node_types.size());
+                        }
+                    }
+
+                    writer.set(GATE_ID, ids);
+                    writer.set(GATE_NAME, names);
+                    writer.set(GATE_TYPE, types);
+                    writer.set(GATE_FLAGS, flags);
+                    writer.set(FUNCTION_GATE, function_gates);
+                    writer.set(FUNCTION_NAME, function_names);
+                    writer.set(FUNCTION_NODE_OFFSETS, function_node_offsets);
+                    writer.set(NODE_TYPE, node_types);
+                    writer.set(NODE_SIZE, node_sizes);
+                    writer.set(NODE_INDEX, node_indices);
+                    writer.set(NODE_VARIABLE, node_variables);
+                    writer.set(NODE_CONSTANT_OFFSETS, node_constant_offsets);
+                    writer.set(CONSTANT_VALUES, constant_values);
+                }
+
+                // nets and their endpoints
+                {
+                    std::vector<Net*> sorted = nl->get_nets();
+                    std::sort(sorted.begin(), sorted.end(), [](Net* lhs, Net* rhs) { return lhs->get_id() < rhs->get_id(); });
+
+                    std::vector<u32> ids, names;
+                    std::vector<u8> flags;
+                    std::vector<u32> endpoint_nets, endpoint_gates, endpoint_pins;
+                    std::vector<u8> endpoint_flags;
+
+                    ids.reserve(sorted.size());
+                    names.reserve(sorted.size());
+                    flags.reserve(sorted.size());
+
+                    for (const Net* net : sorted)
+                    {
+                        ids.push_back(net->get_id());
+                        names.push_back(strings.add(net->get_name()));
+                        flags.push_back((nl->is_global_input_net(net) ? GLOBAL_INPUT_NET : 0) | (nl->is_global_output_net(net) ? GLOBAL_OUTPUT_NET : 0));
+
+                        for (const bool is_source : {true, false})
+                        {
+                            std::vector<Endpoint*> endpoints = is_source ? net->get_sources() : net->get_destinations();
+                            std::sort(endpoints.begin(), endpoints.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+                            for (const Endpoint* ep : endpoints)
+                            {
+                                endpoint_nets.push_back(net->get_id());
+                                endpoint_gates.push_back(ep->get_gate()->get_id());
+                                endpoint_pins.push_back(ep->get_pin()->get_id());
+                                endpoint_flags.push_back(is_source ? SOURCE_ENDPOINT : 0);
+                            }
+                        }
+
+                        serialize_data(net, NET_DATA, net->get_id(), strings, data_columns, data_owner_kinds);
+                    }
+
+                    writer.set(NET_ID, ids);
+                    writer.set(NET_NAME, names);
+                    writer.set(NET_FLAGS, flags);
+                    writer.set(ENDPOINT_NET, endpoint_nets);
+                    writer.set(ENDPOINT_GATE, endpoint_gates);
+                    writer.set(ENDPOINT_PIN, endpoint_pins);
+                    writer.set(ENDPOINT_FLAGS, endpoint_flags);
+                }
+
+                // modules, their gates, and their pins
+                {
+                    std::vector<u32> ids, names, types, parents, gates;
+                    std::vector<u64> gate_offsets = {0};
+                    std::vector<u32> pin_group_modules, pin_group_ids, pin_group_names, pin_group_directions, pin_group_types, pin_group_start_indices;
+                    std::vector<u8> pin_group_ascending;
+                    std::vector<u64> pin_group_pin_offsets = {0};
+                    std::vector<u32> pin_ids, pin_names, pin_types, pin_nets;
+
+                    // module ids are not sorted to preserve hierarchy
+                    std::queue<const Module*> q;
+                    q.push(nl->get_top_module());
+                    while (!q.empty())
+                    {
+                        const Module* module = q.front();
+                        q.pop();
+
+                        ids.push_back(module->get_id());
+                        names.push_back(strings.add(module->get_name()));
+                        types.push_back(strings.add(module->get_type()));
+                        parents.push_back(module->is_top_module() ? 0 : module->get_parent_module()->get_id());
+
+                        std::vector<Gate*> sorted = module->get_gates(nullptr, false);
+                        std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                        for (const Gate* g : sorted)
+                        {
+                            gates.push_back(g->get_id());
+                        }
+                        gate_offsets.push_back(gates.size());
+
+                        for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+                        {
+                            pin_group_modules.push_back(module->get_id());
+                            pin_group_ids.push_back(pin_group->get_id());
+                            pin_group_names.push_back(strings.add(pin_group->get_name()));
+                            pin_group_directions.push_back(strings.add(enum_to_string(pin_group->get_direction())));
+                            pin_group_types.push_back(strings.add(enum_to_string(pin_group->get_type())));
+                            pin_group_ascending.push_back(pin_group->is_ascending() ? 1 : 0);
+                            pin_group_start_indices.push_back(pin_group->get_start_index());
+                            for (const ModulePin* pin : pin_group->get_pins())
+                            {
+                                pin_ids.push_back(pin->get_id());
+                                pin_names.push_back(strings.add(pin->get_name()));
+                                pin_types.push_back(strings.add(enum_to_string(pin->get_type())));
+                                pin_nets.push_back(pin->get_net()->get_id());
+                            }
+                            pin_group_pin_offsets.push_back(pin_ids.size());
+                        }
+
+                        serialize_data(module, MODULE_DATA, module->get_id(), strings, data_columns, data_owner_kinds);
+
+                        for (const Module* sm : module->get_submodules())
+                        {
+                            q.push(sm);
+                        }
+                    }
+
+                    writer.set(MODULE_ID, ids);
+                    writer.set(MODULE_NAME, names);
+                    writer.set(MODULE_TYPE, types);
+                    writer.set(MODULE_PARENT, parents);
+                    writer.set(MODULE_GATE_OFFSETS, gate_offsets);
+                    writer.set(MODULE_GATES, gates);
+                    writer.set(PIN_GROUP_MODULE, pin_group_modules);
+                    writer.set(PIN_GROUP_ID, pin_group_ids);
+                    writer.set(PIN_GROUP_NAME, pin_group_names);
+                    writer.set(PIN_GROUP_DIRECTION, pin_group_directions);
+                    writer.set(PIN_GROUP_TYPE, pin_group_types);
+                    writer.set(PIN_GROUP_ASCENDING, pin_group_ascending);
+                    writer.set(PIN_GROUP_START_INDEX, pin_group_start_indices);
+                    writer.set(PIN_GROUP_PIN_OFFSETS, pin_group_pin_offsets);
+                    writer.set(MODULE_PIN_ID, pin_ids);
+                    writer.set(MODULE_PIN_NAME, pin_names);
+                    writer.set(MODULE_PIN_TYPE, pin_types);
+                    writer.set(MODULE_PIN_NET, pin_nets);
+                }
+
+                writer.set(DATA_OWNER_KIND, data_owner_kinds);
+                writer.set(DATA_OWNER_ID, data_columns[0]);
+                writer.set(DATA_CATEGORY, data_columns[1]);
+                writer.set(DATA_KEY, data_columns[2]);
+                writer.set(DATA_TYPE, data_columns[3]);
+                writer.set(DATA_VALUE, data_columns[4]);
+
+                writer.set(STRING_OFFSETS, strings.get_offsets());
+                writer.set(STRING_DATA, strings.get_data());
+
+                return writer.write(stream);
+            }
+
+            // deserializing functions
+
+            template<typename T>
+            struct ColumnView
+            {
+                const T* data = nullptr;
+                u64 size      = 0;
+
+                const T& operator[](u64 i) const
+                {
+                    return data[i];
+                }
+            };
+
+            class ColumnReader
+            {
+            public:
+                Result<std::monostate> open(const std::filesystem::path& hal_file)
+                {
+                    if (auto res = m_file.open(hal_file); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not read binary netlist file '" + hal_file.string() + "': unable to open file");
+                    }
+
+                    const std::string_view content = m_file.get_data();
+                    if (content.size() < sizeof(FileHeader) || std::memcmp(content.data(), MAGIC, sizeof(MAGIC)) != 0)
+                    {
+                        return ERR("could not read binary netlist file '" + hal_file.string() + "': file is not a binary netlist file");
+                    }
+
+                    std::memcpy(&m_header, content.data(), sizeof(FileHeader));
+                    if (m_header.byte_order != BYTE_ORDER_MARK)
+                    {
+                        return ERR("could not read binary netlist file '" + hal_file.string() + "': file has been written on a machine with a different byte order");
+                    }
+                    if (content.size() < sizeof(FileHeader) + (u64)m_header.num_columns * sizeof(ColumnDescriptor))
+                    {
+                        return ERR("could not read binary netlist file '" + hal_file.string() + "': file is truncated");
+                    }
+
+                    m_descriptors.resize(m_header.num_columns);
+                    std::memcpy(m_descriptors.data(), content.data() + sizeof(FileHeader), m_header.num_columns * sizeof(ColumnDescriptor));
+                    for (u32 i = 0; i < m_header.num_columns; i++)
+                    {
+                        const auto& descriptor = m_descriptors[i];
+                        if (descriptor.offset % ALIGNMENT != 0 || descriptor.offset > content.size()
+                            || (descriptor.element_size != 0 && descriptor.count > (content.size() - descriptor.offset) / descriptor.element_size))
+                        {
+                            return ERR("could not read binary netlist file '" + hal_file.string() + "': column " + std::to_string(i) + " exceeds the file");
+                        }
+                    }
+
+                    m_string_offsets = get<u64>(STRING_OFFSETS);
+                    m_string_data    = get<char>(STRING_DATA);
+                    if (m_string_offsets.size == 0)
+                    {
+                        return ERR("could not read binary netlist file '" + hal_file.string() + "': file does not contain a string table");
+                    }
+                    for (u64 i = 0; i < m_string_offsets.size; i++)
+                    {
+                        if (m_string_offsets[i] > m_string_data.size || (i > 0 && m_string_offsets[i] < m_string_offsets[i - 1]))
+                        {
+                            return ERR("could not read binary netlist file '" + hal_file.string() + "': string table is corrupted");
+                        }
+                    }
+
+                    return OK({});
+                }
+
+                u32 get_version() const
+                {
+                    return m_header.version;
+                }
+
+                template<typename T>
+                ColumnView<T> get(Column column) const
+                {
+                    // columns unknown to the writer are treated as empty
+                    if (column >= m_descriptors.size() || m_descriptors[column].element_size != sizeof(T))
+                    {
+                        return ColumnView<T>();
+                    }
+                    const auto& descriptor = m_descriptors[column];
+                    return {reinterpret_cast<const T*>(m_file.get_data().data() + descriptor.offset), descriptor.count};
+                }
+
+                u64 get_num_strings() const
+                {
+                    return m_string_offsets.size - 1;
+                }
+
+                std::string get_string(u32 index) const
+                {
+                    if (index >= get_num_strings())
+                    {
+                        return std::string();
+                    }
+                    return std::string(m_string_data.data + m_string_offsets[index], m_string_offsets[index + 1] - m_string_offsets[index]);
+                }
+
+            private:
+                MemoryMappedFile m_file;
+                FileHeader m_header;
+                std::vector<ColumnDescriptor> m_descriptors;
+                ColumnView<u64> m_string_offsets;
+                ColumnView<char> m_string_data;
+            };
+
+            GateLibrary* load_gate_library(const std::string& gate_library_path)
+            {
+                std::filesystem::path glib_path(gate_library_path);
+
+                GateLibrary* glib = gate_library_manager::get_gate_library(glib_path.string());
+                if (glib == nullptr)
+                {
+                    if (glib_path.extension() == ".hgl")
+                    {
+                        glib_path.replace_extension(".lib");
+                    }
+                    else
+                    {
+                        glib_path.replace_extension(".hgl");
+                    }
+
+                    glib = gate_library_manager::get_gate_library(glib_path.string());
+                    if (glib != nullptr)
+                    {
+                        log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", gate_library_path, glib_path.string());
+                    }
+                }
+                return glib;
+            }
+
+            Result<std::unique_ptr<Netlist>> deserialize(const ColumnReader& reader)
+            {
+                const auto info = reader.get<u32>(NETLIST_INFO);
+                if (info.size < 5)
+                {
+                    return ERR("could not deserialize netlist: file does not contain netlist information");
+                }
+
+                const std::string gate_library_path = reader.get_string(info[1]);
+                GateLibrary* glib                   = load_gate_library(gate_library_path);
+                if (glib == nullptr)
+                {
+                    return ERR("could not deserialize netlist: failed to load gate library '" + gate_library_path + "'");
+                }
+
+                const auto gate_ids   = reader.get<u32>(GATE_ID);
+                const auto gate_names = reader.get<u32>(GATE_NAME);
+                const auto gate_types = reader.get<u32>(GATE_TYPE);
+                const auto gate_flags = reader.get<u8>(GATE_FLAGS);
+                const auto net_ids    = reader.get<u32>(NET_ID);
+                const auto net_names  = reader.get<u32>(NET_NAME);
+                const auto net_flags  = reader.get<u8>(NET_FLAGS);
+                const auto module_ids = reader.get<u32>(MODULE_ID);
+                if (gate_names.size != gate_ids.size || gate_types.size != gate_ids.size || gate_flags.size != gate_ids.size || net_names.size != net_ids.size || net_flags.size != net_ids.size)
+                {
+                    return ERR("could not deserialize netlist: gate and net columns differ in length");
+                }
+
+                auto nl = std::make_unique<Netlist>(glib);
+                nl->set_id(info[0]);
+                nl->set_input_filename(reader.get_string(info[2]));
+                nl->set_design_name(reader.get_string(info[3]));
+                nl->set_device_name(reader.get_string(info[4]));
+
+                // all objects are known upfront, so allocate their storage at once
+                nl->reserve(gate_ids.size, net_ids.size, module_ids.size);
+
+                // disable automatically checking module nets
+                nl->enable_automatic_net_checks(false);
+
+                // batch all object creation, module nets are classified once on commit
+                NetlistBuilder builder(nl.get());
+
+                // gate types are resolved once per distinct type name
+                const auto& gate_types_by_name = glib->get_gate_types();
+                std::unordered_map<u32, GateType*> gate_type_cache;
+
+                for (u64 i = 0; i < gate_ids.size; i++)
+                {
+                    auto type_it = gate_type_cache.find(gate_types[i]);
+                    if (type_it == gate_type_cache.end())
+                    {
+                        const std::string type_name = reader.get_string(gate_types[i]);
+                        const auto lib_it           = gate_types_by_name.find(type_name);
+                        if (lib_it == gate_types_by_name.end())
+                        {
+                            return ERR("could not deserialize gate '" + reader.get_string(gate_names[i]) + "' with ID " + std::to_string(gate_ids[i]) + ": failed to find gate type '" + type_name
+                                       + "' in gate library '" + glib->get_name() + "'");
+                        }
+                        type_it = gate_type_cache.emplace(gate_types[i], lib_it->second).first;
+                    }
+
+                    Gate* gate = builder.create_gate(gate_ids[i], type_it->second, reader.get_string(gate_names[i]));
+                    if (gate == nullptr)
+                    {
+                        return ERR("could not deserialize gate '" + reader.get_string(gate_names[i]) + "' with ID " + std::to_string(gate_ids[i]) + ": failed to create gate");
+                    }
+
+                    if ((gate_flags[i] & VCC_GATE) && !nl->mark_vcc_gate(gate))
+                    {
+                        return ERR("could not deserialize gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + ": failed to mark VCC gate");
+                    }
+                    if ((gate_flags[i] & GND_GATE) && !nl->mark_gnd_gate(gate))
+                    {
+                        return ERR("could not deserialize gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + ": failed to mark GND gate");
+                    }
+                }
+
+                // custom Boolean functions are rebuilt directly from their nodes
+                {
+                    const auto function_gates        = reader.get<u32>(FUNCTION_GATE);
+                    const auto function_names        = reader.get<u32>(FUNCTION_NAME);
+                    const auto function_node_offsets = reader.get<u64>(FUNCTION_NODE_OFFSETS);
+                    const auto node_types            = reader.get<u16>(NODE_TYPE);
+                    const auto node_sizes            = reader.get<u16>(NODE_SIZE);
+                    const auto node_indices          = reader.get<u16>(NODE_INDEX);
+                    const auto node_variables        = reader.get<u32>(NODE_VARIABLE);
+                    const auto node_constant_offsets = reader.get<u64>(NODE_CONSTANT_OFFSETS);
+                    const auto constant_values       = reader.get<i8>(CONSTANT_VALUES);
+                    if (function_names.size != function_gates.size || (function_gates.size > 0 && function_node_offsets.size != function_gates.size + 1) || node_sizes.size != node_types.size
+                        || node_indices.size != node_types.size || node_variables.size != node_types.size || (node_types.size > 0 && node_constant_offsets.size != node_types.size + 1))
+                    {
+                        return ERR("could not deserialize netlist: Boolean function columns differ in length");
+                    }
+
+                    for (u64 i = 0; i < function_gates.size; i++)
+                    {
+                        Gate* gate = nl->get_gate_by_id(function_gates[i]);
+                        if (gate == nullptr || function_node_offsets[i] > function_node_offsets[i + 1] || function_node_offsets[i + 1] > node_types.size)
+                        {
+                            return ERR("could not deserialize netlist: invalid Boolean function for gate with ID " + std::to_string(function_gates[i]));
+                        }
+
+                        std::vector<BooleanFunction::Node> nodes;
+                        nodes.reserve(function_node_offsets[i + 1] - function_node_offsets[i]);
+                        for (u64 j = function_node_offsets[i]; j < function_node_offsets[i + 1]; j++)
+                        {
+                            const u16 type = node_types[j];
+                            if (type == BooleanFunction::NodeType::Constant)
+                            {
+                                if (node_constant_offsets[j] > node_constant_offsets[j + 1] || node_constant_offsets[j + 1] > constant_values.size)
+                                {
+                                    return ERR("could not deserialize gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + ": invalid constant in Boolean function");
+                                }
+                                std::vector<BooleanFunction::Value> value;
+                                value.reserve(node_constant_offsets[j + 1] - node_constant_offsets[j]);
+                                for (u64 k = node_constant_offsets[j]; k < node_constant_offsets[j + 1]; k++)
+                                {
+                                    value.push_back((BooleanFunction::Value)constant_values[k]);
+                                }
+                                nodes.push_back(BooleanFunction::Node::Constant(value));
+                            }
+                            else if (type == BooleanFunction::NodeType::Index)
+                            {
+                                nodes.push_back(BooleanFunction::Node::Index(node_indices[j], node_sizes[j]));
+                            }
+                            else if (type == BooleanFunction::NodeType::Variable)
+                            {
+                                nodes.push_back(BooleanFunction::Node::Variable(reader.get_string(node_variables[j]), node_sizes[j]));
+                            }
+                            else
+                            {
+                                nodes.push_back(BooleanFunction::Node::Operation(type, node_sizes[j]));
+                            }
+                        }
+
+                        auto function = BooleanFunction::build(std::move(nodes));
+                        if (function.is_error())
+                        {
+                            return ERR_APPEND(function.get_error(),
+                                              "could not deserialize gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + ": failed to build Boolean function '"
+                                                  + reader.get_string(function_names[i]) + "'");
+                        }
+                        gate->add_boolean_function(reader.get_string(function_names[i]), function.get());
+                    }
+                }
+
+                for (u64 i = 0; i < net_ids.size; i++)
+                {
+                    Net* net = builder.create_net(net_ids[i], reader.get_string(net_names[i]));
+                    if (net == nullptr)
+                    {
+                        return ERR("could not deserialize net '" + reader.get_string(net_names[i]) + "' with ID " + std::to_string(net_ids[i]) + ": failed to create net");
+                    }
+
+                    if ((net_flags[i] & GLOBAL_INPUT_NET) && !nl->mark_global_input_net(net))
+                    {
+                        return ERR("could not deserialize net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to mark global input net");
+                    }
+                    if ((net_flags[i] & GLOBAL_OUTPUT_NET) && !nl->mark_global_output_net(net))
+                    {
+                        return ERR("could not deserialize net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to mark global output net");
+                    }
+                }
+
+                // endpoints are stored grouped by net, so consecutive endpoints mostly share the same net
+                {
+                    const auto endpoint_nets  = reader.get<u32>(ENDPOINT_NET);
+                    const auto endpoint_gates = reader.get<u32>(ENDPOINT_GATE);
+                    const auto endpoint_pins  = reader.get<u32>(ENDPOINT_PIN);
+                    const auto endpoint_flags = reader.get<u8>(ENDPOINT_FLAGS);
+                    if (endpoint_gates.size != endpoint_nets.size || endpoint_pins.size != endpoint_nets.size || endpoint_flags.size != endpoint_nets.size)
+                    {
+                        return ERR("could not deserialize netlist: endpoint columns differ in length");
+                    }
+
+                    Net* net = nullptr;
+                    for (u64 i = 0; i < endpoint_nets.size; i++)
+                    {
+                        if (net == nullptr || net->get_id() != endpoint_nets[i])
+                        {
+                            net = nl->get_net_by_id(endpoint_nets[i]);
+                        }
+                        Gate* gate = nl->get_gate_by_id(endpoint_gates[i]);
+                        if (net == nullptr || gate == nullptr)
+                        {
+                            return ERR("could not deserialize netlist: endpoint references net with ID " + std::to_string(endpoint_nets[i]) + " and gate with ID " + std::to_string(endpoint_gates[i])
+                                       + ", but at least one of them does not exist");
+                        }
+
+                        GatePin* pin = gate->get_type()->get_pin_by_id(endpoint_pins[i]);
+                        if (pin == nullptr)
+                        {
+                            return ERR("could not deserialize endpoint of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with ID "
+                                       + std::to_string(endpoint_pins[i]));
+                        }
+
+                        if (endpoint_flags[i] & SOURCE_ENDPOINT)
+                        {
+                            if (builder.add_source(net, gate, pin) == nullptr)
+                            {
+                                return ERR("could not deserialize net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '" + pin->get_name()
+                                           + "' of gate '" + gate->get_name() + "' as source");
+                            }
+                        }
+                        else if (builder.add_destination(net, gate, pin) == nullptr)
+                        {
+                            return ERR("could not deserialize net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '" + pin->get_name() + "' of gate '"
+                                       + gate->get_name() + "' as destination");
+                        }
+                    }
+                }
+
+                // modules are stored top-down, so parents are always created before their submodules
+                {
+                    const auto module_names        = reader.get<u32>(MODULE_NAME);
+                    const auto module_types        = reader.get<u32>(MODULE_TYPE);
+                    const auto module_parents      = reader.get<u32>(MODULE_PARENT);
+                    const auto module_gate_offsets = reader.get<u64>(MODULE_GATE_OFFSETS);
+                    const auto module_gates        = reader.get<u32>(MODULE_GATES);
+                    if (module_names.size != module_ids.size || module_types.size != module_ids.size || module_parents.size != module_ids.size
+                        || (module_ids.size > 0 && module_gate_offsets.size != module_ids.size + 1))
+                    {
+                        return ERR("could not deserialize netlist: module columns differ in length");
+                    }
+
+                    for (u64 i = 0; i < module_ids.size; i++)
+                    {
+                        const std::string module_name = reader.get_string(module_names[i]);
+
+                        Module* sm;
+                        if (module_parents[i] == 0)
+                        {
+                            // top_module must not be created but might be renamed
+                            sm = nl->get_top_module();
+                            if (module_name != sm->get_name())
+                            {
+                                sm->set_name(module_name);
+                            }
+                        }
+                        else
+                        {
+                            sm = builder.create_module(module_ids[i], module_name, nl->get_module_by_id(module_parents[i]));
+                            if (sm == nullptr)
+                            {
+                                return ERR("could not deserialize module '" + module_name + "' with ID " + std::to_string(module_ids[i]) + ": failed to create module");
+                            }
+                        }
+
+                        sm->set_type(reader.get_string(module_types[i]));
+
+                        if (!sm->is_top_module())
+                        {
+                            if (module_gate_offsets[i] > module_gate_offsets[i + 1] || module_gate_offsets[i + 1] > module_gates.size)
+                            {
+                                return ERR("could not deserialize module '" + module_name + "' with ID " + std::to_string(module_ids[i]) + ": invalid gate assignment");
+                            }
+
+                            std::vector<Gate*> gates;
+                            gates.reserve(module_gate_offsets[i + 1] - module_gate_offsets[i]);
+                            for (u64 j = module_gate_offsets[i]; j < module_gate_offsets[i + 1]; j++)
+                            {
+                                gates.push_back(nl->get_gate_by_id(module_gates[j]));
+                            }
+                            if (!builder.assign_gates(sm, gates))
+                            {
+                                return ERR("could not deserialize module '" + module_name + "' with ID " + std::to_string(module_ids[i]) + ": failed to assign gates");
+                            }
+                        }
+                    }
+                }
+
+                // data entries of gates, nets, and modules
+                {
+                    const auto owner_kinds = reader.get<u8>(DATA_OWNER_KIND);
+                    const auto owner_ids   = reader.get<u32>(DATA_OWNER_ID);
+                    const auto categories  = reader.get<u32>(DATA_CATEGORY);
+                    const auto keys        = reader.get<u32>(DATA_KEY);
+                    const auto types       = reader.get<u32>(DATA_TYPE);
+                    const auto values      = reader.get<u32>(DATA_VALUE);
+                    if (owner_ids.size != owner_kinds.size || categories.size != owner_kinds.size || keys.size != owner_kinds.size || types.size != owner_kinds.size
+                        || values.size != owner_kinds.size)
+                    {
+                        return ERR("could not deserialize netlist: data columns differ in length");
+                    }
+
+                    for (u64 i = 0; i < owner_kinds.size; i++)
+                    {
+                        DataContainer* container = nullptr;
+                        switch (owner_kinds[i])
+                        {
+                            case GATE_DATA:
+                                container = nl->get_gate_by_id(owner_ids[i]);
+                                break;
+                            case NET_DATA:
+                                container = nl->get_net_by_id(owner_ids[i]);
+                                break;
+                            case MODULE_DATA:
+                                container = nl->get_module_by_id(owner_ids[i]);
+                                break;
+                        }
+                        if (container == nullptr)
+                        {
+                            return ERR("could not deserialize netlist: data entry references unknown object with ID " + std::to_string(owner_ids[i]));
+                        }
+                        container->set_data(reader.get_string(categories[i]), reader.get_string(keys[i]), reader.get_string(types[i]), reader.get_string(values[i]));
+                    }
+                }
+
+                // classify module nets, internal nets, input nets, and output nets
+                if (auto res = builder.commit(); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not deserialize netlist: failed to commit netlist builder");
+                }
+
+                // load module pins (nets must have been updated beforehand)
+                {
+                    const auto pin_group_modules       = reader.get<u32>(PIN_GROUP_MODULE);
+                    const auto pin_group_ids           = reader.get<u32>(PIN_GROUP_ID);
+                    const auto pin_group_names         = reader.get<u32>(PIN_GROUP_NAME);
+                    const auto pin_group_directions    = reader.get<u32>(PIN_GROUP_DIRECTION);
+                    const auto pin_group_types         = reader.get<u32>(PIN_GROUP_TYPE);
+                    const auto pin_group_ascending     = reader.get<u8>(PIN_GROUP_ASCENDING);
+                    const auto pin_group_start_indices = reader.get<u32>(PIN_GROUP_START_INDEX);
+                    const auto pin_group_pin_offsets   = reader.get<u64>(PIN_GROUP_PIN_OFFSETS);
+                    const auto pin_ids                 = reader.get<u32>(MODULE_PIN_ID);
+                    const auto pin_names               = reader.get<u32>(MODULE_PIN_NAME);
+                    const auto pin_types               = reader.get<u32>(MODULE_PIN_TYPE);
+                    const auto pin_nets                = reader.get<u32>(MODULE_PIN_NET);
+                    if (pin_group_ids.size != pin_group_modules.size || pin_group_names.size != pin_group_modules.size || pin_group_directions.size != pin_group_modules.size
+                        || pin_group_types.size != pin_group_modules.size || pin_group_ascending.size != pin_group_modules.size || pin_group_start_indices.size != pin_group_modules.size
+                        || (pin_group_modules.size > 0 && pin_group_pin_offsets.size != pin_group_modules.size + 1) || pin_names.size != pin_ids.size || pin_types.size != pin_ids.size
+                        || pin_nets.size != pin_ids.size)
+                    {
+                        return ERR("could not deserialize netlist: pin columns differ in length");
+                    }
+
+                    for (u64 i = 0; i < pin_group_modules.size; i++)
+                    {
+                        Module* sm = nl->get_module_by_id(pin_group_modules[i]);
+                        if (sm == nullptr || pin_group_pin_offsets[i] > pin_group_pin_offsets[i + 1] || pin_group_pin_offsets[i + 1] > pin_ids.size)
+                        {
+                            return ERR("could not deserialize netlist: invalid pin group with ID " + std::to_string(pin_group_ids[i]) + " of module with ID " + std::to_string(pin_group_modules[i]));
+                        }
+
+                        std::vector<ModulePin*> pins;
+                        for (u64 j = pin_group_pin_offsets[i]; j < pin_group_pin_offsets[i + 1]; j++)
+                        {
+                            const std::string pin_name = reader.get_string(pin_names[j]);
+                            if (auto res = sm->create_pin(
+                                    pin_ids[j], pin_name, nl->get_net_by_id(pin_nets[j]), enum_from_string<PinType>(reader.get_string(pin_types[j]), PinType::none), false);
+                                res.is_error())
+                            {
+                                return ERR_APPEND(res.get_error(),
+                                                  "could not deserialize pin '" + pin_name + "' of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id()) + ": failed to create pin");
+                            }
+                            else
+                            {
+                                pins.push_back(res.get());
+                            }
+                        }
+
+                        const std::string pin_group_name = reader.get_string(pin_group_names[i]);
+                        if (auto res = sm->create_pin_group(pin_group_ids[i],
+                                                            pin_group_name,
+                                                            pins,
+                                                            enum_from_string<PinDirection>(reader.get_string(pin_group_directions[i]), PinDirection::none),
+                                                            enum_from_string<PinType>(reader.get_string(pin_group_types[i]), PinType::none),
+                                                            pin_group_ascending[i] != 0,
+                                                            pin_group_start_indices[i]);
+                            res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(),
+                                              "could not deserialize pin group '" + pin_group_name + "' of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id())
+                                                  + ": failed to create pin group");
+                        }
+                    }
+                }
+
+                // re-enable automatically checking module nets
+                nl->enable_automatic_net_checks(true);
+
+                return OK(std::move(nl));
+            }
+        }    // namespace
+
+        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file)
+        {
+            if (nl == nullptr)
+            {
+                return false;
+            }
+
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            std::filesystem::path serialize_to_dir = hal_file.parent_path();
+            if (serialize_to_dir.empty())
+                return false;
+
+            if (serialize_to_dir.is_relative())
+                serialize_to_dir = ProjectManager::instance()->get_project_directory() / serialize_to_dir;
+
+            // create directory if it got erased in the meantime
+            if (!std::filesystem::exists(serialize_to_dir))
+            {
+                std::error_code err;
+                if (!std::filesystem::create_directories(serialize_to_dir, err))
+                {
+                    log_error("netlist_persistent", "Could not create directory '{}', error was '{}'.", serialize_to_dir.string(), err.message());
+                    return false;
+                }
+            }
+
+            std::ofstream hal_file_stream(hal_file, std::ios::binary | std::ios::trunc);
+            if (hal_file_stream.fail())
+            {
+                log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", hal_file.string());
+                return false;
+            }
+
+            if (!serialize(nl, hal_file_stream))
+            {
+                log_error("netlist_persistent", "could not write binary netlist file {}.", hal_file.string());
+                return false;
+            }
+
+            hal_file_stream.close();
+
+            log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+
+            return true;
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file)
+        {
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            ColumnReader reader;
+            if (auto res = reader.open(hal_file); res.is_error())
+            {
+                log_error("netlist_persistent", "{}", res.get_error().get());
+                return nullptr;
+            }
+
+            if (reader.get_version() > BINARY_FORMAT_VERSION)
+            {
+                log_warning("netlist_persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
+            }
+
+            auto res = deserialize(reader);
+            if (res.is_error())
+            {
+                log_error("netlist_persistent", "could not deserialize netlist from '{}':\n{}", hal_file.string(), res.get_error().get());
+                return nullptr;
+            }
+
+            log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+
+            return res.get();
+        }
+
+        bool is_binary_file(const std::filesystem::path& hal_file)
+        {
+            std::ifstream stream(hal_file, std::ios::binary);
+            char magic[sizeof(MAGIC)];
+            if (!stream.read(magic, sizeof(magic)))
+            {
+                return false;
+            }
+            return std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+        }
+    }    // namespace netlist_binary_serializer
+}    // namespace hal
+
+#undef DURATION
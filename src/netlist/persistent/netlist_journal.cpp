@@ -0,0 +1,916 @@
+#include "hal_core/netlist/persistent/netlist_journal.h"
+
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/log.h"
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+namespace hal
+{
+    struct NetlistJournal::Changes
+    {
+        bool recording       = true;
+        bool netlist_changed = false;
+        std::set<u32> changed_gates;
+        std::set<u32> removed_gates;
+        std::set<u32> changed_nets;
+        std::set<u32> removed_nets;
+        std::set<u32> changed_modules;
+        std::set<u32> removed_modules;
+
+        bool empty() const
+        {
+            return !netlist_changed && changed_gates.empty() && removed_gates.empty() && changed_nets.empty() && removed_nets.empty() && changed_modules.empty() && removed_modules.empty();
+        }
+
+        void clear()
+        {
+            netlist_changed = false;
+            changed_gates.clear();
+            removed_gates.clear();
+            changed_nets.clear();
+            removed_nets.clear();
+            changed_modules.clear();
+            removed_modules.clear();
+        }
+    };
+
+    namespace
+    {
+        const std::string CALLBACK_NAME = "netlist_journal";
+
+        using DataMap    = std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>;
+        using JsonWriter = rapidjson::Writer<rapidjson::StringBuffer>;
+
+        struct PinGroupRecord
+        {
+            struct PinRecord
+            {
+                u32 id;
+                std::string name;
+                PinType type;
+                u32 net_id;
+            };
+
+            u32 id;
+            std::string name;
+            PinDirection direction;
+            PinType type;
+            bool ascending;
+            u32 start_index;
+            std::vector<PinRecord> pins;
+        };
+
+        /*
+         * ################################################################
+         *      writing
+         * ################################################################
+         */
+
+        void write_string(JsonWriter& writer, const std::string& str)
+        {
+            writer.String(str.c_str(), (rapidjson::SizeType)str.length());
+        }
+
+        void write_data(JsonWriter& writer, const DataMap& data)
+        {
+            writer.Key("data");
+            writer.StartArray();
+            for (const auto& [key, value] : data)
+            {
+                writer.StartArray();
+                write_string(writer, std::get<0>(key));
+                write_string(writer, std::get<1>(key));
+                write_string(writer, std::get<0>(value));
+                write_string(writer, std::get<1>(value));
+                writer.EndArray();
+            }
+            writer.EndArray();
+        }
+
+        template<typename T>
+        void write_ids(JsonWriter& writer, const char* key, const std::vector<T*>& objects)
+        {
+            writer.Key(key);
+            writer.StartArray();
+            for (const T* object : objects)
+            {
+                writer.Uint(object->get_id());
+            }
+            writer.EndArray();
+        }
+
+        void write_endpoints(JsonWriter& writer, const char* key, const std::vector<Endpoint*>& endpoints)
+        {
+            writer.Key(key);
+            writer.StartArray();
+            for (const Endpoint* ep : endpoints)
+            {
+                writer.StartObject();
+                writer.Key("gate_id");
+                writer.Uint(ep->get_gate()->get_id());
+                writer.Key("pin_id");
+                writer.Uint(ep->get_pin()->get_id());
+                writer.EndObject();
+            }
+            writer.EndArray();
+        }
+
+        void write_removal(JsonWriter& writer, const char* op, u32 id)
+        {
+            writer.StartObject();
+            writer.Key("op");
+            writer.String(op);
+            writer.Key("id");
+            writer.Uint(id);
+            writer.EndObject();
+        }
+
+        void write_gate(JsonWriter& writer, const Gate* gate)
+        {
+            writer.StartObject();
+            writer.Key("op");
+            writer.String("gate");
+            writer.Key("id");
+            writer.Uint(gate->get_id());
+            writer.Key("name");
+            write_string(writer, gate->get_name());
+            writer.Key("type");
+            write_string(writer, gate->get_type()->get_name());
+            writer.Key("module");
+            writer.Uint(gate->get_module()->get_id());
+            write_data(writer, gate->get_data_map());
+            writer.Key("custom_functions");
+            writer.StartObject();
+            for (const auto& [name, function] : gate->get_boolean_functions(true))
+            {
+                writer.Key(name.c_str(), (rapidjson::SizeType)name.length());
+                write_string(writer, function.to_string());
+            }
+            writer.EndObject();
+            writer.EndObject();
+        }
+
+        void write_net(JsonWriter& writer, const Net* net)
+        {
+            writer.StartObject();
+            writer.Key("op");
+            writer.String("net");
+            writer.Key("id");
+            writer.Uint(net->get_id());
+            writer.Key("name");
+            write_string(writer, net->get_name());
+            write_endpoints(writer, "srcs", net->get_sources());
+            write_endpoints(writer, "dsts", net->get_destinations());
+            write_data(writer, net->get_data_map());
+            writer.EndObject();
+        }
+
+        void write_module(JsonWriter& writer, const Module* module)
+        {
+            writer.StartObject();
+            writer.Key("op");
+            writer.String("module");
+            writer.Key("id");
+            writer.Uint(module->get_id());
+            writer.Key("name");
+            write_string(writer, module->get_name());
+            writer.Key("type");
+            write_string(writer, module->get_type());
+            writer.Key("parent");
+            const Module* parent = module->get_parent_module();
+            writer.Uint((parent == nullptr) ? 0 : parent->get_id());
+            write_data(writer, module->get_data_map());
+            writer.Key("pin_groups");
+            writer.StartArray();
+            for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+            {
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(pin_group->get_id());
+                writer.Key("name");
+                write_string(writer, pin_group->get_name());
+                writer.Key("direction");
+                write_string(writer, enum_to_string(pin_group->get_direction()));
+                writer.Key("type");
+                write_string(writer, enum_to_string(pin_group->get_type()));
+                writer.Key("ascending");
+                writer.Bool(pin_group->is_ascending());
+                writer.Key("start_index");
+                writer.Uint(pin_group->get_start_index());
+                writer.Key("pins");
+                writer.StartArray();
+                for (const ModulePin* pin : pin_group->get_pins())
+                {
+                    writer.StartObject();
+                    writer.Key("id");
+                    writer.Uint(pin->get_id());
+                    writer.Key("name");
+                    write_string(writer, pin->get_name());
+                    writer.Key("type");
+                    write_string(writer, enum_to_string(pin->get_type()));
+                    writer.Key("net_id");
+                    writer.Uint(pin->get_net()->get_id());
+                    writer.EndObject();
+                }
+                writer.EndArray();
+                writer.EndObject();
+            }
+            writer.EndArray();
+            writer.EndObject();
+        }
+
+        void write_netlist(JsonWriter& writer, const Netlist* nl)
+        {
+            writer.StartObject();
+            writer.Key("op");
+            writer.String("netlist");
+            writer.Key("id");
+            writer.Uint(nl->get_id());
+            writer.Key("input_file");
+            write_string(writer, nl->get_input_filename().string());
+            writer.Key("design_name");
+            write_string(writer, nl->get_design_name());
+            writer.Key("device_name");
+            write_string(writer, nl->get_device_name());
+            write_ids(writer, "global_vcc", nl->get_vcc_gates());
+            write_ids(writer, "global_gnd", nl->get_gnd_gates());
+            write_ids(writer, "global_in", nl->get_global_input_nets());
+            write_ids(writer, "global_out", nl->get_global_output_nets());
+            writer.EndObject();
+        }
+
+        /*
+         * ################################################################
+         *      replaying
+         * ################################################################
+         */
+
+        DataMap read_data(const rapidjson::Value& val)
+        {
+            DataMap data;
+            if (val.HasMember("data"))
+            {
+                for (const auto& entry : val["data"].GetArray())
+                {
+                    data[std::make_tuple(entry[0].GetString(), entry[1].GetString())] = std::make_tuple(entry[2].GetString(), entry[3].GetString());
+                }
+            }
+            return data;
+        }
+
+        Result<std::monostate> replay_module(Netlist* nl, const rapidjson::Value& val, std::vector<std::pair<u32, std::vector<PinGroupRecord>>>& pin_records)
+        {
+            const u32 module_id           = val["id"].GetUint();
+            const std::string module_name = val["name"].GetString();
+            const u32 parent_id           = val["parent"].GetUint();
+
+            Module* module = nl->get_module_by_id(module_id);
+            if (parent_id == 0)
+            {
+                if (module == nullptr || !module->is_top_module())
+                {
+                    return ERR("could not replay module '" + module_name + "' with ID " + std::to_string(module_id) + ": module is not the top module of the netlist");
+                }
+                if (module->get_name() != module_name)
+                {
+                    module->set_name(module_name);
+                }
+            }
+            else
+            {
+                Module* parent = nl->get_module_by_id(parent_id);
+                if (parent == nullptr)
+                {
+                    return ERR("could not replay module '" + module_name + "' with ID " + std::to_string(module_id) + ": parent module with ID " + std::to_string(parent_id) + " does not exist");
+                }
+
+                if (module == nullptr)
+                {
+                    module = nl->create_module(module_id, module_name, parent);
+                    if (module == nullptr)
+                    {
+                        return ERR("could not replay module '" + module_name + "' with ID " + std::to_string(module_id) + ": failed to create module");
+                    }
+                }
+                else
+                {
+                    if (module->get_name() != module_name)
+                    {
+                        module->set_name(module_name);
+                    }
+                    if (module->get_parent_module() != parent && !module->set_parent_module(parent))
+                    {
+                        return ERR("could not replay module '" + module_name + "' with ID " + std::to_string(module_id) + ": failed to move module to parent module with ID "
+                                   + std::to_string(parent_id));
+                    }
+                }
+            }
+
+            if (const std::string type = val["type"].GetString(); module->get_type() != type)
+            {
+                module->set_type(type);
+            }
+            module->set_data_map(read_data(val));
+
+            std::vector<PinGroupRecord> pin_groups;
+            for (const auto& json_pin_group : val["pin_groups"].GetArray())
+            {
+                PinGroupRecord pin_group;
+                pin_group.id          = json_pin_group["id"].GetUint();
+                pin_group.name        = json_pin_group["name"].GetString();
+                pin_group.direction   = enum_from_string<PinDirection>(json_pin_group["direction"].GetString());
+                pin_group.type        = enum_from_string<PinType>(json_pin_group["type"].GetString());
+                pin_group.ascending   = json_pin_group["ascending"].GetBool();
+                pin_group.start_index = json_pin_group["start_index"].GetUint();
+                for (const auto& json_pin : json_pin_group["pins"].GetArray())
+                {
+                    pin_group.pins.push_back({json_pin["id"].GetUint(), json_pin["name"].GetString(), enum_from_string<PinType>(json_pin["type"].GetString()), json_pin["net_id"].GetUint()});
+                }
+                pin_groups.push_back(std::move(pin_group));
+            }
+            pin_records.emplace_back(module_id, std::move(pin_groups));
+
+            return OK({});
+        }
+
+        Result<std::monostate> replay_gate(Netlist* nl, const rapidjson::Value& val)
+        {
+            const u32 gate_id           = val["id"].GetUint();
+            const std::string gate_name = val["name"].GetString();
+            const std::string type_name = val["type"].GetString();
+            const u32 module_id         = val["module"].GetUint();
+
+            GateType* gate_type = nl->get_gate_library()->get_gate_type_by_name(type_name);
+            if (gate_type == nullptr)
+            {
+                return ERR("could not replay gate '" + gate_name + "' with ID " + std::to_string(gate_id) + ": failed to find gate type '" + type_name + "' in gate library '"
+                           + nl->get_gate_library()->get_name() + "'");
+            }
+
+            Module* module = nl->get_module_by_id(module_id);
+            if (module == nullptr)
+            {
+                return ERR("could not replay gate '" + gate_name + "' with ID " + std::to_string(gate_id) + ": module with ID " + std::to_string(module_id) + " does not exist");
+            }
+
+            Gate* gate = nl->get_gate_by_id(gate_id);
+            if (gate != nullptr && gate->get_type() != gate_type)
+            {
+                nl->delete_gate(gate);
+                gate = nullptr;
+            }
+
+            if (gate == nullptr)
+            {
+                gate = nl->create_gate(gate_id, gate_type, gate_name);
+                if (gate == nullptr)
+                {
+                    return ERR("could not replay gate '" + gate_name + "' with ID " + std::to_string(gate_id) + ": failed to create gate");
+                }
+            }
+            else if (gate->get_name() != gate_name)
+            {
+                gate->set_name(gate_name);
+            }
+
+            if (gate->get_module() != module && !module->assign_gate(gate))
+            {
+                return ERR("could not replay gate '" + gate_name + "' with ID " + std::to_string(gate_id) + ": failed to assign gate to module with ID " + std::to_string(module_id));
+            }
+
+            gate->set_data_map(read_data(val));
+
+            for (auto it = val["custom_functions"].MemberBegin(); it != val["custom_functions"].MemberEnd(); ++it)
+            {
+                auto function = BooleanFunction::from_string(it->value.GetString());
+                if (function.is_error())
+                {
+                    return ERR_APPEND(function.get_error(), "could not replay gate '" + gate_name + "' with ID " + std::to_string(gate_id) + ": failed to parse Boolean function");
+                }
+                gate->add_boolean_function(it->name.GetString(), function.get());
+            }
+
+            return OK({});
+        }
+
+        Result<std::monostate> replay_endpoints(Netlist* nl, Net* net, const rapidjson::Value& val, bool is_destination)
+        {
+            std::set<std::pair<u32, u32>> recorded;
+            for (const auto& ep_node : val.GetArray())
+            {
+                recorded.insert(std::make_pair(ep_node["gate_id"].GetUint(), ep_node["pin_id"].GetUint()));
+            }
+
+            // keep endpoints that did not change, the remaining recorded endpoints are added below
+            for (Endpoint* ep : is_destination ? net->get_destinations() : net->get_sources())
+            {
+                if (recorded.erase(std::make_pair(ep->get_gate()->get_id(), ep->get_pin()->get_id())) == 0)
+                {
+                    if (!(is_destination ? net->remove_destination(ep) : net->remove_source(ep)))
+                    {
+                        return ERR("could not replay net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to remove endpoint");
+                    }
+                }
+            }
+
+            for (const auto& [gate_id, pin_id] : recorded)
+            {
+                Gate* gate   = nl->get_gate_by_id(gate_id);
+                GatePin* pin = (gate != nullptr) ? gate->get_type()->get_pin_by_id(pin_id) : nullptr;
+                if (pin == nullptr)
+                {
+                    return ERR("could not replay net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to find pin with ID " + std::to_string(pin_id)
+                               + " of gate with ID " + std::to_string(gate_id));
+                }
+                if ((is_destination ? net->add_destination(gate, pin) : net->add_source(gate, pin)) == nullptr)
+                {
+                    return ERR("could not replay net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add endpoint at pin '" + pin->get_name() + "' of gate '"
+                               + gate->get_name() + "' with ID " + std::to_string(gate_id));
+                }
+            }
+
+            return OK({});
+        }
+
+        Result<std::monostate> replay_net(Netlist* nl, const rapidjson::Value& val)
+        {
+            const u32 net_id           = val["id"].GetUint();
+            const std::string net_name = val["name"].GetString();
+
+            Net* net = nl->get_net_by_id(net_id);
+            if (net == nullptr)
+            {
+                net = nl->create_net(net_id, net_name);
+                if (net == nullptr)
+                {
+                    return ERR("could not replay net '" + net_name + "' with ID " + std::to_string(net_id) + ": failed to create net");
+                }
+            }
+            else if (net->get_name() != net_name)
+            {
+                net->set_name(net_name);
+            }
+
+            if (auto res = replay_endpoints(nl, net, val["srcs"], false); res.is_error())
+            {
+                return res;
+            }
+            if (auto res = replay_endpoints(nl, net, val["dsts"], true); res.is_error())
+            {
+                return res;
+            }
+
+            net->set_data_map(read_data(val));
+
+            return OK({});
+        }
+
+        template<typename T>
+        void replay_marks(const rapidjson::Value& val,
+                          const std::vector<T*>& current,
+                          const std::function<T*(u32)>& get_by_id,
+                          const std::function<bool(T*)>& mark,
+                          const std::function<bool(T*)>& unmark)
+        {
+            std::set<u32> recorded;
+            for (const auto& id_node : val.GetArray())
+            {
+                recorded.insert(id_node.GetUint());
+            }
+
+            for (T* object : std::vector<T*>(current))
+            {
+                if (recorded.erase(object->get_id()) == 0)
+                {
+                    unmark(object);
+                }
+            }
+
+            for (u32 id : recorded)
+            {
+                if (T* object = get_by_id(id); object != nullptr)
+                {
+                    mark(object);
+                }
+            }
+        }
+
+        void replay_netlist(Netlist* nl, const rapidjson::Value& val)
+        {
+            nl->set_id(val["id"].GetUint());
+            nl->set_input_filename(val["input_file"].GetString());
+            nl->set_design_name(val["design_name"].GetString());
+            nl->set_device_name(val["device_name"].GetString());
+
+            auto get_gate = [nl](u32 id) { return nl->get_gate_by_id(id); };
+            auto get_net  = [nl](u32 id) { return nl->get_net_by_id(id); };
+            replay_marks<Gate>(
+                val["global_vcc"], nl->get_vcc_gates(), get_gate, [nl](Gate* g) { return nl->mark_vcc_gate(g); }, [nl](Gate* g) { return nl->unmark_vcc_gate(g); });
+            replay_marks<Gate>(
+                val["global_gnd"], nl->get_gnd_gates(), get_gate, [nl](Gate* g) { return nl->mark_gnd_gate(g); }, [nl](Gate* g) { return nl->unmark_gnd_gate(g); });
+            replay_marks<Net>(
+                val["global_in"], nl->get_global_input_nets(), get_net, [nl](Net* n) { return nl->mark_global_input_net(n); }, [nl](Net* n) { return nl->unmark_global_input_net(n); });
+            replay_marks<Net>(
+                val["global_out"], nl->get_global_output_nets(), get_net, [nl](Net* n) { return nl->mark_global_output_net(n); }, [nl](Net* n) { return nl->unmark_global_output_net(n); });
+        }
+
+        void replay_pin_groups(Module* module, const std::vector<PinGroupRecord>& pin_groups)
+        {
+            // the previous pins of the module have been removed, so pins and pin groups can be recreated with their original IDs
+            for (const PinGroupRecord& record : pin_groups)
+            {
+                std::vector<ModulePin*> pins;
+                for (const PinGroupRecord::PinRecord& pin_record : record.pins)
+                {
+                    Net* net = module->get_netlist()->get_net_by_id(pin_record.net_id);
+                    if (net == nullptr)
+                    {
+                        log_warning("netlist_persistent", "could not restore pin '{}' of module '{}' with ID {}: net with ID {} does not exist", pin_record.name, module->get_name(), module->get_id(), pin_record.net_id);
+                        continue;
+                    }
+                    if (auto res = module->create_pin(pin_record.id, pin_record.name, net, pin_record.type, false); res.is_error())
+                    {
+                        log_warning("netlist_persistent", "could not restore pin '{}' of module '{}' with ID {}:\n{}", pin_record.name, module->get_name(), module->get_id(), res.get_error().get());
+                    }
+                    else
+                    {
+                        pins.push_back(res.get());
+                    }
+                }
+
+                if (auto res = module->create_pin_group(record.id, record.name, pins, record.direction, record.type, record.ascending, record.start_index); res.is_error())
+                {
+                    log_warning("netlist_persistent", "could not restore pin group '{}' of module '{}' with ID {}:\n{}", record.name, module->get_name(), module->get_id(), res.get_error().get());
+                }
+            }
+        }
+
+        Result<std::monostate> replay_transaction(Netlist* nl, const std::vector<std::string_view>& records, std::vector<std::pair<u32, std::vector<PinGroupRecord>>>& pin_records)
+        {
+            for (const std::string_view& record : records)
+            {
+                rapidjson::Document document;
+                document.Parse(record.data(), record.size());
+                if (document.HasParseError() || !document.IsObject() || !document.HasMember("op"))
+                {
+                    return ERR("could not replay journal transaction: invalid record '" + std::string(record) + "'");
+                }
+
+                const std::string op = document["op"].GetString();
+                if (op == "remove_net")
+                {
+                    if (Net* net = nl->get_net_by_id(document["id"].GetUint()); net != nullptr)
+                    {
+                        nl->delete_net(net);
+                    }
+                }
+                else if (op == "remove_gate")
+                {
+                    if (Gate* gate = nl->get_gate_by_id(document["id"].GetUint()); gate != nullptr)
+                    {
+                        nl->delete_gate(gate);
+                    }
+                }
+                else if (op == "remove_module")
+                {
+                    if (Module* module = nl->get_module_by_id(document["id"].GetUint()); module != nullptr && !module->is_top_module())
+                    {
+                        nl->delete_module(module);
+                    }
+                }
+                else if (op == "module")
+                {
+                    if (auto res = replay_module(nl, document, pin_records); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not replay journal transaction");
+                    }
+                }
+                else if (op == "gate")
+                {
+                    if (auto res = replay_gate(nl, document); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not replay journal transaction");
+                    }
+                }
+                else if (op == "net")
+                {
+                    if (auto res = replay_net(nl, document); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not replay journal transaction");
+                    }
+                }
+                else if (op == "netlist")
+                {
+                    replay_netlist(nl, document);
+                }
+                else
+                {
+                    return ERR("could not replay journal transaction: unknown record type '" + op + "'");
+                }
+            }
+
+            return OK({});
+        }
+
+        u32 get_depth(const Module* module)
+        {
+            u32 depth = 0;
+            for (const Module* parent = module->get_parent_module(); parent != nullptr; parent = parent->get_parent_module())
+            {
+                depth++;
+            }
+            return depth;
+        }
+    }    // namespace
+
+    NetlistJournal::NetlistJournal(Netlist* netlist) : m_netlist(netlist), m_changes(std::make_shared<Changes>())
+    {
+        // the callbacks share the recorded changes, so that they remain valid if the journal is destroyed before the netlist
+        std::shared_ptr<Changes> changes = m_changes;
+        EventHandler* event_handler      = m_netlist->get_event_handler();
+
+        event_handler->register_callback(CALLBACK_NAME, std::function<void(NetlistEvent::event, Netlist*, u32)>([changes](NetlistEvent::event, Netlist*, u32) {
+                                             if (changes->recording)
+                                             {
+                                                 changes->netlist_changed = true;
+                                             }
+                                         }));
+
+        event_handler->register_callback(CALLBACK_NAME, std::function<void(GateEvent::event, Gate*, u32)>([changes](GateEvent::event ev, Gate* gate, u32) {
+                                             if (!changes->recording)
+                                             {
+                                                 return;
+                                             }
+                                             if (ev == GateEvent::event::removed)
+                                             {
+                                                 changes->changed_gates.erase(gate->get_id());
+                                                 changes->removed_gates.insert(gate->get_id());
+                                             }
+                                             else
+                                             {
+                                                 changes->changed_gates.insert(gate->get_id());
+                                             }
+                                         }));
+
+        event_handler->register_callback(CALLBACK_NAME, std::function<void(NetEvent::event, Net*, u32)>([changes](NetEvent::event ev, Net* net, u32) {
+                                             if (!changes->recording)
+                                             {
+                                                 return;
+                                             }
+                                             if (ev == NetEvent::event::removed)
+                                             {
+                                                 changes->changed_nets.erase(net->get_id());
+                                                 changes->removed_nets.insert(net->get_id());
+                                             }
+                                             else
+                                             {
+                                                 changes->changed_nets.insert(net->get_id());
+                                             }
+                                         }));
+
+        event_handler->register_callback(CALLBACK_NAME, std::function<void(ModuleEvent::event, Module*, u32)>([changes](ModuleEvent::event ev, Module* module, u32 associated_data) {
+                                             if (!changes->recording)
+                                             {
+                                                 return;
+                                             }
+                                             switch (ev)
+                                             {
+                                                 case ModuleEvent::event::removed:
+                                                     changes->changed_modules.erase(module->get_id());
+                                                     changes->removed_modules.insert(module->get_id());
+                                                     break;
+                                                 case ModuleEvent::event::created:
+                                                 case ModuleEvent::event::name_changed:
+                                                 case ModuleEvent::event::type_changed:
+                                                 case ModuleEvent::event::parent_changed:
+                                                 case ModuleEvent::event::pin_changed:
+                                                 case ModuleEvent::event::data_changed:
+                                                     changes->changed_modules.insert(module->get_id());
+                                                     break;
+                                                 case ModuleEvent::event::gate_assigned:
+                                                 case ModuleEvent::event::gate_removed:
+                                                     // the module of a gate is stored with the gate
+                                                     changes->changed_gates.insert(associated_data);
+                                                     break;
+                                                 default:
+                                                     break;
+                                             }
+                                         }));
+    }
+
+    NetlistJournal::~NetlistJournal()
+    {
+        // the netlist may already have been destroyed, so the callbacks are only disabled
+        m_changes->recording = false;
+        m_changes->clear();
+    }
+
+    Netlist* NetlistJournal::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    bool NetlistJournal::has_changes() const
+    {
+        return !m_changes->empty();
+    }
+
+    void NetlistJournal::clear()
+    {
+        m_changes->clear();
+    }
+
+    Result<u64> NetlistJournal::append_to_file(const std::filesystem::path& journal_file)
+    {
+        if (m_changes->empty())
+        {
+            return OK(0);
+        }
+
+        rapidjson::StringBuffer buffer;
+        JsonWriter writer(buffer);
+        auto end_record = [&writer, &buffer]() {
+            buffer.Put('\n');
+            writer.Reset(buffer);
+        };
+
+        // removals first, since IDs of removed objects may have been reused by new objects
+        for (u32 id : m_changes->removed_nets)
+        {
+            write_removal(writer, "remove_net", id);
+            end_record();
+        }
+        for (u32 id : m_changes->removed_gates)
+        {
+            write_removal(writer, "remove_gate", id);
+            end_record();
+        }
+        for (u32 id : m_changes->removed_modules)
+        {
+            write_removal(writer, "remove_module", id);
+            end_record();
+        }
+
+        // parent modules must exist before their submodules and gates
+        std::vector<std::pair<u32, const Module*>> modules;
+        for (u32 id : m_changes->changed_modules)
+        {
+            if (const Module* module = m_netlist->get_module_by_id(id); module != nullptr)
+            {
+                modules.emplace_back(get_depth(module), module);
+            }
+        }
+        std::sort(modules.begin(), modules.end(), [](const auto& lhs, const auto& rhs) {
+            return (lhs.first != rhs.first) ? (lhs.first < rhs.first) : (lhs.second->get_id() < rhs.second->get_id());
+        });
+        for (const auto& [depth, module] : modules)
+        {
+            write_module(writer, module);
+            end_record();
+        }
+
+        for (u32 id : m_changes->changed_gates)
+        {
+            if (const Gate* gate = m_netlist->get_gate_by_id(id); gate != nullptr)
+            {
+                write_gate(writer, gate);
+                end_record();
+            }
+        }
+
+        for (u32 id : m_changes->changed_nets)
+        {
+            if (const Net* net = m_netlist->get_net_by_id(id); net != nullptr)
+            {
+                write_net(writer, net);
+                end_record();
+            }
+        }
+
+        if (m_changes->netlist_changed)
+        {
+            write_netlist(writer, m_netlist);
+            end_record();
+        }
+
+        writer.StartObject();
+        writer.Key("op");
+        writer.String("commit");
+        writer.EndObject();
+        end_record();
+
+        FILE* journal = fopen(journal_file.string().c_str(), "ab");
+        if (journal == NULL)
+        {
+            return ERR("could not append to journal file '" + journal_file.string() + "': unable to open file");
+        }
+        const size_t written = fwrite(buffer.GetString(), 1, buffer.GetSize(), journal);
+        if (fclose(journal) != 0 || written != buffer.GetSize())
+        {
+            return ERR("could not append to journal file '" + journal_file.string() + "': unable to write file");
+        }
+
+        m_changes->clear();
+        return OK(written);
+    }
+
+    void NetlistJournal::clear_module_pins(Module* module)
+    {
+        const std::vector<ModulePin*> pins = module->get_pins();
+        for (PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+        {
+            module->delete_pin_group_internal(pin_group);
+        }
+        for (ModulePin* pin : pins)
+        {
+            module->delete_pin_internal(pin);
+        }
+    }
+
+    Result<u32> NetlistJournal::replay(Netlist* netlist, const std::filesystem::path& journal_file)
+    {
+        if (netlist == nullptr)
+        {
+            return ERR("could not replay journal file '" + journal_file.string() + "': netlist is a 'nullptr'");
+        }
+
+        std::ifstream ifs(journal_file, std::ios::binary);
+        if (!ifs.good())
+        {
+            return ERR("could not replay journal file '" + journal_file.string() + "': unable to open file");
+        }
+        std::stringstream ss;
+        ss << ifs.rdbuf();
+        const std::string content = ss.str();
+
+        // records of a transaction are only applied once its commit record has been read
+        const std::string_view commit = "{\"op\":\"commit\"}";
+        std::vector<std::string_view> records;
+        u32 num_transactions = 0;
+        size_t pos           = 0;
+        while (pos < content.size())
+        {
+            size_t end = content.find('\n', pos);
+            if (end == std::string::npos)
+            {
+                break;
+            }
+
+            const std::string_view line(content.data() + pos, end - pos);
+            pos = end + 1;
+
+            if (line.empty())
+            {
+                continue;
+            }
+            if (line != commit)
+            {
+                records.push_back(line);
+                continue;
+            }
+
+            // pins depend on the nets and are hence restored at the end of the transaction
+            std::vector<std::pair<u32, std::vector<PinGroupRecord>>> pin_records;
+            if (auto res = replay_transaction(netlist, records, pin_records); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not replay journal file '" + journal_file.string() + "'");
+            }
+
+            // disable automatically checking module nets while recreating the pins
+            netlist->enable_automatic_net_checks(false);
+            for (const auto& [module_id, pin_groups] : pin_records)
+            {
+                if (Module* module = netlist->get_module_by_id(module_id); module != nullptr)
+                {
+                    clear_module_pins(module);
+                    replay_pin_groups(module, pin_groups);
+                }
+            }
+            netlist->enable_automatic_net_checks(true);
+            records.clear();
+            num_transactions++;
+        }
+
+        if (!records.empty() || pos < content.size())
+        {
+            log_warning("netlist_persistent", "discarded incomplete transaction at the end of journal file '{}'.", journal_file.string());
+        }
+
+        return OK(num_transactions);
+    }
+}    // namespace hal
@@ -6,9 +6,13 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_builder.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/utilities/log.h"
+#include "rapidjson/document.h"
 #include "rapidjson/filereadstream.h"
+#include "rapidjson/filewritestream.h"
 #include "rapidjson/stringbuffer.h"
 
 #define PRETTY_JSON_OUTPUT false
@@ -18,10 +22,10 @@
 #include "rapidjson/writer.h"
 #endif
 
+#include <atomic>
 #include <chrono>
-#include <fstream>
 #include <queue>
-#include <sstream>
+#include <thread>
 
 #ifndef DURATION
 #define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
@@ -36,7 +40,16 @@ namespace hal
         {
             const int SERIALIZATION_FORMAT_VERSION = 11;
 
-#define JSON_STR_HELPER(x) rapidjson::Value{}.SetString(x.c_str(), x.length(), allocator)
+            // number of gates, nets, or modules that are serialized in parallel before being written to the file
+            const size_t SERIALIZATION_CHUNK_SIZE = 4096;
+
+#if PRETTY_JSON_OUTPUT == 1
+            using FileWriter  = rapidjson::PrettyWriter<rapidjson::FileWriteStream>;
+            using ChunkWriter = rapidjson::PrettyWriter<rapidjson::StringBuffer>;
+#else
+            using FileWriter  = rapidjson::Writer<rapidjson::FileWriteStream>;
+            using ChunkWriter = rapidjson::Writer<rapidjson::StringBuffer>;
+#endif
 
 #define assert_availablility(MEMBER)                                                               \
     if (!root.HasMember(MEMBER))                                                                   \
@@ -68,20 +81,81 @@ namespace hal
 
             }    // namespace
 
+            template<typename Writer>
+            void write_string(Writer& writer, const std::string& str)
+            {
+                writer.String(str.c_str(), (rapidjson::SizeType)str.length());
+            }
+
+            /**
+             * Serializes all objects into a JSON array, preserving their order.
+             * The objects are processed in chunks: the objects of a chunk are serialized into separate string buffers by multiple threads and then appended to the array in order.
+             * This bounds the memory required to the size of a single chunk instead of the entire netlist.
+             */
+            template<typename T>
+            void serialize_array_in_parallel(FileWriter& writer, const std::vector<T*>& objects, void (*serialize_object)(const T*, ChunkWriter&))
+            {
+                const size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+                std::vector<rapidjson::StringBuffer> buffers(std::min(objects.size(), SERIALIZATION_CHUNK_SIZE));
+
+                writer.StartArray();
+                for (size_t chunk_begin = 0; chunk_begin < objects.size(); chunk_begin += SERIALIZATION_CHUNK_SIZE)
+                {
+                    const size_t chunk_size = std::min(objects.size() - chunk_begin, SERIALIZATION_CHUNK_SIZE);
+
+                    std::atomic<size_t> next_index = 0;
+                    auto worker                    = [&]() {
+                        for (size_t i = next_index++; i < chunk_size; i = next_index++)
+                        {
+                            buffers[i].Clear();
+                            ChunkWriter chunk_writer(buffers[i]);
+                            serialize_object(objects[chunk_begin + i], chunk_writer);
+                        }
+                    };
+
+                    std::vector<std::thread> threads;
+                    for (size_t t = 1; t < std::min(num_threads, chunk_size); t++)
+                    {
+                        threads.emplace_back(worker);
+                    }
+                    worker();
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    for (size_t i = 0; i < chunk_size; i++)
+                    {
+                        writer.RawValue(buffers[i].GetString(), buffers[i].GetSize(), rapidjson::kObjectType);
+                    }
+                }
+                writer.EndArray();
+            }
+
+            void serialize_id_array(FileWriter& writer, const std::vector<u32>& ids)
+            {
+                writer.StartArray();
+                for (u32 id : ids)
+                {
+                    writer.Uint(id);
+                }
+                writer.EndArray();
+            }
+
             // serialize container data
-            rapidjson::Value serialize(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data, rapidjson::Document::AllocatorType& allocator)
+            void serialize(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data, ChunkWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kArrayType);
+                writer.StartArray();
                 for (const auto& it : data)
                 {
-                    rapidjson::Value entry(rapidjson::kArrayType);
-                    entry.PushBack(JSON_STR_HELPER(std::get<0>(it.first)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<1>(it.first)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<0>(it.second)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<1>(it.second)), allocator);
-                    val.PushBack(entry, allocator);
+                    writer.StartArray();
+                    write_string(writer, std::get<0>(it.first));
+                    write_string(writer, std::get<1>(it.first));
+                    write_string(writer, std::get<0>(it.second));
+                    write_string(writer, std::get<1>(it.second));
+                    writer.EndArray();
                 }
-                return val;
+                writer.EndArray();
             }
 
             void deserialize_data(DataContainer* c, const rapidjson::Value& val)
@@ -93,15 +167,17 @@ namespace hal
             }
 
             // serialize endpoint
-            rapidjson::Value serialize(const Endpoint* ep, rapidjson::Document::AllocatorType& allocator)
+            void serialize(const Endpoint* ep, ChunkWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("gate_id", ep->get_gate()->get_id(), allocator);
-                val.AddMember("pin_id", ep->get_pin()->get_id(), allocator);
-                return val;
+                writer.StartObject();
+                writer.Key("gate_id");
+                writer.Uint(ep->get_gate()->get_id());
+                writer.Key("pin_id");
+                writer.Uint(ep->get_pin()->get_id());
+                writer.EndObject();
             }
 
-            bool deserialize_destination(Netlist* nl, Net* net, const rapidjson::Value& val)
+            bool deserialize_destination(Netlist* nl, NetlistBuilder& builder, Net* net, const rapidjson::Value& val)
             {
                 Gate* gate = nl->get_gate_by_id(val["gate_id"].GetUint());
                 GatePin* pin;
@@ -129,7 +205,7 @@ namespace hal
                         return false;
                     }
                 }
-                if (!net->add_destination(gate, pin))
+                if (!builder.add_destination(net, gate, pin))
                 {
                     log_error("netlist_persistent",
                               "could not deserialize destination of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '" + pin->get_name()
@@ -139,7 +215,7 @@ namespace hal
                 return true;
             }
 
-            bool deserialize_source(Netlist* nl, Net* net, const rapidjson::Value& val)
+            bool deserialize_source(Netlist* nl, NetlistBuilder& builder, Net* net, const rapidjson::Value& val)
             {
                 Gate* gate = nl->get_gate_by_id(val["gate_id"].GetUint());
                 GatePin* pin;
@@ -166,7 +242,7 @@ namespace hal
                         return false;
                     }
                 }
-                if (net->add_source(gate, pin) == nullptr)
+                if (builder.add_source(net, gate, pin) == nullptr)
                 {
                     log_error("netlist_persistent",
                               "could not deserialize source of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '" + pin->get_name()
@@ -177,40 +253,42 @@ namespace hal
             }
 
             // serialize gate
-            rapidjson::Value serialize(const Gate* gate, rapidjson::Document::AllocatorType& allocator)
+            void serialize_gate(const Gate* gate, ChunkWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", gate->get_id(), allocator);
-                val.AddMember("name", gate->get_name(), allocator);
-                val.AddMember("type", gate->get_type()->get_name(), allocator);
-                auto data = serialize(gate->get_data_map(), allocator);
-                if (!data.Empty())
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(gate->get_id());
+                writer.Key("name");
+                write_string(writer, gate->get_name());
+                writer.Key("type");
+                write_string(writer, gate->get_type()->get_name());
+                if (const auto& data = gate->get_data_map(); !data.empty())
                 {
-                    val.AddMember("data", data, allocator);
+                    writer.Key("data");
+                    serialize(data, writer);
                 }
+                if (const auto functions = gate->get_boolean_functions(true); !functions.empty())
                 {
-                    rapidjson::Value functions(rapidjson::kObjectType);
-                    for (const auto& [name, function] : gate->get_boolean_functions(true))
-                    {
-                        const std::string function_str = function.to_string();
-                        functions.AddMember(JSON_STR_HELPER(name), JSON_STR_HELPER(function_str), allocator);
-                    }
-                    if (functions.MemberCount() > 0)
+                    writer.Key("custom_functions");
+                    writer.StartObject();
+                    for (const auto& [name, function] : functions)
                     {
-                        val.AddMember("custom_functions", functions, allocator);
+                        writer.Key(name.c_str(), (rapidjson::SizeType)name.length());
+                        write_string(writer, function.to_string());
                     }
+                    writer.EndObject();
                 }
-                return val;
+                writer.EndObject();
             }
 
-            bool deserialize_gate(Netlist* nl, const rapidjson::Value& val, const std::unordered_map<std::string, hal::GateType*>& gate_types)
+            bool deserialize_gate(Netlist* nl, NetlistBuilder& builder, const rapidjson::Value& val, const std::unordered_map<std::string, hal::GateType*>& gate_types)
             {
                 const u32 gate_id           = val["id"].GetUint();
                 const std::string gate_name = val["name"].GetString();
                 const std::string gate_type = val["type"].GetString();
                 if (auto it = gate_types.find(gate_type); it != gate_types.end())
                 {
-                    auto gate = nl->create_gate(gate_id, it->second, gate_name);
+                    auto gate = builder.create_gate(gate_id, it->second, gate_name);
                     if (gate == nullptr)
                     {
                         log_error("netlist_persistent", "could not deserialize gate '" + gate_name + "' with ID " + std::to_string(gate_id) + ": failed to create gate");
@@ -249,53 +327,51 @@ namespace hal
             }
 
             // serialize net
-            rapidjson::Value serialize(const Net* net, rapidjson::Document::AllocatorType& allocator)
+            void serialize_net(const Net* net, ChunkWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", net->get_id(), allocator);
-                val.AddMember("name", net->get_name(), allocator);
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(net->get_id());
+                writer.Key("name");
+                write_string(writer, net->get_name());
 
+                if (std::vector<Endpoint*> sorted = net->get_sources(); !sorted.empty())
                 {
-                    rapidjson::Value srcs(rapidjson::kArrayType);
-                    std::vector<Endpoint*> sorted = net->get_sources();
                     std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+                    writer.Key("srcs");
+                    writer.StartArray();
                     for (const Endpoint* src : sorted)
                     {
-                        srcs.PushBack(serialize(src, allocator), allocator);
-                    }
-                    if (!srcs.Empty())
-                    {
-                        val.AddMember("srcs", srcs, allocator);
+                        serialize(src, writer);
                     }
+                    writer.EndArray();
                 }
 
+                if (std::vector<Endpoint*> sorted = net->get_destinations(); !sorted.empty())
                 {
-                    rapidjson::Value dsts(rapidjson::kArrayType);
-                    std::vector<Endpoint*> sorted = net->get_destinations();
                     std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+                    writer.Key("dsts");
+                    writer.StartArray();
                     for (const Endpoint* dst : sorted)
                     {
-                        dsts.PushBack(serialize(dst, allocator), allocator);
-                    }
-                    if (!dsts.Empty())
-                    {
-                        val.AddMember("dsts", dsts, allocator);
+                        serialize(dst, writer);
                     }
+                    writer.EndArray();
                 }
 
-                auto data = serialize(net->get_data_map(), allocator);
-                if (!data.Empty())
+                if (const auto& data = net->get_data_map(); !data.empty())
                 {
-                    val.AddMember("data", data, allocator);
+                    writer.Key("data");
+                    serialize(data, writer);
                 }
-                return val;
+                writer.EndObject();
             }
 
-            bool deserialize_net(Netlist* nl, const rapidjson::Value& val)
+            bool deserialize_net(Netlist* nl, NetlistBuilder& builder, const rapidjson::Value& val)
             {
                 const u32 net_id           = val["id"].GetUint();
                 const std::string net_name = val["name"].GetString();
-                auto net                   = nl->create_net(net_id, net_name);
+                auto net                   = builder.create_net(net_id, net_name);
                 if (net == nullptr)
                 {
                     log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(net_id) + ": failed to create net");
@@ -306,7 +382,7 @@ namespace hal
                 {
                     for (const auto& src_node : val["srcs"].GetArray())
                     {
-                        if (!deserialize_source(nl, net, src_node))
+                        if (!deserialize_source(nl, builder, net, src_node))
                         {
                             log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(net_id) + ": failed to deserialize source");
                             return false;
@@ -318,7 +394,7 @@ namespace hal
                 {
                     for (const auto& dst_node : val["dsts"].GetArray())
                     {
-                        if (!deserialize_destination(nl, net, dst_node))
+                        if (!deserialize_destination(nl, builder, net, dst_node))
                         {
                             log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(net_id) + ": failed to deserialize destination");
                             return false;
@@ -335,73 +411,80 @@ namespace hal
             }
 
             // serialize module
-            rapidjson::Value serialize(const Module* module, rapidjson::Document::AllocatorType& allocator)
+            void serialize_module(const Module* module, ChunkWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", module->get_id(), allocator);
-                val.AddMember("type", module->get_type(), allocator);
-                val.AddMember("name", module->get_name(), allocator);
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(module->get_id());
+                writer.Key("type");
+                write_string(writer, module->get_type());
+                writer.Key("name");
+                write_string(writer, module->get_name());
+                writer.Key("parent");
                 Module* parent = module->get_parent_module();
-                if (parent == nullptr)
-                {
-                    val.AddMember("parent", 0, allocator);
-                }
-                else
-                {
-                    val.AddMember("parent", parent->get_id(), allocator);
-                }
+                writer.Uint((parent == nullptr) ? 0 : parent->get_id());
+
+                if (std::vector<Gate*> sorted = module->get_gates(nullptr, false); !sorted.empty())
                 {
-                    rapidjson::Value gates(rapidjson::kArrayType);
-                    std::vector<Gate*> sorted = module->get_gates(nullptr, false);
                     std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                    writer.Key("gates");
+                    writer.StartArray();
                     for (const Gate* g : sorted)
                     {
-                        gates.PushBack(g->get_id(), allocator);
-                    }
-                    if (!gates.Empty())
-                    {
-                        val.AddMember("gates", gates, allocator);
+                        writer.Uint(g->get_id());
                     }
+                    writer.EndArray();
                 }
+
+                if (const std::vector<PinGroup<ModulePin>*> pin_groups = module->get_pin_groups(); !pin_groups.empty())
                 {
-                    rapidjson::Value json_pin_groups(rapidjson::kArrayType);
-                    for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+                    writer.Key("pin_groups");
+                    writer.StartArray();
+                    for (const PinGroup<ModulePin>* pin_group : pin_groups)
                     {
-                        rapidjson::Value json_pin_group(rapidjson::kObjectType);
-                        json_pin_group.AddMember("id", pin_group->get_id(), allocator);
-                        json_pin_group.AddMember("name", pin_group->get_name(), allocator);
-                        json_pin_group.AddMember("direction", enum_to_string(pin_group->get_direction()), allocator);
-                        json_pin_group.AddMember("type", enum_to_string(pin_group->get_type()), allocator);
-                        json_pin_group.AddMember("ascending", pin_group->is_ascending(), allocator);
-                        json_pin_group.AddMember("start_index", pin_group->get_start_index(), allocator);
-                        rapidjson::Value json_pins(rapidjson::kArrayType);
+                        writer.StartObject();
+                        writer.Key("id");
+                        writer.Uint(pin_group->get_id());
+                        writer.Key("name");
+                        write_string(writer, pin_group->get_name());
+                        writer.Key("direction");
+                        write_string(writer, enum_to_string(pin_group->get_direction()));
+                        writer.Key("type");
+                        write_string(writer, enum_to_string(pin_group->get_type()));
+                        writer.Key("ascending");
+                        writer.Bool(pin_group->is_ascending());
+                        writer.Key("start_index");
+                        writer.Uint(pin_group->get_start_index());
+                        writer.Key("pins");
+                        writer.StartArray();
                         for (const ModulePin* pin : pin_group->get_pins())
                         {
-                            rapidjson::Value json_pin(rapidjson::kObjectType);
-                            json_pin.AddMember("id", pin->get_id(), allocator);
-                            json_pin.AddMember("name", pin->get_name(), allocator);
-                            json_pin.AddMember("type", enum_to_string(pin->get_type()), allocator);
-                            json_pin.AddMember("net_id", pin->get_net()->get_id(), allocator);
-                            json_pins.PushBack(json_pin, allocator);
+                            writer.StartObject();
+                            writer.Key("id");
+                            writer.Uint(pin->get_id());
+                            writer.Key("name");
+                            write_string(writer, pin->get_name());
+                            writer.Key("type");
+                            write_string(writer, enum_to_string(pin->get_type()));
+                            writer.Key("net_id");
+                            writer.Uint(pin->get_net()->get_id());
+                            writer.EndObject();
                         }
-                        json_pin_group.AddMember("pins", json_pins, allocator);
-                        json_pin_groups.PushBack(json_pin_group, allocator);
-                    }
-                    if (!json_pin_groups.Empty())
-                    {
-                        val.AddMember("pin_groups", json_pin_groups, allocator);
+                        writer.EndArray();
+                        writer.EndObject();
                     }
+                    writer.EndArray();
                 }
 
-                auto data = serialize(module->get_data_map(), allocator);
-                if (!data.Empty())
+                if (const auto& data = module->get_data_map(); !data.empty())
                 {
-                    val.AddMember("data", data, allocator);
+                    writer.Key("data");
+                    serialize(data, writer);
                 }
-                return val;
+                writer.EndObject();
             }
 
-            bool deserialize_module(Netlist* nl, const rapidjson::Value& val, std::unordered_map<Module*, std::vector<PinGroupInformation>>& pin_group_cache)
+            bool deserialize_module(Netlist* nl, NetlistBuilder& builder, const rapidjson::Value& val, std::unordered_map<Module*, std::vector<PinGroupInformation>>& pin_group_cache)
             {
                 const u32 module_id           = val["id"].GetUint();
                 const std::string module_name = val["name"].GetString();
@@ -419,7 +502,7 @@ namespace hal
                 }
                 else
                 {
-                    sm = nl->create_module(module_id, module_name, nl->get_module_by_id(parent_id));
+                    sm = builder.create_module(module_id, module_name, nl->get_module_by_id(parent_id));
                     if (sm == nullptr)
                     {
                         log_error("netlist_persistent", "could not deserialize module '" + module_name + "' with ID " + std::to_string(module_id) + ": failed to create module");
@@ -442,7 +525,7 @@ namespace hal
                             gates.push_back(nl->get_gate_by_id(gate_node.GetUint()));
                         }
                     }
-                    sm->assign_gates(gates);
+                    builder.assign_gates(sm, gates);
                 }
 
                 if (val.HasMember("data"))
@@ -560,87 +643,91 @@ namespace hal
             }
 
             // serialize netlist
-            void serialize(const Netlist* nl, rapidjson::Document& document)
+            void serialize(const Netlist* nl, FileWriter& writer)
             {
-                rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-                rapidjson::Value root(rapidjson::kObjectType);
-
-                root.AddMember("gate_library", nl->get_gate_library()->get_path().string(), allocator);
-                root.AddMember("id", nl->get_id(), allocator);
-                root.AddMember("input_file", nl->get_input_filename().string(), allocator);
-                root.AddMember("design_name", nl->get_design_name(), allocator);
-                root.AddMember("device_name", nl->get_device_name(), allocator);
+                writer.StartObject();
+                writer.Key("gate_library");
+                write_string(writer, nl->get_gate_library()->get_path().string());
+                writer.Key("id");
+                writer.Uint(nl->get_id());
+                writer.Key("input_file");
+                write_string(writer, nl->get_input_filename().string());
+                writer.Key("design_name");
+                write_string(writer, nl->get_design_name());
+                writer.Key("device_name");
+                write_string(writer, nl->get_device_name());
 
                 {
-                    rapidjson::Value gates(rapidjson::kArrayType);
-                    rapidjson::Value global_vccs(rapidjson::kArrayType);
-                    rapidjson::Value global_gnds(rapidjson::kArrayType);
+                    std::vector<u32> global_vccs;
+                    std::vector<u32> global_gnds;
                     std::vector<Gate*> sorted = nl->get_gates();
                     std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
                     for (const Gate* gate : sorted)
                     {
-                        gates.PushBack(serialize(gate, allocator), allocator);
-
                         if (nl->is_gnd_gate(gate))
                         {
-                            global_gnds.PushBack(gate->get_id(), allocator);
+                            global_gnds.push_back(gate->get_id());
                         }
 
                         if (nl->is_vcc_gate(gate))
                         {
-                            global_vccs.PushBack(gate->get_id(), allocator);
+                            global_vccs.push_back(gate->get_id());
                         }
                     }
-                    root.AddMember("gates", gates, allocator);
-                    root.AddMember("global_vcc", global_vccs, allocator);
-                    root.AddMember("global_gnd", global_gnds, allocator);
+                    writer.Key("gates");
+                    serialize_array_in_parallel(writer, sorted, serialize_gate);
+                    writer.Key("global_vcc");
+                    serialize_id_array(writer, global_vccs);
+                    writer.Key("global_gnd");
+                    serialize_id_array(writer, global_gnds);
                 }
                 {
-                    rapidjson::Value nets(rapidjson::kArrayType);
-                    rapidjson::Value global_in(rapidjson::kArrayType);
-                    rapidjson::Value global_out(rapidjson::kArrayType);
+                    std::vector<u32> global_in;
+                    std::vector<u32> global_out;
                     std::vector<Net*> sorted = nl->get_nets();
                     std::sort(sorted.begin(), sorted.end(), [](Net* lhs, Net* rhs) { return lhs->get_id() < rhs->get_id(); });
                     for (const Net* net : sorted)
                     {
-                        nets.PushBack(serialize(net, allocator), allocator);
-
                         if (nl->is_global_input_net(net))
                         {
-                            global_in.PushBack(net->get_id(), allocator);
+                            global_in.push_back(net->get_id());
                         }
 
                         if (nl->is_global_output_net(net))
                         {
-                            global_out.PushBack(net->get_id(), allocator);
+                            global_out.push_back(net->get_id());
                         }
                     }
-                    root.AddMember("nets", nets, allocator);
-                    root.AddMember("global_in", global_in, allocator);
-                    root.AddMember("global_out", global_out, allocator);
+                    writer.Key("nets");
+                    serialize_array_in_parallel(writer, sorted, serialize_net);
+                    writer.Key("global_in");
+                    serialize_id_array(writer, global_in);
+                    writer.Key("global_out");
+                    serialize_id_array(writer, global_out);
                 }
                 {
-                    rapidjson::Value modules(rapidjson::kArrayType);
+                    std::vector<Module*> modules;
 
                     // module ids are not sorted to preserve hierarchy
-                    std::queue<const Module*> q;
+                    std::queue<Module*> q;
                     q.push(nl->get_top_module());
                     while (!q.empty())
                     {
-                        const Module* module = q.front();
+                        Module* module = q.front();
                         q.pop();
 
-                        modules.PushBack(serialize(module, allocator), allocator);
+                        modules.push_back(module);
 
-                        for (const Module* sm : module->get_submodules())
+                        for (Module* sm : module->get_submodules())
                         {
                             q.push(sm);
                         }
                     }
-                    root.AddMember("modules", modules, allocator);
+                    writer.Key("modules");
+                    serialize_array_in_parallel(writer, modules, serialize_module);
                 }
 
-                document.AddMember("netlist", root, document.GetAllocator());
+                writer.EndObject();
             }
 
             std::unique_ptr<Netlist> deserialize(const rapidjson::Document& document)
@@ -689,6 +776,9 @@ namespace hal
                 // disable automatically checking module nets
                 nl->enable_automatic_net_checks(false);
 
+                // batch all object creation, module nets are classified once on commit
+                NetlistBuilder builder(nl.get());
+
                 if (!root.HasMember("id"))
                 {
                     log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'id'");
@@ -725,7 +815,7 @@ namespace hal
                 auto gate_types = nl->get_gate_library()->get_gate_types();
                 for (auto& gate_node : root["gates"].GetArray())
                 {
-                    if (!deserialize_gate(nl.get(), gate_node, gate_types))
+                    if (!deserialize_gate(nl.get(), builder, gate_node, gate_types))
                     {
                         log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
                         return nullptr;
@@ -767,7 +857,7 @@ namespace hal
                 }
                 for (auto& net_node : root["nets"].GetArray())
                 {
-                    if (!deserialize_net(nl.get(), net_node))
+                    if (!deserialize_net(nl.get(), builder, net_node))
                     {
                         log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize net");
                         return nullptr;
@@ -810,17 +900,18 @@ namespace hal
                 std::unordered_map<Module*, std::vector<PinGroupInformation>> pin_group_cache;
                 for (auto& module_node : root["modules"].GetArray())
                 {
-                    if (!deserialize_module(nl.get(), module_node, pin_group_cache))
+                    if (!deserialize_module(nl.get(), builder, module_node, pin_group_cache))
                     {
                         log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module");
                         return nullptr;
                     }
                 }
 
-                // update module nets, internal nets, input nets, and output nets
-                for (Module* mod : nl->get_modules())
+                // classify module nets, internal nets, input nets, and output nets
+                if (auto res = builder.commit(); res.is_error())
                 {
-                    mod->update_nets();
+                    log_error("netlist_persistent", "could not deserialize netlist: failed to commit netlist builder\n{}", res.get_error().get());
+                    return nullptr;
                 }
 
                 // load module pins (nets must have been updated beforehand)
@@ -864,32 +955,32 @@ namespace hal
                 }
             }
 
-            std::ofstream hal_file_stream;
-            hal_file_stream.open(hal_file.string());
-            if (hal_file_stream.fail())
+            FILE* pFile = fopen(hal_file.string().c_str(), "wb");
+            if (pFile == NULL)
             {
                 log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", hal_file.string());
                 return false;
             }
 
-            rapidjson::Document document;
-            document.SetObject();
-
-            document.AddMember("serialization_format_version", SERIALIZATION_FORMAT_VERSION, document.GetAllocator());
-
-            serialize(nl, document);
-
-            rapidjson::StringBuffer strbuf;
-#if PRETTY_JSON_OUTPUT == 1
-            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
-#else
-            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
-#endif
-            document.Accept(writer);
-
-            hal_file_stream << strbuf.GetString();
-
-            hal_file_stream.close();
+            // the JSON is streamed into the file instead of building the whole document in memory first
+            char buffer[65536];
+            rapidjson::FileWriteStream os(pFile, buffer, sizeof(buffer));
+            FileWriter writer(os);
+
+            writer.StartObject();
+            writer.Key("serialization_format_version");
+            writer.Int(SERIALIZATION_FORMAT_VERSION);
+            writer.Key("netlist");
+            serialize(nl, writer);
+            writer.EndObject();
+            os.Flush();
+
+            const bool write_failed = ferror(pFile) != 0;
+            if (fclose(pFile) != 0 || write_failed)
+            {
+                log_error("netlist_persistent", "could not write file {}: please verify that there is enough space left on the device", hal_file.string());
+                return false;
+            }
 
             log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
 
@@ -898,6 +989,12 @@ namespace hal
 
         std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file)
         {
+            // binary .hal files are detected by their header
+            if (netlist_binary_serializer::is_binary_file(hal_file))
+            {
+                return netlist_binary_serializer::deserialize_from_file(hal_file);
+            }
+
             auto begin_time = std::chrono::high_resolution_clock::now();
 
             // event_controls::enable_all(false);
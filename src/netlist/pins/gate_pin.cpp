@@ -5,4 +5,9 @@ namespace hal
     GatePin::GatePin(const u32 id, const std::string& name, PinDirection direction, PinType type) : BasePin<GatePin>(id, name, direction, type)
     {
     }
+
+    u32 GatePin::get_index() const
+    {
+        return m_index;
+    }
 }    // namespace hal
\ No newline at end of file
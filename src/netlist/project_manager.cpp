@@ -3,6 +3,8 @@
 #include "hal_core/netlist/gate_library/gate_library.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+#include "hal_core/netlist/persistent/netlist_journal.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/netlist/project_serializer.h"
 #include "hal_core/utilities/log.h"
@@ -28,7 +30,7 @@ namespace hal
 
     const std::string ProjectManager::s_project_file = ".project.json";
 
-    ProjectManager::ProjectManager() : m_project_status(ProjectStatus::NONE)
+    ProjectManager::ProjectManager() : m_project_status(ProjectStatus::NONE), m_netlist_format(NetlistFormat::JSON), m_autosave_journal_enabled(true)
     {
         ;
     }
@@ -123,6 +125,13 @@ namespace hal
     void ProjectManager::set_project_status(ProjectStatus stat)
     {
         m_project_status = stat;
+
+        // the netlist of a closed project must not be journaled any longer
+        if (stat == ProjectStatus::NONE)
+        {
+            m_journal.reset();
+            m_journal_file.clear();
+        }
     }
 
     ProjectManager::ProjectStatus ProjectManager::get_project_status() const
@@ -130,6 +139,31 @@ namespace hal
         return m_project_status;
     }
 
+    ProjectManager::NetlistFormat ProjectManager::get_netlist_format() const
+    {
+        return m_netlist_format;
+    }
+
+    void ProjectManager::set_netlist_format(NetlistFormat format)
+    {
+        m_netlist_format = format;
+    }
+
+    bool ProjectManager::is_autosave_journal_enabled() const
+    {
+        return m_autosave_journal_enabled;
+    }
+
+    void ProjectManager::set_autosave_journal_enabled(bool enable)
+    {
+        m_autosave_journal_enabled = enable;
+        if (!enable)
+        {
+            m_journal.reset();
+            m_journal_file.clear();
+        }
+    }
+
     void ProjectManager::set_gate_library_path(const std::string& glpath)
     {
         m_gatelib_path = glpath;
@@ -149,15 +183,68 @@ namespace hal
         else
             m_netlist_file = m_proj_dir.get_default_filename(".hal");
 
-        if (!netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file))
+        if (shadow && append_to_journal())
+        {
+            if (!serialize_external(shadow))
+                return false;
+            return serialize_to_projectfile(shadow);
+        }
+
+        if (m_netlist_format == NetlistFormat::BINARY)
+        {
+            if (!netlist_binary_serializer::serialize_to_file(m_netlist_save, m_netlist_file))
+                return false;
+        }
+        else if (!netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file))
             return false;
 
+        std::error_code err;
+        if (shadow && m_autosave_journal_enabled)
+        {
+            // start a new journal on top of the snapshot
+            m_journal_file = m_proj_dir.get_shadow_filename(".journal").string();
+            std::filesystem::remove(m_journal_file, err);
+            if (!m_journal || m_journal->get_netlist() != netlist)
+                m_journal = std::make_unique<NetlistJournal>(netlist);
+            else
+                m_journal->clear();
+        }
+        else if (!shadow)
+        {
+            // a journal restored from autosave is obsolete once the complete netlist has been saved
+            std::filesystem::remove(m_proj_dir.get_default_filename(".journal"), err);
+        }
+
         if (!serialize_external(shadow))
             return false;
 
         return serialize_to_projectfile(shadow);
     }
 
+    bool ProjectManager::append_to_journal()
+    {
+        if (!m_autosave_journal_enabled || !m_journal || m_journal->get_netlist() != m_netlist_save || m_journal_file.empty())
+            return false;
+
+        // the snapshot might have been removed together with the autosave directory
+        std::error_code err;
+        u64 snapshot_size = std::filesystem::file_size(m_netlist_file, err);
+        if (err)
+            return false;
+
+        // compact the journal into a new snapshot once replaying it gets expensive
+        u64 journal_size = std::filesystem::file_size(m_journal_file, err);
+        if (!err && journal_size > snapshot_size / 2)
+            return false;
+
+        if (auto res = m_journal->append_to_file(m_journal_file); res.is_error())
+        {
+            log_warning("project_manager", "cannot append to autosave journal, writing a new snapshot instead:\n{}", res.get_error().get());
+            return false;
+        }
+        return true;
+    }
+
     std::string ProjectManager::get_netlist_filename() const
     {
         std::filesystem::path filename(m_proj_dir);
@@ -185,30 +272,38 @@ namespace hal
         doc.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(frs);
         fclose(fp);
 
-        if (doc.HasMember("netlist"))
+        bool modified = false;
+        for (const char* member : {"netlist", "journal"})
         {
-            rapidjson::Value::MemberIterator netlistMember = doc.FindMember("netlist");
-            std::string netlistFilename                    = netlistMember->value.GetString();
-            int n                                          = ProjectDirectory::s_shadow_dir.size() + 1;
-            if (netlistFilename.substr(0, n) == ProjectDirectory::s_shadow_dir + '/')
+            if (!doc.HasMember(member))
+                continue;
+
+            rapidjson::Value::MemberIterator fileMember = doc.FindMember(member);
+            std::string filename                        = fileMember->value.GetString();
+            int n                                       = ProjectDirectory::s_shadow_dir.size() + 1;
+            if (filename.substr(0, n) == ProjectDirectory::s_shadow_dir + '/')
             {
-                netlistFilename.erase(0, n);
-                netlistMember->value.SetString(netlistFilename.c_str(), doc.GetAllocator());
+                filename.erase(0, n);
+                fileMember->value.SetString(filename.c_str(), doc.GetAllocator());
+                modified = true;
+            }
+        }
 
-                std::ofstream of(projFilePath);
-                if (!of.good())
-                    return;
+        if (modified)
+        {
+            std::ofstream of(projFilePath);
+            if (!of.good())
+                return;
 
-                rapidjson::StringBuffer strbuf;
+            rapidjson::StringBuffer strbuf;
 #if PRETTY_JSON_OUTPUT == 1
-                rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
 #else
-                rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
 #endif
-                doc.Accept(writer);
-                of << strbuf.GetString();
-                of.close();
-            }
+            doc.Accept(writer);
+            of << strbuf.GetString();
+            of.close();
         }
     }
 
@@ -235,12 +330,32 @@ namespace hal
             m_netlist_file = doc["netlist"].GetString();
             std::filesystem::path netlistPath(m_proj_dir);
             netlistPath.append(m_netlist_file);
-            m_netlist_load = netlist_factory::load_netlist(netlistPath);
+            m_netlist_format = netlist_binary_serializer::is_binary_file(netlistPath) ? NetlistFormat::BINARY : NetlistFormat::JSON;
+            m_netlist_load   = netlist_factory::load_netlist(netlistPath);
             if (!m_netlist_load)
             {
                 log_error("project_manager", "cannot load netlist {}.", netlistPath.string());
                 return false;
             }
+
+            // changes autosaved after the netlist snapshot
+            if (doc.HasMember("journal"))
+            {
+                std::filesystem::path journalPath(m_proj_dir);
+                journalPath.append(doc["journal"].GetString());
+                if (std::filesystem::exists(journalPath))
+                {
+                    if (auto res = NetlistJournal::replay(m_netlist_load.get(), journalPath); res.is_error())
+                    {
+                        log_error("project_manager", "cannot replay journal {}:\n{}", journalPath.string(), res.get_error().get());
+                        return false;
+                    }
+                    else
+                    {
+                        log_info("project_manager", "replayed {} autosave transactions from journal {}.", res.get(), journalPath.string());
+                    }
+                }
+            }
         }
         else
         {
@@ -295,6 +410,8 @@ namespace hal
         doc["serialization_format_version"] = SERIALIZATION_FORMAT_VERSION;
         doc["netlist"]                      = m_proj_dir.get_relative_file_path(m_netlist_file).string();
         doc["gate_library"]                 = m_proj_dir.get_relative_file_path(m_gatelib_path).string();
+        if (shadow && !m_journal_file.empty())
+            doc["journal"] = m_proj_dir.get_relative_file_path(m_journal_file).string();
 
         if (!m_filename.empty())
         {
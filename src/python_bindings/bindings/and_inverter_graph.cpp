@@ -0,0 +1,239 @@
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void and_inverter_graph_init(py::module& m)
+    {
+        py::class_<AndInverterGraph> py_and_inverter_graph(m, "AndInverterGraph", R"(
+            A structurally hashed and-inverter graph (AIG) representing an arbitrary number of single-bit Boolean functions that share their common logic.
+            Every structurally identical sub-function is represented by exactly one node, i.e., reconvergent logic is stored only once and shared among all outputs of the graph.
+            Nodes are referenced by literals, where the least significant bit of a literal marks a complemented (inverted) edge.
+            Literal 0 represents the constant 0 and literal 1 represents the constant 1.
+        )");
+
+        py_and_inverter_graph.def_readonly_static("CONSTANT_ZERO", &AndInverterGraph::CONSTANT_ZERO, R"(
+            The literal representing the constant 0.
+
+            :type: int
+        )");
+
+        py_and_inverter_graph.def_readonly_static("CONSTANT_ONE", &AndInverterGraph::CONSTANT_ONE, R"(
+            The literal representing the constant 1.
+
+            :type: int
+        )");
+
+        py_and_inverter_graph.def(py::init<>(), R"(
+            Construct an empty graph that only consists of the constant node.
+        )");
+
+        py_and_inverter_graph.def_static("negate", &AndInverterGraph::negate, py::arg("literal"), R"(
+            Get the complement of a literal.
+
+            :param int literal: The literal.
+            :returns: The complemented literal.
+            :rtype: int
+        )");
+
+        py_and_inverter_graph.def_static("is_complemented", &AndInverterGraph::is_complemented, py::arg("literal"), R"(
+            Check whether a literal references its node via a complemented edge.
+
+            :param int literal: The literal.
+            :returns: True if the literal is complemented, False otherwise.
+            :rtype: bool
+        )");
+
+        py_and_inverter_graph.def_static("get_node_index", &AndInverterGraph::get_node_index, py::arg("literal"), R"(
+            Get the index of the node referenced by a literal.
+
+            :param int literal: The literal.
+            :returns: The node index.
+            :rtype: int
+        )");
+
+        py_and_inverter_graph.def_property_readonly("num_nodes", &AndInverterGraph::get_num_nodes, R"(
+            The number of nodes of the graph including the constant node and all input nodes.
+
+            :type: int
+        )");
+
+        py_and_inverter_graph.def_property_readonly("num_and_nodes", &AndInverterGraph::get_num_and_nodes, R"(
+            The number of AND nodes of the graph.
+
+            :type: int
+        )");
+
+        py_and_inverter_graph.def_property_readonly("input_names", &AndInverterGraph::get_input_names, R"(
+            The names of all inputs in the order they were added.
+
+            :type: list[str]
+        )");
+
+        py_and_inverter_graph.def_property_readonly("outputs", &AndInverterGraph::get_outputs, R"(
+            All outputs as pairs of name and literal in the order they were added.
+
+            :type: list[tuple(str,int)]
+        )");
+
+        py_and_inverter_graph.def("add_input", &AndInverterGraph::add_input, py::arg("name"), R"(
+            Add a named input to the graph.
+            If an input with the given name already exists, its literal is returned instead.
+
+            :param str name: The name of the input.
+            :returns: The literal of the input.
+            :rtype: int
+        )");
+
+        py_and_inverter_graph.def("add_and", &AndInverterGraph::add_and, py::arg("a"), py::arg("b"), R"(
+            Get the conjunction of two literals.
+            Trivial cases are resolved without creating a node and structurally identical nodes are reused.
+
+            :param int a: The first literal.
+            :param int b: The second literal.
+            :returns: The literal of the conjunction.
+            :rtype: int
+        )");
+
+        py_and_inverter_graph.def("add_or", &AndInverterGraph::add_or, py::arg("a"), py::arg("b"), R"(
+            Get the disjunction of two literals.
+
+            :param int a: The first literal.
+            :param int b: The second literal.
+            :returns: The literal of the disjunction.
+            :rtype: int
+        )");
+
+        py_and_inverter_graph.def("add_xor", &AndInverterGraph::add_xor, py::arg("a"), py::arg("b"), R"(
+            Get the exclusive disjunction of two literals.
+
+            :param int a: The first literal.
+            :param int b: The second literal.
+            :returns: The literal of the exclusive disjunction.
+            :rtype: int
+        )");
+
+        py_and_inverter_graph.def("add_ite", &AndInverterGraph::add_ite, py::arg("condition"), py::arg("true_case"), py::arg("false_case"), R"(
+            Get the if-then-else of three literals.
+
+            :param int condition: The condition literal.
+            :param int true_case: The literal selected if the condition is 1.
+            :param int false_case: The literal selected if the condition is 0.
+            :returns: The literal of the if-then-else.
+            :rtype: int
+        )");
+
+        py_and_inverter_graph.def(
+            "add_function",
+            [](AndInverterGraph& self, const BooleanFunction& function, const std::unordered_map<std::string, AndInverterGraph::Literal>& variables) -> std::optional<AndInverterGraph::Literal> {
+                auto res = self.add_function(function, variables);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("function"),
+            py::arg("variables") = std::unordered_map<std::string, AndInverterGraph::Literal>(),
+            R"(
+            Add a single-bit Boolean function to the graph.
+            Variables contained in the given dict are replaced by the respective literals, all other variables are added as inputs.
+
+            :param hal_py.BooleanFunction function: The Boolean function.
+            :param dict[str,int] variables: A dict from variable names to literals of this graph.
+            :returns: The literal representing the Boolean function on success, None otherwise.
+            :rtype: int or None
+        )");
+
+        py_and_inverter_graph.def(
+            "add_output",
+            [](AndInverterGraph& self, const std::string& name, AndInverterGraph::Literal literal) -> bool {
+                auto res = self.add_output(name, literal);
+                if (res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            py::arg("name"),
+            py::arg("literal"),
+            R"(
+            Add a named output to the graph.
+
+            :param str name: The name of the output.
+            :param int literal: The literal driving the output.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_and_inverter_graph.def(
+            "to_boolean_function",
+            [](const AndInverterGraph& self, const std::string& name) -> std::optional<BooleanFunction> {
+                auto res = self.to_boolean_function(name);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("name"),
+            R"(
+            Convert the function of a named output into a Boolean function.
+            Every node is converted only once, but since a Boolean function is tree-shaped, shared nodes are duplicated in the result.
+
+            :param str name: The name of the output.
+            :returns: The Boolean function on success, None otherwise.
+            :rtype: hal_py.BooleanFunction or None
+        )");
+
+        py_and_inverter_graph.def(
+            "to_smt2",
+            [](const AndInverterGraph& self) -> std::optional<std::string> {
+                auto res = SMT::Translator::translate_to_smt2(self);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            R"(
+            Translate the graph into a sequence of SMT-LIB commands that define every shared node exactly once.
+
+            :returns: The SMT-LIB v2 commands on success, None otherwise.
+            :rtype: str or None
+        )");
+
+        py_and_inverter_graph.def(
+            "simplify",
+            [](const AndInverterGraph& self) -> std::optional<AndInverterGraph> {
+                auto res = Simplification::abc_simplification(self);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            R"(
+            Simplify all outputs of the graph using ABC.
+
+            :returns: The simplified graph on success, None otherwise.
+            :rtype: hal_py.AndInverterGraph or None
+        )");
+    }
+}    // namespace hal
@@ -0,0 +1,196 @@
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void frozen_netlist_view_init(py::module& m)
+    {
+        py::class_<FrozenNetlistView> py_frozen_netlist_view(m, "FrozenNetlistView", R"(
+            Immutable snapshot of the connectivity of a netlist that is intended for read-only analysis passes.
+            Gates and nets are remapped to contiguous indices and their connections are stored in compressed sparse row (CSR) arrays.
+            Any modification of the gates, nets, or endpoints of the netlist invalidates the view, which can be checked using 'is_valid()'.
+        )");
+
+        py_frozen_netlist_view.def_readonly_static("invalid_index", &FrozenNetlistView::invalid_index, R"(
+            Index returned for gates and nets that are not part of the view.
+
+            :type: int
+        )");
+
+        py_frozen_netlist_view.def(py::init<const Netlist&>(), py::arg("netlist"), py::keep_alive<1, 2>(), R"(
+            Construct a frozen view of the current connectivity of the given netlist.
+            Gate and net indices follow the order of 'Netlist.get_gates()' and 'Netlist.get_nets()'.
+
+            :param hal_py.Netlist netlist: The netlist to take the snapshot of.
+        )");
+
+        py_frozen_netlist_view.def_property_readonly("stamp", &FrozenNetlistView::get_stamp, R"(
+            The connectivity stamp of the netlist at the time the view was constructed.
+
+            :type: int
+        )");
+
+        py_frozen_netlist_view.def("get_stamp", &FrozenNetlistView::get_stamp, R"(
+            Get the connectivity stamp of the netlist at the time the view was constructed.
+
+            :returns: The connectivity stamp.
+            :rtype: int
+        )");
+
+        py_frozen_netlist_view.def("is_valid", &FrozenNetlistView::is_valid, R"(
+            Check whether the view still reflects the connectivity of the netlist, i.e., no gate, net, or endpoint has been created or removed since its construction.
+
+            :returns: True if the view is still valid, False otherwise.
+            :rtype: bool
+        )");
+
+        py_frozen_netlist_view.def_property_readonly("num_gates", &FrozenNetlistView::get_num_gates, R"(
+            The number of gates within the view.
+
+            :type: int
+        )");
+
+        py_frozen_netlist_view.def("get_num_gates", &FrozenNetlistView::get_num_gates, R"(
+            Get the number of gates within the view.
+
+            :returns: The number of gates.
+            :rtype: int
+        )");
+
+        py_frozen_netlist_view.def_property_readonly("num_nets", &FrozenNetlistView::get_num_nets, R"(
+            The number of nets within the view.
+
+            :type: int
+        )");
+
+        py_frozen_netlist_view.def("get_num_nets", &FrozenNetlistView::get_num_nets, R"(
+            Get the number of nets within the view.
+
+            :returns: The number of nets.
+            :rtype: int
+        )");
+
+        py_frozen_netlist_view.def("get_gate", &FrozenNetlistView::get_gate, py::arg("gate_index"), R"(
+            Get the gate corresponding to the given gate index.
+
+            :param int gate_index: The gate index.
+            :returns: The gate on success, None if the index is out of range.
+            :rtype: hal_py.Gate
+        )");
+
+        py_frozen_netlist_view.def("get_net", &FrozenNetlistView::get_net, py::arg("net_index"), R"(
+            Get the net corresponding to the given net index.
+
+            :param int net_index: The net index.
+            :returns: The net on success, None if the index is out of range.
+            :rtype: hal_py.Net
+        )");
+
+        py_frozen_netlist_view.def("get_gate_index", &FrozenNetlistView::get_gate_index, py::arg("gate"), R"(
+            Get the index of the given gate.
+
+            :param hal_py.Gate gate: The gate.
+            :returns: The gate index on success, 'FrozenNetlistView.invalid_index' if the gate is not part of the view.
+            :rtype: int
+        )");
+
+        py_frozen_netlist_view.def("get_gate_index_by_id", &FrozenNetlistView::get_gate_index_by_id, py::arg("gate_id"), R"(
+            Get the index of the gate with the given ID.
+
+            :param int gate_id: The ID of the gate.
+            :returns: The gate index on success, 'FrozenNetlistView.invalid_index' if the gate is not part of the view.
+            :rtype: int
+        )");
+
+        py_frozen_netlist_view.def("get_net_index", &FrozenNetlistView::get_net_index, py::arg("net"), R"(
+            Get the index of the given net.
+
+            :param hal_py.Net net: The net.
+            :returns: The net index on success, 'FrozenNetlistView.invalid_index' if the net is not part of the view.
+            :rtype: int
+        )");
+
+        py_frozen_netlist_view.def("get_net_index_by_id", &FrozenNetlistView::get_net_index_by_id, py::arg("net_id"), R"(
+            Get the index of the net with the given ID.
+
+            :param int net_id: The ID of the net.
+            :returns: The net index on success, 'FrozenNetlistView.invalid_index' if the net is not part of the view.
+            :rtype: int
+        )");
+
+        py_frozen_netlist_view.def(
+            "get_fan_in_nets", [](const FrozenNetlistView& self, u32 gate_index) { return self.get_fan_in_nets(gate_index).to_vector(); }, py::arg("gate_index"), R"(
+            Get the indices of all nets connected to the input pins of a gate.
+            The i-th net is connected to the i-th pin returned by 'get_fan_in_pins()'.
+
+            :param int gate_index: The gate index.
+            :returns: A list of net indices.
+            :rtype: list[int]
+        )");
+
+        py_frozen_netlist_view.def(
+            "get_fan_in_pins", [](const FrozenNetlistView& self, u32 gate_index) { return self.get_fan_in_pins(gate_index).to_vector(); }, py::arg("gate_index"), R"(
+            Get all input pins of a gate that are connected to a net.
+
+            :param int gate_index: The gate index.
+            :returns: A list of pins.
+            :rtype: list[hal_py.GatePin]
+        )");
+
+        py_frozen_netlist_view.def(
+            "get_fan_out_nets", [](const FrozenNetlistView& self, u32 gate_index) { return self.get_fan_out_nets(gate_index).to_vector(); }, py::arg("gate_index"), R"(
+            Get the indices of all nets connected to the output pins of a gate.
+            The i-th net is connected to the i-th pin returned by 'get_fan_out_pins()'.
+
+            :param int gate_index: The gate index.
+            :returns: A list of net indices.
+            :rtype: list[int]
+        )");
+
+        py_frozen_netlist_view.def(
+            "get_fan_out_pins", [](const FrozenNetlistView& self, u32 gate_index) { return self.get_fan_out_pins(gate_index).to_vector(); }, py::arg("gate_index"), R"(
+            Get all output pins of a gate that are connected to a net.
+
+            :param int gate_index: The gate index.
+            :returns: A list of pins.
+            :rtype: list[hal_py.GatePin]
+        )");
+
+        py_frozen_netlist_view.def(
+            "get_sources", [](const FrozenNetlistView& self, u32 net_index) { return self.get_sources(net_index).to_vector(); }, py::arg("net_index"), R"(
+            Get the indices of all source gates of a net.
+            The i-th gate drives the net through the i-th pin returned by 'get_source_pins()'.
+
+            :param int net_index: The net index.
+            :returns: A list of gate indices.
+            :rtype: list[int]
+        )");
+
+        py_frozen_netlist_view.def(
+            "get_source_pins", [](const FrozenNetlistView& self, u32 net_index) { return self.get_source_pins(net_index).to_vector(); }, py::arg("net_index"), R"(
+            Get the pins through which the source gates drive a net.
+
+            :param int net_index: The net index.
+            :returns: A list of pins.
+            :rtype: list[hal_py.GatePin]
+        )");
+
+        py_frozen_netlist_view.def(
+            "get_destinations", [](const FrozenNetlistView& self, u32 net_index) { return self.get_destinations(net_index).to_vector(); }, py::arg("net_index"), R"(
+            Get the indices of all destination gates of a net.
+            The i-th gate is connected to the net through the i-th pin returned by 'get_destination_pins()'.
+
+            :param int net_index: The net index.
+            :returns: A list of gate indices.
+            :rtype: list[int]
+        )");
+
+        py_frozen_netlist_view.def(
+            "get_destination_pins", [](const FrozenNetlistView& self, u32 net_index) { return self.get_destination_pins(net_index).to_vector(); }, py::arg("net_index"), R"(
+            Get the pins through which the destination gates are connected to a net.
+
+            :param int net_index: The net index.
+            :returns: A list of pins.
+            :rtype: list[hal_py.GatePin]
+        )");
+    }
+}    // namespace hal
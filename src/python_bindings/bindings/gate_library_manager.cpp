@@ -15,6 +15,7 @@ namespace hal
             py::arg("reload") = false,
             R"(
             Load a gate library from file.
+            If the gate library file has not changed since it was last parsed, the gate library is restored from the gate library cache instead of being parsed again.
 
             :param hal_py.hal_path file_path: The input path.
             :param bool reload: If true, reloads the library in case it is already loaded.
@@ -24,8 +25,9 @@ namespace hal
 
         py_gate_library_manager.def("load_all", &gate_library_manager::load_all, py::arg("reload") = false, R"(
             Load all gate libraries available in standard gate library directories.
+            Unless a reload is requested, the gate library files are only registered and each library is loaded on first access through get_gate_library, get_gate_library_by_name, or get_gate_libraries.
 
-            :param bool reload: If true, reloads all libraries that have already been loaded.
+            :param bool reload: If true, immediately reloads all libraries including those that have already been loaded.
         )");
 
         py_gate_library_manager.def("save", &gate_library_manager::save, py::arg("file_path"), py::arg("gate_lib"), py::arg("overwrite") = false, R"(
@@ -52,7 +54,8 @@ namespace hal
             [](const std::string& lib_name) { return RawPtrWrapper<GateLibrary>(gate_library_manager::get_gate_library_by_name(lib_name)); },
             py::arg("lib_name"),
             R"(
-            Get a gate library by name. If no library with the given name is loaded, None will be returned.
+            Get a gate library by name. If no library with the given name is loaded, the libraries registered by load_all are searched and the matching one is loaded.
+            Otherwise, None will be returned.
 
             :param str lib_name: The name of the gate library.
             :returns: The gate library on success, None otherwise.
@@ -71,6 +74,7 @@ namespace hal
             },
             R"(
             Get all loaded gate libraries.
+            Libraries registered by load_all that have not been accessed yet are loaded first.
 
             :returns: A list of gate libraries.
             :rtype:  list[hal_py.GateLibrary]
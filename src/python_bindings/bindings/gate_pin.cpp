@@ -7,5 +7,20 @@ namespace hal
         py::class_<GatePin, BasePin<GatePin>, RawPtrWrapper<GatePin>> py_gate_pin(m, "GatePin", R"(
             The pin of a gate type. Each pin has a name, a direction, and a type. 
         )");
+
+        py_gate_pin.def_property_readonly("index", &GatePin::get_index, R"(
+            The index of the pin within its gate type.
+            Pins are indexed consecutively from 0 in the order of their creation.
+
+            :type: int
+        )");
+
+        py_gate_pin.def("get_index", &GatePin::get_index, R"(
+            Get the index of the pin within its gate type.
+            Pins are indexed consecutively from 0 in the order of their creation, which allows to store per-pin data of a gate in plain arrays.
+
+            :returns: The index of the pin.
+            :rtype: int
+        )");
     }
 }    // namespace hal
\ No newline at end of file
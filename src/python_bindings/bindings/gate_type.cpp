@@ -356,6 +356,30 @@ namespace hal
             :rtype: hal_py.GatePin or None
         )");
 
+        py_gate_type.def_property_readonly("pin_count", &GateType::get_pin_count, R"(
+            The number of pins of the gate type.
+            Pin indices range from 0 to the number of pins minus one.
+
+            :type: int
+        )");
+
+        py_gate_type.def("get_pin_count", &GateType::get_pin_count, R"(
+            Get the number of pins of the gate type.
+            Pin indices range from 0 to the number of pins minus one.
+
+            :returns: The number of pins.
+            :rtype: int
+        )");
+
+        py_gate_type.def("get_pin_by_index", &GateType::get_pin_by_index, py::arg("index"), R"(
+            Get the pin corresponding to the given index.
+            Pins are indexed consecutively in the order of their creation, see hal_py.GatePin.get_index.
+
+            :param int index: The index of the pin.
+            :returns: The pin on success, None otherwise.
+            :rtype: hal_py.GatePin or None
+        )");
+
         py_gate_type.def("get_pin_by_name", &GateType::get_pin_by_name, py::arg("name"), R"(
             Get the pin corresponding to the given name.
 
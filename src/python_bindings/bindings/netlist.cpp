@@ -132,6 +132,16 @@ namespace hal
             :rtype: hal_py.Netlist
         )");
 
+        py_netlist.def("reserve", &Netlist::reserve, py::arg("num_gates"), py::arg("num_nets"), py::arg("num_modules") = 0, R"(
+            Pre-allocate storage for the given number of gates, nets, and modules.
+            Calling this function before building a large netlist avoids repeated growth of the internal object storage.
+            It does not limit the number of gates, nets, or modules that can be created.
+
+            :param int num_gates: The expected number of gates.
+            :param int num_nets: The expected number of nets.
+            :param int num_modules: The expected number of modules.
+        )");
+
         py_netlist.def("clear_caches", &Netlist::clear_caches, R"(
             Clear all internal caches of the netlist.
             In a typical application, calling this function is not required.
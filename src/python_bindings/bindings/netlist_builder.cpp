@@ -0,0 +1,202 @@
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void netlist_builder_init(py::module& m)
+    {
+        py::class_<NetlistBuilder> py_netlist_builder(m, "NetlistBuilder", R"(
+            Transaction for constructing large parts of a netlist in bulk.
+            While the transaction is open, gates, nets, endpoints, and module assignments created through the builder skip the per-item event notifications and module net checks.
+            Instead, the input, output, and internal nets of all affected modules are determined in a single pass over the affected nets on 'commit()', after which the events of the transaction are emitted.
+            If automatic net checks were enabled when the transaction was opened, 'commit()' also creates, updates, and removes module pins as the automatic net checks would do.
+            The transaction must be committed explicitly.
+        )");
+
+        py_netlist_builder.def(py::init<Netlist*>(), py::arg("netlist"), py::keep_alive<1, 2>(), R"(
+            Open a new transaction on the given netlist.
+            Automatic net checks are suspended until the transaction is committed.
+
+            :param hal_py.Netlist netlist: The netlist to build.
+        )");
+
+        py_netlist_builder.def_property_readonly("netlist", &NetlistBuilder::get_netlist, R"(
+            The netlist built by the transaction.
+
+            :type: hal_py.Netlist
+        )");
+
+        py_netlist_builder.def("get_netlist", &NetlistBuilder::get_netlist, R"(
+            Get the netlist built by the transaction.
+
+            :returns: The netlist.
+            :rtype: hal_py.Netlist
+        )");
+
+        py_netlist_builder.def("is_open", &NetlistBuilder::is_open, R"(
+            Check whether the transaction is still open, i.e., has not been committed yet.
+
+            :returns: True if the transaction is open, False otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_builder.def("create_gate",
+                               py::overload_cast<const u32, GateType*, const std::string&, i32, i32>(&NetlistBuilder::create_gate),
+                               py::arg("gate_id"),
+                               py::arg("gate_type"),
+                               py::arg("name"),
+                               py::arg("x") = -1,
+                               py::arg("y") = -1,
+                               R"(
+            Create a new gate and add it to the top module of the netlist.
+
+            :param int gate_id: The unique ID of the gate.
+            :param hal_py.GateType gate_type: The gate type.
+            :param str name: The name of the gate.
+            :param int x: The x-coordinate of the gate.
+            :param int y: The y-coordinate of the gate.
+            :returns: The new gate on success, None otherwise.
+            :rtype: hal_py.Gate or None
+        )");
+
+        py_netlist_builder.def("create_gate",
+                               py::overload_cast<GateType*, const std::string&, i32, i32>(&NetlistBuilder::create_gate),
+                               py::arg("gate_type"),
+                               py::arg("name"),
+                               py::arg("x") = -1,
+                               py::arg("y") = -1,
+                               R"(
+            Create a new gate and add it to the top module of the netlist.
+            The ID of the gate is set automatically.
+
+            :param hal_py.GateType gate_type: The gate type.
+            :param str name: The name of the gate.
+            :param int x: The x-coordinate of the gate.
+            :param int y: The y-coordinate of the gate.
+            :returns: The new gate on success, None otherwise.
+            :rtype: hal_py.Gate or None
+        )");
+
+        py_netlist_builder.def("create_net", py::overload_cast<const u32, const std::string&>(&NetlistBuilder::create_net), py::arg("net_id"), py::arg("name"), R"(
+            Create a new net.
+
+            :param int net_id: The unique ID of the net.
+            :param str name: The name of the net.
+            :returns: The new net on success, None otherwise.
+            :rtype: hal_py.Net or None
+        )");
+
+        py_netlist_builder.def("create_net", py::overload_cast<const std::string&>(&NetlistBuilder::create_net), py::arg("name"), R"(
+            Create a new net.
+            The ID of the net is set automatically.
+
+            :param str name: The name of the net.
+            :returns: The new net on success, None otherwise.
+            :rtype: hal_py.Net or None
+        )");
+
+        py_netlist_builder.def("add_source", py::overload_cast<Net*, Gate*, GatePin*>(&NetlistBuilder::add_source), py::arg("net"), py::arg("gate"), py::arg("pin"), R"(
+            Add a source to a net.
+
+            :param hal_py.Net net: The net.
+            :param hal_py.Gate gate: The gate.
+            :param hal_py.GatePin pin: The output pin of the gate.
+            :returns: The new endpoint on success, None otherwise.
+            :rtype: hal_py.Endpoint or None
+        )");
+
+        py_netlist_builder.def("add_source", py::overload_cast<Net*, Gate*, const std::string&>(&NetlistBuilder::add_source), py::arg("net"), py::arg("gate"), py::arg("pin_name"), R"(
+            Add a source to a net.
+
+            :param hal_py.Net net: The net.
+            :param hal_py.Gate gate: The gate.
+            :param str pin_name: The name of the output pin of the gate.
+            :returns: The new endpoint on success, None otherwise.
+            :rtype: hal_py.Endpoint or None
+        )");
+
+        py_netlist_builder.def("add_destination", py::overload_cast<Net*, Gate*, GatePin*>(&NetlistBuilder::add_destination), py::arg("net"), py::arg("gate"), py::arg("pin"), R"(
+            Add a destination to a net.
+
+            :param hal_py.Net net: The net.
+            :param hal_py.Gate gate: The gate.
+            :param hal_py.GatePin pin: The input pin of the gate.
+            :returns: The new endpoint on success, None otherwise.
+            :rtype: hal_py.Endpoint or None
+        )");
+
+        py_netlist_builder.def("add_destination", py::overload_cast<Net*, Gate*, const std::string&>(&NetlistBuilder::add_destination), py::arg("net"), py::arg("gate"), py::arg("pin_name"), R"(
+            Add a destination to a net.
+
+            :param hal_py.Net net: The net.
+            :param hal_py.Gate gate: The gate.
+            :param str pin_name: The name of the input pin of the gate.
+            :returns: The new endpoint on success, None otherwise.
+            :rtype: hal_py.Endpoint or None
+        )");
+
+        py_netlist_builder.def("create_module",
+                               py::overload_cast<const u32, const std::string&, Module*, const std::vector<Gate*>&>(&NetlistBuilder::create_module),
+                               py::arg("module_id"),
+                               py::arg("name"),
+                               py::arg("parent"),
+                               py::arg("gates") = std::vector<Gate*>(),
+                               R"(
+            Create a new module as a submodule of the given parent module and assign the given gates to it.
+
+            :param int module_id: The unique ID of the module.
+            :param str name: The name of the module.
+            :param hal_py.Module parent: The parent module.
+            :param list[hal_py.Gate] gates: The gates to assign to the module.
+            :returns: The new module on success, None otherwise.
+            :rtype: hal_py.Module or None
+        )");
+
+        py_netlist_builder.def("create_module",
+                               py::overload_cast<const std::string&, Module*, const std::vector<Gate*>&>(&NetlistBuilder::create_module),
+                               py::arg("name"),
+                               py::arg("parent"),
+                               py::arg("gates") = std::vector<Gate*>(),
+                               R"(
+            Create a new module as a submodule of the given parent module and assign the given gates to it.
+            The ID of the module is set automatically.
+
+            :param str name: The name of the module.
+            :param hal_py.Module parent: The parent module.
+            :param list[hal_py.Gate] gates: The gates to assign to the module.
+            :returns: The new module on success, None otherwise.
+            :rtype: hal_py.Module or None
+        )");
+
+        py_netlist_builder.def("assign_gates", &NetlistBuilder::assign_gates, py::arg("module"), py::arg("gates"), R"(
+            Move the given gates into a module.
+            Gates that are already contained in the module are skipped.
+
+            :param hal_py.Module module: The module.
+            :param list[hal_py.Gate] gates: The gates to assign to the module.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_builder.def(
+            "commit",
+            [](NetlistBuilder& self) -> bool {
+                auto res = self.commit();
+                if (res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while committing netlist builder:\n{}", res.get_error().get());
+                    return false;
+                }
+            },
+            R"(
+            Finalize the transaction.
+            Updates the nets of all affected modules, re-enables automatic net checks if they were enabled before, and emits the events for all objects created or changed during the transaction.
+
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+    }
+}    // namespace hal
@@ -19,10 +19,42 @@ namespace hal
 
         py_netlist_serializer.def("deserialize_from_file", netlist_serializer::deserialize_from_file, py::arg("hal_file"), R"(
             Deserializes a netlist from a .hal file.
+            Binary .hal files are detected automatically.
         
             :param hal_py.hal_path hal_file: The source .hal file.
             :returns: The deserialized netlist.
             :rtype: hal_py.Netlist
         )");
+
+        auto py_netlist_binary_serializer = m.def_submodule("NetlistBinarySerializer", R"(
+            HAL Netlist Binary Serializer functions.
+        )");
+
+        py_netlist_binary_serializer.def("serialize_to_file", netlist_binary_serializer::serialize_to_file, py::arg("netlist"), py::arg("hal_file"), R"(
+            Serializes a netlist into a binary .hal file.
+            The netlist is stored as fixed-width columns and a string table that can be memory-mapped and bulk-loaded.
+            The file can only be read on machines with the same byte order.
+        
+            :param hal_py.Netlist netlist: The netlist to serialize.
+            :param hal_py.hal_path hal_file: The destination .hal file.
+            :returns: True on success, false otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_binary_serializer.def("deserialize_from_file", netlist_binary_serializer::deserialize_from_file, py::arg("hal_file"), R"(
+            Deserializes a netlist from a binary .hal file.
+        
+            :param hal_py.hal_path hal_file: The source .hal file.
+            :returns: The deserialized netlist on success, None otherwise.
+            :rtype: hal_py.Netlist or None
+        )");
+
+        py_netlist_binary_serializer.def("is_binary_file", netlist_binary_serializer::is_binary_file, py::arg("hal_file"), R"(
+            Check whether a file is a binary .hal file by inspecting its header.
+        
+            :param hal_py.hal_path hal_file: The file to check.
+            :returns: True if the file is a binary .hal file, false otherwise.
+            :rtype: bool
+        )");
     }
 }
@@ -17,6 +17,14 @@ namespace hal
             .value("SAVED", ProjectManager::ProjectStatus::SAVED, R"(Represents a saved project state.)")
             .export_values();
 
+        py::enum_<ProjectManager::NetlistFormat> py_netlist_format(py_project_manager, "NetlistFormat", R"(
+            Represents the file format used to store the netlist of a project.
+        )");
+
+        py_netlist_format.value("JSON", ProjectManager::NetlistFormat::JSON, R"(Represents the JSON .hal file format.)")
+            .value("BINARY", ProjectManager::NetlistFormat::BINARY, R"(Represents the binary columnar .hal file format.)")
+            .export_values();
+
         py_project_manager.def_static("instance", &ProjectManager::instance, R"(
             Returns the singleton instance which gets constructed upon first call.
 
@@ -42,6 +50,38 @@ namespace hal
             :param hal_py.ProjectManager.ProjectStatus status: The new project status value.
         )");
 
+        py_project_manager.def("get_netlist_format", &ProjectManager::get_netlist_format, R"(
+            Returns the file format used when serializing the netlist of the project.
+
+            :returns: The netlist file format.
+            :rtype: hal_py.ProjectManager.NetlistFormat
+        )");
+
+        py_project_manager.def("set_netlist_format", &ProjectManager::set_netlist_format, py::arg("format"), R"(
+            Set the file format used when serializing the netlist of the project.
+            Opening a project sets the format to the one of its netlist file.
+            Both formats are detected automatically when loading a netlist.
+
+            :param hal_py.ProjectManager.NetlistFormat format: The netlist file format.
+        )");
+
+        py_project_manager.def("is_autosave_journal_enabled", &ProjectManager::is_autosave_journal_enabled, R"(
+            Returns whether autosave appends the changes of the netlist to a journal instead of writing the complete netlist.
+
+            :returns: True if the autosave journal is enabled, False otherwise.
+            :rtype: bool
+        )");
+
+        py_project_manager.def("set_autosave_journal_enabled", &ProjectManager::set_autosave_journal_enabled, py::arg("enable"), R"(
+            Enable or disable the autosave journal.
+            If enabled, autosave writes a full snapshot of the netlist only once and afterwards appends the gates, nets, and modules changed since the previous autosave to a journal file next to the snapshot.
+            The journal is compacted into a new snapshot once it has grown to half the size of the snapshot.
+            Opening the project replays the journal on top of the snapshot.
+            Enabled by default.
+
+            :param bool enable: True to enable the autosave journal, False to disable it.
+        )");
+
         py_project_manager.def("get_filename", &ProjectManager::get_filename, py::arg("serializer_name"), R"(
             Returns the relative path of the file to be parsed by an external serializer.
 
@@ -408,6 +408,229 @@ namespace hal
             :rtype: hal_py.SMT.Result or str
         )");
 
+        py::class_<SMT::SolverSession, std::unique_ptr<SMT::SolverSession>> py_smt_solver_session(py_smt, "SolverSession", R"(
+            Represents a persistent, incremental session with an SMT solver.
+            In contrast to hal_py.SMT.Solver, a session keeps a single solver alive for its whole lifetime and supports incremental constraints, scopes, assumptions, and batched queries.
+        )");
+
+        py_smt_solver_session.def_static(
+            "start",
+            [](const SMT::QueryConfig& config) -> std::unique_ptr<SMT::SolverSession> {
+                auto res = SMT::SolverSession::start(config);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return nullptr;
+                }
+            },
+            py::arg("config") = SMT::QueryConfig(),
+            R"(
+            Starts a session with a local solver process of the type specified in the query configuration.
+            The timeout of the configuration applies to every single check.
+
+            :param hal_py.SMT.QueryConfig config: The SMT solver query configuration.
+            :returns: The session on success, None otherwise.
+            :rtype: hal_py.SMT.SolverSession or None
+        )");
+
+        py_smt_solver_session.def_static(
+            "start_in_process",
+            [](const SMT::QueryConfig& config) -> std::unique_ptr<SMT::SolverSession> {
+                auto res = SMT::SolverSession::start_in_process(config);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return nullptr;
+                }
+            },
+            py::arg("config") = SMT::QueryConfig(),
+            R"(
+            Starts a session using the Z3 library linked into HAL instead of a solver process.
+            The solver type of the query configuration is ignored.
+
+            :param hal_py.SMT.QueryConfig config: The SMT solver query configuration.
+            :returns: The session on success, None otherwise.
+            :rtype: hal_py.SMT.SolverSession or None
+        )");
+
+        py_smt_solver_session.def_property_readonly("config", &SMT::SolverSession::get_config, R"(
+            The query configuration of the session.
+
+            :type: hal_py.SMT.QueryConfig
+        )");
+
+        py_smt_solver_session.def_property_readonly("in_process", &SMT::SolverSession::is_in_process, R"(
+            True if the session uses the Z3 library linked into HAL, False if it communicates with a solver process.
+
+            :type: bool
+        )");
+
+        py_smt_solver_session.def_property_readonly("num_scopes", &SMT::SolverSession::get_num_scopes, R"(
+            The number of currently open scopes.
+
+            :type: int
+        )");
+
+        py_smt_solver_session.def_property_readonly("usable", &SMT::SolverSession::is_usable, R"(
+            False if the solver process has been terminated after a failed request, True otherwise.
+            An unusable session has to be restarted.
+
+            :type: bool
+        )");
+
+        py_smt_solver_session.def(
+            "restart",
+            [](SMT::SolverSession& self) -> bool {
+                auto res = self.restart();
+                if (res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            R"(
+            Restarts the session with a new solver of the same configuration.
+            All scopes and constraints of the session are discarded.
+
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_smt_solver_session.def(
+            "push",
+            [](SMT::SolverSession& self) -> bool {
+                auto res = self.push();
+                if (res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            R"(
+            Opens a new scope. All constraints and declarations added afterwards are discarded by the matching pop.
+
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_smt_solver_session.def(
+            "pop",
+            [](SMT::SolverSession& self, u32 num_scopes) -> bool {
+                auto res = self.pop(num_scopes);
+                if (res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            py::arg("num_scopes") = 1,
+            R"(
+            Closes the given number of scopes and discards all constraints and declarations added within them.
+
+            :param int num_scopes: The number of scopes to close.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_smt_solver_session.def(
+            "add_constraint",
+            [](SMT::SolverSession& self, const SMT::Constraint& constraint) -> bool {
+                auto res = self.add_constraint(constraint);
+                if (res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            py::arg("constraint"),
+            R"(
+            Asserts a constraint within the current scope.
+
+            :param hal_py.SMT.Constraint constraint: The constraint.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_smt_solver_session.def(
+            "add_constraints",
+            [](SMT::SolverSession& self, const std::vector<SMT::Constraint>& constraints) -> bool {
+                auto res = self.add_constraints(constraints);
+                if (res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            py::arg("constraints"),
+            R"(
+            Asserts a list of constraints within the current scope.
+
+            :param list[hal_py.SMT.Constraint] constraints: The constraints.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_smt_solver_session.def(
+            "check",
+            [](SMT::SolverSession& self, const std::vector<BooleanFunction>& assumptions) -> std::optional<SMT::SolverResult> {
+                auto res = self.check(assumptions);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("assumptions") = std::vector<BooleanFunction>(),
+            R"(
+            Checks the satisfiability of all asserted constraints, optionally under a set of assumptions.
+            Assumptions only hold for this check and are not asserted permanently.
+
+            :param list[hal_py.BooleanFunction] assumptions: Boolean functions of a single bit that are assumed to evaluate to 1.
+            :returns: The result on success, None otherwise.
+            :rtype: hal_py.SMT.SolverResult or None
+        )");
+
+        py_smt_solver_session.def(
+            "check_batch",
+            [](SMT::SolverSession& self, const std::vector<std::vector<SMT::Constraint>>& queries) -> std::optional<std::vector<SMT::SolverResult>> {
+                auto res = self.check_batch(queries);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("queries"),
+            R"(
+            Checks a batch of independent queries against the asserted constraints.
+            Each query is checked within its own scope, i.e., the constraints of one query do not affect the others.
+
+            :param list[list[hal_py.SMT.Constraint]] queries: The queries, each given as a list of additional constraints.
+            :returns: One result per query on success, None otherwise.
+            :rtype: list[hal_py.SMT.SolverResult] or None
+        )");
+
         py::class_<SMT::SymbolicState> py_smt_symbolic_state(py_smt, "SymbolicState", R"(
            Represents the data structure that keeps track of symbolic variable values (e.g., required for symbolic simplification).
         )");
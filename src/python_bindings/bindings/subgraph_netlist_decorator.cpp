@@ -171,5 +171,59 @@ namespace hal
             :returns: The combined Boolean function of the subgraph on success, None otherwise.
             :rtype: hal_py.BooleanFunction or None
         )");
+
+        py_subgraph_netlist_decorator.def(
+            "get_subgraph_function",
+            [](SubgraphNetlistDecorator& self, const std::vector<const Gate*>& subgraph_gates, const std::vector<const Net*>& subgraph_outputs) -> std::optional<AndInverterGraph> {
+                auto res = self.get_subgraph_function(subgraph_gates, subgraph_outputs);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while generating subgraph function:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("subgraph_gates"),
+            py::arg("subgraph_outputs"),
+            R"(
+            Get the combined Boolean functions of multiple outputs of a subgraph of combinational gates as a single and-inverter graph.
+            Logic that is shared within the subgraph or among its outputs is represented only once.
+            The inputs and outputs of the graph are named after the subgraph input and output nets using 'BooleanFunctionNetDecorator.get_boolean_variable_name'.
+
+            :param list[hal_py.Gate] subgraph_gates: The gates making up the subgraph to consider.
+            :param list[hal_py.Net] subgraph_outputs: The subgraph output nets for which to generate the Boolean functions.
+            :returns: The and-inverter graph of the subgraph on success, None otherwise.
+            :rtype: hal_py.AndInverterGraph or None
+        )");
+
+        py_subgraph_netlist_decorator.def(
+            "get_subgraph_function",
+            [](SubgraphNetlistDecorator& self, const Module* subgraph_module, const std::vector<const Net*>& subgraph_outputs) -> std::optional<AndInverterGraph> {
+                auto res = self.get_subgraph_function(subgraph_module, subgraph_outputs);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while generating subgraph function:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("subgraph_module"),
+            py::arg("subgraph_outputs"),
+            R"(
+            Get the combined Boolean functions of multiple outputs of a subgraph of combinational gates as a single and-inverter graph.
+            Logic that is shared within the subgraph or among its outputs is represented only once.
+            The inputs and outputs of the graph are named after the subgraph input and output nets using 'BooleanFunctionNetDecorator.get_boolean_variable_name'.
+
+            :param hal_py.Module subgraph_module: The module making up the subgraph to consider.
+            :param list[hal_py.Net] subgraph_outputs: The subgraph output nets for which to generate the Boolean functions.
+            :returns: The and-inverter graph of the subgraph on success, None otherwise.
+            :rtype: hal_py.AndInverterGraph or None
+        )");
     }
-}    // namespace hal
\ No newline at end of file
+}    // namespace hal
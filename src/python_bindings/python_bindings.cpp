@@ -33,6 +33,8 @@ namespace hal
 
         netlist_init(m);
 
+        netlist_builder_init(m);
+
         project_manager_init(m);
 
         netlist_serializer_init(m);
@@ -65,6 +67,8 @@ namespace hal
 
         boolean_function_init(m);
 
+        and_inverter_graph_init(m);
+
         smt_init(m);
 
         boolean_function_net_decorator_init(m);
@@ -73,6 +77,8 @@ namespace hal
 
         boolean_function_decorator_init(m);
 
+        frozen_netlist_view_init(m);
+
 #ifndef PYBIND11_MODULE
         return m.ptr();
 #endif    // PYBIND11_MODULE
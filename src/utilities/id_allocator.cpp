@@ -0,0 +1,237 @@
+#include "hal_core/utilities/id_allocator.h"
+
+#include <algorithm>
+
+namespace hal
+{
+    namespace
+    {
+        // IDs below twice the number of used IDs plus this slack are stored in the bitmaps
+        constexpr u64 DENSE_SLACK = 1 << 16;
+    }    // namespace
+
+    bool IdAllocator::IdSet::contains(u32 id) const
+    {
+        if (id < get_num_dense_bits())
+        {
+            return (m_dense[id >> 6] >> (id & 63)) & 1;
+        }
+        return m_sparse.find(id) != m_sparse.end();
+    }
+
+    bool IdAllocator::IdSet::insert(u32 id)
+    {
+        if (id < get_num_dense_bits())
+        {
+            u64& word     = m_dense[id >> 6];
+            const u64 bit = u64(1) << (id & 63);
+            if (word & bit)
+            {
+                return false;
+            }
+            word |= bit;
+        }
+        else if (!m_sparse.insert(id).second)
+        {
+            return false;
+        }
+        m_size++;
+        return true;
+    }
+
+    bool IdAllocator::IdSet::erase(u32 id)
+    {
+        if (id < get_num_dense_bits())
+        {
+            u64& word     = m_dense[id >> 6];
+            const u64 bit = u64(1) << (id & 63);
+            if (!(word & bit))
+            {
+                return false;
+            }
+            word &= ~bit;
+        }
+        else if (m_sparse.erase(id) == 0)
+        {
+            return false;
+        }
+        m_size--;
+        return true;
+    }
+
+    void IdAllocator::IdSet::clear()
+    {
+        std::fill(m_dense.begin(), m_dense.end(), 0);
+        m_sparse.clear();
+        m_size = 0;
+    }
+
+    void IdAllocator::IdSet::grow(u64 num_bits)
+    {
+        const u64 num_words = (num_bits + 63) / 64;
+        if (num_words <= m_dense.size())
+        {
+            return;
+        }
+        m_dense.resize(num_words, 0);
+
+        // move sparse IDs that are now covered by the bitmap
+        for (auto it = m_sparse.begin(); it != m_sparse.end();)
+        {
+            if (*it < get_num_dense_bits())
+            {
+                m_dense[*it >> 6] |= u64(1) << (*it & 63);
+                it = m_sparse.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    u64 IdAllocator::IdSet::get_num_dense_bits() const
+    {
+        return m_dense.size() * 64;
+    }
+
+    u32 IdAllocator::IdSet::size() const
+    {
+        return m_size;
+    }
+
+    u32 IdAllocator::IdSet::find_first(u32 from) const
+    {
+        for (u64 word_index = from >> 6; word_index < m_dense.size(); word_index++)
+        {
+            u64 word = m_dense[word_index];
+            if (word_index == (from >> 6))
+            {
+                word &= ~u64(0) << (from & 63);
+            }
+            if (word != 0)
+            {
+                return static_cast<u32>(word_index * 64 + __builtin_ctzll(word));
+            }
+        }
+
+        u32 first = 0;
+        for (u32 id : m_sparse)
+        {
+            if (id >= from && (first == 0 || id < first))
+            {
+                first = id;
+            }
+        }
+        return first;
+    }
+
+    std::set<u32> IdAllocator::IdSet::to_set() const
+    {
+        std::set<u32> ids(m_sparse.begin(), m_sparse.end());
+        for (u64 word_index = 0; word_index < m_dense.size(); word_index++)
+        {
+            for (u64 word = m_dense[word_index]; word != 0; word &= word - 1)
+            {
+                ids.insert(ids.end(), static_cast<u32>(word_index * 64 + __builtin_ctzll(word)));
+            }
+        }
+        return ids;
+    }
+
+    void IdAllocator::make_dense(u32 id)
+    {
+        const u64 num_bits = m_used.get_num_dense_bits();
+        if (id >= num_bits && id < 2 * u64(m_used.size()) + DENSE_SLACK)
+        {
+            // grow geometrically so that ascending IDs only cause a logarithmic number of reallocations
+            reserve(static_cast<u32>(std::min<u64>(std::max<u64>(id, num_bits + num_bits / 2), ~u32(0) - 1)));
+        }
+    }
+
+    u32 IdAllocator::get_unique_id()
+    {
+        if (m_free.size() != 0)
+        {
+            m_lowest_free = m_free.find_first(m_lowest_free);
+            return m_lowest_free;
+        }
+        while (m_used.contains(m_next_id))
+        {
+            m_next_id++;
+        }
+        return m_next_id;
+    }
+
+    bool IdAllocator::is_used(u32 id) const
+    {
+        return m_used.contains(id);
+    }
+
+    bool IdAllocator::acquire(u32 id)
+    {
+        make_dense(id);
+        if (!m_used.insert(id))
+        {
+            return false;
+        }
+        m_free.erase(id);
+        return true;
+    }
+
+    void IdAllocator::release(u32 id)
+    {
+        m_used.erase(id);
+        m_free.insert(id);
+        m_lowest_free = std::min(m_lowest_free, id);
+    }
+
+    void IdAllocator::reserve(u32 max_id)
+    {
+        m_used.grow(u64(max_id) + 1);
+        m_free.grow(u64(max_id) + 1);
+    }
+
+    u32 IdAllocator::get_next_id() const
+    {
+        return m_next_id;
+    }
+
+    void IdAllocator::set_next_id(u32 id)
+    {
+        m_next_id = id;
+    }
+
+    std::set<u32> IdAllocator::get_used_ids() const
+    {
+        return m_used.to_set();
+    }
+
+    void IdAllocator::set_used_ids(const std::set<u32>& ids)
+    {
+        m_used.clear();
+        if (!ids.empty() && *ids.rbegin() < 2 * u64(ids.size()) + DENSE_SLACK)
+        {
+            reserve(*ids.rbegin());
+        }
+        for (u32 id : ids)
+        {
+            m_used.insert(id);
+        }
+    }
+
+    std::set<u32> IdAllocator::get_free_ids() const
+    {
+        return m_free.to_set();
+    }
+
+    void IdAllocator::set_free_ids(const std::set<u32>& ids)
+    {
+        m_free.clear();
+        for (u32 id : ids)
+        {
+            m_free.insert(id);
+        }
+        m_lowest_free = 0;
+    }
+}    // namespace hal
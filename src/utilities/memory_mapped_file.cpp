@@ -0,0 +1,179 @@
+#include "hal_core/utilities/memory_mapped_file.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hal
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+
+            m_data    = other.m_data;
+            m_size    = other.m_size;
+            m_is_open = other.m_is_open;
+#ifdef _WIN32
+            m_file_handle    = other.m_file_handle;
+            m_mapping_handle = other.m_mapping_handle;
+
+            other.m_file_handle    = nullptr;
+            other.m_mapping_handle = nullptr;
+#endif
+            other.m_data    = nullptr;
+            other.m_size    = 0;
+            other.m_is_open = false;
+        }
+        return *this;
+    }
+
+    Result<std::monostate> MemoryMappedFile::open(const std::filesystem::path& file_path)
+    {
+        close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return ERR("could not map file '" + file_path.string() + "' into memory: unable to open file");
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return ERR("could not map file '" + file_path.string() + "' into memory: unable to determine file size");
+        }
+
+        // empty files cannot be mapped
+        if (size.QuadPart > 0)
+        {
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping == nullptr)
+            {
+                CloseHandle(file);
+                return ERR("could not map file '" + file_path.string() + "' into memory: unable to create file mapping");
+            }
+
+            const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (data == nullptr)
+            {
+                CloseHandle(mapping);
+                CloseHandle(file);
+                return ERR("could not map file '" + file_path.string() + "' into memory: unable to map view of file");
+            }
+
+            m_mapping_handle = mapping;
+            m_data           = static_cast<const char*>(data);
+        }
+
+        m_file_handle = file;
+        m_size        = size.QuadPart;
+#else
+        int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return ERR("could not map file '" + file_path.string() + "' into memory: unable to open file");
+        }
+
+        struct stat sb;
+        if (fstat(fd, &sb) == -1)
+        {
+            ::close(fd);
+            return ERR("could not map file '" + file_path.string() + "' into memory: unable to determine file size");
+        }
+
+        // empty files cannot be mapped
+        if (sb.st_size > 0)
+        {
+            void* data = mmap(nullptr, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(fd);
+                return ERR("could not map file '" + file_path.string() + "' into memory: unable to map file");
+            }
+
+            // the file is usually read front to back, so let the kernel read ahead aggressively
+            madvise(data, sb.st_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const char*>(data);
+        }
+
+        // the mapping stays valid after closing the file descriptor
+        ::close(fd);
+        m_size = sb.st_size;
+#endif
+
+        m_is_open = true;
+        return OK({});
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (!m_is_open)
+        {
+            return;
+        }
+
+#ifdef _WIN32
+        if (m_data != nullptr)
+        {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping_handle != nullptr)
+        {
+            CloseHandle(m_mapping_handle);
+        }
+        if (m_file_handle != nullptr)
+        {
+            CloseHandle(m_file_handle);
+        }
+        m_file_handle    = nullptr;
+        m_mapping_handle = nullptr;
+#else
+        if (m_data != nullptr)
+        {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+
+        m_data    = nullptr;
+        m_size    = 0;
+        m_is_open = false;
+    }
+
+    bool MemoryMappedFile::is_open() const
+    {
+        return m_is_open;
+    }
+
+    std::string_view MemoryMappedFile::get_data() const
+    {
+        if (m_data == nullptr)
+        {
+            return std::string_view();
+        }
+        return std::string_view(m_data, m_size);
+    }
+
+    u64 MemoryMappedFile::get_size() const
+    {
+        return m_size;
+    }
+}    // namespace hal
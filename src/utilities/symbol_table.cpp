@@ -0,0 +1,94 @@
+#include "hal_core/utilities/symbol_table.h"
+
+#include <cstring>
+#include <mutex>
+
+namespace hal
+{
+    namespace
+    {
+        // strings are copied into blocks of this size, longer strings get a block of their own
+        constexpr u64 BLOCK_SIZE = 64 * 1024;
+    }    // namespace
+
+    SymbolTable::Symbol SymbolTable::intern(std::string_view str)
+    {
+        {
+            std::shared_lock lock(m_mutex);
+            if (const auto it = m_symbols.find(str); it != m_symbols.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::unique_lock lock(m_mutex);
+        if (const auto it = m_symbols.find(str); it != m_symbols.end())
+        {
+            return it->second;
+        }
+
+        char* dst = nullptr;
+        if (str.size() > BLOCK_SIZE / 4)
+        {
+            auto block = std::make_unique<char[]>(str.size());
+            dst        = block.get();
+            m_allocated += str.size();
+
+            // keep the partially filled block last so that its remaining space is still used
+            m_blocks.insert(m_blocks.empty() ? m_blocks.end() : m_blocks.end() - 1, std::move(block));
+        }
+        else
+        {
+            if (m_blocks.empty() || m_block_fill + str.size() > m_block_size)
+            {
+                m_blocks.push_back(std::make_unique<char[]>(BLOCK_SIZE));
+                m_block_size = BLOCK_SIZE;
+                m_block_fill = 0;
+                m_allocated += BLOCK_SIZE;
+            }
+            dst = m_blocks.back().get() + m_block_fill;
+            m_block_fill += str.size();
+        }
+        std::memcpy(dst, str.data(), str.size());
+
+        const Symbol symbol = static_cast<Symbol>(m_strings.size());
+        const std::string_view stored(dst, str.size());
+        m_strings.push_back(stored);
+        m_symbols.emplace(stored, symbol);
+        return symbol;
+    }
+
+    SymbolTable::Symbol SymbolTable::find(std::string_view str) const
+    {
+        std::shared_lock lock(m_mutex);
+        if (const auto it = m_symbols.find(str); it != m_symbols.end())
+        {
+            return it->second;
+        }
+        return INVALID_SYMBOL;
+    }
+
+    std::string_view SymbolTable::get(Symbol symbol) const
+    {
+        std::shared_lock lock(m_mutex);
+        if (symbol >= m_strings.size())
+        {
+            return std::string_view();
+        }
+        return m_strings[symbol];
+    }
+
+    u32 SymbolTable::size() const
+    {
+        std::shared_lock lock(m_mutex);
+        return static_cast<u32>(m_strings.size());
+    }
+
+    u64 SymbolTable::get_memory_usage() const
+    {
+        std::shared_lock lock(m_mutex);
+        // every index entry holds a string view, a symbol, and a next pointer plus a bucket pointer
+        return m_allocated + m_strings.capacity() * sizeof(std::string_view) + m_symbols.size() * (sizeof(std::string_view) + sizeof(Symbol) + 2 * sizeof(void*))
+               + m_symbols.bucket_count() * sizeof(void*);
+    }
+}    // namespace hal
@@ -1,7 +1,12 @@
 #include "netlist_test_utils.h"
 #include "gtest/gtest.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/and_inverter_graph.h"
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
+#include "hal_core/netlist/boolean_function/simplification.h"
 #include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/solver_session.h"
+#include "hal_core/netlist/boolean_function/symbolic_execution.h"
 #include "hal_core/netlist/boolean_function/types.h"
 
 #include <iostream>
@@ -1206,6 +1211,118 @@ namespace hal {
         }
     }
 
+    TEST(BooleanFunction, CompiledEvaluation) {
+        const auto a = BooleanFunction::Var("A", 3),
+                   b = BooleanFunction::Var("B", 3),
+                   c = BooleanFunction::Var("C", 1);
+
+        using Value = BooleanFunction::Value;
+
+        const std::vector<BooleanFunction> data = {
+            a.clone() & b.clone(),
+            a.clone() | ~b.clone(),
+            a.clone() ^ b.clone(),
+            a.clone() + b.clone(),
+            a.clone() - b.clone(),
+            a.clone() * b.clone(),
+            BooleanFunction::Eq(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ule(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ult(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Sle(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Slt(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ite(c.clone(), a.clone(), b.clone(), 3).get(),
+            BooleanFunction::Concat(c.clone(), a.clone() & b.clone(), 4).get(),
+            BooleanFunction::Zext(a.clone() ^ b.clone(), BooleanFunction::Index(5, 5), 5).get(),
+            BooleanFunction::Sext(a.clone() - b.clone(), BooleanFunction::Index(5, 5), 5).get(),
+        };
+
+        // compare the compiled evaluation against the symbolic evaluation for all assignments over {0, 1, X}
+        const std::vector<Value> values = {Value::ZERO, Value::ONE, Value::X};
+        for (const auto& function : data) {
+            auto compiled = CompiledBooleanFunction::compile(function, {"A", "B", "C"});
+            ASSERT_TRUE(compiled.is_ok());
+            ASSERT_EQ(compiled.get().get_num_inputs(), 7);
+            ASSERT_EQ(compiled.get().size(), function.size());
+
+            for (u32 assignment = 0; assignment < 3 * 3 * 3 * 3 * 3 * 3 * 3; assignment++) {
+                std::vector<Value> inputs;
+                auto tmp = assignment;
+                for (u32 i = 0; i < 7; i++) {
+                    inputs.push_back(values[tmp % 3]);
+                    tmp /= 3;
+                }
+
+                auto symbolic_execution = SMT::SymbolicExecution();
+                symbolic_execution.state.set(a.clone(), BooleanFunction::Const({inputs[0], inputs[1], inputs[2]}));
+                symbolic_execution.state.set(b.clone(), BooleanFunction::Const({inputs[3], inputs[4], inputs[5]}));
+                symbolic_execution.state.set(c.clone(), BooleanFunction::Const({inputs[6]}));
+                auto expected = symbolic_execution.evaluate(function);
+                ASSERT_TRUE(expected.is_ok());
+                ASSERT_TRUE(expected.get().is_constant());
+
+                auto value = compiled.get().evaluate(inputs);
+                ASSERT_TRUE(value.is_ok());
+                EXPECT_EQ(value.get(), expected.get().get_top_level_node().constant) << function.to_string();
+            }
+        }
+
+        // evaluate 128 assignments in a single bitsliced pass
+        {
+            auto compiled = CompiledBooleanFunction::compile(a.clone() + b.clone(), {"A", "B"});
+            ASSERT_TRUE(compiled.is_ok());
+
+            std::vector<u64> inputs(6 * 2, 0);
+            for (u32 lane = 0; lane < 128; lane++) {
+                const u32 va = lane % 8, vb = (lane / 8) % 8;
+                for (u32 i = 0; i < 3; i++) {
+                    inputs[i * 2 + lane / 64] |= (u64)((va >> i) & 1) << (lane % 64);
+                    inputs[(3 + i) * 2 + lane / 64] |= (u64)((vb >> i) & 1) << (lane % 64);
+                }
+            }
+
+            std::vector<u64> output_values, output_unknowns;
+            ASSERT_TRUE(compiled.get().evaluate(inputs, {}, output_values, output_unknowns, 2).is_ok());
+            ASSERT_EQ(output_values.size(), 3 * 2);
+            for (u32 lane = 0; lane < 128; lane++) {
+                const u32 expected = ((lane % 8) + ((lane / 8) % 8)) % 8;
+                u32 result = 0;
+                for (u32 i = 0; i < 3; i++) {
+                    EXPECT_EQ((output_unknowns[i * 2 + lane / 64] >> (lane % 64)) & 1, 0);
+                    result |= ((output_values[i * 2 + lane / 64] >> (lane % 64)) & 1) << i;
+                }
+                EXPECT_EQ(result, expected);
+            }
+        }
+
+        // truth table spanning several lane words
+        {
+            std::vector<std::string> variables;
+            BooleanFunction function = BooleanFunction::Var("V0");
+            variables.push_back("V0");
+            for (u32 i = 1; i < 8; i++) {
+                variables.push_back("V" + std::to_string(i));
+                function = (i % 2 == 0) ? (function & BooleanFunction::Var(variables.back())) : (function ^ BooleanFunction::Var(variables.back()));
+            }
+
+            auto truth_table = function.compute_truth_table(variables);
+            ASSERT_TRUE(truth_table.is_ok());
+            ASSERT_EQ(truth_table.get().size(), 1);
+            ASSERT_EQ(truth_table.get().front().size(), 256);
+            for (u32 row = 0; row < 256; row++) {
+                std::unordered_map<std::string, Value> inputs;
+                for (u32 i = 0; i < 8; i++) {
+                    inputs[variables[i]] = ((row >> i) & 1) ? Value::ONE : Value::ZERO;
+                }
+                EXPECT_EQ(truth_table.get().front()[row], function.evaluate(inputs).get());
+            }
+        }
+
+        // unsupported operations and unknown variables are rejected
+        EXPECT_TRUE(CompiledBooleanFunction::compile(BooleanFunction::Udiv(a.clone(), b.clone(), 3).get()).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(a.clone() & b.clone(), {"A"}).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(BooleanFunction()).is_error());
+    }
+
     TEST(BooleanFunction, SimplificationVsTruthTable) {
         const auto  a = BooleanFunction::Var("A"),
                     b = BooleanFunction::Var("B"),
@@ -1630,4 +1747,231 @@ namespace hal {
             }
         }
     }
+
+    TEST(BooleanFunction, SolverSession) {
+        const auto  a = BooleanFunction::Var("A"),
+                    b = BooleanFunction::Var("B"),
+                    c = BooleanFunction::Var("C", 4),
+                    d = BooleanFunction::Var("D", 4),
+                   _0 = BooleanFunction::Const(0, 1),
+                   _1 = BooleanFunction::Const(1, 1);
+
+        std::vector<std::unique_ptr<SMT::SolverSession>> sessions;
+        {
+            auto res = SMT::SolverSession::start_in_process(SMT::QueryConfig().with_model_generation().with_timeout(1000));
+            ASSERT_TRUE(res.is_ok());
+            sessions.push_back(res.get());
+            EXPECT_TRUE(sessions.back()->is_in_process());
+        }
+        if (SMT::Solver::has_local_solver_for(SMT::SolverType::Z3)) {
+            auto res = SMT::SolverSession::start(SMT::QueryConfig().with_solver(SMT::SolverType::Z3).with_model_generation().with_timeout(1000));
+            ASSERT_TRUE(res.is_ok());
+            sessions.push_back(res.get());
+            EXPECT_FALSE(sessions.back()->is_in_process());
+        }
+
+        for (auto& session : sessions) {
+            // incremental assertions
+            ASSERT_TRUE(session->add_constraint(SMT::Constraint(a.clone() | b.clone(), _1.clone())).is_ok());
+            {
+                auto res = session->check();
+                ASSERT_TRUE(res.is_ok());
+                EXPECT_TRUE(res.get().is_sat());
+            }
+
+            // scopes
+            ASSERT_TRUE(session->push().is_ok());
+            EXPECT_EQ(session->get_num_scopes(), 1);
+            ASSERT_TRUE(session->add_constraints({SMT::Constraint(a.clone(), _0.clone()), SMT::Constraint(b.clone(), _0.clone())}).is_ok());
+            {
+                auto res = session->check();
+                ASSERT_TRUE(res.is_ok());
+                EXPECT_TRUE(res.get().is_unsat());
+            }
+            ASSERT_TRUE(session->pop().is_ok());
+            EXPECT_EQ(session->get_num_scopes(), 0);
+            EXPECT_TRUE(session->pop().is_error());
+
+            // assumptions only hold for a single check
+            {
+                auto res = session->check({~a.clone()});
+                ASSERT_TRUE(res.is_ok());
+                ASSERT_TRUE(res.get().is_sat());
+                EXPECT_EQ(*res.get().model, SMT::Model({{"A", {0, 1}}, {"B", {1, 1}}}));
+            }
+            {
+                auto res = session->check({~a.clone(), ~b.clone()});
+                ASSERT_TRUE(res.is_ok());
+                EXPECT_TRUE(res.get().is_unsat());
+            }
+            {
+                auto res = session->check();
+                ASSERT_TRUE(res.is_ok());
+                EXPECT_TRUE(res.get().is_sat());
+            }
+            EXPECT_TRUE(session->check({c.clone()}).is_error());
+
+            // batch of independent queries
+            {
+                auto res = session->check_batch({
+                    {SMT::Constraint(BooleanFunction::Add(c.clone(), d.clone(), 4).get(), BooleanFunction::Const(5, 4)), SMT::Constraint(c.clone(), BooleanFunction::Const(0, 4))},
+                    {SMT::Constraint(a.clone(), _0.clone()), SMT::Constraint(b.clone(), _0.clone())},
+                    {SMT::Constraint(c.clone(), BooleanFunction::Const(7, 4)), SMT::Constraint(d.clone(), c.clone())},
+                });
+                ASSERT_TRUE(res.is_ok());
+                const auto results = res.get();
+                ASSERT_EQ(results.size(), 3);
+                ASSERT_TRUE(results.at(0).is_sat());
+                EXPECT_EQ(results.at(0).model->model.at("D"), std::make_tuple(u64(5), u16(4)));
+                EXPECT_TRUE(results.at(1).is_unsat());
+                ASSERT_TRUE(results.at(2).is_sat());
+                EXPECT_EQ(results.at(2).model->model.at("D"), std::make_tuple(u64(7), u16(4)));
+            }
+            EXPECT_EQ(session->get_num_scopes(), 0);
+        }
+
+        // a query in the middle of a batch fails, the solver process is terminated and the session has to be restarted
+        if (SMT::Solver::has_local_solver_for(SMT::SolverType::Z3)) {
+            auto res = SMT::SolverSession::start(SMT::QueryConfig().with_solver(SMT::SolverType::Z3).with_model_generation().with_timeout(1000));
+            ASSERT_TRUE(res.is_ok());
+            auto session = res.get();
+            ASSERT_TRUE(session->add_constraint(SMT::Constraint(a.clone(), _1.clone())).is_ok());
+
+            // E is declared with a size of 4 bit by the first query, hence the second query is rejected by the solver,
+            // the remaining queries exceed the pipe capacities and must neither block the session nor corrupt it
+            const auto e_4 = BooleanFunction::Var("E", 4), e_8 = BooleanFunction::Var("E", 8);
+            std::vector<std::vector<SMT::Constraint>> queries;
+            queries.push_back({SMT::Constraint(e_4.clone(), BooleanFunction::Const(3, 4))});
+            queries.push_back({SMT::Constraint(e_8.clone(), BooleanFunction::Const(3, 8))});
+            for (u32 i = 0; i < 10000; i++) {
+                queries.push_back({SMT::Constraint(BooleanFunction::Add(c.clone(), d.clone(), 4).get(), BooleanFunction::Const(i % 16, 4))});
+            }
+            EXPECT_TRUE(session->check_batch(queries).is_error());
+            EXPECT_FALSE(session->is_usable());
+            EXPECT_TRUE(session->check().is_error());
+            EXPECT_TRUE(session->push().is_error());
+
+            ASSERT_TRUE(session->restart().is_ok());
+            EXPECT_TRUE(session->is_usable());
+            EXPECT_FALSE(session->is_in_process());
+            EXPECT_EQ(session->get_num_scopes(), 0);
+            ASSERT_TRUE(session->add_constraint(SMT::Constraint(a.clone(), _0.clone())).is_ok());
+            {
+                auto res = session->check();
+                ASSERT_TRUE(res.is_ok());
+                ASSERT_TRUE(res.get().is_sat());
+                EXPECT_EQ(res.get().model->model.at("A"), std::make_tuple(u64(0), u16(1)));
+            }
+        }
+    }
+
+    TEST(BooleanFunction, AndInverterGraph) {
+        const auto  a = BooleanFunction::Var("A"),
+                    b = BooleanFunction::Var("B"),
+                    c = BooleanFunction::Var("C"),
+                   _0 = BooleanFunction::Const(0, 1),
+                   _1 = BooleanFunction::Const(1, 1);
+
+        using Literal = AndInverterGraph::Literal;
+
+        ////////////////////////////////////////////////////////////////////////
+        // structural hashing and trivial cases
+        ////////////////////////////////////////////////////////////////////////
+        {
+            AndInverterGraph graph;
+            const Literal la = graph.add_input("A");
+            const Literal lb = graph.add_input("B");
+
+            EXPECT_EQ(graph.add_input("A"), la);
+            EXPECT_EQ(graph.get_input("B").get(), lb);
+            EXPECT_TRUE(graph.get_input("C").is_error());
+            EXPECT_EQ(graph.get_input_names(), std::vector<std::string>({"A", "B"}));
+
+            EXPECT_EQ(graph.add_and(la, AndInverterGraph::CONSTANT_ZERO), AndInverterGraph::CONSTANT_ZERO);
+            EXPECT_EQ(graph.add_and(la, AndInverterGraph::CONSTANT_ONE), la);
+            EXPECT_EQ(graph.add_and(la, la), la);
+            EXPECT_EQ(graph.add_and(la, AndInverterGraph::negate(la)), AndInverterGraph::CONSTANT_ZERO);
+            EXPECT_EQ(graph.get_num_and_nodes(), 0u);
+
+            const Literal l_and = graph.add_and(la, lb);
+            EXPECT_EQ(graph.add_and(lb, la), l_and);
+            EXPECT_EQ(graph.get_num_and_nodes(), 1u);
+            EXPECT_TRUE(graph.is_and_node(AndInverterGraph::get_node_index(l_and)));
+            EXPECT_TRUE(graph.is_input_node(AndInverterGraph::get_node_index(la)));
+            EXPECT_EQ(graph.get_fan_in(AndInverterGraph::get_node_index(l_and)).get(), std::make_pair(la, lb));
+            EXPECT_TRUE(graph.get_fan_in(AndInverterGraph::get_node_index(la)).is_error());
+
+            // ~(~A & ~B) reuses a single node for A | B
+            const Literal l_or = graph.add_or(la, lb);
+            EXPECT_TRUE(AndInverterGraph::is_complemented(l_or));
+            EXPECT_EQ(graph.add_or(lb, la), l_or);
+            EXPECT_EQ(graph.get_num_and_nodes(), 2u);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // translation from and to Boolean functions with sharing
+        ////////////////////////////////////////////////////////////////////////
+        {
+            AndInverterGraph graph;
+            const auto f = (a & b) | ~c;
+            const auto g = ((a & b) ^ c) | ((b & a) & _1);
+
+            const auto lf = graph.add_function(f);
+            ASSERT_TRUE(lf.is_ok());
+            const auto num_nodes = graph.get_num_and_nodes();
+            const auto lg        = graph.add_function(g);
+            ASSERT_TRUE(lg.is_ok());
+
+            // A & B is shared between both functions
+            EXPECT_EQ(graph.get_num_and_nodes(), num_nodes + 3);
+            EXPECT_EQ(graph.add_function(BooleanFunction::Eq(a.clone(), b.clone(), 1).get()).get(), AndInverterGraph::negate(graph.add_xor(graph.get_input("A").get(), graph.get_input("B").get())));
+            EXPECT_EQ(graph.add_function(BooleanFunction::Ite(c.clone(), a.clone(), _0.clone(), 1).get()).get(), graph.add_and(graph.get_input("C").get(), graph.get_input("A").get()));
+
+            // substituted variables do not become inputs
+            EXPECT_EQ(graph.add_function(BooleanFunction::Var("X") & a, {{"X", lf.get()}}).get(), graph.add_and(lf.get(), graph.get_input("A").get()));
+            EXPECT_TRUE(graph.get_input("X").is_error());
+
+            EXPECT_TRUE(graph.add_output("f", lf.get()).is_ok());
+            EXPECT_TRUE(graph.add_output("g", lg.get()).is_ok());
+            EXPECT_TRUE(graph.add_output("f", lg.get()).is_error());
+            EXPECT_TRUE(graph.add_output("h", 2 * graph.get_num_nodes()).is_error());
+            EXPECT_EQ(graph.get_output("g").get(), lg.get());
+            EXPECT_EQ(graph.get_outputs().size(), 2u);
+
+            // unsupported functions
+            EXPECT_TRUE(graph.add_function(BooleanFunction::Var("D", 2)).is_error());
+            EXPECT_TRUE(graph.add_function(BooleanFunction::Add(a.clone(), b.clone(), 1).get()).is_error());
+            EXPECT_TRUE(graph.add_function(BooleanFunction::Const(BooleanFunction::Value::X)).is_error());
+
+            const auto check_equivalent = [](const BooleanFunction& expected, const BooleanFunction& actual) {
+                for (u32 assignment = 0; assignment < 8; assignment++)
+                {
+                    std::unordered_map<std::string, std::vector<BooleanFunction::Value>> values = {
+                        {"A", {(assignment & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO}},
+                        {"B", {(assignment & 2) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO}},
+                        {"C", {(assignment & 4) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO}},
+                    };
+                    EXPECT_EQ(expected.evaluate(values).get(), actual.evaluate(values).get());
+                }
+            };
+
+            const auto f_res = graph.to_boolean_function("f");
+            ASSERT_TRUE(f_res.is_ok());
+            check_equivalent(f, f_res.get());
+            const auto g_res = graph.to_boolean_function("g");
+            ASSERT_TRUE(g_res.is_ok());
+            check_equivalent(g, g_res.get());
+            EXPECT_TRUE(graph.to_boolean_function("h").is_error());
+            EXPECT_EQ(graph.to_boolean_function(AndInverterGraph::CONSTANT_ONE).get(), ~_0);
+
+            // simplification via ABC keeps inputs, outputs, and functionality
+            const auto simplified = Simplification::abc_simplification(graph);
+            ASSERT_TRUE(simplified.is_ok());
+            EXPECT_EQ(simplified.get().get_input_names(), graph.get_input_names());
+            ASSERT_EQ(simplified.get().get_outputs().size(), 2u);
+            EXPECT_LE(simplified.get().get_num_and_nodes(), graph.get_num_and_nodes());
+            check_equivalent(f, simplified.get().to_boolean_function("f").get());
+            check_equivalent(g, simplified.get().to_boolean_function("g").get());
+        }
+    }
 } //namespace hal
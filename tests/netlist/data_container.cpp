@@ -16,6 +16,12 @@ namespace hal
         TestDataContainer()  = default;
         ~TestDataContainer() = default;
 
+        TestDataContainer(SymbolTable* symbol_table) : DataContainer(symbol_table)
+        {
+        }
+
+        using DataContainer::copy_data;
+
         /**
          * Returns true whenever the notify_updated() was called since the last
          * call of data_update_notified
@@ -233,4 +239,70 @@ TEST_F(DataContainerTest, check_get_data)
 
     TEST_END
 }
+
+/**
+     * Testing that data is interned in the symbol table of the container and that containers using different symbol tables can be compared and copied.
+     *
+     * Functions: DataContainer, copy_data, operator==, SymbolTable::intern, SymbolTable::find, SymbolTable::get
+     */
+TEST_F(DataContainerTest, check_symbol_interning)
+{
+    TEST_START
+    {
+        // Strings are interned once
+        SymbolTable symbols;
+        EXPECT_EQ(symbols.find("a"), SymbolTable::INVALID_SYMBOL);
+        SymbolTable::Symbol a = symbols.intern("a");
+        SymbolTable::Symbol b = symbols.intern("b");
+        EXPECT_NE(a, b);
+        EXPECT_EQ(symbols.intern("a"), a);
+        EXPECT_EQ(symbols.find("a"), a);
+        EXPECT_EQ(symbols.get(a), "a");
+        EXPECT_EQ(symbols.get(b), "b");
+        EXPECT_EQ(symbols.get(SymbolTable::INVALID_SYMBOL), "");
+        std::string long_str(100000, 'x');
+        SymbolTable::Symbol l = symbols.intern(long_str);
+        EXPECT_EQ(symbols.get(l), long_str);
+        EXPECT_EQ(symbols.get(symbols.intern("c")), "c");
+        EXPECT_EQ(symbols.size(), 4);
+    }
+    {
+        // Containers sharing a symbol table share their strings
+        SymbolTable symbols;
+        TestDataContainer d_cont_0(&symbols);
+        TestDataContainer d_cont_1(&symbols);
+        d_cont_0.set_data("category", "key", "data_type", "value");
+        d_cont_1.set_data("category", "key", "data_type", "value");
+        d_cont_1.set_data("category", "key_1", "data_type", "value");
+        EXPECT_EQ(symbols.size(), 5);
+        EXPECT_NE(d_cont_0, d_cont_1);
+        d_cont_1.delete_data("category", "key_1");
+        EXPECT_EQ(d_cont_0, d_cont_1);
+        EXPECT_FALSE(d_cont_0.has_data("unknown_category", "key"));
+        EXPECT_EQ(symbols.size(), 5);
+    }
+    {
+        // Containers using different symbol tables
+        SymbolTable symbols_0;
+        SymbolTable symbols_1;
+        TestDataContainer d_cont_0(&symbols_0);
+        TestDataContainer d_cont_1(&symbols_1);
+        symbols_1.intern("unrelated");
+        d_cont_0.set_data("category_0", "key_0", "data_type_0", "value_0");
+        d_cont_0.set_data("category_1", "key_1", "data_type_1", "value_1");
+        d_cont_1.set_data("category_1", "key_1", "data_type_1", "value_1");
+        d_cont_1.set_data("category_0", "key_0", "data_type_0", "value_0");
+        EXPECT_EQ(d_cont_0, d_cont_1);
+
+        TestDataContainer d_cont_2(&symbols_1);
+        d_cont_2.copy_data(d_cont_0);
+        EXPECT_EQ(d_cont_2, d_cont_0);
+        EXPECT_EQ(d_cont_2.get_data("category_1", "key_1"), std::make_tuple("data_type_1", "value_1"));
+        d_cont_0.set_data("category_0", "key_0", "data_type_0", "value_2");
+        EXPECT_NE(d_cont_2, d_cont_0);
+        EXPECT_EQ(d_cont_2.get_data("category_0", "key_0"), std::make_tuple("data_type_0", "value_0"));
+    }
+
+    TEST_END
+}
 }
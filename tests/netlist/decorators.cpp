@@ -6,6 +6,8 @@
 #include "hal_core/netlist/boolean_function.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/decorators/boolean_function_decorator.h"
+#include "hal_core/netlist/decorators/subgraph_netlist_decorator.h"
+#include "hal_core/netlist/boolean_function/translator.h"
 #include "netlist_test_utils.h"
 
 
@@ -73,4 +75,111 @@ namespace hal {
         }
         TEST_END
     }
-}
\ No newline at end of file
+
+    /**
+     * Test SubgraphNetlistDecorator::get_subgraph_function for multiple outputs.
+     */
+    TEST_F(DecoratorTest, check_subgraph_function_graph)
+    {
+        TEST_START
+        {
+            // chain of reconvergent stages: p_i = x_{i-1} & c, q_i = x_{i-1} | c, x_i = p_i ^ q_i
+            std::unique_ptr<Netlist> nl_owner = test_utils::create_empty_netlist();
+            auto* nl = nl_owner.get();
+            ASSERT_NE(nl, nullptr);
+            const auto* gl = nl->get_gate_library();
+
+            const u32 num_stages = 24;
+
+            auto* xor0 = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor_0");
+            ASSERT_NE(xor0, nullptr);
+            Net* a = test_utils::connect_global_in(nl, xor0, "I0", "a");
+            ASSERT_NE(a, nullptr);
+            Net* b = test_utils::connect_global_in(nl, xor0, "I1", "b");
+            ASSERT_NE(b, nullptr);
+            Net* c = nl->create_net("c");
+            ASSERT_NE(c, nullptr);
+            nl->mark_global_input_net(c);
+
+            std::vector<Gate*> gates = {xor0};
+            std::vector<const Net*> stage_nets;
+            Gate* prev = xor0;
+            for (u32 i = 1; i <= num_stages; i++)
+            {
+                auto* and_gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and_" + std::to_string(i));
+                auto* or_gate  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or_" + std::to_string(i));
+                auto* xor_gate = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor_" + std::to_string(i));
+                ASSERT_NE(and_gate, nullptr);
+                ASSERT_NE(or_gate, nullptr);
+                ASSERT_NE(xor_gate, nullptr);
+
+                Net* x = test_utils::connect(nl, prev, "O", and_gate, "I0", "x_" + std::to_string(i - 1));
+                ASSERT_NE(x, nullptr);
+                ASSERT_NE(x->add_destination(or_gate, "I0"), nullptr);
+                ASSERT_NE(c->add_destination(and_gate, "I1"), nullptr);
+                ASSERT_NE(c->add_destination(or_gate, "I1"), nullptr);
+                ASSERT_NE(test_utils::connect(nl, and_gate, "O", xor_gate, "I0", "p_" + std::to_string(i)), nullptr);
+                ASSERT_NE(test_utils::connect(nl, or_gate, "O", xor_gate, "I1", "q_" + std::to_string(i)), nullptr);
+
+                stage_nets.push_back(x);
+                gates.insert(gates.end(), {and_gate, or_gate, xor_gate});
+                prev = xor_gate;
+            }
+            Net* out = test_utils::connect_global_out(nl, prev, "O", "out");
+            ASSERT_NE(out, nullptr);
+
+            const auto decorator = SubgraphNetlistDecorator(*nl);
+
+            // the graph grows linearly with the number of stages and shares logic between outputs
+            auto graph_res = decorator.get_subgraph_function(gates, std::vector<const Net*>({out, stage_nets.at(3), stage_nets.at(6), a}));
+            ASSERT_TRUE(graph_res.is_ok());
+            const auto graph = graph_res.get();
+
+            EXPECT_EQ(graph.get_input_names().size(), 3u);
+            EXPECT_EQ(graph.get_outputs().size(), 4u);
+            EXPECT_LE(graph.get_num_and_nodes(), 5 * (num_stages + 1));
+            EXPECT_EQ(graph.get_output(BooleanFunctionNetDecorator(*a).get_boolean_variable_name()).get(), graph.get_input(BooleanFunctionNetDecorator(*a).get_boolean_variable_name()).get());
+
+            // x_i = (x_{i-1} & c) ^ (x_{i-1} | c) = x_{i-1} ^ c, hence x_3 = a ^ b ^ c and x_6 = a ^ b
+            // (converting the output of the last stage would expand the graph into an exponentially large tree)
+            const auto var_a = BooleanFunctionNetDecorator(*a).get_boolean_variable();
+            const auto var_b = BooleanFunctionNetDecorator(*b).get_boolean_variable();
+            const auto var_c = BooleanFunctionNetDecorator(*c).get_boolean_variable();
+            const auto expected_x3  = var_a ^ var_b ^ var_c;
+            const auto expected_x6 = var_a ^ var_b;
+
+            const auto x3_res = graph.to_boolean_function(BooleanFunctionNetDecorator(*stage_nets.at(3)).get_boolean_variable_name());
+            ASSERT_TRUE(x3_res.is_ok());
+            const auto x6_res = graph.to_boolean_function(BooleanFunctionNetDecorator(*stage_nets.at(6)).get_boolean_variable_name());
+            ASSERT_TRUE(x6_res.is_ok());
+
+            for (u32 assignment = 0; assignment < 8; assignment++)
+            {
+                std::unordered_map<std::string, std::vector<BooleanFunction::Value>> values = {
+                    {BooleanFunctionNetDecorator(*a).get_boolean_variable_name(), {(assignment & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO}},
+                    {BooleanFunctionNetDecorator(*b).get_boolean_variable_name(), {(assignment & 2) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO}},
+                    {BooleanFunctionNetDecorator(*c).get_boolean_variable_name(), {(assignment & 4) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO}},
+                };
+                EXPECT_EQ(x3_res.get().evaluate(values).get(), expected_x3.evaluate(values).get());
+                EXPECT_EQ(x6_res.get().evaluate(values).get(), expected_x6.evaluate(values).get());
+            }
+
+            // the SMT-LIB translation defines every shared node exactly once
+            const auto smt_res = SMT::Translator::translate_to_smt2(graph);
+            ASSERT_TRUE(smt_res.is_ok());
+            const auto& smt = smt_res.get();
+            u32 num_defines = 0;
+            for (auto pos = smt.find("(define-fun aig_node_"); pos != std::string::npos; pos = smt.find("(define-fun aig_node_", pos + 1))
+            {
+                num_defines++;
+            }
+            EXPECT_LE(num_defines, graph.get_num_and_nodes());
+            EXPECT_NE(smt.find("(declare-fun " + BooleanFunctionNetDecorator(*c).get_boolean_variable_name() + " () (_ BitVec 1))"), std::string::npos);
+
+            // invalid inputs
+            EXPECT_TRUE(decorator.get_subgraph_function(std::vector<const Gate*>(), std::vector<const Net*>({out})).is_error());
+            EXPECT_TRUE(decorator.get_subgraph_function(gates, std::vector<const Net*>({nullptr})).is_error());
+        }
+        TEST_END
+    }
+}
@@ -0,0 +1,170 @@
+#include "hal_core/netlist/frozen_netlist_view.h"
+
+#include "gate_library_test_utils.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+namespace hal
+{
+    class FrozenNetlistViewTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /**
+     * Test that the frozen view reproduces the connectivity of the netlist.
+     *
+     * Functions: FrozenNetlistView, get_num_gates, get_num_nets, get_gate, get_net, get_gate_index, get_net_index, get_fan_in_nets, get_fan_in_pins, get_fan_out_nets,
+     *            get_fan_out_pins, get_sources, get_source_pins, get_destinations, get_destination_pins
+     */
+    TEST_F(FrozenNetlistViewTest, check_connectivity)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+
+            FrozenNetlistView view(*nl);
+            ASSERT_EQ(view.get_num_gates(), nl->get_gates().size());
+            ASSERT_EQ(view.get_num_nets(), nl->get_nets().size());
+
+            for (u32 i = 0; i < view.get_num_gates(); i++)
+            {
+                const Gate* gate = view.get_gate(i);
+                EXPECT_EQ(view.get_gate_index(gate), i);
+                EXPECT_EQ(view.get_gate_index_by_id(gate->get_id()), i);
+
+                const auto in_eps   = gate->get_fan_in_endpoints();
+                const auto in_nets  = view.get_fan_in_nets(i);
+                const auto in_pins  = view.get_fan_in_pins(i);
+                ASSERT_EQ(in_nets.size(), in_eps.size());
+                ASSERT_EQ(in_pins.size(), in_eps.size());
+                for (u32 j = 0; j < in_eps.size(); j++)
+                {
+                    EXPECT_EQ(view.get_net(in_nets[j]), in_eps[j]->get_net());
+                    EXPECT_EQ(in_pins[j], in_eps[j]->get_pin());
+                }
+
+                const auto out_eps  = gate->get_fan_out_endpoints();
+                const auto out_nets = view.get_fan_out_nets(i);
+                const auto out_pins = view.get_fan_out_pins(i);
+                ASSERT_EQ(out_nets.size(), out_eps.size());
+                ASSERT_EQ(out_pins.size(), out_eps.size());
+                for (u32 j = 0; j < out_eps.size(); j++)
+                {
+                    EXPECT_EQ(view.get_net(out_nets[j]), out_eps[j]->get_net());
+                    EXPECT_EQ(out_pins[j], out_eps[j]->get_pin());
+                }
+            }
+
+            for (u32 i = 0; i < view.get_num_nets(); i++)
+            {
+                const Net* net = view.get_net(i);
+                EXPECT_EQ(view.get_net_index(net), i);
+                EXPECT_EQ(view.get_net_index_by_id(net->get_id()), i);
+
+                const auto src_eps  = net->get_sources();
+                const auto srcs     = view.get_sources(i);
+                const auto src_pins = view.get_source_pins(i);
+                ASSERT_EQ(srcs.size(), src_eps.size());
+                ASSERT_EQ(src_pins.size(), src_eps.size());
+                for (u32 j = 0; j < src_eps.size(); j++)
+                {
+                    EXPECT_EQ(view.get_gate(srcs[j]), src_eps[j]->get_gate());
+                    EXPECT_EQ(src_pins[j], src_eps[j]->get_pin());
+                }
+
+                const auto dst_eps  = net->get_destinations();
+                const auto dsts     = view.get_destinations(i);
+                const auto dst_pins = view.get_destination_pins(i);
+                ASSERT_EQ(dsts.size(), dst_eps.size());
+                ASSERT_EQ(dst_pins.size(), dst_eps.size());
+                for (u32 j = 0; j < dst_eps.size(); j++)
+                {
+                    EXPECT_EQ(view.get_gate(dsts[j]), dst_eps[j]->get_gate());
+                    EXPECT_EQ(dst_pins[j], dst_eps[j]->get_pin());
+                }
+            }
+
+            // objects that are not part of the view
+            EXPECT_EQ(view.get_gate_index(nullptr), FrozenNetlistView::invalid_index);
+            EXPECT_EQ(view.get_net_index(nullptr), FrozenNetlistView::invalid_index);
+            EXPECT_EQ(view.get_gate_index_by_id(1234), FrozenNetlistView::invalid_index);
+            EXPECT_EQ(view.get_net_index_by_id(1234), FrozenNetlistView::invalid_index);
+            EXPECT_EQ(view.get_gate(view.get_num_gates()), nullptr);
+            EXPECT_EQ(view.get_net(view.get_num_nets()), nullptr);
+            EXPECT_EQ(view.get_gate(FrozenNetlistView::invalid_index), nullptr);
+            EXPECT_EQ(view.get_net(FrozenNetlistView::invalid_index), nullptr);
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that modifications of the netlist connectivity invalidate the frozen view.
+     *
+     * Functions: get_stamp, is_valid
+     */
+    TEST_F(FrozenNetlistViewTest, check_invalidation)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+
+            {
+                // renaming does not invalidate the view
+                FrozenNetlistView view(*nl);
+                EXPECT_TRUE(view.is_valid());
+                nl->get_gates().front()->set_name("renamed_gate");
+                nl->get_nets().front()->set_name("renamed_net");
+                EXPECT_TRUE(view.is_valid());
+            }
+            {
+                // creating a gate invalidates the view
+                FrozenNetlistView view(*nl);
+                EXPECT_TRUE(view.is_valid());
+                Gate* gate = nl->create_gate(gl->get_gate_type_by_name("BUF"), "new_gate");
+                ASSERT_NE(gate, nullptr);
+                EXPECT_FALSE(view.is_valid());
+            }
+            {
+                // adding a destination invalidates the view
+                Gate* gate = nl->create_gate(gl->get_gate_type_by_name("BUF"), "unconnected_gate");
+                ASSERT_NE(gate, nullptr);
+                FrozenNetlistView view(*nl);
+                Net* net = nl->create_net("new_net");
+                ASSERT_NE(net, nullptr);
+                EXPECT_FALSE(view.is_valid());
+
+                FrozenNetlistView view_2(*nl);
+                EXPECT_TRUE(view_2.is_valid());
+                EXPECT_NE(view.get_stamp(), view_2.get_stamp());
+                ASSERT_NE(net->add_destination(gate, "I"), nullptr);
+                EXPECT_FALSE(view_2.is_valid());
+            }
+            {
+                // disabling events does not prevent invalidation
+                FrozenNetlistView view(*nl);
+                nl->get_event_handler()->event_enable_all(false);
+                EXPECT_TRUE(nl->delete_net(nl->get_nets().front()));
+                nl->get_event_handler()->event_enable_all(true);
+                EXPECT_FALSE(view.is_valid());
+            }
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -490,6 +490,19 @@ namespace hal
             EXPECT_EQ(gate_0->get_fan_in_net("I0"), nl->get_net_by_id(MIN_NET_ID + 30));
             EXPECT_EQ(gate_0->get_fan_in_net("I1"), nl->get_net_by_id(MIN_NET_ID + 20));
         }
+        {
+            // Get the Net of a pin after it has been disconnected and connected again
+            Gate* gate_0 = nl->get_gate_by_id(MIN_GATE_ID + 0);
+            Net* net_30  = nl->get_net_by_id(MIN_NET_ID + 30);
+            ASSERT_TRUE(net_30->remove_destination(gate_0, "I0"));
+            EXPECT_EQ(gate_0->get_fan_in_net("I0"), nullptr);
+            EXPECT_EQ(gate_0->get_fan_in_endpoint("I0"), nullptr);
+            EXPECT_EQ(gate_0->get_fan_in_net("I1"), nl->get_net_by_id(MIN_NET_ID + 20));
+            Endpoint* ep = net_30->add_destination(gate_0, "I0");
+            ASSERT_NE(ep, nullptr);
+            EXPECT_EQ(gate_0->get_fan_in_endpoint("I0"), ep);
+            EXPECT_EQ(gate_0->get_fan_in_net("I0"), net_30);
+        }
         {
             // Get the Net of a pin where no Net is connected
             Gate* gate_5 = nl->get_gate_by_id(MIN_GATE_ID + 5);
@@ -0,0 +1,256 @@
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
+
+#include "gate_library_test_utils.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_port_component.h"
+#include "hal_core/utilities/utils.h"
+#include "hal_version.h"
+#include "netlist_test_utils.h"
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+#include <iterator>
+
+namespace hal
+{
+    class GateLibraryCacheTest : public ::testing::Test
+    {
+    protected:
+        // gate library file the cached libraries are keyed by, its content is never parsed
+        std::filesystem::path m_lib_path;
+
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+            std::filesystem::path lib_dir = utils::get_gate_library_directories().back();
+            std::filesystem::create_directories(lib_dir);
+            m_lib_path = std::filesystem::absolute(lib_dir / "cache_test_lib.hgl");
+            std::ofstream ofs(m_lib_path);
+            ofs << "{\"version\": 1, \"library\": \"TESTING_GATE_LIBRARY\"}";
+        }
+
+        virtual void TearDown()
+        {
+            gate_library_manager::remove(m_lib_path);
+            std::filesystem::remove(gate_library_cache::get_cache_file(m_lib_path));
+            std::filesystem::remove(m_lib_path);
+        }
+
+        /**
+         * Create the testing gate library extended by gate types using latch, RAM, RAM port, and MAC components.
+         */
+        std::unique_ptr<GateLibrary> create_test_lib()
+        {
+            std::unique_ptr<GateLibrary> lib = test_utils::create_gate_library(m_lib_path);
+            lib->add_include("some_include.h");
+            lib->set_gate_location_data_identifiers("X", "Y");
+
+            auto latch_component  = GateTypeComponent::create_latch_component(GateTypeComponent::create_state_component(nullptr, "IQ", "IQN"));
+            LatchComponent* latch = latch_component->convert_to<LatchComponent>();
+            latch->set_data_in_function(BooleanFunction::Var("D"));
+            latch->set_enable_function(BooleanFunction::Var("E"));
+            latch->set_async_reset_function(BooleanFunction::Var("R"));
+            latch->set_async_set_reset_behavior(AsyncSetResetBehavior::L, AsyncSetResetBehavior::H);
+            GateType* latch_type = lib->create_gate_type("LATCH_R", {GateTypeProperty::sequential, GateTypeProperty::latch}, std::move(latch_component));
+            latch_type->create_pin("D", PinDirection::input, PinType::data);
+            latch_type->create_pin("E", PinDirection::input, PinType::enable);
+            latch_type->create_pin("R", PinDirection::input, PinType::reset);
+            latch_type->create_pin("Q", PinDirection::output, PinType::state);
+            latch_type->add_boolean_function("Q", BooleanFunction::Var("IQ"));
+
+            auto read_port     = GateTypeComponent::create_ram_port_component(GateTypeComponent::create_init_component("generic", {"INIT_0", "INIT_1"}),
+                                                                          "DOUT",
+                                                                          "RADDR",
+                                                                          BooleanFunction::Var("CLK"),
+                                                                          BooleanFunction::Const(1, 1),
+                                                                          false);
+            auto write_port    = GateTypeComponent::create_ram_port_component(std::move(read_port), "DIN", "WADDR", BooleanFunction::Var("CLK"), BooleanFunction::Var("WE"), true);
+            GateType* ram_type = lib->create_gate_type("RAM64", {GateTypeProperty::sequential, GateTypeProperty::ram}, GateTypeComponent::create_ram_component(std::move(write_port), 64));
+            ram_type->create_pin("CLK", PinDirection::input, PinType::clock);
+            ram_type->create_pin("WE", PinDirection::input, PinType::enable);
+            std::vector<GatePin*> addr_pins;
+            for (u32 i = 0; i < 6; i++)
+            {
+                addr_pins.push_back(ram_type->create_pin("WADDR(" + std::to_string(i) + ")", PinDirection::input, PinType::address, false).get());
+            }
+            ram_type->create_pin_group("WADDR", addr_pins, PinDirection::input, PinType::address, true, 0);
+
+            lib->create_gate_type("MAC", {GateTypeProperty::combinational, GateTypeProperty::dsp}, GateTypeComponent::create_mac_component());
+            return lib;
+        }
+    };
+
+    /**
+     * Testing that a gate library read from the cache is identical to the gate library that was written to it.
+     *
+     * Functions: write, read, read_name
+     */
+    TEST_F(GateLibraryCacheTest, check_write_and_read)
+    {
+        TEST_START
+        {
+            auto lib = create_test_lib();
+            ASSERT_NE(lib, nullptr);
+            ASSERT_TRUE(gate_library_cache::write(lib.get()).is_ok());
+            EXPECT_TRUE(std::filesystem::exists(gate_library_cache::get_cache_file(m_lib_path)));
+
+            auto name = gate_library_cache::read_name(m_lib_path);
+            ASSERT_TRUE(name.is_ok());
+            EXPECT_EQ(name.get(), "TESTING_GATE_LIBRARY");
+
+            auto res = gate_library_cache::read(m_lib_path);
+            ASSERT_TRUE(res.is_ok());
+            auto cached = res.get();
+            ASSERT_NE(cached, nullptr);
+            EXPECT_TRUE(test_utils::gate_libraries_are_equal(lib.get(), cached.get()));
+            EXPECT_EQ(cached->get_path(), m_lib_path);
+            EXPECT_EQ(cached->get_includes(), lib->get_includes());
+            EXPECT_EQ(cached->get_gate_location_data_category(), lib->get_gate_location_data_category());
+            EXPECT_EQ(cached->get_gate_location_data_identifiers(), lib->get_gate_location_data_identifiers());
+
+            // GND and VCC markers
+            EXPECT_EQ(cached->get_gnd_gate_types().size(), 1);
+            EXPECT_NE(cached->get_gnd_gate_types().find("GND"), cached->get_gnd_gate_types().end());
+            EXPECT_EQ(cached->get_vcc_gate_types().size(), 1);
+            EXPECT_NE(cached->get_vcc_gate_types().find("VCC"), cached->get_vcc_gate_types().end());
+
+            // pin IDs and pin groups
+            for (const auto& [gt_name, gt] : lib->get_gate_types())
+            {
+                GateType* cached_gt = cached->get_gate_type_by_name(gt_name);
+                ASSERT_NE(cached_gt, nullptr);
+                EXPECT_EQ(cached_gt->get_id(), gt->get_id());
+                ASSERT_EQ(cached_gt->get_pins().size(), gt->get_pins().size());
+                for (const GatePin* pin : gt->get_pins())
+                {
+                    const GatePin* cached_pin = cached_gt->get_pin_by_id(pin->get_id());
+                    ASSERT_NE(cached_pin, nullptr);
+                    EXPECT_EQ(*cached_pin, *pin);
+                }
+            }
+
+            // RAM and MAC components
+            GateType* ram = cached->get_gate_type_by_name("RAM64");
+            ASSERT_NE(ram, nullptr);
+            const RAMComponent* ram_component = ram->get_component_as<RAMComponent>([](const GateTypeComponent* c) { return RAMComponent::is_class_of(c); });
+            ASSERT_NE(ram_component, nullptr);
+            EXPECT_EQ(ram_component->get_bit_size(), 64);
+            const InitComponent* init_component = ram->get_component_as<InitComponent>([](const GateTypeComponent* c) { return InitComponent::is_class_of(c); });
+            ASSERT_NE(init_component, nullptr);
+            EXPECT_EQ(init_component->get_init_identifiers(), std::vector<std::string>({"INIT_0", "INIT_1"}));
+            std::vector<GateTypeComponent*> ports = ram->get_components([](const GateTypeComponent* c) { return RAMPortComponent::is_class_of(c); });
+            ASSERT_EQ(ports.size(), 2);
+            const RAMPortComponent* write_port = ports.at(1)->convert_to<RAMPortComponent>();
+            EXPECT_EQ(write_port->get_data_group(), "DIN");
+            EXPECT_EQ(write_port->get_address_group(), "WADDR");
+            EXPECT_EQ(write_port->get_clock_function(), BooleanFunction::Var("CLK"));
+            EXPECT_EQ(write_port->get_enable_function(), BooleanFunction::Var("WE"));
+            EXPECT_TRUE(write_port->is_write_port());
+            const RAMPortComponent* read_port = ports.at(0)->convert_to<RAMPortComponent>();
+            EXPECT_EQ(read_port->get_data_group(), "DOUT");
+            EXPECT_EQ(read_port->get_enable_function(), BooleanFunction::Const(1, 1));
+            EXPECT_FALSE(read_port->is_write_port());
+            EXPECT_TRUE(cached->get_gate_type_by_name("MAC")->has_component_of_type(GateTypeComponent::ComponentType::mac));
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that outdated, missing, and corrupted cache files are rejected.
+     *
+     * Functions: write, read, read_name
+     */
+    TEST_F(GateLibraryCacheTest, check_invalid_cache)
+    {
+        TEST_START
+        {
+            // no cache file
+            EXPECT_TRUE(gate_library_cache::read(m_lib_path).is_error());
+            EXPECT_TRUE(gate_library_cache::read_name(m_lib_path).is_error());
+            EXPECT_TRUE(gate_library_cache::write(nullptr).is_error());
+        }
+        {
+            // gate library file changed after the cache file has been written
+            auto lib = create_test_lib();
+            ASSERT_TRUE(gate_library_cache::write(lib.get()).is_ok());
+            {
+                std::ofstream ofs(m_lib_path, std::ios::app);
+                ofs << "\n";
+            }
+            EXPECT_TRUE(gate_library_cache::read(m_lib_path).is_error());
+            EXPECT_TRUE(gate_library_cache::read_name(m_lib_path).is_error());
+        }
+        {
+            // truncated cache file
+            auto lib = create_test_lib();
+            ASSERT_TRUE(gate_library_cache::write(lib.get()).is_ok());
+            const std::filesystem::path cache_file = gate_library_cache::get_cache_file(m_lib_path);
+            std::filesystem::resize_file(cache_file, std::filesystem::file_size(cache_file) / 2);
+            EXPECT_TRUE(gate_library_cache::read_name(m_lib_path).is_ok());
+            EXPECT_TRUE(gate_library_cache::read(m_lib_path).is_error());
+        }
+        {
+            // cache file written by a different HAL version, which is stored after the magic number, the format version, and the byte order mark
+            auto lib = create_test_lib();
+            ASSERT_TRUE(gate_library_cache::write(lib.get()).is_ok());
+            const std::filesystem::path cache_file = gate_library_cache::get_cache_file(m_lib_path);
+            std::string content;
+            {
+                std::ifstream ifs(cache_file, std::ios::binary);
+                content = std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+            }
+            const u64 version_offset        = 16;
+            const std::string other_version = hal_version::version + "-other";
+            const u32 other_version_size    = other_version.size();
+            ASSERT_GT(content.size(), version_offset + sizeof(u32) + hal_version::version.size());
+            content.replace(version_offset,
+                            sizeof(u32) + hal_version::version.size(),
+                            std::string(reinterpret_cast<const char*>(&other_version_size), sizeof(u32)) + other_version);
+            {
+                std::ofstream ofs(cache_file, std::ios::binary | std::ios::trunc);
+                ofs << content;
+            }
+            EXPECT_TRUE(gate_library_cache::read_name(m_lib_path).is_error());
+            EXPECT_TRUE(gate_library_cache::read(m_lib_path).is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that the gate library manager restores cached gate libraries and defers loading of gate libraries registered by load_all until they are requested.
+     *
+     * Functions: load, load_all, get_gate_library_by_name
+     */
+    TEST_F(GateLibraryCacheTest, check_manager_uses_cache)
+    {
+        TEST_START
+        {
+            // the content of the gate library file is not a valid gate library, so it can only be loaded from the cache
+            auto lib = create_test_lib();
+            ASSERT_TRUE(gate_library_cache::write(lib.get()).is_ok());
+
+            gate_library_manager::load_all();
+            bool loaded = false;
+            for (const GateLibrary* gl : gate_library_manager::get_gate_libraries())
+            {
+                loaded |= gl->get_path() == m_lib_path;
+            }
+            EXPECT_TRUE(loaded);
+            gate_library_manager::remove(m_lib_path);
+
+            gate_library_manager::load_all();
+            GateLibrary* gl = gate_library_manager::get_gate_library_by_name("TESTING_GATE_LIBRARY");
+            ASSERT_NE(gl, nullptr);
+            EXPECT_EQ(gl->get_path(), m_lib_path);
+            EXPECT_TRUE(test_utils::gate_libraries_are_equal(lib.get(), gl));
+            EXPECT_EQ(gate_library_manager::load(m_lib_path), gl);
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -124,6 +124,19 @@ namespace hal
             EXPECT_EQ(gt->get_gate_library(), &gl);
         }
 
+        // gate type with multiple properties
+        {
+            GateType* gt = gl.create_gate_type("multi", {GateTypeProperty::sequential, GateTypeProperty::c_lut, GateTypeProperty::power});
+            ASSERT_NE(gt, nullptr);
+            EXPECT_EQ(gt->get_properties(), std::set<GateTypeProperty>({GateTypeProperty::sequential, GateTypeProperty::power, GateTypeProperty::c_lut}));
+            gt->assign_property(GateTypeProperty::ff);
+            EXPECT_TRUE(gt->has_property(GateTypeProperty::ff));
+            EXPECT_TRUE(gt->has_property(GateTypeProperty::c_lut));
+            EXPECT_TRUE(gt->has_property(GateTypeProperty::power));
+            EXPECT_FALSE(gt->has_property(GateTypeProperty::ground));
+            EXPECT_EQ(gt->get_properties(), std::set<GateTypeProperty>({GateTypeProperty::sequential, GateTypeProperty::power, GateTypeProperty::ff, GateTypeProperty::c_lut}));
+        }
+
         TEST_END
     }
 
@@ -389,6 +402,17 @@ namespace hal
             EXPECT_EQ(gt->get_pin_by_name("P1"), p1);
             EXPECT_EQ(gt->get_pin_by_name("P2"), p2);
             EXPECT_EQ(gt->get_pin_by_name("P3"), p3);
+
+            EXPECT_EQ(gt->get_pin_count(), 4);
+            EXPECT_EQ(p0->get_index(), 0);
+            EXPECT_EQ(p1->get_index(), 1);
+            EXPECT_EQ(p2->get_index(), 2);
+            EXPECT_EQ(p3->get_index(), 3);
+            EXPECT_EQ(gt->get_pin_by_index(0), p0);
+            EXPECT_EQ(gt->get_pin_by_index(1), p1);
+            EXPECT_EQ(gt->get_pin_by_index(2), p2);
+            EXPECT_EQ(gt->get_pin_by_index(3), p3);
+            EXPECT_EQ(gt->get_pin_by_index(4), nullptr);
         }
 
         // multiple pins with same name
@@ -830,6 +830,168 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing that the input, output, and internal nets as well as the pins of all modules stay consistent while gates and modules are moved around in a deep hierarchy.
+     *
+     * Functions: assign_gates, remove_gates, set_parent_module, get_gates, contains_gate, get_nets, get_input_nets, get_output_nets, get_internal_nets
+     */
+    TEST_F(ModuleTest, check_incremental_net_classification) {
+        TEST_START
+            auto nl        = test_utils::create_empty_netlist();
+            GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+
+            // gate i drives net i, which feeds gates i + 1 and (5 * i + 2) % num_gates
+            const u32 num_gates = 48;
+            std::vector<Gate*> gates;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                gates.push_back(nl->create_gate(and2, "gate_" + std::to_string(i)));
+            }
+            Net* global_in = nl->create_net("global_in");
+            global_in->add_destination(gates.front(), "I0");
+            nl->mark_global_input_net(global_in);
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                Net* net = nl->create_net("net_" + std::to_string(i));
+                net->add_source(gates.at(i), "O");
+                if (i + 1 < num_gates)
+                {
+                    net->add_destination(gates.at(i + 1), "I0");
+                }
+                else
+                {
+                    nl->mark_global_output_net(net);
+                }
+                net->add_destination(gates.at((5 * i + 2) % num_gates), "I1");
+            }
+
+            // classify all nets of all modules from scratch and compare
+            auto check_modules = [&nl]() {
+                for (Module* mod : nl->get_modules())
+                {
+                    const std::vector<Gate*> contained = mod->get_gates(nullptr, true);
+                    const std::unordered_set<Gate*> contained_set(contained.begin(), contained.end());
+                    ASSERT_EQ(contained.size(), contained_set.size());
+                    for (Gate* g : contained)
+                    {
+                        EXPECT_TRUE(mod->contains_gate(g, true));
+                    }
+
+                    std::unordered_set<Net*> exp_nets, exp_inputs, exp_outputs, exp_internal;
+                    for (Net* net : nl->get_nets())
+                    {
+                        bool int_src = false, ext_src = net->is_global_input_net(), int_dst = false, ext_dst = net->is_global_output_net();
+                        for (Endpoint* ep : net->get_sources())
+                        {
+                            (contained_set.find(ep->get_gate()) != contained_set.end() ? int_src : ext_src) = true;
+                        }
+                        for (Endpoint* ep : net->get_destinations())
+                        {
+                            (contained_set.find(ep->get_gate()) != contained_set.end() ? int_dst : ext_dst) = true;
+                        }
+
+                        if (int_src || int_dst)
+                        {
+                            exp_nets.insert(net);
+                        }
+                        if (int_src && int_dst)
+                        {
+                            exp_internal.insert(net);
+                        }
+                        if (int_src && int_dst && ext_src && ext_dst)
+                        {
+                            exp_inputs.insert(net);
+                            exp_outputs.insert(net);
+                        }
+                        else if (ext_src && int_dst)
+                        {
+                            exp_inputs.insert(net);
+                        }
+                        else if (int_src && ext_dst)
+                        {
+                            exp_outputs.insert(net);
+                        }
+                    }
+                    EXPECT_EQ(mod->get_nets(), exp_nets);
+                    EXPECT_EQ(mod->get_input_nets(), exp_inputs);
+                    EXPECT_EQ(mod->get_output_nets(), exp_outputs);
+                    EXPECT_EQ(mod->get_internal_nets(), exp_internal);
+
+                    if (!mod->is_top_module())
+                    {
+                        std::unordered_set<Net*> pin_nets;
+                        for (ModulePin* pin : mod->get_pins())
+                        {
+                            pin_nets.insert(pin->get_net());
+                        }
+                        std::unordered_set<Net*> port_nets = exp_inputs;
+                        port_nets.insert(exp_outputs.begin(), exp_outputs.end());
+                        EXPECT_EQ(pin_nets, port_nets);
+                    }
+                }
+            };
+
+            // build a deep hierarchy: top -> mod_0 -> ... -> mod_5, and top -> side
+            std::vector<Module*> chain;
+            Module* parent = nl->get_top_module();
+            for (u32 d = 0; d < 6; d++)
+            {
+                parent = nl->create_module("mod_" + std::to_string(d), parent);
+                chain.push_back(parent);
+            }
+            Module* side = nl->create_module("side", nl->get_top_module());
+            check_modules();
+
+            {
+                // spread the gates over the hierarchy
+                std::vector<std::vector<Gate*>> assignments(chain.size() + 1);
+                for (u32 i = 0; i < num_gates; i++)
+                {
+                    assignments.at(i % assignments.size()).push_back(gates.at(i));
+                }
+                for (u32 d = 0; d < chain.size(); d++)
+                {
+                    ASSERT_TRUE(chain.at(d)->assign_gates(assignments.at(d)));
+                }
+                ASSERT_TRUE(side->assign_gates(assignments.back()));
+                check_modules();
+            }
+            {
+                // move gates between the branches and within the chain
+                ASSERT_TRUE(side->assign_gates({gates.at(0), gates.at(5), gates.at(12)}));
+                check_modules();
+                ASSERT_TRUE(chain.at(2)->assign_gates({gates.at(6), gates.at(13)}));
+                check_modules();
+                ASSERT_TRUE(side->remove_gates({gates.at(0), gates.at(5)}));
+                check_modules();
+            }
+            {
+                // move a sub-hierarchy, including moving a module below its own descendant
+                ASSERT_TRUE(chain.at(3)->set_parent_module(side));
+                check_modules();
+                ASSERT_TRUE(side->set_parent_module(chain.at(4)));
+                check_modules();
+            }
+            {
+                // delete modules, gates, and nets
+                ASSERT_TRUE(nl->delete_module(chain.at(1)));
+                check_modules();
+                ASSERT_TRUE(nl->delete_gate(gates.at(20)));
+                check_modules();
+                ASSERT_TRUE(nl->delete_net(nl->get_net_by_id(gates.at(30)->get_fan_out_net("O")->get_id())));
+                check_modules();
+            }
+            {
+                // update_nets yields the same classification
+                for (Module* mod : nl->get_modules())
+                {
+                    mod->update_nets();
+                }
+                check_modules();
+            }
+        TEST_END
+    }
+
     /**
      * Testing the usage of module pins
      *
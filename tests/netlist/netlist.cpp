@@ -1698,4 +1698,181 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Test that the storage of deleted objects is reused for new objects without invalidating live objects.
+     *
+     * Functions: reserve, create_gate, create_net, copy, delete_gate, delete_net
+     */
+    TEST_F(NetlistTest, check_allocation_reuse) {
+        TEST_START
+        {
+            const u32 num_gates = 64;
+
+            auto nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl = nl->get_gate_library();
+            GateType* and2 = gl->get_gate_type_by_name("AND2");
+            ASSERT_NE(and2, nullptr);
+            GatePin* in_0 = and2->get_pin_by_name("I0");
+            GatePin* in_1 = and2->get_pin_by_name("I1");
+            GatePin* out = and2->get_pin_by_name("O");
+
+            nl->reserve(num_gates, num_gates + 2);
+
+            Net* in_a = nl->create_net("in_a");
+            Net* in_b = nl->create_net("in_b");
+            std::vector<Gate*> gates;
+            Net* previous = in_a;
+            Net* second_previous = in_b;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                Gate* g = nl->create_gate(and2, "g_" + std::to_string(i));
+                Net* n = nl->create_net("n_" + std::to_string(i));
+                ASSERT_NE(previous->add_destination(g, in_0), nullptr);
+                ASSERT_NE(second_previous->add_destination(g, in_1), nullptr);
+                ASSERT_NE(n->add_source(g, out), nullptr);
+                gates.push_back(g);
+                second_previous = previous;
+                previous = n;
+            }
+            EXPECT_EQ(nl->get_gates().size(), num_gates);
+
+            auto copy_res = nl->copy();
+            ASSERT_TRUE(copy_res.is_ok());
+            auto nl_copy = copy_res.get();
+            EXPECT_EQ(nl_copy->get_gates().size(), num_gates);
+            EXPECT_EQ(nl_copy->get_nets().size(), num_gates + 2);
+            EXPECT_EQ(nl_copy->get_net_by_id(gates.at(0)->get_fan_out_net(out)->get_id())->get_num_of_destinations(), 2);
+            nl_copy.reset();
+
+            // deleted objects free their storage for new objects while all other objects stay in place
+            Gate* survivor = gates.at(1);
+            Endpoint* survivor_ep = survivor->get_fan_in_endpoint(in_0);
+            ASSERT_TRUE(nl->delete_gate(gates.at(0)));
+            ASSERT_TRUE(nl->delete_net(in_a));
+            Gate* replacement = nl->create_gate(and2, "replacement");
+            ASSERT_NE(replacement, nullptr);
+            ASSERT_NE(in_b->add_destination(replacement, in_1), nullptr);
+            EXPECT_EQ(survivor->get_name(), "g_1");
+            EXPECT_EQ(survivor->get_fan_in_endpoint(in_0), survivor_ep);
+            EXPECT_EQ(survivor_ep->get_gate(), survivor);
+            EXPECT_EQ(nl->get_gates().size(), num_gates);
+            EXPECT_EQ(in_b->get_num_of_destinations(), 1);
+        }
+        TEST_END
+    }
+
+    /**
+     * Stress test the construction, copying, and destruction of a large netlist.
+     * Disabled by default since it is a benchmark rather than a unit test, run it using --gtest_also_run_disabled_tests.
+     *
+     * Functions: reserve, create_gate, create_net, copy
+     */
+    TEST_F(NetlistTest, DISABLED_check_allocation_performance) {
+        TEST_START
+        {
+            const u32 num_gates = 100000;
+
+            auto nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl = nl->get_gate_library();
+            GateType* and2 = gl->get_gate_type_by_name("AND2");
+            ASSERT_NE(and2, nullptr);
+            GatePin* in_0 = and2->get_pin_by_name("I0");
+            GatePin* in_1 = and2->get_pin_by_name("I1");
+            GatePin* out = and2->get_pin_by_name("O");
+
+            nl->reserve(num_gates, num_gates + 2);
+            nl->enable_automatic_net_checks(false);
+
+            Net* previous = nl->create_net("in_a");
+            Net* second_previous = nl->create_net("in_b");
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                Gate* g = nl->create_gate(and2, "g_" + std::to_string(i));
+                Net* n = nl->create_net("n_" + std::to_string(i));
+                ASSERT_NE(previous->add_destination(g, in_0), nullptr);
+                ASSERT_NE(second_previous->add_destination(g, in_1), nullptr);
+                ASSERT_NE(n->add_source(g, out), nullptr);
+                second_previous = previous;
+                previous = n;
+            }
+            nl->enable_automatic_net_checks(true);
+            EXPECT_EQ(nl->get_gates().size(), num_gates);
+
+            auto copy_res = nl->copy();
+            ASSERT_TRUE(copy_res.is_ok());
+            auto nl_copy = copy_res.get();
+            EXPECT_EQ(nl_copy->get_gates().size(), num_gates);
+            EXPECT_EQ(nl_copy->get_nets().size(), num_gates + 2);
+        }
+        TEST_END
+    }
+
+    /**
+     * Test the bookkeeping of used and free IDs for dense and very large IDs.
+     *
+     * Functions: get_unique_gate_id, get_gate_by_id, get_used_gate_ids, get_free_gate_ids, set_used_gate_ids, set_free_gate_ids, copy
+     */
+    TEST_F(NetlistTest, check_id_bookkeeping) {
+        TEST_START
+        {
+            auto nl = test_utils::create_empty_netlist();
+            GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+            ASSERT_NE(buf, nullptr);
+
+            // dense IDs, a gap, and a very large ID that must not inflate the lookup tables
+            std::vector<Gate*> gates;
+            for (u32 id = 1; id <= 1000; id++)
+            {
+                gates.push_back(nl->create_gate(id, buf, "gate_" + std::to_string(id)));
+                ASSERT_NE(gates.back(), nullptr);
+            }
+            Gate* far_gate = nl->create_gate(3000000000u, buf, "far_gate");
+            ASSERT_NE(far_gate, nullptr);
+            EXPECT_EQ(nl->create_gate(3000000000u, buf, "duplicate"), nullptr);
+            EXPECT_EQ(nl->get_gate_by_id(3000000000u), far_gate);
+            EXPECT_EQ(nl->get_gate_by_id(500), gates.at(499));
+            {
+                NO_COUT_BLOCK;
+                EXPECT_EQ(nl->get_gate_by_id(1001), nullptr);
+                EXPECT_EQ(nl->get_gate_by_id(2999999999u), nullptr);
+            }
+            EXPECT_EQ(nl->get_unique_gate_id(), 1001);
+            EXPECT_EQ(nl->get_used_gate_ids().size(), 1001);
+            EXPECT_EQ(*nl->get_used_gate_ids().rbegin(), 3000000000u);
+
+            // released IDs are reused smallest first
+            ASSERT_TRUE(nl->delete_gate(gates.at(699)));
+            ASSERT_TRUE(nl->delete_gate(gates.at(9)));
+            ASSERT_TRUE(nl->delete_gate(far_gate));
+            EXPECT_EQ(nl->get_free_gate_ids(), std::set<u32>({10, 700, 3000000000u}));
+            {
+                NO_COUT_BLOCK;
+                EXPECT_EQ(nl->get_gate_by_id(3000000000u), nullptr);
+            }
+            EXPECT_EQ(nl->get_unique_gate_id(), 10);
+            ASSERT_NE(nl->create_gate(buf, "reuse_0"), nullptr);
+            EXPECT_EQ(nl->get_unique_gate_id(), 700);
+            ASSERT_NE(nl->create_gate(700, buf, "reuse_1"), nullptr);
+            EXPECT_EQ(nl->get_unique_gate_id(), 3000000000u);
+            EXPECT_EQ(nl->get_free_gate_ids(), std::set<u32>({3000000000u}));
+
+            // used and free IDs survive copying and restoring
+            auto copy_res = nl->copy();
+            ASSERT_TRUE(copy_res.is_ok());
+            auto nl_copy = copy_res.get();
+            EXPECT_EQ(nl_copy->get_used_gate_ids(), nl->get_used_gate_ids());
+            EXPECT_EQ(nl_copy->get_free_gate_ids(), nl->get_free_gate_ids());
+            EXPECT_EQ(nl_copy->get_unique_gate_id(), 3000000000u);
+
+            nl_copy->set_free_gate_ids({5, 2000000000u});
+            EXPECT_EQ(nl_copy->get_unique_gate_id(), 5);
+            nl_copy->set_free_gate_ids({});
+            nl_copy->set_used_gate_ids({1, 2, 3, 4000000000u});
+            nl_copy->set_next_gate_id(1);
+            EXPECT_EQ(nl_copy->get_unique_gate_id(), 4);
+            EXPECT_EQ(nl_copy->get_used_gate_ids(), std::set<u32>({1, 2, 3, 4000000000u}));
+        }
+        TEST_END
+    }
+
 } //namespace hal
@@ -0,0 +1,399 @@
+#include "hal_core/netlist/netlist_builder.h"
+
+#include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+namespace hal
+{
+    class NetlistBuilderTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+
+        /*
+         *  Hierarchy: top -> mod_a -> mod_b, top -> mod_c
+         *  Gates g_0 ... g_{n-1} are AND2 gates assigned round-robin to top, mod_a, mod_b, and mod_c.
+         *  Net n_i is driven by g_i and feeds g_{i+1}.I0 and g_{(i * 7 + 3) % n}.I1.
+         *  The I0 pin of g_0 is driven by a global input, the output of g_{n-1} is a global output.
+         */
+        static constexpr u32 num_gates = 64;
+
+        static u32 get_module_index(u32 gate_index)
+        {
+            return gate_index % 4;
+        }
+
+        static u32 get_second_destination(u32 net_index)
+        {
+            return (net_index * 7 + 3) % num_gates;
+        }
+
+        /* build the example netlist through the regular per-item API */
+        static void build_reference(Netlist* nl)
+        {
+            GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+
+            std::vector<Gate*> gates;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                gates.push_back(nl->create_gate(test_utils::MIN_GATE_ID + i, and2, "g_" + std::to_string(i)));
+            }
+
+            Net* global_in = nl->create_net(test_utils::MIN_NET_ID + num_gates, "global_in");
+            global_in->add_destination(gates.front(), "I0");
+            nl->mark_global_input_net(global_in);
+
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                Net* net = nl->create_net(test_utils::MIN_NET_ID + i, "n_" + std::to_string(i));
+                net->add_source(gates.at(i), "O");
+                if (i + 1 < num_gates)
+                {
+                    net->add_destination(gates.at(i + 1), "I0");
+                }
+                else
+                {
+                    nl->mark_global_output_net(net);
+                }
+                net->add_destination(gates.at(get_second_destination(i)), "I1");
+            }
+
+            Module* mod_a = nl->create_module(test_utils::MIN_MODULE_ID + 0, "mod_a", nl->get_top_module());
+            Module* mod_b = nl->create_module(test_utils::MIN_MODULE_ID + 1, "mod_b", mod_a);
+            Module* mod_c = nl->create_module(test_utils::MIN_MODULE_ID + 2, "mod_c", nl->get_top_module());
+            std::vector<Module*> modules = {nl->get_top_module(), mod_a, mod_b, mod_c};
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                if (u32 m = get_module_index(i); m != 0)
+                {
+                    modules.at(m)->assign_gate(gates.at(i));
+                }
+            }
+        }
+
+        /* build the same netlist through a netlist builder */
+        static void build_with_builder(NetlistBuilder& builder)
+        {
+            Netlist* nl    = builder.get_netlist();
+            GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+
+            std::vector<Gate*> gates;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                gates.push_back(builder.create_gate(test_utils::MIN_GATE_ID + i, and2, "g_" + std::to_string(i)));
+            }
+
+            Net* global_in = builder.create_net(test_utils::MIN_NET_ID + num_gates, "global_in");
+            builder.add_destination(global_in, gates.front(), "I0");
+            nl->mark_global_input_net(global_in);
+
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                Net* net = builder.create_net(test_utils::MIN_NET_ID + i, "n_" + std::to_string(i));
+                builder.add_source(net, gates.at(i), "O");
+                if (i + 1 < num_gates)
+                {
+                    builder.add_destination(net, gates.at(i + 1), "I0");
+                }
+                else
+                {
+                    nl->mark_global_output_net(net);
+                }
+                builder.add_destination(net, gates.at(get_second_destination(i)), "I1");
+            }
+
+            Module* mod_a = builder.create_module(test_utils::MIN_MODULE_ID + 0, "mod_a", nl->get_top_module());
+            Module* mod_b = builder.create_module(test_utils::MIN_MODULE_ID + 1, "mod_b", mod_a);
+            Module* mod_c = builder.create_module(test_utils::MIN_MODULE_ID + 2, "mod_c", nl->get_top_module());
+            std::vector<std::vector<Gate*>> assignments(4);
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                assignments.at(get_module_index(i)).push_back(gates.at(i));
+            }
+            builder.assign_gates(mod_a, assignments.at(1));
+            builder.assign_gates(mod_b, assignments.at(2));
+            builder.assign_gates(mod_c, assignments.at(3));
+        }
+
+        static std::set<u32> to_ids(const std::unordered_set<Net*>& nets)
+        {
+            std::set<u32> ids;
+            for (const Net* net : nets)
+            {
+                ids.insert(net->get_id());
+            }
+            return ids;
+        }
+
+        static std::set<u32> to_ids(const std::vector<Gate*>& gates)
+        {
+            std::set<u32> ids;
+            for (const Gate* gate : gates)
+            {
+                ids.insert(gate->get_id());
+            }
+            return ids;
+        }
+
+        static std::set<u32> get_pin_net_ids(const Module* module)
+        {
+            std::set<u32> ids;
+            for (const ModulePin* pin : module->get_pins())
+            {
+                ids.insert(pin->get_net()->get_id());
+            }
+            return ids;
+        }
+
+        static void expect_same_modules(Netlist* nl_ref, Netlist* nl)
+        {
+            ASSERT_EQ(nl_ref->get_modules().size(), nl->get_modules().size());
+            for (Module* mod_ref : nl_ref->get_modules())
+            {
+                Module* mod = nl->get_module_by_id(mod_ref->get_id());
+                ASSERT_NE(mod, nullptr);
+                EXPECT_EQ(to_ids(mod->get_gates()), to_ids(mod_ref->get_gates()));
+                EXPECT_EQ(mod->get_gates().size(), mod_ref->get_gates().size());
+                EXPECT_EQ(to_ids(mod->get_nets()), to_ids(mod_ref->get_nets()));
+                EXPECT_EQ(to_ids(mod->get_input_nets()), to_ids(mod_ref->get_input_nets()));
+                EXPECT_EQ(to_ids(mod->get_output_nets()), to_ids(mod_ref->get_output_nets()));
+                EXPECT_EQ(to_ids(mod->get_internal_nets()), to_ids(mod_ref->get_internal_nets()));
+                EXPECT_EQ(get_pin_net_ids(mod), get_pin_net_ids(mod_ref));
+            }
+        }
+    };
+
+    /**
+     * Test that a netlist constructed through the builder ends up with the same module nets and pins as one constructed through the per-item API.
+     *
+     * Functions: NetlistBuilder, create_gate, create_net, add_source, add_destination, create_module, assign_gates, commit
+     */
+    TEST_F(NetlistBuilderTest, check_module_nets)
+    {
+        TEST_START
+        {
+            // automatic net checks enabled, pins are created on commit
+            auto nl_ref = test_utils::create_empty_netlist();
+            build_reference(nl_ref.get());
+
+            auto nl = test_utils::create_empty_netlist();
+            {
+                NetlistBuilder builder(nl.get());
+                build_with_builder(builder);
+                EXPECT_TRUE(builder.is_open());
+                ASSERT_TRUE(builder.commit().is_ok());
+                EXPECT_FALSE(builder.is_open());
+            }
+            expect_same_modules(nl_ref.get(), nl.get());
+
+            // module nets must remain consistent with an explicit update afterwards
+            for (Module* mod : nl->get_modules())
+            {
+                const auto inputs  = to_ids(mod->get_input_nets());
+                const auto outputs = to_ids(mod->get_output_nets());
+                const auto nets    = to_ids(mod->get_internal_nets());
+                mod->update_nets();
+                EXPECT_EQ(to_ids(mod->get_input_nets()), inputs);
+                EXPECT_EQ(to_ids(mod->get_output_nets()), outputs);
+                EXPECT_EQ(to_ids(mod->get_internal_nets()), nets);
+            }
+
+            // automatic net checks are active again after committing
+            Gate* g = nl->get_gate_by_id(test_utils::MIN_GATE_ID + 1);
+            nl->get_top_module()->assign_gate(g);
+            nl_ref->get_top_module()->assign_gate(nl_ref->get_gate_by_id(test_utils::MIN_GATE_ID + 1));
+            expect_same_modules(nl_ref.get(), nl.get());
+        }
+        {
+            // automatic net checks disabled, only module nets are classified
+            auto nl_ref = test_utils::create_empty_netlist();
+            nl_ref->enable_automatic_net_checks(false);
+            build_reference(nl_ref.get());
+            for (Module* mod : nl_ref->get_modules())
+            {
+                mod->update_nets();
+            }
+
+            auto nl = test_utils::create_empty_netlist();
+            nl->enable_automatic_net_checks(false);
+            {
+                NetlistBuilder builder(nl.get());
+                build_with_builder(builder);
+            }
+            expect_same_modules(nl_ref.get(), nl.get());
+            for (Module* mod : nl->get_modules())
+            {
+                EXPECT_TRUE(mod->get_pins().empty());
+            }
+        }
+        {
+            // moving pre-existing gates through the builder
+            auto nl_ref = test_utils::create_empty_netlist();
+            build_reference(nl_ref.get());
+
+            auto nl = test_utils::create_empty_netlist();
+            build_reference(nl.get());
+
+            Module* mod_c_ref = nl_ref->get_module_by_id(test_utils::MIN_MODULE_ID + 2);
+            Module* mod_c     = nl->get_module_by_id(test_utils::MIN_MODULE_ID + 2);
+            std::vector<Gate*> moved_ref;
+            std::vector<Gate*> moved;
+            for (u32 i = 0; i < num_gates; i += 5)
+            {
+                if (get_module_index(i) == 3)
+                {
+                    continue;
+                }
+                moved_ref.push_back(nl_ref->get_gate_by_id(test_utils::MIN_GATE_ID + i));
+                moved.push_back(nl->get_gate_by_id(test_utils::MIN_GATE_ID + i));
+            }
+            ASSERT_TRUE(mod_c_ref->assign_gates(moved_ref));
+            {
+                NetlistBuilder builder(nl.get());
+                EXPECT_TRUE(builder.assign_gates(mod_c, moved));
+                EXPECT_TRUE(builder.commit().is_ok());
+            }
+            expect_same_modules(nl_ref.get(), nl.get());
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that events are suppressed during the transaction and emitted on commit.
+     *
+     * Functions: NetlistBuilder, commit
+     */
+    TEST_F(NetlistBuilderTest, check_events)
+    {
+        TEST_START
+        {
+            auto nl = test_utils::create_empty_netlist();
+
+            u32 num_gates_created   = 0;
+            u32 num_gates_assigned  = 0;
+            u32 num_nets_created    = 0;
+            u32 num_modules_created = 0;
+            u32 num_submodules      = 0;
+            nl->get_event_handler()->register_callback("gate_cb", std::function<void(GateEvent::event, Gate*, u32)>([&](GateEvent::event e, Gate*, u32) {
+                                                           if (e == GateEvent::event::created)
+                                                           {
+                                                               num_gates_created++;
+                                                           }
+                                                       }));
+            nl->get_event_handler()->register_callback("net_cb", std::function<void(NetEvent::event, Net*, u32)>([&](NetEvent::event e, Net*, u32) {
+                                                           if (e == NetEvent::event::created)
+                                                           {
+                                                               num_nets_created++;
+                                                           }
+                                                       }));
+            nl->get_event_handler()->register_callback("module_cb", std::function<void(ModuleEvent::event, Module*, u32)>([&](ModuleEvent::event e, Module*, u32) {
+                                                           if (e == ModuleEvent::event::created)
+                                                           {
+                                                               num_modules_created++;
+                                                           }
+                                                           else if (e == ModuleEvent::event::gate_assigned)
+                                                           {
+                                                               num_gates_assigned++;
+                                                           }
+                                                           else if (e == ModuleEvent::event::submodule_added)
+                                                           {
+                                                               num_submodules++;
+                                                           }
+                                                       }));
+
+            NetlistBuilder builder(nl.get());
+            build_with_builder(builder);
+            EXPECT_EQ(num_gates_created, 0);
+            EXPECT_EQ(num_nets_created, 0);
+            EXPECT_EQ(num_modules_created, 0);
+
+            ASSERT_TRUE(builder.commit().is_ok());
+            EXPECT_EQ(num_gates_created, num_gates);
+            EXPECT_EQ(num_nets_created, num_gates + 1);
+            EXPECT_EQ(num_modules_created, 3);
+            EXPECT_EQ(num_submodules, 3);
+            EXPECT_EQ(num_gates_assigned, num_gates);
+
+            nl->get_event_handler()->unregister_callback("gate_cb");
+            nl->get_event_handler()->unregister_callback("net_cb");
+            nl->get_event_handler()->unregister_callback("module_cb");
+        }
+        TEST_END
+    }
+
+    /**
+     * Test the input validation of the builder.
+     *
+     * Functions: NetlistBuilder, create_gate, create_net, add_source, add_destination, create_module, assign_gates, commit
+     */
+    TEST_F(NetlistBuilderTest, check_invalid_input)
+    {
+        TEST_START
+        {
+            auto nl        = test_utils::create_empty_netlist();
+            auto nl_other  = test_utils::create_empty_netlist();
+            GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+
+            NetlistBuilder builder(nl.get());
+            Gate* g_0 = builder.create_gate(test_utils::MIN_GATE_ID, and2, "g_0");
+            ASSERT_NE(g_0, nullptr);
+            Net* n_0 = builder.create_net(test_utils::MIN_NET_ID, "n_0");
+            ASSERT_NE(n_0, nullptr);
+
+            {
+                NO_COUT_TEST_BLOCK;
+                // IDs already in use
+                EXPECT_EQ(builder.create_gate(test_utils::MIN_GATE_ID, and2, "g_1"), nullptr);
+                EXPECT_EQ(builder.create_net(test_utils::MIN_NET_ID, "n_1"), nullptr);
+                EXPECT_EQ(builder.create_module(nl->get_top_module()->get_id(), "mod", nl->get_top_module()), nullptr);
+
+                // invalid gate type or parent
+                EXPECT_EQ(builder.create_gate(nullptr, "g_1"), nullptr);
+                EXPECT_EQ(builder.create_module("mod", nullptr), nullptr);
+
+                // wrong pin direction, unknown pins, and foreign objects
+                EXPECT_EQ(builder.add_source(n_0, g_0, "I0"), nullptr);
+                EXPECT_EQ(builder.add_destination(n_0, g_0, "O"), nullptr);
+                EXPECT_EQ(builder.add_destination(n_0, g_0, "A"), nullptr);
+                EXPECT_EQ(builder.add_destination(nullptr, g_0, "I0"), nullptr);
+                EXPECT_EQ(builder.add_destination(n_0, nullptr, "I0"), nullptr);
+                EXPECT_FALSE(builder.assign_gates(nl_other->get_top_module(), {g_0}));
+            }
+
+            EXPECT_NE(builder.add_destination(n_0, g_0, "I0"), nullptr);
+            {
+                NO_COUT_TEST_BLOCK;
+                // pin already connected
+                EXPECT_EQ(builder.add_destination(n_0, g_0, "I0"), nullptr);
+            }
+
+            ASSERT_TRUE(builder.commit().is_ok());
+            EXPECT_EQ(n_0->get_destinations().size(), 1);
+            EXPECT_EQ(g_0->get_fan_in_net("I0"), n_0);
+
+            {
+                NO_COUT_TEST_BLOCK;
+                // transaction already committed
+                EXPECT_EQ(builder.create_gate(and2, "g_2"), nullptr);
+                EXPECT_EQ(builder.create_net("n_2"), nullptr);
+                EXPECT_EQ(builder.add_source(n_0, g_0, "O"), nullptr);
+                EXPECT_TRUE(builder.commit().is_error());
+            }
+        }
+        TEST_END
+    }
+}    // namespace hal
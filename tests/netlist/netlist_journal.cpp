@@ -0,0 +1,199 @@
+#include "hal_core/netlist/persistent/netlist_journal.h"
+
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+
+namespace hal
+{
+    class NetlistJournalTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
+        }
+
+        virtual void TearDown()
+        {
+            test_utils::remove_sandbox_directory();
+        }
+    };
+
+    /**
+     * Testing that replaying the journal on a snapshot of the netlist restores all recorded changes.
+     *
+     * Functions: append_to_file, replay
+     */
+    TEST_F(NetlistJournalTest, check_append_and_replay)
+    {
+        TEST_START
+        {
+            auto nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+            auto snapshot = nl->copy();
+            ASSERT_TRUE(snapshot.is_ok());
+            auto base = snapshot.get();
+
+            std::filesystem::path journal_file = test_utils::create_sandbox_path("test.journal");
+            NetlistJournal journal(nl.get());
+            EXPECT_EQ(journal.get_netlist(), nl.get());
+            EXPECT_FALSE(journal.has_changes());
+
+            // first transaction: modify, create, and delete gates, nets, and modules
+            const GateLibrary* gl = nl->get_gate_library();
+            nl->get_gate_by_id(test_utils::MIN_GATE_ID + 0)->set_name("renamed_gate");
+            Gate* new_gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "new_gate");
+            ASSERT_NE(new_gate, nullptr);
+            new_gate->set_data("category", "key", "string", "value");
+            new_gate->add_boolean_function("custom", BooleanFunction::Var("I0") & BooleanFunction::Var("I1"));
+            nl->get_net_by_id(test_utils::MIN_NET_ID + 78)->add_destination(new_gate, "I1");
+            Net* new_net = nl->create_net("new_net");
+            new_net->add_source(new_gate, "O");
+            new_net->add_destination(nl->get_gate_by_id(test_utils::MIN_GATE_ID + 6), "I0");
+            nl->mark_global_output_net(new_net);
+            ASSERT_TRUE(nl->delete_gate(nl->get_gate_by_id(test_utils::MIN_GATE_ID + 5)));
+            Module* mod_a = nl->create_module("mod_a", nl->get_top_module(), {nl->get_gate_by_id(test_utils::MIN_GATE_ID + 3), nl->get_gate_by_id(test_utils::MIN_GATE_ID + 4)});
+            ASSERT_NE(mod_a, nullptr);
+            Module* mod_b = nl->create_module("mod_b", mod_a, {new_gate});
+            ASSERT_NE(mod_b, nullptr);
+            mod_b->set_type("some_type");
+            EXPECT_TRUE(journal.has_changes());
+
+            auto res = journal.append_to_file(journal_file);
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_GT(res.get(), 0);
+            EXPECT_FALSE(journal.has_changes());
+
+            // without changes, nothing is appended
+            res = journal.append_to_file(journal_file);
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), 0);
+
+            // second transaction: undo parts of the first one and reuse an ID
+            ASSERT_TRUE(nl->delete_module(mod_b));
+            ASSERT_TRUE(nl->delete_net(nl->get_net_by_id(test_utils::MIN_NET_ID + 13)));
+            nl->set_design_name("new_design_name");
+            nl->get_top_module()->set_name("new_top");
+            Gate* reused_gate = nl->create_gate(test_utils::MIN_GATE_ID + 5, gl->get_gate_type_by_name("OR2"), "reused_gate");
+            ASSERT_NE(reused_gate, nullptr);
+            ASSERT_TRUE(mod_a->assign_gate(reused_gate));
+            ASSERT_TRUE(journal.append_to_file(journal_file).is_ok());
+
+            auto replayed = NetlistJournal::replay(base.get(), journal_file);
+            ASSERT_TRUE(replayed.is_ok());
+            EXPECT_EQ(replayed.get(), 2);
+            EXPECT_TRUE(*base == *nl);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that changes to the data containers of gates, nets, and modules are recorded even if the objects are not modified otherwise.
+     *
+     * Functions: set_data, delete_data, append_to_file, replay
+     */
+    TEST_F(NetlistJournalTest, check_data_only_changes)
+    {
+        TEST_START
+        {
+            auto nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+            Gate* gate = nl->get_gate_by_id(test_utils::MIN_GATE_ID + 0);
+            ASSERT_NE(gate, nullptr);
+            gate->set_data("category", "to_be_deleted", "string", "value");
+            auto snapshot = nl->copy();
+            ASSERT_TRUE(snapshot.is_ok());
+            auto base = snapshot.get();
+
+            std::filesystem::path journal_file = test_utils::create_sandbox_path("test.journal");
+            NetlistJournal journal(nl.get());
+
+            // setting an identical entry is not a change
+            gate->set_data("category", "to_be_deleted", "string", "value");
+            EXPECT_FALSE(journal.has_changes());
+
+            gate->set_data("category", "key", "string", "gate_value");
+            EXPECT_TRUE(journal.has_changes());
+            ASSERT_TRUE(gate->delete_data("category", "to_be_deleted"));
+            nl->get_net_by_id(test_utils::MIN_NET_ID + 13)->set_data("category", "key", "string", "net_value");
+            nl->get_top_module()->set_data("category", "key", "string", "module_value");
+            ASSERT_TRUE(journal.append_to_file(journal_file).is_ok());
+
+            auto replayed = NetlistJournal::replay(base.get(), journal_file);
+            ASSERT_TRUE(replayed.is_ok());
+            EXPECT_EQ(replayed.get(), 1);
+            EXPECT_EQ(base->get_gate_by_id(test_utils::MIN_GATE_ID + 0)->get_data("category", "key"), std::make_tuple(std::string("string"), std::string("gate_value")));
+            EXPECT_FALSE(base->get_gate_by_id(test_utils::MIN_GATE_ID + 0)->has_data("category", "to_be_deleted"));
+            EXPECT_EQ(base->get_net_by_id(test_utils::MIN_NET_ID + 13)->get_data("category", "key"), std::make_tuple(std::string("string"), std::string("net_value")));
+            EXPECT_EQ(base->get_top_module()->get_data("category", "key"), std::make_tuple(std::string("string"), std::string("module_value")));
+            EXPECT_TRUE(*base == *nl);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that incomplete transactions at the end of the journal are discarded and that invalid journals are rejected.
+     *
+     * Functions: replay
+     */
+    TEST_F(NetlistJournalTest, check_replay_negative)
+    {
+        TEST_START
+        {
+            auto nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+            auto snapshot = nl->copy();
+            ASSERT_TRUE(snapshot.is_ok());
+            auto base = snapshot.get();
+
+            std::filesystem::path journal_file = test_utils::create_sandbox_path("test.journal");
+            {
+                NetlistJournal journal(nl.get());
+                nl->get_gate_by_id(test_utils::MIN_GATE_ID + 0)->set_name("renamed_gate");
+                ASSERT_TRUE(journal.append_to_file(journal_file).is_ok());
+            }
+
+            // changes after the journal has been destroyed are no longer recorded
+            nl->get_gate_by_id(test_utils::MIN_GATE_ID + 1)->set_name("unrecorded");
+
+            // simulate a crash while appending the next transaction
+            {
+                std::ofstream ofs(journal_file, std::ios::app);
+                ofs << "{\"op\":\"gate\",\"id\":1,\"name\":\"partial\"";
+            }
+
+            auto replayed = NetlistJournal::replay(base.get(), journal_file);
+            ASSERT_TRUE(replayed.is_ok());
+            EXPECT_EQ(replayed.get(), 1);
+            EXPECT_EQ(base->get_gate_by_id(test_utils::MIN_GATE_ID + 0)->get_name(), "renamed_gate");
+            EXPECT_EQ(base->get_gate_by_id(test_utils::MIN_GATE_ID + 1)->get_name(), "gate_1");
+        }
+        {
+            // unknown record type within a committed transaction
+            auto nl                            = test_utils::create_example_netlist();
+            std::filesystem::path journal_file = test_utils::create_sandbox_path("invalid.journal");
+            {
+                std::ofstream ofs(journal_file);
+                ofs << "{\"op\":\"unknown\"}\n{\"op\":\"commit\"}\n";
+            }
+            EXPECT_TRUE(NetlistJournal::replay(nl.get(), journal_file).is_error());
+        }
+        {
+            // missing journal file
+            auto nl = test_utils::create_example_netlist();
+            EXPECT_TRUE(NetlistJournal::replay(nl.get(), test_utils::create_sandbox_path("missing.journal")).is_error());
+            EXPECT_TRUE(NetlistJournal::replay(nullptr, test_utils::create_sandbox_path("missing.journal")).is_error());
+        }
+        TEST_END
+    }
+}    // namespace hal
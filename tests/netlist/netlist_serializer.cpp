@@ -1,4 +1,5 @@
 #include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
@@ -12,6 +13,8 @@
 #include "netlist_test_utils.h"
 
 #include <experimental/filesystem>
+#include <fstream>
+#include <iterator>
 
 namespace hal {
     using test_utils::MIN_GATE_ID;
@@ -275,4 +278,152 @@ namespace hal {
              }
          TEST_END
      }
+
+    /**
+     * Testing the serialization and a followed deserialization of a netlist whose gates and nets span multiple serialization chunks.
+     * The chunks are serialized in parallel, hence also checks that the output does not depend on the thread schedule.
+     *
+     * Functions: serialize_netlist, deserialize_netlist
+     */
+     TEST_F(NetlistSerializerTest, check_serialize_and_deserialize_multiple_chunks) {
+         TEST_START
+             {
+                 // more gates and nets than fit into two chunks of 4096 objects
+                 const u32 num_gates = 2 * 4096 + 123;
+
+                 auto nl = std::make_unique<Netlist>(m_gl);
+                 GateType* and2 = m_gl->get_gate_type_by_name("AND2");
+                 ASSERT_NE(and2, nullptr);
+
+                 Net* previous        = nl->create_net("in_a");
+                 Net* second_previous = nl->create_net("in_b");
+                 previous->mark_global_input_net();
+                 second_previous->mark_global_input_net();
+
+                 std::vector<Gate*> gates;
+                 for (u32 i = 0; i < num_gates; i++)
+                 {
+                     Gate* g = nl->create_gate(and2, "gate_" + std::to_string(i));
+                     Net* n  = nl->create_net("net_" + std::to_string(i));
+                     ASSERT_NE(previous->add_destination(g, "I0"), nullptr);
+                     ASSERT_NE(second_previous->add_destination(g, "I1"), nullptr);
+                     ASSERT_NE(n->add_source(g, "O"), nullptr);
+                     if (i % 7 == 0)
+                     {
+                         g->set_data("category", "key", "string", "gate_value_" + std::to_string(i));
+                         n->set_data("category", "key", "string", "net_value_" + std::to_string(i));
+                     }
+                     gates.push_back(g);
+                     second_previous = previous;
+                     previous        = n;
+                 }
+                 previous->mark_global_output_net();
+
+                 // distribute the gates over some nested modules
+                 Module* parent = nl->get_top_module();
+                 for (u32 m = 0; m < 8; m++)
+                 {
+                     Module* mod = nl->create_module("mod_" + std::to_string(m), parent);
+                     ASSERT_NE(mod, nullptr);
+                     ASSERT_TRUE(mod->assign_gates(std::vector<Gate*>(gates.begin() + m * 1024, gates.begin() + (m + 1) * 1024)));
+                     parent = (m % 2 == 0) ? mod : parent;
+                 }
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 auto des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_EQ(des_nl->get_gates().size(), num_gates);
+                 EXPECT_EQ(des_nl->get_nets().size(), num_gates + 2);
+                 EXPECT_TRUE(*nl == *des_nl);
+
+                 // serializing the same netlist again yields the identical file
+                 std::filesystem::path second_hal_file_path = test_utils::create_sandbox_path("test_hal_file_2.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), second_hal_file_path));
+                 auto read_file = [](const std::filesystem::path& path) {
+                     std::ifstream ifs(path.string(), std::ios::binary);
+                     return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+                 };
+                 const std::string first_content = read_file(test_hal_file_path);
+                 EXPECT_FALSE(first_content.empty());
+                 EXPECT_TRUE(first_content == read_file(second_hal_file_path));
+             }
+         TEST_END
+     }
+
+    /**
+     * Testing the serialization into the binary format and a followed deserialization of the example netlist.
+     *
+     * Functions: netlist_binary_serializer::serialize_to_file, netlist_binary_serializer::deserialize_from_file, netlist_binary_serializer::is_binary_file
+     */
+     TEST_F(NetlistSerializerTest, check_binary_serialize_and_deserialize) {
+         TEST_START
+             {
+                 // Serialize and deserialize the example netlist and compare the result with the original netlist
+                 auto nl = create_example_serializer_netlist();
+                 // -- Add a custom function containing constant, index, and variable nodes
+                 auto slice = BooleanFunction::Slice(BooleanFunction::Var("I0", 4), BooleanFunction::Index(1, 4), BooleanFunction::Index(2, 4), 2).get();
+                 nl->get_gate_by_id(6)->add_boolean_function("O_slice", slice & BooleanFunction::Const({BooleanFunction::Value::ONE, BooleanFunction::Value::X}));
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 EXPECT_TRUE(netlist_binary_serializer::is_binary_file(test_hal_file_path));
+                 auto des_nl = netlist_binary_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+
+                 // the binary format is detected automatically
+                 auto detected_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(detected_nl, nullptr);
+                 EXPECT_TRUE(*nl == *detected_nl);
+             }
+             {
+                 // Serialize and deserialize an empty netlist and compare the result with the original netlist
+                 auto nl = std::make_unique<Netlist>(m_gl);
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 auto des_nl = netlist_binary_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+             {
+                 // JSON files are not binary files
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 EXPECT_FALSE(netlist_binary_serializer::is_binary_file(test_hal_file_path));
+             }
+         TEST_END
+     }
+
+    /**
+     * Testing the serialization and deserialization of a netlist with invalid input using the binary format
+     *
+     * Functions: netlist_binary_serializer::serialize_to_file, netlist_binary_serializer::deserialize_from_file
+     */
+     TEST_F(NetlistSerializerTest, check_binary_serialize_and_deserialize_negative) {
+         TEST_START
+             {
+                 // Serialize a netlist which is a nullptr
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 EXPECT_FALSE(netlist_binary_serializer::serialize_to_file(nullptr, test_hal_file_path));
+             }
+             {
+                 // Deserialize a netlist from a non existing path
+                 NO_COUT_TEST_BLOCK;
+                 EXPECT_EQ(netlist_binary_serializer::deserialize_from_file(std::filesystem::path("/using/this/file/is/let.hal")), nullptr);
+             }
+             {
+                 // Deserialize a truncated file
+                 NO_COUT_TEST_BLOCK;
+                 auto nl = create_example_serializer_netlist();
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 std::filesystem::resize_file(test_hal_file_path, std::filesystem::file_size(test_hal_file_path) / 2);
+                 EXPECT_EQ(netlist_binary_serializer::deserialize_from_file(test_hal_file_path), nullptr);
+             }
+         TEST_END
+     }
 }    //namespace hal